@@ -96,8 +96,9 @@ void InspectorPanel::AddMaterialSection(Entity entity) {
 	auto *grid = static_cast<UI::Core::PropertyGrid *>(col->AddContent(std::move(gridUniq)));
 
 	auto albedo = CreateUnique<UI::Core::ColorPicker>(m_Context, mat.surfaceProperties.albedo);
-	albedo->SetOnChanged(
-		[entity](vec4 c) mutable { entity.GetComponent<MaterialComponent>().surfaceProperties.albedo = c; });
+	albedo->SetOnChanged([entity](vec4 c) mutable {
+		entity.PatchComponent<MaterialComponent>([c](MaterialComponent &m) { m.surfaceProperties.albedo = c; });
+	});
 	grid->AddRow("Albedo", std::move(albedo));
 
 	auto metallic = CreateUnique<UI::Core::DragFloat>();
@@ -105,8 +106,9 @@ void InspectorPanel::AddMaterialSection(Entity entity) {
 	metallic->SetSpeed(0.01f);
 	metallic->SetPrecision(3);
 	metallic->SetValue(mat.surfaceProperties.metallic);
-	metallic->SetOnChanged(
-		[entity](float v) mutable { entity.GetComponent<MaterialComponent>().surfaceProperties.metallic = v; });
+	metallic->SetOnChanged([entity](float v) mutable {
+		entity.PatchComponent<MaterialComponent>([v](MaterialComponent &m) { m.surfaceProperties.metallic = v; });
+	});
 	grid->AddRow("Metallic", std::move(metallic));
 
 	auto roughness = CreateUnique<UI::Core::DragFloat>();
@@ -114,8 +116,9 @@ void InspectorPanel::AddMaterialSection(Entity entity) {
 	roughness->SetSpeed(0.01f);
 	roughness->SetPrecision(3);
 	roughness->SetValue(mat.surfaceProperties.roughness);
-	roughness->SetOnChanged(
-		[entity](float v) mutable { entity.GetComponent<MaterialComponent>().surfaceProperties.roughness = v; });
+	roughness->SetOnChanged([entity](float v) mutable {
+		entity.PatchComponent<MaterialComponent>([v](MaterialComponent &m) { m.surfaceProperties.roughness = v; });
+	});
 	grid->AddRow("Roughness", std::move(roughness));
 }
 
@@ -8,6 +8,7 @@
 #include "Aquila/GFX/GfxSwapchain.h"
 #include "Aquila/GFX/GfxTexture.h"
 #include "Aquila/Scene/Scene.h"
+#include "Aquila/Assets/AssetManager.h"
 #include "Aquila/Rendering/RenderPipeline.h"
 #include "Aquila/Rendering/Renderers/Renderer.h"
 #include "Aquila/Rendering/Renderers/Renderer2D.h"
@@ -43,6 +44,7 @@ class Application {
 	GFX::GfxContext &GetContext() { return *m_Ctx; }
 	GFX::GfxTexture &GetRenderOutput() { return m_RenderPipeline->GetOutput(); }
 	SceneManagement::Scene &GetScene() { return *m_Scene; }
+	Assets::AssetManager &GetAssets() { return *m_Assets; }
 	Rendering::RenderPipeline &GetRenderPipeline() { return *m_RenderPipeline; }
 	Rendering::Renderer &GetRenderer() { return *m_Renderer; }
 	Rendering::Renderer2D &GetRenderer2D() { return *m_Renderer2D; }
@@ -61,6 +63,7 @@ class Application {
 
 	Unique<GFX::GfxContext> m_Ctx;
 	Ref<GFX::GfxSwapchain> m_Swapchain;
+	Unique<Assets::AssetManager> m_Assets;
 	Unique<SceneManagement::Scene> m_Scene;
 	Unique<Rendering::RenderPipeline> m_RenderPipeline;
 	Rendering::Renderer *m_Renderer = nullptr;
@@ -24,6 +24,8 @@ class Window {
 
 	void PollEvents();
 	void WaitEvents();
+	// Makes a WaitEvents blocked on any thread return. Safe to call from any thread.
+	static void PostEmptyEvent();
 	bool ShouldClose() const;
 
 	uint32 GetWidth() const { return m_Data.Width; }
@@ -0,0 +1,96 @@
+#ifndef AQUILA_ASSET_HANDLE_H
+#define AQUILA_ASSET_HANDLE_H
+
+#include <atomic>
+#include <typeindex>
+#include "Aquila/Foundation/Defines.h"
+#include "Aquila/Foundation/Job.h"
+#include "Aquila/Foundation/UUID.h"
+
+namespace Aquila::Assets {
+
+enum class AssetState : uint8 { Loading, Ready, Failed };
+
+// AssetSlot
+//
+// What the manager and every handle to one asset share. `asset` is written once by the
+// loading job before it publishes the state, so a reader that sees Ready may read it.
+struct AssetSlot {
+	AssetSlot(Foundation::UUID uuid, std::string path, std::type_index type)
+		: uuid(uuid), path(std::move(path)), type(type) {}
+
+	const Foundation::UUID uuid;
+	const std::string path;
+	const std::type_index type;
+
+	std::atomic<AssetState> state{ AssetState::Loading };
+	Ref<void> asset;
+
+	// Set by whichever queued job starts first: a load re-requested at a higher priority
+	// queues a second job, and the one that loses finds this set and returns.
+	std::atomic<bool> claimed{ false };
+	Priority queuedPriority = Priority::Low; // guarded by the manager's mutex
+	std::vector<Foundation::JobHandle<void>> jobs; // guarded by the manager's mutex
+};
+
+// AssetHandle
+//
+// A counted reference to an asset loaded through AssetManager. Copies share the asset; once
+// the last handle is gone the manager lets go of it on its next CollectGarbage.
+//
+// Never blocks: Get returns the loaded asset once it is ready and the type's fallback until
+// then (or for good, if the load failed). Assets with a GPU copy, like textures, count as
+// ready only once that copy is resident.
+template <typename T> class AssetHandle {
+  public:
+	AssetHandle() = default;
+
+	[[nodiscard]] bool IsValid() const { return m_Slot != nullptr; }
+	explicit operator bool() const { return IsValid(); }
+
+	[[nodiscard]] AssetState GetState() const {
+		return m_Slot ? m_Slot->state.load(std::memory_order_acquire) : AssetState::Failed;
+	}
+	[[nodiscard]] bool IsLoading() const { return GetState() == AssetState::Loading; }
+	[[nodiscard]] bool IsFailed() const { return GetState() == AssetState::Failed; }
+	[[nodiscard]] bool IsReady() const { return TryGet() != nullptr; }
+
+	// The asset if ready, otherwise null.
+	[[nodiscard]] Ref<T> TryGet() const {
+		if (GetState() != AssetState::Ready) {
+			return nullptr;
+		}
+		Ref<T> asset = std::static_pointer_cast<T>(m_Slot->asset);
+		if constexpr (requires(const T &a) { a.IsResident(); }) {
+			if (!asset->IsResident()) {
+				return nullptr;
+			}
+		}
+		return asset;
+	}
+
+	// The asset if ready, otherwise the fallback registered for T (may be null).
+	[[nodiscard]] Ref<T> Get() const {
+		Ref<T> asset = TryGet();
+		return asset ? asset : m_Fallback;
+	}
+
+	[[nodiscard]] Foundation::UUID GetUUID() const { return m_Slot ? m_Slot->uuid : Foundation::UUID::Null(); }
+	[[nodiscard]] const std::string &GetPath() const {
+		static const std::string kEmpty;
+		return m_Slot ? m_Slot->path : kEmpty;
+	}
+
+	bool operator==(const AssetHandle &other) const { return m_Slot == other.m_Slot; }
+
+  private:
+	friend class AssetManager;
+	AssetHandle(Ref<AssetSlot> slot, Ref<T> fallback) : m_Slot(std::move(slot)), m_Fallback(std::move(fallback)) {}
+
+	Ref<AssetSlot> m_Slot;
+	Ref<T> m_Fallback;
+};
+
+} // namespace Aquila::Assets
+
+#endif
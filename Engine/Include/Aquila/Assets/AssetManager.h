@@ -1,286 +1,137 @@
-// #pragma once
-
-// #include "Aquila/Assets/AssetLoaderBase.h"
-// #include "Aquila/Graphics/Material/Material.h"
-// #include "Aquila/Graphics/Material/MaterialSerializer.h"
-// #include "Aquila/Graphics/Material/MaterialSystem.h"
-// #include "Aquila/Graphics/Resources/Mesh.h"
-// #include "Aquila/Graphics/Resources/Texture2D.h"
-// #include "Aquila/Scene/Scene.h"
-// #include "Aquila/Scene/SceneManager.h"
-// #include "Aquila/Foundation/DeletionManager.h"
-
-// namespace Aquila::Assets {
-
-// enum class AssetType { Unknown = 0, Mesh, Texture, Material, Shader, Scene, Model, Audio };
-
-// struct AssetMetadata {
-// 	Utils::UUID uuid;
-// 	std::string filepath;
-// 	AssetType type = AssetType::Unknown;
-// 	bool isLoaded = false;
-// 	bool isValid = false;
-// 	uint64 fileSize = 0;
-// 	uint64 lastModified = 0;
-// };
-
-// class AssetEntry {
-//   public:
-// 	Utils::UUID uuid;
-// 	AssetMetadata metadata;
-// 	AssetType type;
-// 	Ref<void> asset; // Type-erased asset pointer
-// 	uint32 referenceCount{ 0 };
-// 	bool isLoading{ false };
-
-// 	template <typename T> Ref<T> GetAs() const { return std::static_pointer_cast<T>(asset); }
-
-// 	template <typename T> void SetAsset(Ref<T> ptr) { asset = std::static_pointer_cast<void>(ptr); }
-// };
-
-// // Main asset manager - refactored for clean async architecture
-// class AssetManager {
-//   public:
-// 	AssetManager(Graphics::Device &device, Graphics::Material::MaterialSystem &materialSystem, uint32 currentFrame);
-// 	~AssetManager();
-
-// 	// INITIALIZATION
-
-// 	void Initialize(uint32 jobThreads = 0);
-// 	void Shutdown();
-
-// 	// MESH LOADING
-
-// 	// Synchronous load (blocks until ready)
-// 	Ref<Graphics::Resources::Mesh> LoadMesh(const std::string &filepath);
-
-// 	// Asynchronous load (returns immediately with handle)
-// 	Core::JobHandle<Ref<Graphics::Resources::Mesh>>
-// 	LoadMeshAsync(const std::string &filepath, Core::JobPriority priority = Core::JobPriority::Normal);
-
-// 	// Get cached mesh or load if not present
-// 	Ref<Graphics::Resources::Mesh> GetMesh(const std::string &filepath);
-// 	Ref<Graphics::Resources::Mesh> GetMesh(const Utils::UUID &uuid);
-
-// 	// Procedural meshes (CPU-only, immediate)
-// 	Ref<Graphics::Resources::Mesh> CreateProceduralMesh(const std::string &type, const std::string &name = "");
-
-// 	// TEXTURE LOADING
-
-// 	// Synchronous loads
-// 	Ref<Graphics::Resources::Texture2D> LoadTexture(const std::string &filepath,
-// 													VkFormat format = VK_FORMAT_R8G8B8A8_SRGB);
-// 	Ref<Graphics::Resources::Texture2D> LoadHDRTexture(const std::string &filepath);
-
-// 	// Asynchronous loads
-// 	Core::JobHandle<Ref<Graphics::Resources::Texture2D>>
-// 	LoadTextureAsync(const std::string &filepath, VkFormat format = VK_FORMAT_R8G8B8A8_SRGB,
-// 					 Core::JobPriority priority = Core::JobPriority::Normal);
-
-// 	Core::JobHandle<Ref<Graphics::Resources::Texture2D>>
-// 	LoadHDRTextureAsync(const std::string &filepath, Core::JobPriority priority = Core::JobPriority::Normal);
-
-// 	// Get cached texture
-// 	Ref<Graphics::Resources::Texture2D> GetTexture(const std::string &filepath);
-// 	Ref<Graphics::Resources::Texture2D> GetTexture(const Utils::UUID &uuid);
-
-// 	Ref<Graphics::Resources::Texture2D> TryGetTexture(const std::string &filepath);
-// 	Ref<Graphics::Resources::Texture2D> TryGetTexture(const Utils::UUID &uuid);
-
-// 	Ref<Graphics::Resources::Mesh> TryGetMesh(const std::string &filepath);
-// 	Ref<Graphics::Resources::Mesh> TryGetMesh(const Utils::UUID &uuid);
-
-// 	bool IsAssetLoading(const std::string &filepath) const;
-// 	bool IsAssetLoading(const Utils::UUID &uuid) const;
-
-// 	Ref<Graphics::Shader::ShaderProgram> LoadShader(const std::string &filepath);
-// 	Ref<Graphics::Shader::ShaderProgram> TryGetShader(const std::string &filepath);
-
-// 	// Runtime texture creation
-// 	Ref<Graphics::Resources::Texture2D>
-// 	CreateRenderTarget(uint32 width, uint32 height, VkFormat format,
-// 					   VkImageUsageFlags usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-// 					   VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT);
-
-// 	Ref<Graphics::Resources::Texture2D> CreateCubemap(uint32 width, uint32 height, VkFormat format,
-// 													  VkImageUsageFlags usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
-// 																				VK_IMAGE_USAGE_SAMPLED_BIT,
-// 													  bool mipmapped = false);
-
-// 	// Fallback textures
-// 	Ref<Graphics::Resources::Texture2D> GetFallbackTexture(Graphics::Resources::TextureType type);
-
-// 	// Materials
-// 	Ref<Graphics::Material::Material> LoadMaterial(const std::string &filepath);
-// 	Ref<Graphics::Material::Material> LoadMaterialAsset(const std::string &filepath);
-// 	Ref<Graphics::Material::Material> CreateMaterialInstance(const Ref<Graphics::Material::Material> &assetMaterial);
-// 	Ref<Graphics::Material::Material> GetMaterialAsset(const std::string &filepath);
-// 	Ref<Graphics::Material::Material> TryGetMaterialAsset(const std::string &filepath);
-// 	bool SaveMaterialAsset(const Ref<Graphics::Material::Material> &material, const std::string &filepath);
-// 	// BATCH OPERATIONS
-
-// 	// Preload multiple assets asynchronously
-// 	void PreloadAssets(const std::vector<std::string> &filepaths, Core::JobPriority priority = Core::JobPriority::Low);
-// 	void PreloadDirectory(const std::string &directory, bool recursive = false,
-// 						  Core::JobPriority priority = Core::JobPriority::Low);
-
-// 	// Wait for all pending loads
-// 	void WaitForAllLoads();
-
-// 	// ASSET MANAGEMENT
-
-// 	// Check asset status
-// 	bool IsAssetLoaded(const Utils::UUID &uuid) const;
-// 	bool IsAssetLoaded(const std::string &filepath) const;
-// 	AssetLoadState GetAssetState(const Utils::UUID &uuid) const;
-// 	AssetLoadState GetAssetState(const std::string &filepath) const;
-
-// 	// Get metadata
-// 	AssetMetadata GetAssetMetadata(const Utils::UUID &uuid) const;
-// 	AssetMetadata GetAssetMetadata(const std::string &filepath) const;
-
-// 	// Unload assets
-// 	void UnloadAsset(const Utils::UUID &uuid);
-// 	void UnloadAsset(const std::string &filepath);
-// 	void UnloadAllAssets();
-
-// 	// Reload (hot-reload support)
-// 	void ReloadAsset(const Utils::UUID &uuid);
-// 	void ReloadAsset(const std::string &filepath);
-// 	void CheckForModifiedAssets(); // Checks file timestamps
-
-// 	// QUERIES
-
-// 	std::vector<Utils::UUID> GetAllAssetsOfType(AssetType type) const;
-// 	std::vector<std::string> GetAllAssetPaths() const;
-
-// 	size_t GetAssetCount() const;
-// 	size_t GetLoadedAssetCount() const;
-// 	size_t GetPendingLoadCount() const;
-
-// 	// CACHE MANAGEMENT
-
-// 	void ClearCache();
-// 	void ClearUnusedAssets(); // Remove assets with refcount == 1
-// 	size_t GetCacheSize() const;
-
-// 	// SCENE MANAGEMENT (unchanged from original)
-
-// 	SceneManagement::Scene *CreateScene(const std::string &name) const;
-// 	SceneManagement::Scene *LoadScene(const std::string &filepath);
-// 	SceneManagement::Scene *LoadSceneAsync(const std::string &filepath,
-// 										   const Delegate<void(SceneManagement::Scene *)> &onLoaded);
-// 	SceneManagement::Scene *GetScene(const Utils::UUID &uuid) const;
-// 	SceneManagement::Scene *GetScene(const std::string &name);
-// 	SceneManagement::Scene *GetActiveScene() const;
-
-// 	void ActivateScene(const Utils::UUID &uuid);
-// 	void ActivateScene(const std::string &name);
-// 	void ActivateScene(const SceneManagement::Scene *scene);
-
-// 	bool SaveScene(const Utils::UUID &uuid, const std::string &filepath);
-// 	bool SaveActiveScene(const std::string &filepath);
-
-// 	void UnloadScene(const Utils::UUID &uuid);
-// 	void RemoveScene(const Utils::UUID &uuid);
-// 	void ChangeScene(const Utils::UUID &uuid);
-
-// 	SceneManagement::Scene *DuplicateScene(const Utils::UUID &uuid, const std::string &newName);
-// 	std::vector<SceneManagement::Scene *> GetAllScenes() const;
-// 	std::vector<SceneManagement::Scene *> GetInactiveScenes() const;
-// 	bool IsSceneActive(const Utils::UUID &uuid) const;
-
-// 	// CALLBACKS
-
-// 	void SetOnAssetLoaded(std::function<void(Utils::UUID, AssetType)> callback) { m_OnAssetLoaded = callback; }
-// 	void SetOnAssetUnloaded(std::function<void(Utils::UUID, AssetType)> callback) { m_OnAssetUnloaded = callback; }
-// 	void SetOnSceneLoaded(std::function<void(SceneManagement::Scene *)> callback) { m_OnSceneLoaded = callback; }
-// 	void SetOnSceneActivated(std::function<void(SceneManagement::Scene *)> callback) { m_OnSceneActivated = callback; }
-// 	void SetOnSceneDeactivated(std::function<void(SceneManagement::Scene *)> callback) {
-// 		m_OnSceneDeactivated = callback;
-// 	}
-// 	void SetOnSceneDestroyed(std::function<void(SceneManagement::Scene *)> callback) { m_OnSceneDestroyed = callback; }
-
-// 	void QueueDescriptorUpdate(std::function<void()> task) {
-// 		std::lock_guard<std::mutex> lock(m_MainThreadMutex);
-// 		m_MainThreadTasks.push(std::move(task));
-// 	}
-
-// 	// Called from main thread every frame
-// 	void ProcessMainThreadTasks() {
-// 		std::lock_guard<std::mutex> lock(m_MainThreadMutex);
-// 		while (!m_MainThreadTasks.empty()) {
-// 			m_MainThreadTasks.front()();
-// 			m_MainThreadTasks.pop();
-// 		}
-// 	}
-
-//   private:
-// 	// INTERNAL HELPERS
-
-// 	// Mesh loading internals
-// 	Ref<Graphics::Resources::Mesh> LoadMeshCPU(const std::string &filepath);
-// 	void UploadMeshGPU(Graphics::Resources::Mesh &mesh, VkCommandBuffer cmd);
-
-// 	// Texture loading internals
-// 	Ref<Graphics::Resources::Texture2D> LoadTextureCPU(const std::string &filepath, VkFormat format);
-// 	Ref<Graphics::Resources::Texture2D> LoadHDRTextureCPU(const std::string &filepath);
-// 	void UploadTextureGPU(Graphics::Resources::Texture2D &texture, VkCommandBuffer cmd);
-
-// 	// Registry management
-// 	void RegisterAsset(const std::string &filepath, Ref<void> asset, AssetType type);
-// 	Utils::UUID GetOrCreateUUID(const std::string &filepath);
-
-// 	AssetEntry *FindAssetEntry(const Utils::UUID &uuid);
-// 	AssetEntry *FindAssetEntry(const std::string &filepath);
-// 	const AssetEntry *FindAssetEntry(const Utils::UUID &uuid) const;
-// 	const AssetEntry *FindAssetEntry(const std::string &filepath) const;
-
-// 	// File utilities
-// 	AssetType GetAssetTypeFromExtension(const std::string &filepath) const;
-// 	std::vector<std::string> FindAllAssetFiles(const std::string &directory, bool recursive) const;
-// 	uint64 GetFileModificationTime(const std::string &filepath) const;
-// 	uint64 GetFileSize(const std::string &filepath) const;
-
-// 	// Fallback initialization
-// 	void InitializeFallbackTextures();
-
-// 	// MEMBER VARIABLES
-
-// 	// Core systems
-// 	Graphics::Device &m_Device;
-// 	Graphics::Material::MaterialSystem &m_MaterialSystem;
-// 	uint32 m_CurrentFrame;
-
-// 	// Async loading infrastructure
-// 	Unique<Graphics::GPUUploadManager> m_GPUUploadManager;
-// 	bool m_Initialized = false;
-
-// 	mutable std::mutex m_RegistryMutex;
-// 	std::unordered_map<Utils::UUID, AssetEntry> m_AssetRegistry;
-// 	std::unordered_map<std::string, Utils::UUID> m_PathToUUID;
-
-// 	// Deduplication: track assets currently being loaded
-// 	mutable std::mutex m_LoadingMutex;
-// 	std::unordered_map<std::string, Core::JobHandle<Ref<Graphics::Resources::Mesh>>> m_PendingMeshLoads;
-// 	std::unordered_map<std::string, Core::JobHandle<Ref<Graphics::Resources::Texture2D>>> m_PendingTextureLoads;
-
-// 	std::queue<std::function<void()>> m_MainThreadTasks;
-// 	std::mutex m_MainThreadMutex;
-// 	std::atomic<bool> m_ShuttingDown{ false };
-// 	// Fallback textures
-// 	std::unordered_map<Graphics::Resources::TextureType, Ref<Graphics::Resources::Texture2D>> m_FallbackTextures;
-
-// 	// Scene management
-// 	Unique<SceneManagement::SceneManager> m_SceneManager;
-
-// 	// Callbacks
-// 	std::function<void(Utils::UUID, AssetType)> m_OnAssetLoaded;
-// 	std::function<void(Utils::UUID, AssetType)> m_OnAssetUnloaded;
-// 	std::function<void(SceneManagement::Scene *)> m_OnSceneLoaded;
-// 	std::function<void(SceneManagement::Scene *)> m_OnSceneActivated;
-// 	std::function<void(SceneManagement::Scene *)> m_OnSceneDeactivated;
-// 	std::function<void(SceneManagement::Scene *)> m_OnSceneDestroyed;
-// };
-
-// } // namespace Aquila::Assets
+#ifndef AQUILA_ASSET_MANAGER_H
+#define AQUILA_ASSET_MANAGER_H
+
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+#include "Aquila/Assets/AssetHandle.h"
+#include "Aquila/Assets/AssetLoader.h"
+#include "Aquila/Foundation/Cache/ResidentCache.h"
+#include "Aquila/Foundation/Log.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Foundation/SharedConstants.h"
+#include "Aquila/GFX/GfxTexture.h"
+#include "Aquila/Graphics/Texture/TextureCooker.h"
+
+namespace Aquila::GFX {
+class GfxContext;
+}
+
+namespace Aquila::Assets {
+
+// AssetManager
+//
+// Loads assets by path or UUID on the shared JobSystem and hands out AssetHandles right away.
+// Each asset is loaded once: requesting one that is loaded or still on its way returns a
+// handle to the same slot, and requesting it at a more urgent priority than it was queued
+// with queues it again at that priority (whichever job starts first loads it).
+//
+// A path's UUID is UUID::FromFilepath unless Register mapped it to another one, e.g. one read
+// from a scene file. Nothing here blocks except WaitForAll and the destructor, which wait for
+// queued loads.
+//
+// Types are loaded by the AssetLoader registered for them; RegisterDefaultLoaders adds the
+// engine's: Graphics::Resources::Mesh through MeshCache, and GFX::GfxTexture through
+// TextureLoader's cooked path, uploaded by the context's GfxUploadBatcher. A texture is cooked
+// as the TextureKind LoadTexture asked for (Color for plain Load), and kept in a ResidentCache
+// counting its GPU bytes, so textures no handle holds anymore are evicted past
+// TEXTURE_CACHE_BUDGET or the global budget rather than held until the manager goes away.
+class AssetManager {
+  public:
+	AssetManager() = default;
+	~AssetManager();
+
+	AQUILA_NONCOPYABLE(AssetManager);
+	AQUILA_NONMOVEABLE(AssetManager);
+
+	// Replaces any loader registered for T; assets already loaded keep theirs.
+	template <typename T> void RegisterLoader(AssetLoader<T> loader) {
+		std::lock_guard lock(m_Mutex);
+		m_Loaders[typeid(T)] = {
+			.load = [load = std::move(loader.load)](const std::string &path) -> Ref<void> { return load(path); },
+			.fallback = std::move(loader.fallback),
+		};
+	}
+	void RegisterDefaultLoaders(GFX::GfxContext &ctx);
+
+	// Starts loading `path` unless it is loaded or loading already. Invalid if T has no loader
+	// or the path is loaded as another type.
+	template <typename T> AssetHandle<T> Load(const std::string &path, Priority priority = Priority::Medium) {
+		Acquired acquired = Acquire(path, typeid(T), priority);
+		return MakeHandle<T>(std::move(acquired));
+	}
+	// Same, for a UUID whose path is known from an earlier Load or Register.
+	template <typename T> AssetHandle<T> Load(const Foundation::UUID &uuid, Priority priority = Priority::Medium) {
+		const std::string path = GetPath(uuid);
+		if (path.empty()) {
+			AQUILA_LOG_ERROR("AssetManager: no path registered for {}", uuid.ToString());
+			return {};
+		}
+		return Load<T>(path, priority);
+	}
+
+	// Load<GFX::GfxTexture>, cooked as `kind` (BC5 for NormalMap, linear for Data, ...). A path
+	// keeps the kind it was first loaded as while any handle to it is alive.
+	AssetHandle<GFX::GfxTexture> LoadTexture(const std::string &path, Graphics::Texture::TextureKind kind,
+											 Priority priority = Priority::Medium);
+
+	// A handle to an asset that is loaded or loading, without starting a load.
+	template <typename T> AssetHandle<T> Find(const Foundation::UUID &uuid) const {
+		return MakeHandle<T>(Lookup(uuid, typeid(T)));
+	}
+	template <typename T> AssetHandle<T> Find(const std::string &path) const { return Find<T>(GetUUID(path)); }
+
+	// Addresses `path` by `uuid` from now on. False if either is already mapped to another.
+	bool Register(const Foundation::UUID &uuid, const std::string &path);
+	[[nodiscard]] Foundation::UUID GetUUID(const std::string &path) const;
+	[[nodiscard]] std::string GetPath(const Foundation::UUID &uuid) const;
+
+	// Lets go of assets no handle refers to anymore. Once a frame.
+	void CollectGarbage();
+	// Blocks until every queued load has finished. For tools, tests and shutdown.
+	void WaitForAll();
+
+	[[nodiscard]] bool HasPendingLoads() const { return m_PendingLoads.load(std::memory_order_acquire) > 0; }
+	[[nodiscard]] usize GetAssetCount() const;
+
+  private:
+	struct Loader {
+		std::function<Ref<void>(const std::string &)> load;
+		Ref<void> fallback;
+	};
+	struct Acquired {
+		Ref<AssetSlot> slot;
+		Ref<void> fallback;
+	};
+
+	template <typename T> static AssetHandle<T> MakeHandle(Acquired acquired) {
+		if (!acquired.slot) {
+			return {};
+		}
+		return AssetHandle<T>(std::move(acquired.slot), std::static_pointer_cast<T>(acquired.fallback));
+	}
+
+	Acquired Acquire(const std::string &path, std::type_index type, Priority priority);
+	Acquired Lookup(const Foundation::UUID &uuid, std::type_index type) const;
+	// Caller holds m_Mutex.
+	Foundation::UUID GetUUIDLocked(const std::string &path) const;
+	void Schedule(const Ref<AssetSlot> &slot, const Loader &loader, Priority priority);
+	Graphics::Texture::TextureKind GetTextureKind(const std::string &path) const;
+
+	mutable std::mutex m_Mutex;
+	std::unordered_map<std::type_index, Loader> m_Loaders;
+	std::unordered_map<Foundation::UUID, Ref<AssetSlot>> m_Slots;
+	std::unordered_map<std::string, Foundation::UUID> m_PathToUUID;
+	std::unordered_map<Foundation::UUID, std::string> m_UUIDToPath;
+	std::unordered_map<std::string, Graphics::Texture::TextureKind> m_TextureKinds;
+	std::atomic<uint32> m_PendingLoads{ 0 };
+
+	// Keyed by path and kind. Owned here rather than a singleton like MeshCache: its textures
+	// must go before the GfxContext that created them.
+	Foundation::ResidentCache<std::string, GFX::GfxTexture> m_Textures{ "Textures",
+																		SharedConstants::TEXTURE_CACHE_BUDGET };
+};
+
+} // namespace Aquila::Assets
+
+#endif
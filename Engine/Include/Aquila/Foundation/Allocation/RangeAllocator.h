@@ -0,0 +1,185 @@
+#pragma once
+#include <map>
+#include <iterator>
+#include <vector>
+#include "Aquila/Foundation/PrimitiveTypes.h"
+
+namespace Aquila::Foundation {
+
+// RangeAllocator
+//
+// Hands out [offset, offset + size) ranges of an abstract linear space (bytes, vertices,
+// indices — the allocator doesn't care). It never touches memory itself, so it's the
+// bookkeeping half of any "one big buffer, many small users" scheme.
+//
+//   - Best fit: the smallest free block that can hold the request is split.
+//   - Free blocks are kept sorted by offset and merged with both neighbours on Free(),
+//     so fragmentation only survives as long as there are live allocations in between.
+//   - Grow() extends the space at the end (merging with a trailing free block).
+//   - Compact() repacks live ranges front-to-back and reports every move, which is the
+//     hook the owner uses to copy the actual data around.
+class RangeAllocator {
+  public:
+	struct Move {
+		uint64 from = 0;
+		uint64 to = 0;
+		uint64 size = 0;
+	};
+
+	RangeAllocator() = default;
+	explicit RangeAllocator(uint64 capacity) { Reset(capacity); }
+
+	void Reset(uint64 capacity) {
+		m_Capacity = capacity;
+		m_Used = 0;
+		m_Allocations.clear();
+		m_FreeByOffset.clear();
+		m_FreeBySize.clear();
+		if (capacity > 0) {
+			InsertFree(0, capacity);
+		}
+	}
+
+	[[nodiscard]] Option<uint64> Allocate(uint64 size) {
+		if (size == 0) {
+			return std::nullopt;
+		}
+		auto fit = m_FreeBySize.lower_bound(size);
+		if (fit == m_FreeBySize.end()) {
+			return std::nullopt;
+		}
+
+		const uint64 blockSize = fit->first;
+		const uint64 offset = fit->second;
+		EraseFree(offset, blockSize);
+		if (blockSize > size) {
+			InsertFree(offset + size, blockSize - size);
+		}
+
+		m_Allocations.emplace(offset, size);
+		m_Used += size;
+		return offset;
+	}
+
+	// Returns false for offsets that were never handed out (or were already freed).
+	bool Free(uint64 offset) {
+		auto it = m_Allocations.find(offset);
+		if (it == m_Allocations.end()) {
+			return false;
+		}
+		uint64 start = offset;
+		uint64 size = it->second;
+		m_Used -= size;
+		m_Allocations.erase(it);
+
+		// merge with the block right after us
+		auto next = m_FreeByOffset.find(start + size);
+		if (next != m_FreeByOffset.end()) {
+			const uint64 nextSize = next->second;
+			EraseFree(next->first, nextSize);
+			size += nextSize;
+		}
+
+		// ...and the one right before us
+		auto prev = m_FreeByOffset.lower_bound(start);
+		if (prev != m_FreeByOffset.begin()) {
+			--prev;
+			if (prev->first + prev->second == start) {
+				const uint64 prevOffset = prev->first;
+				const uint64 prevSize = prev->second;
+				EraseFree(prevOffset, prevSize);
+				start = prevOffset;
+				size += prevSize;
+			}
+		}
+
+		InsertFree(start, size);
+		return true;
+	}
+
+	void Grow(uint64 newCapacity) {
+		if (newCapacity <= m_Capacity) {
+			return;
+		}
+		uint64 start = m_Capacity;
+		uint64 size = newCapacity - m_Capacity;
+
+		if (!m_FreeByOffset.empty()) {
+			auto last = std::prev(m_FreeByOffset.end());
+			if (last->first + last->second == m_Capacity) {
+				const uint64 lastOffset = last->first;
+				const uint64 lastSize = last->second;
+				EraseFree(lastOffset, lastSize);
+				start = lastOffset;
+				size += lastSize;
+			}
+		}
+
+		m_Capacity = newCapacity;
+		InsertFree(start, size);
+	}
+
+	// Packs every live allocation towards offset 0, in offset order. Moves are returned
+	// in the order they must be applied (each destination is <= its source, so applying
+	// them front-to-back never clobbers data that hasn't moved yet).
+	std::vector<Move> Compact() {
+		std::vector<Move> moves;
+		std::map<uint64, uint64> packed;
+		uint64 cursor = 0;
+		for (const auto &[offset, size] : m_Allocations) {
+			if (offset != cursor) {
+				moves.push_back({ .from = offset, .to = cursor, .size = size });
+			}
+			packed.emplace(cursor, size);
+			cursor += size;
+		}
+
+		m_Allocations = std::move(packed);
+		m_FreeByOffset.clear();
+		m_FreeBySize.clear();
+		if (cursor < m_Capacity) {
+			InsertFree(cursor, m_Capacity - cursor);
+		}
+		return moves;
+	}
+
+	[[nodiscard]] uint64 GetCapacity() const { return m_Capacity; }
+	[[nodiscard]] uint64 GetUsed() const { return m_Used; }
+	[[nodiscard]] uint64 GetFree() const { return m_Capacity - m_Used; }
+	[[nodiscard]] usize GetAllocationCount() const { return m_Allocations.size(); }
+	[[nodiscard]] usize GetFreeBlockCount() const { return m_FreeByOffset.size(); }
+	[[nodiscard]] uint64 GetLargestFreeBlock() const {
+		return m_FreeBySize.empty() ? 0 : std::prev(m_FreeBySize.end())->first;
+	}
+
+	// 0 = all free space is one block, -> 1 = free space is shattered into crumbs.
+	[[nodiscard]] f32 GetFragmentation() const {
+		const uint64 free = GetFree();
+		return free == 0 ? 0.F : 1.F - static_cast<f32>(GetLargestFreeBlock()) / static_cast<f32>(free);
+	}
+
+  private:
+	void InsertFree(uint64 offset, uint64 size) {
+		m_FreeByOffset.emplace(offset, size);
+		m_FreeBySize.emplace(size, offset);
+	}
+
+	void EraseFree(uint64 offset, uint64 size) {
+		m_FreeByOffset.erase(offset);
+		auto [first, last] = m_FreeBySize.equal_range(size);
+		for (auto it = first; it != last; ++it) {
+			if (it->second == offset) {
+				m_FreeBySize.erase(it);
+				break;
+			}
+		}
+	}
+
+	uint64 m_Capacity = 0;
+	uint64 m_Used = 0;
+	std::map<uint64, uint64> m_Allocations; // offset -> size
+	std::map<uint64, uint64> m_FreeByOffset; // offset -> size
+	std::multimap<uint64, uint64> m_FreeBySize; // size -> offset
+};
+
+} // namespace Aquila::Foundation
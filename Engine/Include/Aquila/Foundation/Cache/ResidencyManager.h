@@ -0,0 +1,98 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/Foundation/Macros.h"
+
+namespace Aquila::Foundation {
+
+// Memory an entry keeps alive, split by where it lives.
+struct ResidentBytes {
+	uint64 cpu = 0;
+	uint64 gpu = 0;
+
+	[[nodiscard]] uint64 Total() const { return cpu + gpu; }
+	ResidentBytes &operator+=(const ResidentBytes &other) {
+		cpu += other.cpu;
+		gpu += other.gpu;
+		return *this;
+	}
+	ResidentBytes &operator-=(const ResidentBytes &other) {
+		cpu -= other.cpu;
+		gpu -= other.gpu;
+		return *this;
+	}
+};
+
+struct ResidentCacheStats {
+	std::string name;
+	uint64 hits = 0;
+	uint64 misses = 0;
+	uint64 evictions = 0;
+	usize entries = 0;
+	ResidentBytes bytes;
+	uint64 budget = 0; // 0 = unlimited
+
+	[[nodiscard]] f32 HitRate() const {
+		const uint64 lookups = hits + misses;
+		return lookups > 0 ? static_cast<f32>(hits) / static_cast<f32>(lookups) : 0.F;
+	}
+};
+
+// What ResidencyManager needs from a cache to enforce the global budget. See ResidentCache.
+class IResidentCache {
+  public:
+	virtual ~IResidentCache() = default;
+
+	[[nodiscard]] virtual ResidentBytes GetResidentBytes() const = 0;
+	// Last-used frame of the least recently used entry nothing outside the cache references.
+	[[nodiscard]] virtual std::optional<uint64> GetOldestEvictableFrame() const = 0;
+	virtual bool EvictOldest() = 0;
+	// Evicts down to the cache's own budget.
+	virtual void Trim() = 0;
+	[[nodiscard]] virtual ResidentCacheStats GetStats() const = 0;
+
+  protected:
+	IResidentCache() = default;
+	AQUILA_NONCOPYABLE(IResidentCache);
+};
+
+// ResidencyManager
+//
+// Owns the frame clock entries are stamped with and the budget shared by every registered
+// cache. Once a frame, EndFrame() trims each cache to its own budget, then keeps evicting the
+// least recently used unreferenced entry across all caches until the CPU + GPU total fits the
+// global one. Entries something still holds are never evicted, so a budget is a target, not
+// a hard cap.
+class ResidencyManager {
+  public:
+	static ResidencyManager &Get();
+
+	void Register(IResidentCache &cache);
+	void Unregister(IResidentCache &cache);
+
+	// 0 = unlimited.
+	void SetGlobalBudget(uint64 bytes);
+	[[nodiscard]] uint64 GetGlobalBudget() const;
+
+	[[nodiscard]] uint64 GetFrame() const { return m_Frame.load(std::memory_order_relaxed); }
+	void EndFrame();
+
+	[[nodiscard]] ResidentBytes GetResidentBytes() const;
+	[[nodiscard]] std::vector<ResidentCacheStats> GetStats() const;
+
+  private:
+	ResidencyManager();
+	AQUILA_NONCOPYABLE(ResidencyManager);
+
+	void TrimToGlobalBudget();
+
+	mutable std::mutex m_Mutex;
+	std::vector<IResidentCache *> m_Caches;
+	uint64 m_GlobalBudget = 0;
+	std::atomic<uint64> m_Frame{ 0 };
+};
+
+} // namespace Aquila::Foundation
@@ -0,0 +1,210 @@
+#pragma once
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include "Aquila/Foundation/Cache/ResidencyManager.h"
+#include "Aquila/Foundation/Defines.h"
+
+namespace Aquila::Foundation {
+
+// ResidentCache
+//
+// Thread-safe map of shared assets with byte accounting and least-recently-used eviction.
+// Each entry carries the CPU and GPU bytes it keeps alive and the frame it was last looked up
+// in (ResidencyManager's clock). Over budget, entries are evicted oldest first, skipping any
+// whose Ref is still held outside the cache: evicting those would free nothing and only
+// cause a reload on the next lookup.
+//
+// Registers itself with ResidencyManager, which trims it once a frame and evicts from it to
+// meet the global budget.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ResidentCache final : public IResidentCache {
+  public:
+	explicit ResidentCache(std::string name, uint64 budget = 0) : m_Name(std::move(name)), m_Budget(budget) {
+		ResidencyManager::Get().Register(*this);
+	}
+	~ResidentCache() override { ResidencyManager::Get().Unregister(*this); }
+
+	// Counts a hit or a miss; a hit also marks the entry used this frame.
+	[[nodiscard]] Ref<Value> Find(const Key &key) {
+		std::lock_guard lock(m_Mutex);
+		auto it = m_Entries.find(key);
+		if (it == m_Entries.end()) {
+			++m_Misses;
+			return nullptr;
+		}
+		++m_Hits;
+		Touch(it->second);
+		return it->second.value;
+	}
+
+	// Lookup that neither counts nor touches.
+	[[nodiscard]] Ref<Value> Peek(const Key &key) const {
+		std::lock_guard lock(m_Mutex);
+		auto it = m_Entries.find(key);
+		return it != m_Entries.end() ? it->second.value : nullptr;
+	}
+
+	[[nodiscard]] bool Contains(const Key &key) const {
+		std::lock_guard lock(m_Mutex);
+		return m_Entries.contains(key);
+	}
+
+	// Adds or replaces the entry for `key`, marked used this frame.
+	void Insert(const Key &key, Ref<Value> value, ResidentBytes bytes) {
+		std::lock_guard lock(m_Mutex);
+		auto [it, inserted] = m_Entries.try_emplace(key);
+		Entry &entry = it->second;
+		if (inserted) {
+			m_Lru.push_front(key);
+			entry.lruPosition = m_Lru.begin();
+		} else {
+			m_Bytes -= entry.bytes;
+		}
+		entry.value = std::move(value);
+		entry.bytes = bytes;
+		m_Bytes += bytes;
+		Touch(entry);
+	}
+
+	// For entries whose footprint changes after insertion, e.g. once their GPU copy exists.
+	bool UpdateBytes(const Key &key, ResidentBytes bytes) {
+		std::lock_guard lock(m_Mutex);
+		auto it = m_Entries.find(key);
+		if (it == m_Entries.end()) {
+			return false;
+		}
+		m_Bytes -= it->second.bytes;
+		it->second.bytes = bytes;
+		m_Bytes += bytes;
+		return true;
+	}
+
+	bool Remove(const Key &key) {
+		std::lock_guard lock(m_Mutex);
+		auto it = m_Entries.find(key);
+		if (it == m_Entries.end()) {
+			return false;
+		}
+		Erase(it);
+		return true;
+	}
+
+	void Clear() {
+		std::lock_guard lock(m_Mutex);
+		m_Entries.clear();
+		m_Lru.clear();
+		m_Bytes = {};
+	}
+
+	// 0 = unlimited; takes effect on the next Trim().
+	void SetBudget(uint64 bytes) {
+		std::lock_guard lock(m_Mutex);
+		m_Budget = bytes;
+	}
+
+	[[nodiscard]] usize Size() const {
+		std::lock_guard lock(m_Mutex);
+		return m_Entries.size();
+	}
+
+	[[nodiscard]] ResidentBytes GetResidentBytes() const override {
+		std::lock_guard lock(m_Mutex);
+		return m_Bytes;
+	}
+
+	[[nodiscard]] std::optional<uint64> GetOldestEvictableFrame() const override {
+		std::lock_guard lock(m_Mutex);
+		const Entry *entry = FindOldestEvictable();
+		return entry != nullptr ? std::optional<uint64>(entry->lastUsedFrame) : std::nullopt;
+	}
+
+	bool EvictOldest() override {
+		std::lock_guard lock(m_Mutex);
+		const Entry *entry = FindOldestEvictable();
+		if (entry == nullptr) {
+			return false;
+		}
+		Evict(m_Entries.find(*entry->lruPosition));
+		return true;
+	}
+
+	void Trim() override {
+		std::lock_guard lock(m_Mutex);
+		if (m_Budget == 0) {
+			return;
+		}
+		// Oldest first; stops at the head, so entries all held elsewhere leave it over budget.
+		for (auto lruIt = m_Lru.end(); m_Bytes.Total() > m_Budget && lruIt != m_Lru.begin();) {
+			--lruIt;
+			auto it = m_Entries.find(*lruIt);
+			if (IsEvictable(it->second)) {
+				lruIt = std::next(lruIt);
+				Evict(it);
+			}
+		}
+	}
+
+	[[nodiscard]] ResidentCacheStats GetStats() const override {
+		std::lock_guard lock(m_Mutex);
+		return {
+			.name = m_Name,
+			.hits = m_Hits,
+			.misses = m_Misses,
+			.evictions = m_Evictions,
+			.entries = m_Entries.size(),
+			.bytes = m_Bytes,
+			.budget = m_Budget,
+		};
+	}
+
+  private:
+	struct Entry {
+		Ref<Value> value;
+		ResidentBytes bytes;
+		uint64 lastUsedFrame = 0;
+		typename std::list<Key>::iterator lruPosition;
+	};
+	using EntryMap = std::unordered_map<Key, Entry, Hash>;
+
+	void Touch(Entry &entry) {
+		entry.lastUsedFrame = ResidencyManager::Get().GetFrame();
+		m_Lru.splice(m_Lru.begin(), m_Lru, entry.lruPosition);
+	}
+
+	// Only the cache holds it.
+	static bool IsEvictable(const Entry &entry) { return entry.value.use_count() <= 1; }
+
+	const Entry *FindOldestEvictable() const {
+		for (auto lruIt = m_Lru.rbegin(); lruIt != m_Lru.rend(); ++lruIt) {
+			const Entry &entry = m_Entries.find(*lruIt)->second;
+			if (IsEvictable(entry)) {
+				return &entry;
+			}
+		}
+		return nullptr;
+	}
+
+	void Erase(typename EntryMap::iterator it) {
+		m_Bytes -= it->second.bytes;
+		m_Lru.erase(it->second.lruPosition);
+		m_Entries.erase(it);
+	}
+
+	void Evict(typename EntryMap::iterator it) {
+		Erase(it);
+		++m_Evictions;
+	}
+
+	std::string m_Name;
+	mutable std::mutex m_Mutex;
+	EntryMap m_Entries;
+	std::list<Key> m_Lru; // most recently used first
+	ResidentBytes m_Bytes;
+	uint64 m_Budget = 0;
+	uint64 m_Hits = 0;
+	uint64 m_Misses = 0;
+	uint64 m_Evictions = 0;
+};
+
+} // namespace Aquila::Foundation
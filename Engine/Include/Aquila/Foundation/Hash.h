@@ -0,0 +1,28 @@
+#pragma once
+#include <string_view>
+#include "Aquila/Foundation/PrimitiveTypes.h"
+
+namespace Aquila::Foundation {
+
+// 32-bit FNV-1a. constexpr, so string literals can be hashed at compile time.
+constexpr uint32 HashFnv1a(std::string_view str) {
+	uint32 hash = 0x811c9dc5u;
+	for (char c : str) {
+		hash ^= static_cast<uint8>(c);
+		hash *= 0x01000193u;
+	}
+	return hash;
+}
+
+// 64-bit FNV-1a for content keys. Pass the previous result as `seed` to hash several
+// buffers as if they were one.
+constexpr uint64 HashFnv1a64(std::string_view str, uint64 seed = 0xcbf29ce484222325ull) {
+	uint64 hash = seed;
+	for (char c : str) {
+		hash ^= static_cast<uint8>(c);
+		hash *= 0x100000001b3ull;
+	}
+	return hash;
+}
+
+} // namespace Aquila::Foundation
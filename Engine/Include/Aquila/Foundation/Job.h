@@ -9,8 +9,16 @@ struct Job {
 	std::function<void()> task;
 	Priority priority = Priority::Medium;
 	std::string debugName;
+	uint64 sequence = 0; // schedule order, so equal priorities run first come first served
 
-	bool operator<(const Job &other) const { return priority < other.priority; }
+	// std::priority_queue pops the greatest: VeryHigh has the smallest value, and among equal
+	// priorities the job scheduled first has the smallest sequence.
+	bool operator<(const Job &other) const {
+		if (priority != other.priority) {
+			return priority > other.priority;
+		}
+		return sequence > other.sequence;
+	}
 };
 
 template <typename T> class JobHandle {
@@ -160,6 +168,7 @@ class JobSystem {
 		Job job;
 		job.priority = priority;
 		job.debugName = debugName;
+		job.sequence = m_NextSequence.fetch_add(1, std::memory_order_relaxed);
 		job.task = [task]() { (*task)(); };
 
 		m_JobQueue.Push(std::move(job));
@@ -218,6 +227,7 @@ class JobSystem {
 	JobQueue m_JobQueue;
 	std::vector<std::thread> m_Workers;
 	std::atomic<size_t> m_ActiveJobCount{ 0 };
+	std::atomic<uint64> m_NextSequence{ 0 };
 };
 
 } // namespace Aquila::Foundation
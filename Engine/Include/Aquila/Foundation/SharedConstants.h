@@ -27,8 +27,21 @@ constexpr int MAX_SCENES = 32;
 constexpr int MAX_SCENE_OBJECTS = 5000;
 
 constexpr uint32 MAX_CAMERAS = 8;
-constexpr uint32 MAX_LIGHTS = 256; // max punctual lights uploaded to GPU per frame
-constexpr uint32 MAX_MATERIALS = 4096; // max entities with MaterialComponent per frame
+constexpr uint32 MAX_LIGHTS = 65536; // hard cap on GPU light slots
+constexpr uint32 INITIAL_LIGHT_CAPACITY = 256; // light table grows by doubling from here
+constexpr uint32 MAX_MATERIALS = 65536; // hard cap on GPU material slots
+constexpr uint32 INITIAL_MATERIAL_CAPACITY = 4096; // material table grows by doubling from here
+constexpr uint32 MAX_BINDLESS_TEXTURES = 1024; // sampled-image array in the scene descriptor set
+
+constexpr uint64 UPLOAD_RING_INITIAL_SIZE = 1024 * 1024; // per frame in flight, grows by doubling
+constexpr uint64 UPLOAD_RING_ALIGNMENT = 256; // spec maximum of minUniform/StorageBufferOffsetAlignment
+
+constexpr uint64 STAGING_POOL_SIZE = 64 * 1024 * 1024; // uploads over half of this get a dedicated buffer
+constexpr uint64 STAGING_POOL_ALIGNMENT = 16; // covers bufferOffset rules for every texel size we upload
+
+constexpr uint64 RESIDENT_MEMORY_BUDGET = 2048ULL * 1024 * 1024; // CPU + GPU bytes across all resident caches
+constexpr uint64 MESH_CACHE_BUDGET = 512ULL * 1024 * 1024; // unreferenced meshes past this are evicted, LRU first
+constexpr uint64 TEXTURE_CACHE_BUDGET = 1024ULL * 1024 * 1024; // same, for the AssetManager's textures (GPU bytes)
 
 constexpr uint32 CLUSTER_GRID_X = 16;
 constexpr uint32 CLUSTER_GRID_Y = 9;
@@ -36,6 +49,12 @@ constexpr uint32 CLUSTER_GRID_Z = 24;
 constexpr uint32 CLUSTER_COUNT = CLUSTER_GRID_X * CLUSTER_GRID_Y * CLUSTER_GRID_Z; // 3456
 constexpr uint32 MAX_LIGHTS_PER_CLUSTER = 256;
 
+constexpr uint32 MIN_DRAWS_PER_RECORD_JOB = 512; // below this a secondary cmd buffer costs more than it saves
+
+constexpr uint32 MAX_MESH_LODS = 6; // LOD 0 plus up to five simplified levels, generated at import
+constexpr f32 MESH_LOD_ERROR_PIXELS = 1.0F; // coarsest LOD whose projected error stays under this is drawn
+constexpr f32 MESH_LOD_HYSTERESIS = 0.75F; // coarsening needs error under threshold x this, against popping
+
 constexpr int MAX_KEY_STATES = 512;
 constexpr int MAX_MOUSE_STATES = 8;
 
@@ -27,12 +27,14 @@ class GfxCommandList {
 
 	void TransitionTexture(GfxTexture &texture, RHI::ResourceState oldState, RHI::ResourceState newState);
 	void TransitionBuffer(GfxBuffer &buffer, RHI::ResourceState oldState, RHI::ResourceState newState);
+	void PipelineBarrier(std::span<const RHI::TextureBarrier> textures, std::span<const RHI::BufferBarrier> buffers);
+	void WaitForQueue(const RHI::QueueWait &wait);
 
 	void BindPipeline(GfxPipeline &pipeline);
 	void SetViewport(float x, float y, float width, float height, float minDepth = 0.0f, float maxDepth = 1.0f);
 	void SetScissor(int32 x, int32 y, uint32 width, uint32 height);
 
-	void BindDescriptorSet(uint32 set, GfxDescriptorSet &descriptorSet);
+	void BindDescriptorSet(uint32 set, GfxDescriptorSet &descriptorSet, std::span<const uint32> dynamicOffsets = {});
 
 	template <typename T>
 	void PushConstants(const T &data, RHI::ShaderStageFlags stages = RHI::ShaderStageFlags::Vertex, uint32 offset = 0) {
@@ -49,7 +51,7 @@ class GfxCommandList {
 	void DrawIndexedIndirect(GfxBuffer &buffer, uint64 offset, uint32 drawCount, uint32 stride);
 
 	void CopyBufferToTexture(GfxBuffer &src, GfxTexture &dst, uint32 width, uint32 height, uint32 dstArrayLayer = 0,
-							 uint32 dstMipLevel = 0);
+							 uint32 dstMipLevel = 0, uint64 srcOffset = 0);
 
 	static constexpr uint64 WholeSize = ~0ULL;
 	void FillBuffer(GfxBuffer &buffer, uint32 value = 0u, uint64 offset = 0, uint64 size = WholeSize);
@@ -59,6 +61,9 @@ class GfxCommandList {
 	void PushDebugGroup(const char *name);
 	void PopDebugGroup();
 
+	void ExecuteSecondary(std::span<GfxCommandList *const> secondaries);
+	[[nodiscard]] bool IsSecondary() const;
+
 	[[nodiscard]] RHI::IRHICommandList &GetRHI() { return *m_Cmd; }
 
   private:
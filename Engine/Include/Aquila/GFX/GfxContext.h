@@ -14,6 +14,12 @@ struct GLFWwindow;
 
 namespace Aquila::GFX {
 
+class GfxMeshRegistry;
+class GfxGeometryArena;
+class GfxUploadRing;
+class GfxUploadBatcher;
+class GfxStagingPool;
+
 class GfxContext {
   public:
 	static Unique<GfxContext> Create(GLFWwindow &window);
@@ -22,18 +28,29 @@ class GfxContext {
 	AQUILA_NONMOVEABLE(GfxContext);
 
 	[[nodiscard]] Ref<GfxBuffer> CreateBuffer(const RHI::BufferDesc &desc);
+	// Safe from worker threads, e.g. to create textures for uploads queued on the batcher.
 	[[nodiscard]] Ref<GfxTexture> CreateTexture(const RHI::TextureDesc &desc);
 	[[nodiscard]] Ref<GfxSwapchain> CreateSwapchain(const RHI::SwapchainDesc &desc);
 	[[nodiscard]] Ref<GfxPipeline> CreateGraphicsPipeline(const RHI::GraphicsPipelineDesc &desc);
 	[[nodiscard]] Ref<GfxPipeline> CreateComputePipeline(const RHI::ComputePipelineDesc &desc);
 	[[nodiscard]] Ref<GfxDescriptorSetLayout> CreateDescriptorSetLayout(const RHI::DescriptorSetLayoutDesc &desc);
 	[[nodiscard]] Ref<GfxDescriptorSet> AllocateDescriptorSet(GfxDescriptorSetLayout &layout);
+	[[nodiscard]] bool SupportsDescriptorIndexing() const;
+	[[nodiscard]] bool SupportsBlockCompression() const;
 	[[nodiscard]] Ref<GfxRenderPass> CreateRenderPass(const RHI::RenderPassDesc &desc);
 
 	[[nodiscard]] Ref<GfxCommandList> CreateCommandList(RHI::CommandListType type, const std::string &name = {});
 	[[nodiscard]] GfxCommandList &AcquireFrameCommandList(uint32 frameSlot);
+	// Must be created on the thread that records it; only valid for the current frame.
+	[[nodiscard]] Unique<GfxCommandList> CreateSecondaryCommandList(const RHI::SecondaryCommandListDesc &desc);
+	// Recorded for the compute queue, only valid for the current frame. Check HasAsyncCompute first.
+	[[nodiscard]] Unique<GfxCommandList> CreateAsyncComputeCommandList();
+	// Transfer list from the upload pool; see IRHIDevice::CreateUploadCommandList.
+	[[nodiscard]] Ref<GfxCommandList> CreateUploadCommandList(const std::string &name);
 
 	void CopyBuffer(GfxBuffer &src, GfxBuffer &dst, uint64 size, uint64 srcOffset = 0, uint64 dstOffset = 0);
+	// `data` holds every mip level of `dst`, each tightly packed right after the one before
+	// (RHI::GetTextureLevelSize). Shorter data asserts rather than leaving levels undefined.
 	void UploadTextureData(GfxTexture &dst, const void *data, uint64 byteSize);
 
 	void DestroyImmediateTexture(GfxTexture &texture);
@@ -44,6 +61,15 @@ class GfxContext {
 	void SubmitFrame(GfxCommandList &cmd, GfxSwapchain *swapchain = nullptr, uint32 imageIndex = 0);
 	void SubmitAndWait(GfxCommandList &cmd);
 
+	// Queue timelines, see IRHIDevice.
+	[[nodiscard]] bool HasAsyncCompute() const;
+	uint64 SubmitAsyncCompute(GfxCommandList &cmd);
+	uint64 SubmitTransfer(GfxCommandList &cmd);
+	uint64 FlushFrameCommandList(GfxCommandList &cmd);
+	[[nodiscard]] uint64 GetLastSubmittedValue(RHI::CommandListType queue) const;
+	[[nodiscard]] uint64 GetCompletedValue(RHI::CommandListType queue) const;
+	void WaitForTimeline(RHI::CommandListType queue, uint64 value);
+
 	template <typename Func> void ExecuteImmediate(RHI::CommandListType type, Func &&func) {
 		auto cmd = CreateCommandList(type, "ImmediateCmd");
 		cmd->Begin();
@@ -55,10 +81,29 @@ class GfxContext {
 
 	[[nodiscard]] RHI::IRHIDevice &GetDevice() { return *m_Device; }
 
+	// Shared GPU copies of CPU meshes, one per Mesh across all rendering systems.
+	[[nodiscard]] GfxMeshRegistry &GetMeshRegistry() { return *m_MeshRegistry; }
+	// Shared vertex/index buffers that every GfxMesh sub-allocates from.
+	[[nodiscard]] GfxGeometryArena &GetGeometryArena() { return *m_GeometryArena; }
+	// Per-frame linear allocator for constants rewritten every frame.
+	[[nodiscard]] GfxUploadRing &GetUploadRing() { return *m_UploadRing; }
+	// Shared staging memory for every upload path.
+	[[nodiscard]] GfxStagingPool &GetStagingPool() { return *m_StagingPool; }
+	// Staged buffer copies, submitted on the transfer queue once per frame.
+	[[nodiscard]] GfxUploadBatcher &GetUploadBatcher() { return *m_UploadBatcher; }
+
   private:
 	explicit GfxContext(Unique<RHI::IRHIDevice> device);
 	Unique<RHI::IRHIDevice> m_Device;
 	std::array<Unique<GfxCommandList>, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_FrameCommandLists;
+	// Declared before everything that stages uploads through it.
+	Unique<GfxStagingPool> m_StagingPool;
+	// Declared before the arena, which flushes pending copies through it.
+	Unique<GfxUploadBatcher> m_UploadBatcher;
+	// Declared before the registry: meshes hand their ranges back to the arena on destruction.
+	Unique<GfxGeometryArena> m_GeometryArena;
+	Unique<GfxMeshRegistry> m_MeshRegistry;
+	Unique<GfxUploadRing> m_UploadRing;
 };
 
 } // namespace Aquila::GFX
@@ -30,7 +30,7 @@ class GfxDescriptorSet {
 	AQUILA_NONCOPYABLE(GfxDescriptorSet);
 
 	GfxDescriptorSet &SetBuffer(uint32 binding, GfxBuffer &buffer, uint64 offset = 0, uint64 range = 0);
-	GfxDescriptorSet &SetTexture(uint32 binding, GfxTexture &texture);
+	GfxDescriptorSet &SetTexture(uint32 binding, GfxTexture &texture, uint32 arrayElement = 0);
 	void Flush();
 
 	[[nodiscard]] RHI::IRHIDescriptorSet &GetRHI() { return *m_Set; }
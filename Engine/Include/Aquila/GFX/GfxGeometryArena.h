@@ -0,0 +1,122 @@
+#pragma once
+#include <mutex>
+#include <span>
+#include "Aquila/Foundation/Defines.h"
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/Foundation/Allocation/RangeAllocator.h"
+#include "Aquila/GFX/GfxBuffer.h"
+#include "Aquila/RHI/Backend/RHITypes.h"
+#include "Aquila/RHI/Vertex.h"
+
+namespace Aquila::GFX {
+
+class GfxContext;
+class GfxCommandList;
+
+// Where a mesh lives inside the arena, in elements (not bytes).
+struct GeometryRange {
+	uint32 vertexOffset = 0;
+	uint32 vertexCount = 0;
+	uint32 firstIndex = 0;
+	uint32 indexCount = 0;
+
+	[[nodiscard]] RHI::DrawIndexedIndirectCommand ToIndirect(uint32 instanceCount = 1, uint32 firstInstance = 0) const {
+		return { .indexCount = indexCount,
+				 .instanceCount = instanceCount,
+				 .firstIndex = firstIndex,
+				 .vertexOffset = static_cast<int32>(vertexOffset),
+				 .firstInstance = firstInstance };
+	}
+};
+
+// GfxGeometryArena
+//
+// One vertex buffer (of RHI::PackedVertex) and one index buffer for all mesh geometry.
+// Meshes own a handle into the arena instead of their own VkBuffers, which means:
+//   - a pass binds VB/IB once and every draw is DrawIndexed(count, 1, firstIndex, vertexOffset),
+//   - ranges can be packed into DrawIndexedIndirectCommand arrays for multi-draw.
+//
+// Handles are an indirection over GeometryRange so Defragment() can move data around
+// without anyone holding stale offsets. Freed ranges are only returned to the allocator
+// after MAX_FRAMES_IN_FLIGHT calls to Tick(), since frames still in flight may read them.
+// When an allocation doesn't fit, the buffers double (GPU-side copy of the old contents,
+// after the pending uploads have been flushed). Tick() defragments on its own once the
+// free space stranded outside the largest hole passes a quarter of either buffer.
+class GfxGeometryArena {
+  public:
+	using Handle = uint32;
+	static constexpr Handle InvalidHandle = ~0u;
+
+	static constexpr uint32 InitialVertexCapacity = 256 * 1024;
+	static constexpr uint32 InitialIndexCapacity = 1024 * 1024;
+
+	explicit GfxGeometryArena(GfxContext &ctx);
+	~GfxGeometryArena() = default;
+
+	AQUILA_NONCOPYABLE(GfxGeometryArena);
+	AQUILA_NONMOVEABLE(GfxGeometryArena);
+
+	// Reserves space and queues the upload on the context's GfxUploadBatcher; the range is
+	// safe to draw from any frame list recorded after the batcher's next Submit.
+	[[nodiscard]] Handle Allocate(std::span<const RHI::PackedVertex> vertices, std::span<const uint32> indices);
+	void Free(Handle handle);
+
+	// Once per frame, after the frame's passes are recorded: releases ranges no frame in flight
+	// references any more, then defragments if the buffers are fragmented enough and nothing
+	// was allocated since the last Tick (those uploads may sit in a list not yet submitted).
+	void Tick();
+
+	// Repacks all live ranges to the front of the buffers. Waits for the GPU first,
+	// so call it from a quiet point (level load, editor idle), not mid-frame.
+	void Defragment();
+
+	[[nodiscard]] GeometryRange GetRange(Handle handle) const;
+
+	// Buffers can be replaced by growth/defrag, so fetch them at record time, don't cache.
+	[[nodiscard]] Ref<GfxBuffer> GetVertexBuffer() const;
+	[[nodiscard]] Ref<GfxBuffer> GetIndexBuffer() const;
+	void Bind(GfxCommandList &cmd) const;
+
+	struct Stats {
+		uint64 vertexCapacity = 0;
+		uint64 vertexUsed = 0;
+		uint64 indexCapacity = 0;
+		uint64 indexUsed = 0;
+		usize liveRanges = 0; // excludes freed ranges still waiting out the frames in flight
+		f32 vertexFragmentation = 0.F;
+		f32 indexFragmentation = 0.F;
+	};
+	[[nodiscard]] Stats GetStats() const;
+
+  private:
+	struct PendingFree {
+		Handle handle = InvalidHandle;
+		uint64 retireFrame = 0;
+	};
+
+	Ref<GfxBuffer> CreateVertexBuffer(uint64 vertexCount) const;
+	Ref<GfxBuffer> CreateIndexBuffer(uint64 indexCount) const;
+	void GrowVertices(uint64 minCapacity);
+	void GrowIndices(uint64 minCapacity);
+	void Release(Handle handle);
+	[[nodiscard]] bool NeedsDefragment() const;
+	void DefragmentLocked();
+
+	GfxContext &m_Ctx;
+
+	Ref<GfxBuffer> m_VertexBuffer;
+	Ref<GfxBuffer> m_IndexBuffer;
+	Foundation::RangeAllocator m_VertexAlloc;
+	Foundation::RangeAllocator m_IndexAlloc;
+
+	std::vector<GeometryRange> m_Ranges;
+	std::vector<bool> m_Live; // false once freed, even while the range waits out the frames in flight
+	std::vector<Handle> m_FreeHandles;
+	std::vector<PendingFree> m_PendingFrees;
+	uint64 m_FrameIndex = 0;
+	bool m_AllocatedSinceTick = false;
+
+	mutable std::mutex m_Mutex;
+};
+
+} // namespace Aquila::GFX
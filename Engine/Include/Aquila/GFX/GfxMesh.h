@@ -1,28 +1,43 @@
 #pragma once
 #include "Aquila/Foundation/Defines.h"
 #include "Aquila/GFX/GfxBuffer.h"
+#include "Aquila/GFX/GfxGeometryArena.h"
 #include "Aquila/Graphics/Resources/Mesh.h"
 
 namespace Aquila::GFX {
 
 class GfxContext;
 
+// A mesh's slice of the context's GfxGeometryArena. The vertex/index buffers returned here
+// are the shared arena buffers; bind them once per pass via GfxGeometryArena::Bind. The
+// slice holds every LOD's indices back to back over one vertex range, so draw one level with
+// the range from GetLodRange rather than the whole of GetRange.
 class GfxMesh {
   public:
 	static Ref<GfxMesh> Create(GfxContext &ctx, const Graphics::Resources::Mesh &mesh);
+	~GfxMesh();
 
 	AQUILA_NONCOPYABLE(GfxMesh);
 	AQUILA_NONMOVEABLE(GfxMesh);
 
-	[[nodiscard]] GfxBuffer &GetVertexBuffer() const { return *m_VertexBuffer; }
-	[[nodiscard]] GfxBuffer &GetIndexBuffer() const { return *m_IndexBuffer; }
-	[[nodiscard]] uint32 GetIndexCount() const { return m_IndexCount; }
+	[[nodiscard]] Ref<GfxBuffer> GetVertexBuffer() const { return m_Arena->GetVertexBuffer(); }
+	[[nodiscard]] Ref<GfxBuffer> GetIndexBuffer() const { return m_Arena->GetIndexBuffer(); }
+	[[nodiscard]] GeometryRange GetRange() const {
+		return m_Handle == GfxGeometryArena::InvalidHandle ? GeometryRange{} : m_Arena->GetRange(m_Handle);
+	}
+	[[nodiscard]] uint32 GetIndexCount() const { return m_IndexCount; } // LOD 0
+	[[nodiscard]] uint32 GetLodCount() const { return static_cast<uint32>(m_Lods.size()); }
+	// GetRange narrowed to one LOD's indices; `lod` is clamped to the coarsest level.
+	[[nodiscard]] GeometryRange GetLodRange(uint32 lod) const;
+	// Arena bytes the slice takes: packed vertices plus every LOD's indices.
+	[[nodiscard]] uint64 GetGpuBytes() const;
 
   private:
 	GfxMesh() = default;
-	Ref<GfxBuffer> m_VertexBuffer;
-	Ref<GfxBuffer> m_IndexBuffer;
+	GfxGeometryArena *m_Arena = nullptr;
+	GfxGeometryArena::Handle m_Handle = GfxGeometryArena::InvalidHandle;
 	uint32 m_IndexCount = 0;
+	std::vector<Graphics::Resources::MeshLod> m_Lods;
 };
 
 } // namespace Aquila::GFX
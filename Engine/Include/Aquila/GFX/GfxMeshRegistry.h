@@ -0,0 +1,49 @@
+#pragma once
+#include <mutex>
+#include <unordered_map>
+#include "Aquila/Foundation/Defines.h"
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/GFX/GfxMesh.h"
+#include "Aquila/Graphics/Resources/Mesh.h"
+
+namespace Aquila::GFX {
+
+class GfxContext;
+
+// GfxMeshRegistry
+//
+// One GPU copy per CPU Mesh, shared by every rendering system that draws it.
+// Entries are keyed by the Mesh address but also hold a weak ref to it, so:
+//   - a dead Mesh is evicted on the next CollectGarbage() (called once per frame),
+//   - a new Mesh that happens to land on a recycled address is never handed a stale upload.
+//
+// The registry holds a strong ref to the GfxMesh; callers may hold their own for the frame.
+// Buffer destruction goes through the deletion queue, so eviction is safe while in flight.
+class GfxMeshRegistry {
+  public:
+	explicit GfxMeshRegistry(GfxContext &ctx) : m_Ctx(ctx) {}
+	~GfxMeshRegistry() = default;
+
+	AQUILA_NONCOPYABLE(GfxMeshRegistry);
+	AQUILA_NONMOVEABLE(GfxMeshRegistry);
+
+	[[nodiscard]] Ref<GfxMesh> GetOrUpload(const Ref<Graphics::Resources::Mesh> &mesh);
+
+	// Drops every entry whose CPU mesh has been destroyed. Returns the number evicted.
+	usize CollectGarbage();
+	void Clear();
+
+	[[nodiscard]] usize GetEntryCount() const;
+
+  private:
+	struct Entry {
+		WeakRef<Graphics::Resources::Mesh> cpu;
+		Ref<GfxMesh> gpu;
+	};
+
+	GfxContext &m_Ctx;
+	mutable std::mutex m_Mutex;
+	std::unordered_map<const Graphics::Resources::Mesh *, Entry> m_Entries;
+};
+
+} // namespace Aquila::GFX
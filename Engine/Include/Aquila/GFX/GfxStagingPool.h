@@ -0,0 +1,109 @@
+#pragma once
+#include <deque>
+#include <mutex>
+#include <vector>
+#include "Aquila/Foundation/Defines.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/Foundation/SharedConstants.h"
+#include "Aquila/GFX/GfxBuffer.h"
+#include "Aquila/RHI/Backend/RHITypes.h"
+
+namespace Aquila::GFX {
+
+class GfxContext;
+
+// A CPU-visible range to copy from. Fill it with Write, record a copy from `buffer` at
+// `offset`, then hand it back with Retire (or Free, if the copy already executed).
+struct StagingAllocation {
+	GfxBuffer *buffer = nullptr;
+	uint64 offset = 0;
+	uint64 size = 0;
+	uint8 *data = nullptr;
+	uint64 id = 0;
+
+	// Copies and flushes, in case the pool landed in non-coherent memory.
+	void Write(const void *src, uint64 bytes, uint64 at = 0) {
+		memcpy(data + at, src, bytes);
+		buffer->Flush(bytes, offset + at);
+	}
+	[[nodiscard]] bool IsValid() const { return buffer != nullptr; }
+};
+
+// GfxStagingPool
+//
+// One persistently mapped CPU_ONLY ring shared by every upload path, so staging an icon or
+// a mesh is a bump allocation instead of a VMA allocate/free pair. Allocations are handed
+// back with the queue timeline value of the submission that reads them; the ring's tail
+// only moves past a block once that value has completed, in allocation order.
+//
+// Uploads larger than half the ring, or made while the ring is held by work that hasn't
+// been submitted yet, get a dedicated buffer instead, released the same way.
+//
+// Thread-safe.
+class GfxStagingPool {
+  public:
+	explicit GfxStagingPool(GfxContext &ctx, uint64 capacity = SharedConstants::STAGING_POOL_SIZE);
+	~GfxStagingPool() = default;
+
+	AQUILA_NONCOPYABLE(GfxStagingPool);
+	AQUILA_NONMOVEABLE(GfxStagingPool);
+
+	// May block on the GPU when the ring is full of submitted-but-unfinished uploads.
+	[[nodiscard]] StagingAllocation Allocate(uint64 size, uint64 alignment = SharedConstants::STAGING_POOL_ALIGNMENT);
+	// The copies reading `alloc` were submitted on `queue` and complete at `value`.
+	void Retire(StagingAllocation &alloc, RHI::CommandListType queue, uint64 value);
+	// The copies reading `alloc` have already executed (immediate submits).
+	void Free(StagingAllocation &alloc);
+
+	struct Stats {
+		uint64 capacity = 0;
+		uint64 ringInUse = 0;
+		uint64 dedicatedInUse = 0;
+		uint64 peakInUse = 0; // ring and dedicated together, since creation or ResetPeak
+		uint64 dedicatedAllocations = 0;
+	};
+	[[nodiscard]] Stats GetStats() const;
+	void ResetPeak();
+
+  private:
+	struct Block {
+		uint64 id = 0;
+		uint64 end = 0; // ring position just past the allocation
+		uint64 size = 0;
+		Ref<GfxBuffer> dedicated; // null for ring blocks
+		RHI::CommandListType queue = RHI::CommandListType::Graphics;
+		uint64 value = 0;
+		bool retired = false;
+	};
+
+	// Moves the tail past blocks whose copies have completed. Caller holds m_Mutex.
+	void Reclaim();
+	[[nodiscard]] bool IsComplete(const Block &block) const;
+	// Caller holds m_Mutex.
+	Block *FindBlock(uint64 id);
+	StagingAllocation AllocateDedicated(uint64 size);
+	// Caller holds m_Mutex.
+	void UpdatePeak();
+
+	GfxContext &m_Ctx;
+
+	Ref<GfxBuffer> m_Buffer;
+	uint8 *m_Mapped = nullptr;
+	uint64 m_Capacity = 0;
+
+	// Monotonic positions; the physical offset is position % capacity.
+	uint64 m_Head = 0;
+	uint64 m_Tail = 0;
+	std::deque<Block> m_Blocks; // ring blocks, in allocation order
+	std::vector<Block> m_DedicatedBlocks;
+	uint64 m_NextId = 1;
+
+	uint64 m_DedicatedInUse = 0;
+	uint64 m_DedicatedAllocations = 0;
+	uint64 m_PeakInUse = 0;
+
+	mutable std::mutex m_Mutex;
+};
+
+} // namespace Aquila::GFX
@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include "Aquila/Foundation/Defines.h"
 #include "Aquila/Foundation/PrimitiveTypes.h"
 #include "Aquila/RHI/Backend/IRHITexture.h"
@@ -14,6 +15,14 @@ class GfxTexture {
 
 	void DestroyImmediate();
 	[[nodiscard]] bool IsReady() const;
+	// False from the moment an upload is queued through GfxUploadBatcher until the frame that
+	// acquires it on the graphics queue; draw a placeholder instead of sampling it meanwhile.
+	[[nodiscard]] bool IsResident() const { return m_Resident.load(std::memory_order_acquire); }
+	void SetResident(bool resident) { m_Resident.store(resident, std::memory_order_release); }
+	// Set when the upload that would make it resident can never come (e.g. its file failed to
+	// decode). It is drawn as a placeholder for good, and nothing waits for it to land.
+	[[nodiscard]] bool HasFailed() const { return m_Failed.load(std::memory_order_acquire); }
+	void MarkFailed() { m_Failed.store(true, std::memory_order_release); }
 
 	[[nodiscard]] uint32 GetWidth() const;
 	[[nodiscard]] uint32 GetHeight() const;
@@ -27,6 +36,8 @@ class GfxTexture {
 	friend class GfxContext;
 	explicit GfxTexture(Unique<RHI::IRHITexture> texture);
 	Unique<RHI::IRHITexture> m_Texture;
+	std::atomic<bool> m_Resident{ true };
+	std::atomic<bool> m_Failed{ false };
 };
 
 } // namespace Aquila::GFX
@@ -0,0 +1,103 @@
+#pragma once
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+#include "Aquila/Foundation/Defines.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/GFX/GfxBuffer.h"
+#include "Aquila/GFX/GfxCommandList.h"
+#include "Aquila/GFX/GfxStagingPool.h"
+#include "Aquila/GFX/GfxTexture.h"
+
+namespace Aquila::GFX {
+
+class GfxContext;
+
+// GfxUploadBatcher
+//
+// Collects copies for the transfer queue and submits them as one batch per frame, so an
+// upload costs a staging write instead of a submit and a fence wait. Each batch signals
+// the transfer timeline; Submit hands that value to the frame list as a QueueWait, so the
+// GPU orders the frame after its uploads without the CPU ever blocking.
+//
+// Buffer destinations are written by the transfer queue while other queues read them and
+// must be created with BufferDesc::transferQueueShared. Textures stay exclusive instead: the
+// batch releases them to the graphics queue and Submit records the matching acquire on the
+// frame list, after which they are marked resident. Staging comes from the context's
+// GfxStagingPool and goes back to it on submit; the batch's destinations are released by
+// Collect once the transfer timeline has passed the batch, and its command list is kept for
+// a later batch.
+//
+// Thread-safe: uploads may be queued from any thread. Batch lists come from the context's
+// upload pool, which is only used under m_Mutex.
+class GfxUploadBatcher {
+  public:
+	explicit GfxUploadBatcher(GfxContext &ctx);
+	~GfxUploadBatcher();
+
+	AQUILA_NONCOPYABLE(GfxUploadBatcher);
+	AQUILA_NONMOVEABLE(GfxUploadBatcher);
+
+	// Copies `data` into staging now; the GPU copy lands with the next submit.
+	void UploadBuffer(const Ref<GfxBuffer> &dst, const void *data, uint64 size, uint64 dstOffset = 0);
+	// Same, for several ranges of possibly different destinations sharing one staging buffer.
+	struct Region {
+		Ref<GfxBuffer> dst;
+		const void *data = nullptr;
+		uint64 size = 0;
+		uint64 dstOffset = 0;
+	};
+	void UploadBuffers(std::span<const Region> regions);
+	// Copies level 0 and the mips after it, packed as for GfxContext::UploadTextureData, and
+	// leaves `dst` in ShaderRead. `dst` is not resident until the Submit after this batch.
+	void UploadTexture(const Ref<GfxTexture> &dst, const void *data, uint64 size);
+
+	// Records arbitrary transfer work into the open batch. `onComplete` runs on the thread
+	// that calls Collect once the batch has executed on the GPU.
+	void Record(std::function<void(GfxCommandList &)> record, std::function<void()> onComplete = {});
+
+	// Submits the open batch, if any, and makes `frameCmd`'s next submission wait for it.
+	// Call before the frame records work that reads the uploads.
+	void Submit(GfxCommandList &frameCmd);
+	// Submits the open batch and blocks until every batch has executed. For the rare paths
+	// that copy out of upload destinations with an immediate submit (arena growth, defrag).
+	void SubmitAndWait();
+	// Releases staging memory and runs completion callbacks of batches that have executed.
+	void Collect();
+
+	[[nodiscard]] bool HasPending() const;
+
+  private:
+	struct Batch {
+		Ref<GfxCommandList> cmd;
+		std::vector<StagingAllocation> staging; // retired to the pool on submit
+		std::vector<Ref<GfxBuffer>> keepAlive; // destinations, until the copies ran
+		std::vector<Ref<GfxTexture>> textures; // released to the graphics queue at the end
+		std::vector<std::function<void()>> onComplete;
+		uint64 value = 0;
+	};
+
+	// Lazily begins the open batch's command list. Caller holds m_Mutex.
+	Batch &OpenBatch();
+	// Submits the open batch and returns the value it signals, or the last submitted value
+	// when there was nothing to submit. Caller holds m_Mutex.
+	uint64 SubmitOpenBatch();
+
+	GfxContext &m_Ctx;
+
+	std::optional<Batch> m_Open;
+	std::deque<Batch> m_InFlight;
+	// Lists of completed batches, begun again by OpenBatch.
+	std::vector<Ref<GfxCommandList>> m_FreeLists;
+	// Textures of submitted batches still waiting for their acquire on a frame list.
+	std::vector<Ref<GfxTexture>> m_PendingAcquires;
+	uint64 m_LastValue = 0;
+
+	mutable std::mutex m_Mutex;
+};
+
+} // namespace Aquila::GFX
@@ -0,0 +1,75 @@
+#pragma once
+#include <mutex>
+#include "Aquila/Foundation/Defines.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/Foundation/SharedConstants.h"
+#include "Aquila/GFX/GfxBuffer.h"
+
+namespace Aquila::GFX {
+
+class GfxContext;
+
+// A sub-range of the current frame's ring buffer. Valid until the same frame slot comes
+// around again; bind it with `offset` as the dynamic offset of a *Dynamic descriptor.
+struct UploadAllocation {
+	GfxBuffer *buffer = nullptr;
+	uint32 bufferId = 0; // changes whenever a new buffer backs the ring, even at a reused address
+	uint32 offset = 0;
+	void *data = nullptr;
+};
+
+// GfxUploadRing
+//
+// Linear allocator for data the CPU rewrites every frame (frame constants, material
+// parameter blocks). Each frame-in-flight owns one persistently mapped CPU_TO_GPU buffer;
+// BeginFrame rewinds it and Allocate bumps a head, so a whole frame's worth of constants
+// lives in a single buffer and descriptors only change when that buffer does.
+//
+// A frame that outgrows its buffer gets a new one twice the size. The old buffer stays
+// alive until the slot's next BeginFrame, since earlier allocations this frame point into it.
+class GfxUploadRing {
+  public:
+	explicit GfxUploadRing(GfxContext &ctx);
+	~GfxUploadRing() = default;
+
+	AQUILA_NONCOPYABLE(GfxUploadRing);
+	AQUILA_NONMOVEABLE(GfxUploadRing);
+
+	// Rewinds frameSlot's buffer. Its previous frame must have completed on the GPU.
+	void BeginFrame(uint32 frameSlot);
+	// Flushes what this frame wrote, ahead of submission.
+	void EndFrame();
+
+	[[nodiscard]] UploadAllocation Allocate(uint64 size, uint64 alignment = SharedConstants::UPLOAD_RING_ALIGNMENT);
+
+	template <typename T> [[nodiscard]] UploadAllocation Push(const T &value) {
+		UploadAllocation alloc = Allocate(sizeof(T));
+		memcpy(alloc.data, &value, sizeof(T));
+		return alloc;
+	}
+
+	[[nodiscard]] uint64 GetUsed() const { return m_Frames[m_FrameSlot].head; }
+	[[nodiscard]] uint64 GetCapacity() const { return m_Frames[m_FrameSlot].capacity; }
+
+  private:
+	struct FrameRing {
+		Ref<GfxBuffer> buffer;
+		uint8 *mapped = nullptr;
+		uint32 bufferId = 0;
+		uint64 capacity = 0;
+		uint64 head = 0;
+		std::vector<Ref<GfxBuffer>> retired; // outgrown this frame, freed at the next BeginFrame
+	};
+
+	void CreateBuffer(FrameRing &ring, uint64 capacity);
+
+	GfxContext &m_Ctx;
+	std::array<FrameRing, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_Frames;
+	uint32 m_FrameSlot = 0;
+	uint32 m_NextBufferId = 1;
+
+	std::mutex m_Mutex;
+};
+
+} // namespace Aquila::GFX
@@ -2,6 +2,7 @@
 #define AQUILA_GPU_UPLOADER_H
 
 #include "Aquila/GFX/GfxContext.h"
+#include "Aquila/GFX/GfxUploadBatcher.h"
 #include "Aquila/Foundation/PrimitiveTypes.h"
 
 namespace Aquila::Graphics {
@@ -60,9 +61,13 @@ class GPUUploadManager {
 		return future;
 	}
 
+	// Waits for the queue to drain into the upload batcher, then for the batches on the GPU.
 	void FlushAll() {
-		std::unique_lock<std::mutex> lock(m_QueueMutex);
-		m_FlushCV.wait(lock, [this] { return m_UploadQueue.empty() && !m_IsProcessing; });
+		{
+			std::unique_lock<std::mutex> lock(m_QueueMutex);
+			m_FlushCV.wait(lock, [this] { return m_UploadQueue.empty() && !m_IsProcessing; });
+		}
+		m_Context.GetUploadBatcher().SubmitAndWait();
 	}
 
 	size_t GetQueueSize() const {
@@ -71,9 +76,17 @@ class GPUUploadManager {
 	}
 
   private:
+	// Records into the batcher's open transfer batch; the promise is fulfilled by the
+	// batcher's Collect once the transfer timeline has passed it.
 	void ExecuteUpload(GPUUploadCommand &cmd) {
-		m_Context.ExecuteImmediate(RHI::CommandListType::Transfer,
-								   [&](GFX::GfxCommandList &cmdList) { cmd.uploadFunc(cmdList); });
+		auto completion = std::make_shared<std::promise<void>>(std::move(cmd.completion));
+		try {
+			m_Context.GetUploadBatcher().Record(std::move(cmd.uploadFunc),
+												[completion] { completion->set_value(); });
+		} catch (const std::exception &e) {
+			AQUILA_LOG_ERROR("GPU upload '{}' failed: {}", cmd.debugName, e.what());
+			completion->set_exception(std::current_exception());
+		}
 	}
 
 	void UploadThreadFunc() {
@@ -95,13 +108,7 @@ class GPUUploadManager {
 				m_IsProcessing = true;
 			}
 
-			try {
-				ExecuteUpload(cmd);
-				cmd.completion.set_value();
-			} catch (const std::exception &e) {
-				AQUILA_LOG_ERROR("GPU upload '{}' failed: {}", cmd.debugName, e.what());
-				cmd.completion.set_exception(std::current_exception());
-			}
+			ExecuteUpload(cmd);
 
 			{
 				std::lock_guard<std::mutex> lock(m_QueueMutex);
@@ -102,6 +102,9 @@ class QuadBatcher {
 	AQUILA_NONCOPYABLE(QuadBatcher);
 	AQUILA_NONMOVEABLE(QuadBatcher);
 
+	// The shaders behind the lazily built pipelines, so they can be precompiled at startup.
+	static void DeclareShaders(std::vector<std::string> &outPaths);
+
 	void Begin(GFX::GfxCommandList &cmd, RHI::TextureFormat colorFormat, RHI::SampleCount sampleCount,
 			   const mat4 &viewProjection, RHI::TextureFormat depthFormat = RHI::TextureFormat::None);
 	void Flush();
@@ -109,6 +112,9 @@ class QuadBatcher {
 
 	void BeginCapture();
 	void ExecuteReplay(GFX::GfxCommandList &cmd);
+	// False when the last capture drew placeholders for textures still uploading: record
+	// again instead of replaying, so they show up once resident. Failed textures don't count.
+	[[nodiscard]] bool CanReplay() const { return !m_CapturedPlaceholders; }
 	void SetScissor(GFX::GfxCommandList &cmd, int32 x, int32 y, uint32 w, uint32 h);
 
 	void DrawRect(const RectSpec &spec);
@@ -226,6 +232,7 @@ class QuadBatcher {
 	// Replay state — built during a captured Submit, consumed by ExecuteReplay.
 	std::vector<ReplayEntry> m_ReplayList;
 	bool m_Capturing = false;
+	bool m_CapturedPlaceholders = false;
 	uint32 m_CurrentSlot = 0; // ring slot in use this frame (set by Begin)
 	uint32 m_LastDirtySlot = 0; // ring slot written during last BeginCapture+Submit
 	uint64 m_ReplayQuadBytes = 0;
@@ -41,6 +41,18 @@ class Material {
 	void RegisterParameter(std::string paramName, ParameterType type, uint32 uboOffset,
 						   uint32 textureBinding = UINT32_MAX);
 
+	// Resolve once at setup and keep the handle; invalid if the material has no such parameter.
+	[[nodiscard]] ParamHandle FindHandle(ParamName paramName) const;
+
+	Material &Set(ParamHandle handle, f32 v);
+	Material &Set(ParamHandle handle, int v);
+	Material &Set(ParamHandle handle, bool v);
+	Material &Set(ParamHandle handle, const vec2 &v);
+	Material &Set(ParamHandle handle, const vec3 &v);
+	Material &Set(ParamHandle handle, const vec4 &v);
+	Material &Set(ParamHandle handle, Ref<GFX::GfxTexture> tex);
+
+	// Convenience overloads, one hash lookup per call.
 	Material &Set(const std::string &paramName, f32 v);
 	Material &Set(const std::string &paramName, int v);
 	Material &Set(const std::string &paramName, bool v);
@@ -49,14 +61,16 @@ class Material {
 	Material &Set(const std::string &paramName, const vec4 &v);
 	Material &Set(const std::string &paramName, Ref<GFX::GfxTexture> tex);
 
-	Material &SetAlbedo(const vec4 &color) { return Set("albedo", color); }
-	Material &SetAlbedo(const vec3 &color) { return Set("albedo", vec4{ color, 1.f }); }
-	Material &SetMetallic(f32 v) { return Set("metallic", v); }
-	Material &SetRoughness(f32 v) { return Set("roughness", v); }
-	Material &SetEmissive(f32 v) { return Set("emissive", v); }
+	Material &SetAlbedo(const vec4 &color) { return Set(FindHandle("albedo"), color); }
+	Material &SetAlbedo(const vec3 &color) { return Set(FindHandle("albedo"), vec4{ color, 1.f }); }
+	Material &SetMetallic(f32 v) { return Set(FindHandle("metallic"), v); }
+	Material &SetRoughness(f32 v) { return Set(FindHandle("roughness"), v); }
+	Material &SetEmissive(f32 v) { return Set(FindHandle("emissive"), v); }
 
 	Material &SetTexture(uint32 binding, GFX::GfxTexture &tex);
 
+	// Copies the parameter block into this frame's upload ring and applies pending texture
+	// writes. Must run every frame the material is bound, before recording.
 	void Flush(uint32 frameSlot);
 
 	void Bind(GFX::GfxCommandList &cmd, uint32 setIndex, uint32 frameSlot);
@@ -84,11 +98,19 @@ class Material {
 	Ref<GFX::GfxDescriptorSetLayout> m_Layout;
 
 	std::array<Ref<GFX::GfxDescriptorSet>, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_Sets;
-	std::array<Ref<GFX::GfxBuffer>, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_UniformBuffers;
 
-	uint32 m_DirtySlotMask = 0;
+	// Per frame slot: where this frame's copy of m_UBOData sits in the upload ring, and the
+	// ring buffer and block size the set's dynamic binding 0 currently describes.
+	struct SlotState {
+		uint32 uboOffset = 0;
+		uint32 boundBufferId = 0; // 0 until the set has a ring binding
+		uint32 boundSize = 0;
+	};
+	std::array<SlotState, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_SlotStates{};
+	uint32 m_DirtySlotMask = 0; // slots whose set still lacks m_PendingTextures
 
 	std::vector<MaterialParameter> m_Parameters;
+	std::unordered_map<uint32, uint32> m_ParameterLookup; // name hash -> index into m_Parameters
 	std::vector<uint8> m_UBOData;
 
 	struct PendingTexture {
@@ -98,10 +120,9 @@ class Material {
 	std::vector<PendingTexture> m_PendingTextures;
 
 	MaterialParameter *FindParameter(const std::string &paramName);
+	void AddParameter(MaterialParameter param);
 
-	template <typename T> void WriteUBO(uint32 offset, const T &v);
-
-	void EnsureUniformBuffers();
+	void WriteParameter(ParamHandle handle, ParameterValue value, const void *data, uint32 size);
 };
 
 } // namespace Aquila::Graphics
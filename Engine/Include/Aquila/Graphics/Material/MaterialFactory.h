@@ -1,9 +1,13 @@
 #pragma once
 #include "Aquila/Foundation/Singleton.h"
+#include "Aquila/Foundation/Job.h"
 #include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/Foundation/SharedConstants.h"
 #include "Aquila/Graphics/Material/Material.h"
 #include "Aquila/Graphics/Shader/ShaderWatcher.h"
 #include "Aquila/RHI/Backend/RHITypes.h"
+#include "Aquila/RHI/ShaderCompiler.h"
+#include <array>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -35,29 +39,66 @@ struct MaterialCreateInfo {
 	uint32 pushConstantSize = 256;
 };
 
+// MaterialFactory
+//
+// Creates materials from Slang shaders and hot-reloads them. A saved shader, or any file it
+// imports, is recompiled on a JobSystem worker while its materials keep rendering with the
+// old pipeline. Tick swaps the new pipeline in at the start of the next frame once the job
+// is done; the replaced pipeline, layout and descriptor sets are held for
+// MAX_FRAMES_IN_FLIGHT more frames instead of waiting for the device to go idle. A failed
+// compile leaves everything as it was.
 class MaterialFactory : public Foundation::Singleton<MaterialFactory> {
   public:
+	MaterialFactory() = default;
+	~MaterialFactory();
+
 	Ref<Material> Create(GFX::GfxContext &ctx, const std::string &shaderPath, MaterialCreateInfo info);
 
+	// Once per frame, before recording.
 	void Tick(GFX::GfxContext &ctx);
 
 	void EnableHotReload(bool enable) { m_Watcher.Enable(enable); }
+	// Called from a watcher thread when a shader file changes, so an idle loop can be woken to tick.
+	void SetHotReloadWakeCallback(std::function<void()> callback) { m_Watcher.SetWakeCallback(std::move(callback)); }
 	[[nodiscard]] bool IsHotReloadEnabled() const { return m_Watcher.IsEnabled(); }
 
   private:
+	// What a background recompile hands back to the main thread.
+	struct CompileResult {
+		bool succeeded = false;
+		std::vector<RHI::VulkanCompiledStage> stages;
+		std::vector<std::string> dependencies;
+		std::string errorLog;
+	};
+
 	struct Entry {
 		Ref<Shader::ShaderProgram> program;
 		MaterialCreateInfo info;
 		std::vector<WeakRef<Material>> instances;
+
+		Foundation::JobHandle<CompileResult> pendingCompile;
+		bool compiling = false;
+		bool recompileQueued = false; // saved again while compiling; the running result is stale
+	};
+
+	// Objects a reload replaced, released once no frame in flight can still use them.
+	struct RetiredResources {
+		Ref<GFX::GfxPipeline> pipeline;
+		Ref<GFX::GfxDescriptorSetLayout> layout;
+		std::array<Ref<GFX::GfxDescriptorSet>, SharedConstants::MAX_FRAMES_IN_FLIGHT> sets;
+		uint64 retireFrame = 0;
 	};
 
 	std::unordered_map<std::string, Entry> m_Entries;
 	Shader::ShaderWatcher m_Watcher;
+	std::vector<RetiredResources> m_Retired;
+	uint64 m_FrameIndex = 0;
 
 	static Ref<GFX::GfxPipeline> BuildPipeline(GFX::GfxContext &ctx, Shader::ShaderProgram &program,
 											   const MaterialCreateInfo &info);
 
-	void RebuildEntry(GFX::GfxContext &ctx, Entry &entry, const std::string &shaderPath);
+	void StartRecompile(const std::string &shaderPath, Entry &entry);
+	void ApplyRecompile(GFX::GfxContext &ctx, Entry &entry, const std::string &shaderPath, CompileResult result);
 };
 
 } // namespace Aquila::Graphics
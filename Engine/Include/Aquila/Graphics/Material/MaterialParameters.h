@@ -1,4 +1,5 @@
 #pragma once
+#include "Aquila/Foundation/Hash.h"
 #include "Aquila/Foundation/PrimitiveTypes.h"
 #include "Aquila/GFX/GfxTexture.h"
 
@@ -28,4 +29,23 @@ struct MaterialParameter {
 	uint32 textureBinding = UINT32_MAX;
 };
 
+// Parameter name reduced to its hash. Implicit (and hashed at compile time) from string
+// literals: material.FindHandle("roughness"). Runtime strings go through the explicit
+// string_view constructor.
+struct ParamName {
+	uint32 hash = 0;
+	std::string_view name;
+
+	consteval ParamName(const char *str) : hash(Foundation::HashFnv1a(str)), name(str) {}
+	constexpr explicit ParamName(std::string_view str) : hash(Foundation::HashFnv1a(str)), name(str) {}
+};
+
+// A parameter resolved once through Material::FindHandle. Writes through it index the
+// parameter list directly; no name lookup. Only valid for the material it came from.
+struct ParamHandle {
+	uint32 index = UINT32_MAX;
+
+	[[nodiscard]] bool IsValid() const { return index != UINT32_MAX; }
+};
+
 } // namespace Aquila::Graphics
@@ -2,6 +2,7 @@
 #include "Aquila/Foundation/PrimitiveTypes.h"
 #include "Aquila/Graphics/RenderGraph/RGPassBuilder.h"
 #include "Aquila/Graphics/RenderGraph/RGRegistry.h"
+#include "Aquila/Graphics/RenderGraph/RGTransientPool.h"
 #include "Aquila/GFX/GfxRenderpass.h"
 
 namespace Aquila::GFX {
@@ -18,14 +19,47 @@ struct RGTexBarrier {
 	RGTextureHandle handle;
 	RHI::ResourceState oldState;
 	RHI::ResourceState newState;
+	RHI::PipelineScope srcScope = RHI::PipelineScope::All; // kind of pass that left it in oldState
+	RHI::PipelineScope dstScope = RHI::PipelineScope::All;
+	RHI::CommandListType srcQueue = RHI::CommandListType::Graphics; // differ on a queue hand-off
+	RHI::CommandListType dstQueue = RHI::CommandListType::Graphics;
 };
 
 struct RGBufBarrier {
 	RGBufferHandle handle;
 	RHI::ResourceState oldState;
 	RHI::ResourceState newState;
+	RHI::PipelineScope srcScope = RHI::PipelineScope::All;
+	RHI::PipelineScope dstScope = RHI::PipelineScope::All;
+	RHI::CommandListType srcQueue = RHI::CommandListType::Graphics;
+	RHI::CommandListType dstQueue = RHI::CommandListType::Graphics;
 };
 
+// A run of passes submitted together on one queue.
+//
+// Segments execute in index order. Graphics segments are recorded into the frame command
+// list and separated by a flush; every compute segment gets its own list. A segment whose
+// waitSegment is set starts only once that segment (on the other queue, always earlier)
+// has signalled its timeline value.
+//
+// A resource handed from one queue to the other gets the same barrier record twice: in
+// the consuming pass's barriers (acquire) and in the producing segment's releases, which
+// are recorded after its last pass.
+struct RGQueueSegment {
+	RHI::CommandListType queue = RHI::CommandListType::Graphics;
+	std::vector<uint32> passes; // schedule positions, in order
+	int32 waitSegment = -1;
+	bool signalled = false; // some later segment waits on this one
+
+	std::vector<RGTexBarrier> texReleases;
+	std::vector<RGBufBarrier> bufReleases;
+};
+
+// Split in two halves:
+//  - structure (order, barriers, aliasing) depends only on what the passes declared,
+//    so it is cached by RenderGraph across frames under RGCompiler::DescribeStructure();
+//  - frame resources (physical transients, render passes) are rebound every frame by
+//    RGCompiler::Materialize(), because imported targets and pooled transients change.
 struct RGCompiledGraph {
 	// Topologically sorted, culled pass indices (into RenderGraph::GetPasses()).
 	std::vector<uint32> passOrder;
@@ -39,33 +73,86 @@ struct RGCompiledGraph {
 	std::vector<RGBufBarrier> bufBarriers;
 	std::vector<uint32> passBufBarStart; // size = passOrder.size() + 1
 
+	// Queue each scheduled pass runs on, and the submission segments built from them.
+	// Without async compute there is a single graphics segment holding every pass.
+	std::vector<RHI::CommandListType> passQueue;
+	std::vector<RGQueueSegment> segments;
+
+	// Transient aliasing. texAlias[slot] is the physical index backing that slot, or -1
+	// for imported / unused slots. Physical i takes its descriptor from texPhysicalSlot[i].
+	std::vector<int32> texAlias;
+	std::vector<uint32> texPhysicalSlot;
+	std::vector<int32> bufAlias;
+	std::vector<uint32> bufPhysicalSlot;
+
+	// ---- Frame resources, rebuilt by Materialize() ----
+
 	// Per-pass renderpass handle.  Null for compute / copy passes.
 	// Ref-counted so the GfxContext's internal caching works correctly.
 	std::vector<Ref<GFX::GfxRenderPass>> passRenderPasses;
 
-	// Transient resource owners — alive until Reset() so raw pointers in the
-	// registry remain valid throughout Execute().
+	// Per-pass: record through secondary command lists on JobSystem workers.
+	// The matching render pass was created with secondaryCommandLists = true.
+	std::vector<bool> passParallel;
+
+	// Transient resource owners, indexed by physical index. Alive until the next
+	// Materialize() / ReleaseFrameResources() so raw pointers in the registry remain
+	// valid throughout Execute(). The pool keeps its own reference.
 	std::vector<Ref<GFX::GfxTexture>> transientTextures;
 	std::vector<Ref<GFX::GfxBuffer>> transientBuffers;
 
 	bool valid = false;
 
+	void ReleaseFrameResources() {
+		passRenderPasses.clear();
+		passParallel.clear();
+		transientTextures.clear();
+		transientBuffers.clear();
+	}
+
 	void Reset() {
 		passOrder.clear();
 		texBarriers.clear();
 		passTexBarStart.clear();
 		bufBarriers.clear();
 		passBufBarStart.clear();
-		passRenderPasses.clear();
-		transientTextures.clear();
-		transientBuffers.clear();
+		passQueue.clear();
+		segments.clear();
+		texAlias.clear();
+		texPhysicalSlot.clear();
+		bufAlias.clear();
+		bufPhysicalSlot.clear();
+		ReleaseFrameResources();
 		valid = false;
 	}
 };
 
 class RGCompiler {
   public:
-	static RGCompiledGraph Compile(const std::vector<RGPassData> &passes, RGRegistry &registry, GFX::GfxContext &ctx);
+	// Structural compile: ordering, culling, aliasing, barriers and queue segments. Touches
+	// no GPU objects. asyncCompute says whether RGQueue::AsyncCompute passes may leave the
+	// graphics queue.
+	static RGCompiledGraph Compile(const std::vector<RGPassData> &passes, const RGRegistry &registry,
+								   bool asyncCompute);
+
+	// Binds a compiled structure to this frame's registry: acquires transients from the
+	// pool, resolves every transient handle and builds the render passes.
+	static void Materialize(const std::vector<RGPassData> &passes, RGRegistry &registry, GFX::GfxContext &ctx,
+							RGTransientPool &pool, RGCompiledGraph &compiled);
+
+	// Flattens everything Compile() reads into `out` (cleared first). Equal descriptions =>
+	// the compiled structure can be reused; HashStructure() of one is its cache key.
+	static void DescribeStructure(const std::vector<RGPassData> &passes, const RGRegistry &registry,
+								  bool asyncCompute, std::vector<uint64> &out);
+	[[nodiscard]] static uint64 HashStructure(std::span<const uint64> description);
+
+	// Queue the pass actually runs on, given its request and the device.
+	[[nodiscard]] static RHI::CommandListType ResolveQueue(const RGPassData &pass, bool asyncCompute);
+
+	// Whether passes that opted in may be recorded on the JobSystem workers (the default).
+	// Read by every Materialize, so it can be flipped between frames, e.g. to compare both.
+	static void SetParallelRecording(bool enabled);
+	[[nodiscard]] static bool IsParallelRecordingEnabled();
 
   private:
 	// Directed adjacency list for the dependency graph.
@@ -76,17 +163,16 @@ class RGCompiler {
 		int32 firstUse = INT32_MAX;
 		int32 lastUse = -1;
 		bool imported = false;
+		bool asyncCompute = false; // touched on the compute queue, may overlap anything
 	};
 
-	// Pool entry for texture aliasing.
-	struct TexPoolEntry {
-		Ref<GFX::GfxTexture> tex;
+	// Physical slot used for in-frame aliasing.
+	struct TexAliasEntry {
 		int32 lastUsedAt = -1;
 		RGTextureDesc desc;
 	};
 
-	struct BufPoolEntry {
-		Ref<GFX::GfxBuffer> buf;
+	struct BufAliasEntry {
 		int32 lastUsedAt = -1;
 		RGBufferDesc desc;
 	};
@@ -102,26 +188,25 @@ class RGCompiler {
 
 	static std::vector<LifetimeInterval> ComputeTexLifetimes(const std::vector<RGPassData> &passes,
 															 const std::vector<uint32> &sortedOrder,
-															 const std::vector<bool> &alive, uint32 texCount,
-															 const RGRegistry &registry);
+															 const std::vector<bool> &alive,
+															 const std::vector<RHI::CommandListType> &queues,
+															 uint32 texCount, const RGRegistry &registry);
 
 	static std::vector<LifetimeInterval> ComputeBufLifetimes(const std::vector<RGPassData> &passes,
 															 const std::vector<uint32> &sortedOrder,
-															 const std::vector<bool> &alive, uint32 bufCount,
-															 const RGRegistry &registry);
+															 const std::vector<bool> &alive,
+															 const std::vector<RHI::CommandListType> &queues,
+															 uint32 bufCount, const RGRegistry &registry);
 
-	static void AllocateTransients(const std::vector<RGPassData> &passes, RGRegistry &registry,
-								   const std::vector<LifetimeInterval> &texLifetimes,
-								   const std::vector<LifetimeInterval> &bufLifetimes, GFX::GfxContext &ctx,
-								   RGCompiledGraph &out);
+	static void AssignAliases(const RGRegistry &registry, const std::vector<LifetimeInterval> &texLifetimes,
+							  const std::vector<LifetimeInterval> &bufLifetimes, RGCompiledGraph &out);
 
 	static void InferBarriers(const std::vector<RGPassData> &passes, const std::vector<uint32> &sortedOrder,
-							  const std::vector<bool> &alive, uint32 texCount, uint32 bufCount,
-							  const RGRegistry &registry, RGCompiledGraph &out);
+							  const std::vector<bool> &alive, const std::vector<RHI::CommandListType> &queues,
+							  uint32 texCount, uint32 bufCount, const RGRegistry &registry, RGCompiledGraph &out);
 
-	static void CreateRenderPasses(const std::vector<RGPassData> &passes, const std::vector<uint32> &sortedOrder,
-								   const std::vector<bool> &alive, const RGRegistry &registry, GFX::GfxContext &ctx,
-								   RGCompiledGraph &out);
+	static void CreateRenderPasses(const std::vector<RGPassData> &passes, const RGRegistry &registry,
+								   GFX::GfxContext &ctx, RGCompiledGraph &out);
 
 	static uint32 SlotOf(uint32 id);
 	static bool TexDescCompatible(const RGTextureDesc &a, const RGTextureDesc &b);
@@ -54,24 +54,89 @@ class RenderGraph {
 		m_Passes.push_back(std::move(data));
 	}
 
+	/// Register a pass whose body can be recorded on several threads.
+	///
+	/// @param itemCount       Size of the work range (usually draw count).
+	/// @param minItemsPerJob  Smallest chunk worth its own secondary command list. Passes
+	///                        with fewer than 2x this many items are recorded inline.
+	/// @param executeFn       (cmd, registry, begin, end). Called once per chunk, possibly
+	///                        concurrently, so it may only read shared state. Nothing carries
+	///                        over between chunks: bind pipeline, sets and buffers every time.
+	///
+	/// Only graphics passes (with attachments) are split; anything else runs the whole
+	/// range inline on the frame command list.
+	template <typename SetupFn, typename ExecuteRangeFn>
+	void AddParallelPass(std::string_view name, uint32 itemCount, uint32 minItemsPerJob, SetupFn &&setupFn,
+						 ExecuteRangeFn &&executeFn) {
+		RGPassBuilder builder(name, m_Registry);
+		std::forward<SetupFn>(setupFn)(builder);
+
+		RGPassData data = std::move(builder).TakeData();
+		data.RenderPassExecuteRange = std::forward<ExecuteRangeFn>(executeFn);
+		data.parallelItemCount = itemCount;
+		data.parallelMinItemsPerJob = std::max(1u, minItemsPerJob);
+
+		m_Passes.push_back(std::move(data));
+	}
+
 	/// Must be called once per frame after all AddPass calls and before Execute().
+	/// Reuses the compiled structure of an earlier frame when the graph hashes the same,
+	/// and binds transients from the persistent pool instead of creating them.
 	void Compile(GFX::GfxContext &ctx);
 
 	/// Replay the compiled schedule.
-	/// Compile() must have been called first.
+	/// Compile() must have been called first. Passes placed on the async compute queue
+	/// are submitted from here; the frame list may be flushed in between, so `cmd` must
+	/// be the frame command list and must be recording.
 	void Execute(GFX::GfxCommandList &cmd);
 
-	/// Reset all state for the next frame (releases transient resources).
+	/// Reset per-frame state for the next frame. The compile cache and the transient
+	/// pool survive; see ClearCache().
 	void Reset();
 
+	/// Drop every cached structure and pooled transient (e.g. after a resize, where
+	/// they would otherwise only age out).
+	void ClearCache();
+
 	[[nodiscard]] const RGRegistry &GetRegistry() const { return m_Registry; }
 	[[nodiscard]] const std::vector<RGPassData> &GetPasses() const { return m_Passes; }
-	[[nodiscard]] const RGCompiledGraph &GetCompiled() const { return m_Compiled; }
+	[[nodiscard]] const RGCompiledGraph *GetCompiled() const { return m_Compiled; }
+	[[nodiscard]] const RGTransientPool &GetTransientPool() const { return m_TransientPool; }
+	[[nodiscard]] usize GetCachedGraphCount() const { return m_CompileCache.size(); }
 
   private:
+	// Structures not hit for this many frames are dropped from the cache.
+	static constexpr uint64 kMaxCachedIdleFrames = 120;
+	// Parallel passes are cut into up to this many chunks per recording thread, so threads
+	// that finish early pick up the remainder of slower ones.
+	static constexpr uint32 kChunksPerThread = 2;
+
+	struct CachedGraph {
+		RGCompiledGraph compiled;
+		std::vector<uint64> description; // RGCompiler::DescribeStructure() it was compiled from
+		uint64 lastUsedFrame = 0;
+	};
+
+	void ExecutePass(uint32 schedPos, GFX::GfxCommandList &cmd);
+	void RecordParallel(const RGPassData &pass, GFX::GfxRenderPass &renderPass, GFX::GfxCommandList &cmd);
+	void SubmitBarriers(std::span<const RGTexBarrier> textures, std::span<const RGBufBarrier> buffers,
+						GFX::GfxCommandList &cmd);
+
 	RGRegistry m_Registry;
 	std::vector<RGPassData> m_Passes;
-	RGCompiledGraph m_Compiled;
+	RGCompiledGraph *m_Compiled = nullptr; // points into m_CompileCache, null between Reset() and Compile()
+	GFX::GfxContext *m_Ctx = nullptr;	   // set by Compile(), needed to allocate secondary lists
+
+	std::unordered_map<uint64, CachedGraph> m_CompileCache;
+	std::vector<uint64> m_Description; // this frame's, kept around so Compile() does not allocate
+	RGTransientPool m_TransientPool;
+
+	// Per-pass barrier batches, kept around so Execute() does not allocate
+	std::vector<RHI::TextureBarrier> m_TexBarrierScratch;
+	std::vector<RHI::BufferBarrier> m_BufBarrierScratch;
+
+	// Timeline value each queue segment signalled this frame (0 = not submitted separately)
+	std::vector<uint64> m_SegmentValues;
 };
 
 } // namespace Aquila::Graphics::RG
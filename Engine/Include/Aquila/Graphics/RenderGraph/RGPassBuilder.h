@@ -53,6 +53,16 @@ struct RGPassData {
 	// The execute lambda called by the executor with a resolved command list.
 	Delegate<void(GFX::GfxCommandList &, RGRegistry &)> RenderPassExecute;
 
+	// Opt-in parallel recording (RenderGraph::AddParallelPass). The body is a range over
+	// [0, parallelItemCount) that the executor may split into chunks, each recorded on a
+	// JobSystem worker into its own secondary command list. When the compiler decides not to
+	// split, the executor runs the whole range inline instead of RenderPassExecute.
+	Delegate<void(GFX::GfxCommandList &, RGRegistry &, uint32 begin, uint32 end)> RenderPassExecuteRange;
+	uint32 parallelItemCount = 0;
+	uint32 parallelMinItemsPerJob = 1;
+
+	RGQueue queue = RGQueue::Graphics;
+
 	// When true the culling step keeps this pass alive even if it has no
 	// graph-tracked outputs (e.g. a swapchain blit that writes to an external image).
 	bool hasSideEffect = false;
@@ -104,6 +114,10 @@ class RGPassBuilder {
 	// Prevents the culling step from removing it even when it has no tracked outputs.
 	void MarkAsSideEffect() { m_Data.hasSideEffect = true; }
 
+	// Ask for the pass to run on the async compute queue, overlapping graphics work it does
+	// not depend on. Synchronisation with the graphics queue is inferred from the accesses.
+	void SetQueue(RGQueue queue) { m_Data.queue = queue; }
+
 	// Called by RenderGraph after the setup lambda returns.
 	RGPassData &&TakeData() { return std::move(m_Data); }
 
@@ -0,0 +1,75 @@
+#pragma once
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Graphics/RenderGraph/RGTypes.h"
+
+namespace Aquila::GFX {
+class GfxContext;
+class GfxTexture;
+class GfxBuffer;
+} // namespace Aquila::GFX
+
+namespace Aquila::Graphics::RG {
+
+// RGTransientPool
+//
+// Physical backing for transient graph resources, kept alive across frames so a
+// steady-state graph never calls CreateTexture / CreateBuffer.
+//
+// Entries are bucketed by descriptor (debug name ignored). A resource handed out
+// in frame F is not handed out again before F + MAX_FRAMES_IN_FLIGHT: by then the
+// slot fence of frame F has been waited on, so the GPU is done with it. Within a
+// frame, aliasing between passes is the compiler's job, not the pool's.
+//
+// Entries nobody asked for in kMaxIdleFrames frames are dropped (deferred deletion
+// in the backend takes care of the GPU side).
+
+class RGTransientPool {
+  public:
+	static constexpr uint64 kMaxIdleFrames = 120;
+
+	RGTransientPool() = default;
+	~RGTransientPool() = default;
+
+	AQUILA_NONCOPYABLE(RGTransientPool);
+
+	RGTransientPool(RGTransientPool &&) = default;
+	RGTransientPool &operator=(RGTransientPool &&) = default;
+
+	// Advances the frame counter and evicts entries idle for too long.
+	void BeginFrame();
+
+	[[nodiscard]] Ref<GFX::GfxTexture> AcquireTexture(const RGTextureDesc &desc, GFX::GfxContext &ctx);
+	[[nodiscard]] Ref<GFX::GfxBuffer> AcquireBuffer(const RGBufferDesc &desc, GFX::GfxContext &ctx);
+
+	void Clear();
+
+	[[nodiscard]] uint64 GetFrameIndex() const { return m_FrameIndex; }
+	[[nodiscard]] usize GetTextureCount() const;
+	[[nodiscard]] usize GetBufferCount() const;
+
+  private:
+	struct TexEntry {
+		Ref<GFX::GfxTexture> tex;
+		RGTextureDesc desc; // debugName cleared, views do not outlive the frame
+		uint64 lastUsedFrame = 0;
+	};
+
+	struct BufEntry {
+		Ref<GFX::GfxBuffer> buf;
+		RGBufferDesc desc;
+		uint64 lastUsedFrame = 0;
+	};
+
+	[[nodiscard]] bool IsReusable(uint64 lastUsedFrame) const;
+
+	static uint64 HashDesc(const RGTextureDesc &desc);
+	static uint64 HashDesc(const RGBufferDesc &desc);
+
+	std::unordered_map<uint64, std::vector<TexEntry>> m_Textures;
+	std::unordered_map<uint64, std::vector<BufEntry>> m_Buffers;
+
+	uint64 m_FrameIndex = 0;
+};
+
+} // namespace Aquila::Graphics::RG
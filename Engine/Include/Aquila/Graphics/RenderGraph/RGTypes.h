@@ -41,6 +41,10 @@ struct RGBufferDesc {
 enum class AttachmentLoadOp : uint8 { Load, Clear, DontCare };
 enum class AttachmentStoreOp : uint8 { Store, DontCare };
 
+// Queue a pass would like to run on. AsyncCompute is a hint: it is honoured only for
+// passes without attachments and only when the device has a separate compute queue.
+enum class RGQueue : uint8 { Graphics, AsyncCompute };
+
 struct ClearColor {
 	vec4 color;
 };
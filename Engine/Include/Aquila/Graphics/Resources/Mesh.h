@@ -3,6 +3,7 @@
 
 #include "Aquila/RHI/Vertex.h"
 #include "Aquila/RHI/GPUMesh.h"
+#include "Aquila/Graphics/Resources/MeshSimplifier.h"
 #include "Aquila/Platform/Filesystem/VirtualFileSystem.h"
 
 #include "Aquila/Foundation/Math/Math.h"
@@ -22,7 +23,8 @@ class Mesh {
 
 	AQUILA_NONCOPYABLE(Mesh);
 
-	// Loading — CPU side only, no GPU involvement
+	// Loading — CPU side only, no GPU involvement. Load reads the cooked .aqmesh blob when one
+	// is current and otherwise imports with Assimp and cooks it for next time (see MeshCooker).
 	void Load(const std::string &filepath);
 	void LoadFromData(const MeshData &meshData);
 
@@ -48,19 +50,38 @@ class Mesh {
 	[[nodiscard]] const std::string &GetPath() const { return m_Path; }
 	[[nodiscard]] const std::string &GetDebugName() const { return m_DebugName; }
 	[[nodiscard]] const std::vector<RHI::Vertex> &GetVertices() const { return m_Vertices; }
+	// LOD 0 followed by every simplified level; see GetLods for the ranges.
 	[[nodiscard]] const std::vector<uint32> &GetIndices() const { return m_Indices; }
 	[[nodiscard]] const std::vector<RHI::GPUMeshPrimitive> &GetPrimitives() const { return m_Primitives; }
 	[[nodiscard]] uint32 GetVertexCount() const { return m_VertexCount; }
-	[[nodiscard]] uint32 GetIndexCount() const { return m_IndexCount; }
+	[[nodiscard]] uint32 GetIndexCount() const { return m_IndexCount; } // LOD 0 only
 	[[nodiscard]] bool HasIndexBuffer() const { return m_HasIndexBuffer; }
+	[[nodiscard]] const vec3 &GetBoundsMin() const { return m_BoundsMin; }
+	[[nodiscard]] const vec3 &GetBoundsMax() const { return m_BoundsMax; }
+	// Source material names, and for each primitive an index into them.
+	[[nodiscard]] const std::vector<std::string> &GetMaterialSlots() const { return m_MaterialSlots; }
+	[[nodiscard]] const std::vector<uint32> &GetPrimitiveMaterialSlots() const { return m_PrimitiveMaterialSlots; }
+	// Index ranges from full detail down, with errors that never decrease. Always has LOD 0.
+	[[nodiscard]] const std::vector<MeshLod> &GetLods() const { return m_Lods; }
 
   private:
+	friend class MeshCooker;
+
+	void Import(const std::string &filepath);
+	void ComputeBounds();
+	void FinishLoad();
+
 	std::string m_DebugName;
 	std::string m_Path;
 
 	std::vector<RHI::Vertex> m_Vertices;
 	std::vector<uint32> m_Indices;
 	std::vector<RHI::GPUMeshPrimitive> m_Primitives;
+	std::vector<std::string> m_MaterialSlots;
+	std::vector<uint32> m_PrimitiveMaterialSlots;
+	std::vector<MeshLod> m_Lods;
+	vec3 m_BoundsMin{ 0.f };
+	vec3 m_BoundsMax{ 0.f };
 
 	uint32 m_VertexCount = 0;
 	uint32 m_IndexCount = 0;
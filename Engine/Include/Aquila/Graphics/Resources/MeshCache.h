@@ -2,9 +2,18 @@
 #define AQUILA_MESH_CACHE_H
 
 #include "Aquila/Graphics/Resources/Mesh.h"
+#include "Aquila/Foundation/Cache/ResidentCache.h"
+#include "Aquila/Foundation/Job.h"
+#include "Aquila/Foundation/SharedConstants.h"
 
 namespace Aquila::Graphics::Resources {
 
+// MeshCache
+//
+// Shared meshes by path (or name, for generated ones). A ResidentCache underneath: meshes no
+// scene holds anymore are evicted least recently used first once the cache passes
+// MESH_CACHE_BUDGET or all resident caches pass the global budget, and are reloaded (from
+// the cooked blob) on the next Load.
 class MeshCache {
   public:
 	static MeshCache &Get() {
@@ -13,21 +22,16 @@ class MeshCache {
 	}
 
 	Ref<Mesh> Load(const std::string &filepath) {
-		{
-			std::lock_guard<std::mutex> lock(m_Mutex);
-			auto it = m_Cache.find(filepath);
-			if (it != m_Cache.end()) {
-				AQUILA_LOG_DEBUG("Mesh cache hit: {}", filepath);
-				return it->second;
-			}
+		if (auto cached = m_Cache.Find(filepath)) {
+			AQUILA_LOG_DEBUG("Mesh cache hit: {}", filepath);
+			return cached;
 		}
 
 		AQUILA_LOG_INFO("Mesh cache miss, loading: {}", filepath);
 		auto mesh = CreateRef<Mesh>(filepath);
 		try {
 			mesh->Load(filepath);
-			std::lock_guard<std::mutex> lock(m_Mutex);
-			m_Cache[filepath] = mesh;
+			m_Cache.Insert(filepath, mesh, GetResidentBytes(*mesh));
 			return mesh;
 		} catch (const std::exception &e) {
 			AQUILA_LOG_ERROR("Failed to load mesh {}: {}", filepath, e.what());
@@ -35,24 +39,20 @@ class MeshCache {
 		}
 	}
 
-	std::future<Ref<Mesh>> LoadAsync(const std::string &filepath) {
-		{
-			std::lock_guard<std::mutex> lock(m_Mutex);
-			auto it = m_Cache.find(filepath);
-			if (it != m_Cache.end()) {
-				AQUILA_LOG_DEBUG("Mesh cache hit (async): {}", filepath);
-				std::promise<Ref<Mesh>> promise;
-				promise.set_value(it->second);
-				return promise.get_future();
-			}
+	// Loads on a JobSystem worker. Use Assets::AssetManager to share in-flight loads.
+	Foundation::JobHandle<Ref<Mesh>> LoadAsync(const std::string &filepath, Priority priority = Priority::Medium) {
+		if (auto cached = m_Cache.Find(filepath)) {
+			AQUILA_LOG_DEBUG("Mesh cache hit (async): {}", filepath);
+			std::promise<Ref<Mesh>> promise;
+			promise.set_value(std::move(cached));
+			return Foundation::JobHandle<Ref<Mesh>>(promise.get_future().share());
 		}
 
-		return std::async(std::launch::async, [this, filepath]() -> Ref<Mesh> {
+		return Foundation::JobSystem::Get().Schedule(priority, "LoadMesh", [this, filepath]() -> Ref<Mesh> {
 			auto mesh = CreateRef<Mesh>(filepath);
 			try {
 				mesh->Load(filepath);
-				std::lock_guard<std::mutex> lock(m_Mutex);
-				m_Cache[filepath] = mesh;
+				m_Cache.Insert(filepath, mesh, GetResidentBytes(*mesh));
 				AQUILA_LOG_INFO("Async loaded mesh: {}", filepath);
 				return mesh;
 			} catch (const std::exception &e) {
@@ -63,64 +63,66 @@ class MeshCache {
 	}
 
 	Ref<Mesh> LoadFromData(const std::string &name, const MeshData &data) {
-		{
-			std::lock_guard<std::mutex> lock(m_Mutex);
-			auto it = m_Cache.find(name);
-			if (it != m_Cache.end()) {
-				return it->second;
-			}
+		if (auto cached = m_Cache.Find(name)) {
+			return cached;
 		}
 
 		auto mesh = CreateRef<Mesh>(name);
 		mesh->LoadFromData(data);
-		std::lock_guard<std::mutex> lock(m_Mutex);
-		m_Cache[name] = mesh;
+		m_Cache.Insert(name, mesh, GetResidentBytes(*mesh));
 		return mesh;
 	}
 
-	Ref<Mesh> Find(const std::string &filepath) const {
-		std::lock_guard<std::mutex> lock(m_Mutex);
-		auto it = m_Cache.find(filepath);
-		return it != m_Cache.end() ? it->second : nullptr;
-	}
+	// Lookup only: doesn't count towards the hit rate or mark the mesh used.
+	Ref<Mesh> Find(const std::string &filepath) const { return m_Cache.Peek(filepath); }
 
-	bool IsCached(const std::string &filepath) const {
-		std::lock_guard<std::mutex> lock(m_Mutex);
-		return m_Cache.contains(filepath);
-	}
+	bool IsCached(const std::string &filepath) const { return m_Cache.Contains(filepath); }
 
 	void Remove(const std::string &filepath) {
-		std::lock_guard<std::mutex> lock(m_Mutex);
-		auto it = m_Cache.find(filepath);
-		if (it != m_Cache.end()) {
+		if (m_Cache.Remove(filepath)) {
 			AQUILA_LOG_INFO("Removing mesh from cache: {}", filepath);
-			m_Cache.erase(it);
 		}
 	}
 
 	void Clear() {
-		std::lock_guard<std::mutex> lock(m_Mutex);
-		AQUILA_LOG_INFO("Cleared mesh cache ({} entries)", m_Cache.size());
-		m_Cache.clear();
+		AQUILA_LOG_INFO("Cleared mesh cache ({} entries)", m_Cache.Size());
+		m_Cache.Clear();
 	}
 
 	void Preload(const std::vector<std::string> &filepaths) {
 		for (const auto &filepath : filepaths) {
-			LoadAsync(filepath);
+			LoadAsync(filepath, Priority::Low);
+		}
+	}
+
+	size_t GetCacheSize() const { return m_Cache.Size(); }
+
+	void SetBudget(uint64 bytes) { m_Cache.SetBudget(bytes); }
+	[[nodiscard]] Foundation::ResidentCacheStats GetStats() const { return m_Cache.GetStats(); }
+
+	// Called by GFX::GfxMeshRegistry once it has uploaded `mesh`, with the arena bytes its copy
+	// takes. Meshes not owned by this cache (same key, other object) are left alone.
+	void SetGpuBytes(const Mesh &mesh, uint64 gpuBytes) {
+		const std::string &key = mesh.GetDebugName();
+		if (m_Cache.Peek(key).get() != &mesh) {
+			return;
 		}
+		Foundation::ResidentBytes bytes = GetResidentBytes(mesh);
+		bytes.gpu = gpuBytes;
+		m_Cache.UpdateBytes(key, bytes);
 	}
 
-	size_t GetCacheSize() const {
-		std::lock_guard<std::mutex> lock(m_Mutex);
-		return m_Cache.size();
+	// The CPU arrays only: the GPU copy is counted once GfxMeshRegistry has made it (on the
+	// first draw), through SetGpuBytes, and goes away with the mesh.
+	static Foundation::ResidentBytes GetResidentBytes(const Mesh &mesh) {
+		return { .cpu = mesh.GetVertices().size() * sizeof(RHI::Vertex) + mesh.GetIndices().size() * sizeof(uint32) };
 	}
 
   private:
 	MeshCache() = default;
 	AQUILA_NONCOPYABLE(MeshCache);
 
-	std::unordered_map<std::string, Ref<Mesh>> m_Cache;
-	mutable std::mutex m_Mutex;
+	Foundation::ResidentCache<std::string, Mesh> m_Cache{ "Meshes", SharedConstants::MESH_CACHE_BUDGET };
 };
 
 } // namespace Aquila::Graphics::Resources
@@ -0,0 +1,35 @@
+#ifndef AQUILA_MESH_COOKER_H
+#define AQUILA_MESH_COOKER_H
+
+#include "Aquila/Foundation/PrimitiveTypes.h"
+
+namespace Aquila::Graphics::Resources {
+
+class Mesh;
+
+// MeshCooker
+//
+// Turns source meshes (anything Assimp imports) into versioned .aqmesh blobs under
+// <user cache>/meshes, named after both the source's virtual and on-disk path: a fixed
+// header with counts and bounds, the primitive table with material slots, the LOD table,
+// then the vertex and index arrays exactly as Mesh holds them (simplified LODs included, so
+// they are generated once per source). Loading one is a single file read and a few copies,
+// with no importer or post-processing involved.
+//
+// A blob records the size and write time of the source it came from and is ignored once
+// either changes, or when the format version or vertex layout no longer matches.
+class MeshCooker {
+  public:
+	// Imports `sourcePath` and writes its blob, for cooking ahead of time (`AquilaEngine --cook`).
+	// Returns false if the import or the write fails.
+	static bool Cook(const std::string &sourcePath);
+
+	// Fills `mesh` from a current blob. False if there is none, it is stale or unreadable.
+	static bool TryLoad(const std::string &sourcePath, Mesh &mesh);
+	static bool Store(const std::string &sourcePath, const Mesh &mesh);
+
+	[[nodiscard]] static std::string GetCookedPath(const std::string &sourcePath);
+};
+
+} // namespace Aquila::Graphics::Resources
+#endif
@@ -0,0 +1,42 @@
+#ifndef AQUILA_MESH_SIMPLIFIER_H
+#define AQUILA_MESH_SIMPLIFIER_H
+
+#include "Aquila/RHI/Vertex.h"
+#include "Aquila/RHI/GPUMesh.h"
+
+namespace Aquila::Graphics::Resources {
+
+// One level of detail: a run of the mesh's index buffer over the shared vertex buffer.
+struct MeshLod {
+	uint32 firstIndex = 0;
+	uint32 indexCount = 0;
+	f32 error = 0.F; // largest deviation from the full mesh, in object-space units
+};
+
+// MeshSimplifier
+//
+// Quadric edge-collapse simplification (Garland & Heckbert). Every collapse moves a vertex
+// onto one of its neighbours instead of a new optimal point, so a simplified mesh is only a
+// new index list over the original vertices and every LOD shares one vertex buffer.
+//
+// Vertices that share a position but not attributes (UV or normal seams) collapse as one, and
+// only along the seam, so seams don't tear. Open borders only collapse along themselves, and
+// collapses that would flip a triangle are skipped.
+class MeshSimplifier {
+  public:
+	// Reduces `indices` (a triangle list into `vertices`) towards `targetIndexCount`, stopping
+	// early once the next collapse would exceed `maxError` (object-space units). Returns the
+	// error reached.
+	static f32 Simplify(std::span<const RHI::Vertex> vertices, std::vector<uint32> &indices, usize targetIndexCount,
+						f32 maxError = std::numeric_limits<f32>::max());
+
+	// Appends up to `maxLods - 1` levels, each aiming for half the triangles of the one before,
+	// to `indices` and returns the whole chain, LOD 0 (the indices as given) first. Primitives
+	// are simplified on their own, so every LOD covers all of them in the same order. The chain
+	// stops once a level saves too little to be worth storing.
+	static std::vector<MeshLod> GenerateLods(std::span<const RHI::Vertex> vertices, std::vector<uint32> &indices,
+											 std::span<const RHI::GPUMeshPrimitive> primitives, uint32 maxLods);
+};
+
+} // namespace Aquila::Graphics::Resources
+#endif
@@ -15,8 +15,7 @@ struct ShaderStage {
 	RHI::ShaderStageFlags stage;
 	std::vector<uint32> spirv;
 	std::string entryPointName;
-	Slang::ComPtr<slang::IComponentType> linkedComponent;
-	Slang::ComPtr<slang::ISession> session;
+	std::vector<RHI::VulkanReflectedParameter> parameters;
 };
 
 class ShaderProgram {
@@ -49,8 +48,11 @@ class ShaderProgram {
 
 	AQUILA_NONCOPYABLE(ShaderProgram);
 
-	bool AddStageFromSlang(const std::string &slangPath, std::string &errorLog);
+	bool AddStageFromSlang(const std::string &slangPath, std::string &errorLog,
+						   std::vector<std::string> *outDependencies = nullptr);
 	bool Reload(std::string &errorLog, Ref<GFX::GfxDescriptorSetLayout> &outNewLayout);
+	// Swaps in stages compiled elsewhere (e.g. on a worker) and reflects a layout for them.
+	bool ApplyCompiled(std::vector<RHI::VulkanCompiledStage> compiled, Ref<GFX::GfxDescriptorSetLayout> &outNewLayout);
 	void CommitNewLayout(Ref<GFX::GfxDescriptorSetLayout> newLayout);
 	bool Reflect();
 	void Cleanup();
@@ -88,10 +90,8 @@ class ShaderProgram {
 		bool occupied = false;
 	};
 
-	static bool SlangTypeToDescriptor(slang::TypeLayoutReflection *typeLayout, RHI::DescriptorType &outType,
-									  ReflectedBindingType &outReflectedType);
-
-	void ProcessBinding(slang::VariableLayoutReflection *var, RHI::ShaderStageFlags stageFlags,
+	void SetStages(std::vector<RHI::VulkanCompiledStage> compiled);
+	void ProcessBinding(const RHI::VulkanReflectedParameter &param, RHI::ShaderStageFlags stageFlags,
 						std::map<uint32, std::map<uint32, BindingInfo>> &sets);
 
 	bool ReflectInto(Ref<GFX::GfxDescriptorSetLayout> &outLayout);
@@ -1,17 +1,24 @@
 #ifndef AQUILA_SHADER_WATCHER_H
 #define AQUILA_SHADER_WATCHER_H
 
-#include "Aquila/Platform/Filesystem/VirtualFileSystem.h"
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/Platform/Filesystem/FileWatcher.h"
 
 namespace Aquila::Graphics::Shader {
 
 struct WatchedShader {
 	std::string slangPath; // original path as supplied (VFS or native)
-	std::string programName;
-	uint64 lastModified = 0;
-	bool isNative = false; // true = bypass VFS, use std::filesystem directly
+	std::vector<std::string> files; // native files whose writes reload the program, normalized
+	uint64 lastModified = 0;        // VFS sources only
+	bool isNative = false;          // true = the source itself is watched through the FileWatcher
 };
 
+// ShaderWatcher
+//
+// Maps file change notifications to the programs that need recompiling. A program depends on
+// its own source and on every file its last compile read (imports and includes), so saving a
+// shared header reloads everything built from it. Native files go through a FileWatcher;
+// sources that only exist behind the VFS are still polled by write time.
 class ShaderWatcher {
   public:
 	ShaderWatcher() = default;
@@ -22,97 +29,31 @@ class ShaderWatcher {
 	// Accepts either:
 	//   - A VFS virtual path  (e.g. "assets://Shaders/GBuffer.slang")
 	//   - A native absolute path (e.g. "C:/Programming/Aquila/Engine/Shaders/GBuffer.slang")
-	void WatchSlangFile(const std::string &slangPath, const std::string &programName) {
-		bool native = IsNativePath(slangPath);
+	// `dependencies` are the native paths the compiler reported for it.
+	void WatchSlangFile(const std::string &slangPath, const std::string &programName,
+						const std::vector<std::string> &dependencies = {});
 
-		if (native) {
-			if (!std::filesystem::exists(slangPath)) {
-				AQUILA_LOG_WARNING("ShaderWatcher: cannot watch non-existent file '{}'", slangPath);
-				return;
-			}
-			uint64 lastWrite = NativeLastWriteTime(slangPath);
-			m_WatchedFiles[slangPath] = { .slangPath = slangPath,
-										  .programName = programName,
-										  .lastModified = lastWrite,
-										  .isNative = true };
-		} else {
-			auto *vfs = Platform::Filesystem::VirtualFileSystem::Get();
-			if (!vfs->Exists(slangPath)) {
-				AQUILA_LOG_WARNING("ShaderWatcher: cannot watch non-existent VFS file '{}'", slangPath);
-				return;
-			}
-			m_WatchedFiles[slangPath] = { .slangPath = slangPath,
-										  .programName = programName,
-										  .lastModified = vfs->GetLastWriteTime(slangPath),
-										  .isNative = false };
-		}
+	// Replaces a program's dependencies after a recompile, since its imports may have changed.
+	void SetDependencies(const std::string &programName, const std::vector<std::string> &dependencies);
 
-		AQUILA_LOG_INFO("ShaderWatcher: watching '{}' ({}) -> program '{}'", slangPath, native ? "native" : "VFS",
-						programName);
-	}
-
-	void Unwatch(const std::string &slangPath) { m_WatchedFiles.erase(slangPath); }
-	void Clear() { m_WatchedFiles.clear(); }
+	void Unwatch(const std::string &programName);
+	void Clear();
 
 	// Returns the set of program names that need to be reloaded.
-	std::unordered_set<std::string> CheckForChanges() {
-		if (!m_Enabled) {
-			return {};
-		}
-
-		std::unordered_set<std::string> changed;
-		auto *vfs = Platform::Filesystem::VirtualFileSystem::Get();
-
-		for (auto &[path, watch] : m_WatchedFiles) {
-			uint64 current = 0;
+	std::unordered_set<std::string> CheckForChanges();
 
-			if (watch.isNative) {
-				if (!std::filesystem::exists(path)) {
-					continue;
-				}
-				current = NativeLastWriteTime(path);
-			} else {
-				if (!vfs->Exists(path)) {
-					continue;
-				}
-				current = vfs->GetLastWriteTime(path);
-			}
-
-			if (current > watch.lastModified) {
-				AQUILA_LOG_INFO("ShaderWatcher: '{}' modified, queuing reload of program '{}'", path,
-								watch.programName);
-				watch.lastModified = current;
-				changed.insert(watch.programName);
-			}
-		}
-
-		return changed;
-	}
+	// See FileWatcher::SetWakeCallback; only native files wake, VFS sources wait for a tick.
+	void SetWakeCallback(std::function<void()> callback) { m_FileWatcher.SetWakeCallback(std::move(callback)); }
 
   private:
-	// A path is treated as native if it is an absolute filesystem path
-	// (starts with a drive letter on Windows, or '/' on Unix) and does NOT
-	// contain "://" which is the VFS scheme separator.
-	static bool IsNativePath(const std::string &path) {
-		if (path.find("://") != std::string::npos) {
-			return false; // VFS virtual path
-		}
-
-		// std::filesystem considers "C:\..." and "/home/..." as absolute
-		return std::filesystem::path(path).is_absolute();
-	}
+	static bool IsNativePath(const std::string &path);
 
-	static uint64 NativeLastWriteTime(const std::string &path) {
-		std::error_code ec;
-		auto ftime = std::filesystem::last_write_time(path, ec);
-		if (ec) {
-			return 0;
-		}
-		// Convert to a plain integer comparable across calls
-		return static_cast<uint64>(ftime.time_since_epoch().count());
-	}
+	void AddFile(const std::string &programName, const std::string &path);
+	void RemoveFiles(const std::string &programName);
 
-	std::unordered_map<std::string, WatchedShader> m_WatchedFiles;
+	std::unordered_map<std::string, WatchedShader> m_Programs;                      // by program name
+	std::unordered_map<std::string, std::unordered_set<std::string>> m_FileUsers; // file -> program names
+	Platform::Filesystem::FileWatcher m_FileWatcher;
 	bool m_Enabled = false;
 };
 
@@ -3,6 +3,11 @@
 
 namespace Aquila::Graphics {
 
+// Texture slots of a surface, in GpuSurfaceData::textureIndices order.
+enum class SurfaceTexture : uint8 { Albedo, Normal, MetallicRoughness, Emissive, Count };
+
+constexpr uint32 kNoBindlessTexture = UINT32_MAX;
+
 struct alignas(16) GpuSurfaceData {
 	vec4 albedo{ 1.f, 1.f, 1.f, 1.f };
 	vec4 emissive{ 0.f, 0.f, 0.f, 0.f };
@@ -11,8 +16,9 @@ struct alignas(16) GpuSurfaceData {
 	f32 normalStrength = 1.f;
 	f32 aoStrength = 1.f;
 	vec4 extra0{ 0.f };
-	vec4 extra1{ 0.f };
+	uvec4 textureIndices{ kNoBindlessTexture }; // bindless array slots, see SurfaceTexture
 };
+static_assert(static_cast<uint32>(SurfaceTexture::Count) == 4, "one textureIndices lane per SurfaceTexture");
 static_assert(sizeof(GpuSurfaceData) == 80, "GpuSurfaceData must be 80 bytes (std430)");
 
 } // namespace Aquila::Graphics
@@ -0,0 +1,38 @@
+#ifndef AQUILA_BLOCK_COMPRESSOR_H
+#define AQUILA_BLOCK_COMPRESSOR_H
+
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/RHI/Backend/RHITypes.h"
+
+namespace Aquila::Graphics::Texture {
+
+// BlockCompressor
+//
+// CPU encoders for the BCn formats cooked textures are stored in. Each works on one 4x4
+// block at a time; Compress runs them over a whole image, replicating edge texels into
+// partial blocks. Inputs are RGBA8 (row-major, 4 bytes per texel) for everything but BC6H,
+// which takes RGBA32F and ignores alpha.
+//
+// Endpoints are fitted along the principal axis of the block's colors and then refined by
+// least squares against the chosen indices. BC7 only uses mode 6 (one subset, RGBA, 4-bit
+// indices) and BC6H only mode 11 (one region, 10-bit endpoints): the multi-partition modes
+// would gain a little quality on blocks with sharp edges for many times the encode time.
+class BlockCompressor {
+  public:
+	static constexpr uint32 BlockDim = 4;
+
+	static void EncodeBC1(const uint8 rgba[64], uint8 out[8]); // opaque, 4-color mode
+	static void EncodeBC3(const uint8 rgba[64], uint8 out[16]);
+	static void EncodeBC4(const uint8 values[16], uint8 out[8]);
+	static void EncodeBC5(const uint8 rgba[64], uint8 out[16]); // red and green
+	static void EncodeBC7(const uint8 rgba[64], uint8 out[16]);
+	static void EncodeBC6H(const f32 rgba[64], uint8 out[16]); // unsigned, negatives clamp to 0
+
+	// Encodes a whole `width` x `height` image. `format` picks the encoder; sRGB variants
+	// encode the bytes as given, the format only tells the sampler how to read them.
+	static std::vector<uint8> Compress(const uint8 *rgba, uint32 width, uint32 height, RHI::TextureFormat format);
+	static std::vector<uint8> CompressBC6H(const f32 *rgba, uint32 width, uint32 height);
+};
+
+} // namespace Aquila::Graphics::Texture
+#endif
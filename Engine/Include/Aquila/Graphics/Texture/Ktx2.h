@@ -0,0 +1,38 @@
+#ifndef AQUILA_KTX2_H
+#define AQUILA_KTX2_H
+
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/RHI/Backend/RHITypes.h"
+
+namespace Aquila::Graphics::Texture {
+
+// A 2D texture with its mip chain, ready for GfxContext::UploadTextureData: `data` holds every
+// level tightly packed, level 0 first.
+struct Ktx2Texture {
+	RHI::TextureFormat format = RHI::TextureFormat::None;
+	uint32 width = 0;
+	uint32 height = 0;
+	uint32 levelCount = 0;
+	std::vector<uint8> data;
+	// Key/value metadata, kept sorted by key as the container requires.
+	std::vector<std::pair<std::string, std::vector<uint8>>> keyValues;
+
+	[[nodiscard]] bool IsValid() const { return format != RHI::TextureFormat::None && levelCount > 0; }
+	[[nodiscard]] const std::vector<uint8> *FindValue(std::string_view key) const;
+};
+
+// Ktx2
+//
+// Reads and writes the subset of KTX 2.0 cooked textures use: one 2D image (no layers, faces
+// or depth), any number of mips, no supercompression, and a basic data format descriptor for
+// the formats in RHI::TextureFormat that cooking produces. The payload is stored exactly as the
+// GPU consumes it, so loading one is a read and a copy per level.
+class Ktx2 {
+  public:
+	[[nodiscard]] static std::vector<uint8> Write(const Ktx2Texture &texture);
+	// False if `file` is not a KTX2 file this reader supports or is inconsistent.
+	static bool Read(std::span<const uint8> file, Ktx2Texture &out);
+};
+
+} // namespace Aquila::Graphics::Texture
+#endif
@@ -0,0 +1,26 @@
+#ifndef AQUILA_MIP_GENERATOR_H
+#define AQUILA_MIP_GENERATOR_H
+
+#include "Aquila/Foundation/PrimitiveTypes.h"
+
+namespace Aquila::Graphics::Texture {
+
+// How texel values average when a level is halved.
+enum class MipFilter : uint8 {
+	Linear,	   // plain average per channel
+	Srgb,	   // RGB averaged in linear light, alpha as is
+	NormalMap, // RGB decoded to a unit vector, averaged and renormalized
+};
+
+// MipGenerator
+//
+// Builds full mip chains on the CPU with a 2x2 box filter, down to 1x1. Level 0 is the input
+// itself; each level is tightly packed RGBA (4 channels per texel) at max(size >> level, 1).
+class MipGenerator {
+  public:
+	static std::vector<std::vector<uint8>> Generate(const uint8 *rgba, uint32 width, uint32 height, MipFilter filter);
+	static std::vector<std::vector<f32>> Generate(const f32 *rgba, uint32 width, uint32 height);
+};
+
+} // namespace Aquila::Graphics::Texture
+#endif
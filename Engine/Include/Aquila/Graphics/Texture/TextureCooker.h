@@ -0,0 +1,54 @@
+#ifndef AQUILA_TEXTURE_COOKER_H
+#define AQUILA_TEXTURE_COOKER_H
+
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/Graphics/Texture/Ktx2.h"
+
+namespace Aquila::Graphics::Texture {
+
+// What a texture holds, which decides how its mips are filtered and what it is encoded to.
+enum class TextureKind : uint8 {
+	Color,	   // sRGB albedo / emissive: BC7 sRGB
+	Data,	   // linear masks, metallic-roughness: BC7
+	NormalMap, // tangent-space normals: BC5, z is rebuilt in the shader (SampleSurfaceNormal)
+	HDR,	   // float images, environment maps: BC6H
+};
+
+struct TextureCookSettings {
+	TextureKind kind = TextureKind::Color;
+	// Off when the device lacks BC support; levels are then stored as RGBA8 (RGBA16F for HDR).
+	bool compress = true;
+	// Color and Data only: BC1 when opaque, BC3 otherwise, instead of BC7. Half the size for
+	// opaque textures at visibly lower quality on smooth gradients.
+	bool compact = false;
+};
+
+// TextureCooker
+//
+// Turns source images (anything stb_image decodes) into KTX2 files under <user cache>/textures:
+// a full mip chain, block-compressed per TextureCookSettings. Loading a cooked texture is a
+// file read; no decoding, filtering or encoding happens at runtime.
+//
+// Like MeshCooker, a cooked file records the size and write time of its source and is ignored
+// once either changes or the cooker version moves on. Each settings combination cooks to its
+// own file.
+class TextureCooker {
+  public:
+	// Imports `sourcePath` and writes its cooked file, for cooking ahead of time.
+	static bool Cook(const std::string &sourcePath, const TextureCookSettings &settings);
+
+	// The cooked texture if current, otherwise imports and stores it. False if the source
+	// can't be decoded.
+	static bool Load(const std::string &sourcePath, const TextureCookSettings &settings, Ktx2Texture &out);
+
+	// Fills `out` from a current cooked file. False if there is none, it is stale or unreadable.
+	static bool TryLoad(const std::string &sourcePath, const TextureCookSettings &settings, Ktx2Texture &out);
+	// Decodes the source, builds its mips and encodes them.
+	static bool Import(const std::string &sourcePath, const TextureCookSettings &settings, Ktx2Texture &out);
+	static bool Store(const std::string &sourcePath, const TextureCookSettings &settings, const Ktx2Texture &texture);
+
+	[[nodiscard]] static std::string GetCookedPath(const std::string &sourcePath, const TextureCookSettings &settings);
+};
+
+} // namespace Aquila::Graphics::Texture
+#endif
@@ -4,11 +4,23 @@
 #include "Aquila/Platform/Filesystem/VirtualFileSystem.h"
 #include "Aquila/Foundation/PrimitiveTypes.h"
 #include "Aquila/RHI/Backend/RHITypes.h"
+#include "Aquila/Graphics/Texture/TextureCooker.h"
+
+namespace Aquila::GFX {
+class GfxContext;
+class GfxTexture;
+} // namespace Aquila::GFX
 
 namespace Aquila::Graphics::Texture {
 
 class TextureLoader {
   public:
+	// Decoded pixels stay in the buffer stb_image allocated them in.
+	struct StbiDeleter {
+		void operator()(void *pixels) const;
+	};
+	template <typename T> using StbiPixels = std::unique_ptr<T[], StbiDeleter>;
+
 	struct ImageData {
 		Unique<f32[]> pixels;
 		uint32 width = 0;
@@ -18,7 +30,7 @@ class TextureLoader {
 	};
 
 	struct RawImageData {
-		Unique<uint8[]> pixels;
+		StbiPixels<uint8> pixels;
 		uint32 width = 0;
 		uint32 height = 0;
 		uint32 channels = 0;
@@ -28,7 +40,7 @@ class TextureLoader {
 	};
 
 	struct RawHDRData {
-		Unique<f32[]> pixels;
+		StbiPixels<f32> pixels;
 		uint32 width = 0;
 		uint32 height = 0;
 		uint32 channels = 0;
@@ -43,6 +55,19 @@ class TextureLoader {
 	RawImageData LoadFromVFS(const std::string &filepath);
 	RawHDRData LoadHDRFromFile(const std::string &filepath);
 
+	enum class Upload : uint8 {
+		Immediate, // submitted and waited for before returning
+		Batched, // queued on the context's GfxUploadBatcher, resident from the next frame; worker-safe
+	};
+
+	// Cooked path: the source's KTX2 from the texture cache (cooking it first if missing or
+	// stale), block-compressed when the device samples BC formats. Null if it can't be decoded.
+	static Ref<GFX::GfxTexture> Load(GFX::GfxContext &ctx, const std::string &filepath, TextureKind kind,
+									 Upload upload = Upload::Immediate);
+	// Creates a sampled texture with all of `texture`'s mips and uploads them in one go.
+	static Ref<GFX::GfxTexture> CreateTexture(GFX::GfxContext &ctx, const Ktx2Texture &texture,
+											  const std::string &debugName, Upload upload = Upload::Immediate);
+
   private:
 	static std::array<uint8, 4> ColorToPixel(vec4 color);
 };
@@ -0,0 +1,65 @@
+#ifndef AQUILA_FILE_WATCHER_H
+#define AQUILA_FILE_WATCHER_H
+
+#include "Aquila/Foundation/Defines.h"
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include <thread>
+
+namespace Aquila::Platform::Filesystem {
+
+// FileWatcher
+//
+// Reports changes to a set of native files without stat'ing each of them every frame. On
+// Linux one inotify watch per directory delivers close-after-write and rename-into-place
+// events for the watched names; watching the directory rather than the file keeps working
+// when an editor saves by renaming a temp file over the original. Poll() drains whatever is
+// queued and never blocks. Other platforms fall back to comparing write times in Poll().
+//
+// Poll() only runs when its owner ticks, so an event loop blocked waiting for input would not
+// see a save until the next input event. A wake callback, if set, is called from a background
+// thread as soon as inotify has something queued, once per batch: the next Poll() re-arms it.
+//
+// Paths are reported the way Normalize() spells them, absolute with forward slashes.
+class FileWatcher {
+  public:
+	FileWatcher();
+	~FileWatcher();
+
+	AQUILA_NONCOPYABLE(FileWatcher);
+	AQUILA_NONMOVEABLE(FileWatcher);
+
+	bool Watch(const std::string &path);
+	void Unwatch(const std::string &path);
+	void Clear();
+	[[nodiscard]] bool IsWatching(const std::string &path) const;
+
+	// Watched files written since the last call, each listed once.
+	std::vector<std::string> Poll();
+
+	// Called off the main thread, so it must be thread-safe. Linux only; a no-op elsewhere.
+	void SetWakeCallback(std::function<void()> callback);
+
+	static std::string Normalize(const std::string &path);
+
+  private:
+	struct Directory {
+		int32 descriptor = -1;
+		std::unordered_set<std::string> names;
+	};
+
+	std::vector<std::string> PollWriteTimes();
+	void StopWakeThread();
+	void WakeLoop(const std::stop_token &stop);
+
+	std::unordered_map<std::string, Directory> m_Directories;
+	std::unordered_map<int32, std::string> m_DirectoryByDescriptor;
+	std::unordered_map<std::string, int64> m_WriteTimes; // fallback only
+	int32 m_Handle = -1;
+
+	std::function<void()> m_WakeCallback;
+	std::atomic<bool> m_WakePending{ false }; // the callback fired and Poll() has not drained yet
+	std::jthread m_WakeThread;
+};
+
+} // namespace Aquila::Platform::Filesystem
+#endif // AQUILA_FILE_WATCHER_H
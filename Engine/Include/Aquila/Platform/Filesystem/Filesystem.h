@@ -22,6 +22,16 @@ bool FileRemove(const std::string &path);
 bool FileMove(const std::string &from, const std::string &to);
 std::vector<std::string> DirList(const std::string &path, bool recursive = false);
 
+// Per-user directory for caches that can be rebuilt (pipeline cache, cooked assets).
+// Created on first use.
+std::string DirGetUserCache();
+
+// Whole-file binary helpers. FileWriteAtomic writes a uniquely named sibling temp file and
+// renames it over `path`, so a crash mid-write leaves the previous contents intact and
+// concurrent writers of the same file never interleave.
+bool FileReadAll(const std::string &path, std::vector<uint8> &out);
+bool FileWriteAtomic(const std::string &path, const void *data, usize size);
+
 // Helpers
 std::string PathToAbsolute(const std::string &path);
 std::string PathExtension(const std::string &path);
@@ -30,6 +30,8 @@ class IFileSystem {
 	// Filesystem properties
 	[[nodiscard]] virtual bool IsReadOnly() const = 0;
 	[[nodiscard]] virtual std::string GetDisplayName() const = 0;
+	// Where `path` lives on disk, or empty for file systems not backed by one.
+	[[nodiscard]] virtual std::string GetNativePath(const std::string & /*path*/) const { return {}; }
 };
 } // namespace Aquila::Platform::Filesystem
 
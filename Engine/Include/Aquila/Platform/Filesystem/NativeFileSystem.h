@@ -35,6 +35,7 @@ class NativeFileSystem final : public IFileSystem {
 
 	[[nodiscard]] bool IsReadOnly() const override { return false; }
 	[[nodiscard]] std::string GetDisplayName() const override { return "Native: " + m_RootPath; }
+	[[nodiscard]] std::string GetNativePath(const std::string &path) const override { return ResolvePath(path); }
 };
 
 } // namespace Aquila::Platform::Filesystem
@@ -36,6 +36,8 @@ class VirtualFileSystem : public Foundation::Singleton<VirtualFileSystem> {
 	bool IsDirectory(const std::string &virtualPath);
 	int64 GetFileSize(const std::string &virtualPath);
 	uint64 GetLastWriteTime(const std::string &virtualPath);
+	// The on-disk path `virtualPath` resolves to; empty if it is unmounted or not on disk.
+	std::string GetNativePath(const std::string &virtualPath);
 
 	bool CopyFileA(const std::string &srcVirtualPath, const std::string &dstVirtualPath);
 	bool CreateDir(const std::string &virtualPath);
@@ -9,6 +9,32 @@
 
 namespace Aquila::RHI {
 
+// One entry of a batched PipelineBarrier call. The scopes say which kind of pass
+// produced / consumes the resource, so shader stages can be narrowed.
+//
+// srcQueue != dstQueue marks a queue hand-off: the same entry is recorded twice, once
+// on a list of the source queue (release half) and once on a list of the destination
+// queue (acquire half), with a semaphore wait in between.
+struct TextureBarrier {
+	IRHITexture *texture = nullptr;
+	ResourceState oldState = ResourceState::Undefined;
+	ResourceState newState = ResourceState::Undefined;
+	PipelineScope srcScope = PipelineScope::All;
+	PipelineScope dstScope = PipelineScope::All;
+	CommandListType srcQueue = CommandListType::Graphics;
+	CommandListType dstQueue = CommandListType::Graphics;
+};
+
+struct BufferBarrier {
+	IRHIBuffer *buffer = nullptr;
+	ResourceState oldState = ResourceState::Undefined;
+	ResourceState newState = ResourceState::Undefined;
+	PipelineScope srcScope = PipelineScope::All;
+	PipelineScope dstScope = PipelineScope::All;
+	CommandListType srcQueue = CommandListType::Graphics;
+	CommandListType dstQueue = CommandListType::Graphics;
+};
+
 class IRHICommandList {
   public:
 	virtual ~IRHICommandList() = default;
@@ -27,6 +53,14 @@ class IRHICommandList {
 	virtual void TransitionTexture(IRHITexture &texture, ResourceState oldState, ResourceState newState) = 0;
 	virtual void TransitionBuffer(IRHIBuffer &buffer, ResourceState oldState, ResourceState newState) = 0;
 
+	// Records every transition in one barrier command. Duplicate resources are folded and
+	// transitions that guard no hazard are dropped, so callers can pass raw tables.
+	virtual void PipelineBarrier(std::span<const TextureBarrier> textures, std::span<const BufferBarrier> buffers) = 0;
+
+	// Makes the next submission of this list wait until `wait.queue` has reached `wait.value`
+	// on its timeline. Waits are consumed by the submit.
+	virtual void WaitForQueue(const QueueWait &wait) = 0;
+
 	// Binding a pipeline also captures the pipeline layout, which is required for
 	// subsequent BindDescriptorSet and PushConstants calls.
 
@@ -35,7 +69,9 @@ class IRHICommandList {
 							 float maxDepth = 1.0f) = 0;
 	virtual void SetScissor(int32 x, int32 y, uint32 width, uint32 height) = 0;
 
-	virtual void BindDescriptorSet(uint32 set, IRHIDescriptorSet &descriptorSet) = 0;
+	// One offset per dynamic buffer binding in the set, in binding order.
+	virtual void BindDescriptorSet(uint32 set, IRHIDescriptorSet &descriptorSet,
+								   std::span<const uint32> dynamicOffsets = {}) = 0;
 	virtual void PushConstants(const void *data, uint32 size, ShaderStageFlags stages, uint32 offset = 0) = 0;
 	virtual void BindVertexBuffer(IRHIBuffer &buffer, uint32 binding = 0, uint64 offset = 0) = 0;
 	virtual void BindIndexBuffer(IRHIBuffer &buffer, IndexFormat format = IndexFormat::UInt32, uint64 offset = 0) = 0;
@@ -48,7 +84,7 @@ class IRHICommandList {
 	virtual void DrawIndexedIndirect(IRHIBuffer &buffer, uint64 offset, uint32 drawCount, uint32 stride) = 0;
 
 	virtual void CopyBufferToTexture(IRHIBuffer &src, IRHITexture &dst, uint32 width, uint32 height,
-									 uint32 dstArrayLayer = 0, uint32 dstMipLevel = 0) = 0;
+									 uint32 dstArrayLayer = 0, uint32 dstMipLevel = 0, uint64 srcOffset = 0) = 0;
 
 	virtual void FillBuffer(IRHIBuffer &buffer, uint64 offset, uint64 size, uint32 value) = 0;
 
@@ -57,6 +93,10 @@ class IRHICommandList {
 	virtual void PushDebugGroup(const char *name) = 0;
 	virtual void PopDebugGroup() = 0;
 
+	// Replays already-recorded secondary lists, in order, inside the current render pass.
+	virtual void ExecuteSecondary(std::span<IRHICommandList *const> secondaries) = 0;
+	[[nodiscard]] virtual bool IsSecondary() const = 0;
+
   protected:
 	IRHICommandList() = default;
 };
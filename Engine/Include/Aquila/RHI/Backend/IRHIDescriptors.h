@@ -32,7 +32,7 @@ class IRHIDescriptorSet {
 	IRHIDescriptorSet &operator=(const IRHIDescriptorSet &) = delete;
 
 	virtual void SetBuffer(uint32 binding, IRHIBuffer &buffer, uint64 offset = 0, uint64 range = 0) = 0;
-	virtual void SetTexture(uint32 binding, IRHITexture &texture) = 0;
+	virtual void SetTexture(uint32 binding, IRHITexture &texture, uint32 arrayElement = 0) = 0;
 	virtual void Flush() = 0;
 
   protected:
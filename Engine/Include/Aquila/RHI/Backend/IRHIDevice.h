@@ -27,6 +27,17 @@ class IRHIDevice {
 	[[nodiscard]] virtual Unique<IRHICommandList> CreateCommandList(CommandListType type,
 																	const std::string &name = "") = 0;
 	[[nodiscard]] virtual Unique<IRHICommandList> CreateFrameCommandList(uint32 slot) = 0;
+	// Secondary lists come from a per-thread, per-frame pool and are recycled when the
+	// frame slot comes around again, so call this on the thread that will record it and
+	// don't keep the list past the frame.
+	[[nodiscard]] virtual Unique<IRHICommandList> CreateSecondaryCommandList(const SecondaryCommandListDesc &desc) = 0;
+	// Async compute lists come from a per-frame pool on the compute queue and, like
+	// secondaries, must not outlive the frame they were created in.
+	[[nodiscard]] virtual Unique<IRHICommandList> CreateAsyncComputeCommandList() = 0;
+	// Upload lists are transfer lists from a pool of their own, so recording them never races
+	// with other transfer lists. The caller serializes creating and recording them and may
+	// Begin a list again once its last submission has completed.
+	[[nodiscard]] virtual Unique<IRHICommandList> CreateUploadCommandList(const std::string &name) = 0;
 	[[nodiscard]] virtual Unique<IRHISwapchain> CreateSwapchain(const SwapchainDesc &desc) = 0;
 	[[nodiscard]] virtual Unique<IRHIRenderPass> CreateRenderPass(const RHI::RenderPassDesc &desc) = 0;
 	[[nodiscard]] virtual Unique<IRHIPipeline> CreateGraphicsPipeline(const GraphicsPipelineDesc &desc) = 0;
@@ -34,11 +45,33 @@ class IRHIDevice {
 	[[nodiscard]] virtual Unique<IRHIDescriptorSetLayout>
 	CreateDescriptorSetLayout(const DescriptorSetLayoutDesc &desc) = 0;
 	[[nodiscard]] virtual Unique<IRHIDescriptorSet> AllocateDescriptorSet(IRHIDescriptorSetLayout &layout) = 0;
+	// True when DescriptorBinding::partiallyBound is honoured; otherwise every array element
+	// of a binding the shader uses must hold a valid descriptor.
+	[[nodiscard]] virtual bool SupportsDescriptorIndexing() const = 0;
+	// True when the BC1-BC7 TextureFormats can be created and sampled.
+	[[nodiscard]] virtual bool SupportsBlockCompression() const = 0;
 	virtual void CopyBuffer(IRHICommandList &cmd, IRHIBuffer &src, IRHIBuffer &dst, uint64 size, uint64 srcOffset = 0,
 							uint64 dstOffset = 0) = 0;
 	virtual void Submit(IRHICommandList &cmd) = 0;
 	virtual void SubmitFrame(IRHICommandList &cmd, IRHISwapchain *swapchain = nullptr, uint32 imageIndex = 0) = 0;
 	virtual void SubmitAndWait(IRHICommandList &cmd) = 0;
+
+	// Queue timelines. Every submission through the calls below (and SubmitFrame) signals
+	// its queue's timeline; the returned value can be handed to WaitForQueue on a list
+	// of the other queue.
+	[[nodiscard]] virtual bool HasAsyncCompute() const = 0;
+	// Ends and submits an async compute list. Returns the compute timeline value it signals.
+	virtual uint64 SubmitAsyncCompute(IRHICommandList &cmd) = 0;
+	// Ends and submits a transfer list without waiting. Returns the transfer timeline value it signals.
+	virtual uint64 SubmitTransfer(IRHICommandList &cmd) = 0;
+	// Submits what the frame list recorded so far and keeps recording into a fresh buffer
+	// from the same frame pool. Returns the graphics timeline value the flushed part signals.
+	virtual uint64 FlushFrameCommandList(IRHICommandList &cmd) = 0;
+	[[nodiscard]] virtual uint64 GetLastSubmittedValue(CommandListType queue) const = 0;
+	// Highest value the GPU has signalled on the queue's timeline.
+	[[nodiscard]] virtual uint64 GetCompletedValue(CommandListType queue) const = 0;
+	// Blocks the calling thread until the queue's timeline reaches `value`.
+	virtual void WaitForTimeline(CommandListType queue, uint64 value) = 0;
 	virtual void PresentFrame(IRHISwapchain &swapchain, uint32 imageIndex,
 							  vec4 clearColor = { 0.0f, 0.0f, 0.0f, 1.0f }) = 0;
 	virtual void WaitIdle() = 0;
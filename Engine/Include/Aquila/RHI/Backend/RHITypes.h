@@ -39,6 +39,16 @@ enum class TextureFormat : uint8 {
 	Depth32,
 	Depth24Stencil8,
 	Depth32Stencil8,
+
+	// Block-compressed (4x4 texel blocks), only sampled and only with SupportsBlockCompression()
+	BC1_RGBA,
+	BC1_RGBA_SRGB,
+	BC3_RGBA,
+	BC3_RGBA_SRGB,
+	BC5_RG,
+	BC6H_RGB_UF16,
+	BC7_RGBA,
+	BC7_RGBA_SRGB,
 };
 
 // Bitmask so usages can be combined
@@ -249,6 +259,9 @@ struct BufferDesc {
 	MemoryDomain domain = MemoryDomain::GPU_ONLY;
 	uint32 instanceCount = 1;
 	uint64 minAlignment = 0;
+	// Written on the transfer queue while other queues read it (upload destinations).
+	// Shared concurrently across queue families, so uploads need no ownership hand-off.
+	bool transferQueueShared = false;
 	std::string debugName;
 };
 
@@ -306,6 +319,8 @@ enum class BlendOp : uint8 { Add, Subtract, ReverseSubtract, Min, Max };
 enum class DescriptorType : uint8 {
 	UniformBuffer,
 	StorageBuffer,
+	UniformBufferDynamic, // offset supplied at BindDescriptorSet
+	StorageBufferDynamic,
 	CombinedImageSampler,
 	StorageImage,
 	InputAttachment,
@@ -335,6 +350,17 @@ struct PushConstantRange {
 	uint32 size = 0;
 };
 
+// Same layout as VkDrawIndexedIndirectCommand / D3D12_DRAW_INDEXED_ARGUMENTS,
+// so an array of these can be written straight into an IndirectBuffer.
+struct DrawIndexedIndirectCommand {
+	uint32 indexCount = 0;
+	uint32 instanceCount = 1;
+	uint32 firstIndex = 0;
+	int32 vertexOffset = 0;
+	uint32 firstInstance = 0;
+};
+static_assert(sizeof(DrawIndexedIndirectCommand) == 20, "DrawIndexedIndirectCommand must match the API layout");
+
 struct BlendAttachmentDesc {
 	bool enable = false;
 	BlendFactor srcColor = BlendFactor::SrcAlpha;
@@ -390,6 +416,7 @@ struct DescriptorBinding {
 	DescriptorType type = DescriptorType::UniformBuffer;
 	ShaderStageFlags stages = ShaderStageFlags::Vertex;
 	uint32 count = 1;
+	bool partiallyBound = false; // array elements may be left unwritten (needs descriptor indexing)
 };
 
 struct DescriptorSetLayoutDesc {
@@ -436,6 +463,20 @@ struct RenderPassDesc {
 	// barriers.  Set by the RenderGraph compiler, which handles all transitions
 	// through its own barrier system.
 	bool externalBarriers = false;
+
+	// When true the pass body is recorded exclusively into secondary command lists
+	// (IRHICommandList::ExecuteSecondary). Begin() then skips its default viewport/scissor,
+	// since dynamic state isn't inherited and the secondaries set their own.
+	bool secondaryCommandLists = false;
+};
+
+// Attachment layout a secondary command list will be executed inside of. Has to match
+// the render pass it ends up in, format for format.
+struct SecondaryCommandListDesc {
+	std::vector<TextureFormat> colorFormats;
+	TextureFormat depthFormat = TextureFormat::None;
+	SampleCount samples = SampleCount::x1;
+	std::string debugName = "SecondaryCmd";
 };
 
 enum class ResourceState : uint16 {
@@ -461,5 +502,15 @@ enum class ResourceState : uint16 {
 
 };
 
+// Which kind of work touches a resource on one side of a barrier
+enum class PipelineScope : uint8 { All, Graphics, Compute };
+
+// A GPU-side wait on another queue's timeline, applied to the next submission of a list
+struct QueueWait {
+	CommandListType queue = CommandListType::Graphics;
+	uint64 value = 0;
+	PipelineScope scope = PipelineScope::All;
+};
+
 } // namespace Aquila::RHI
 #endif
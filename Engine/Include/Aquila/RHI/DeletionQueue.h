@@ -23,6 +23,10 @@ using ResourceVariant =
 				 VkDescriptorSetLayout, VkRenderPass, VkFramebuffer, VkSemaphore, VmaImageDeletion, VmaBufferDeletion>;
 } // namespace Deletion
 
+// DeletionQueue
+//
+// Defers destruction of Vulkan objects until the frame slot that last used them comes around
+// again. Resources may be queued from any thread, e.g. by assets dropped on a loader worker.
 class DeletionQueue {
   public:
 	explicit DeletionQueue(VulkanDevice &device);
@@ -44,6 +48,7 @@ class DeletionQueue {
 	void Dispatch(const Deletion::ResourceVariant &resource);
 
 	VulkanDevice &m_Device;
+	std::mutex m_Mutex;
 	uint32 m_CurrentSlot = 0;
 	std::array<std::vector<Deletion::ResourceVariant>, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_Buckets;
 };
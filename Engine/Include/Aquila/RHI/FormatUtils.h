@@ -25,6 +25,55 @@ AQUILA_FORCE_INLINE bool IsColorFormat(TextureFormat format) {
 	return !IsDepthFormat(format);
 }
 
+AQUILA_FORCE_INLINE bool IsBlockCompressedFormat(TextureFormat format) {
+	switch (format) {
+	case TextureFormat::BC1_RGBA:
+	case TextureFormat::BC1_RGBA_SRGB:
+	case TextureFormat::BC3_RGBA:
+	case TextureFormat::BC3_RGBA_SRGB:
+	case TextureFormat::BC5_RG:
+	case TextureFormat::BC6H_RGB_UF16:
+	case TextureFormat::BC7_RGBA:
+	case TextureFormat::BC7_RGBA_SRGB:
+		return true;
+	default:
+		return false;
+	}
+}
+
+AQUILA_FORCE_INLINE bool IsSrgbFormat(TextureFormat format) {
+	switch (format) {
+	case TextureFormat::RGBA8_SRGB:
+	case TextureFormat::BGRA8_SRGB:
+	case TextureFormat::BC1_RGBA_SRGB:
+	case TextureFormat::BC3_RGBA_SRGB:
+	case TextureFormat::BC7_RGBA_SRGB:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Bytes of one 4x4 block for block-compressed formats.
+AQUILA_FORCE_INLINE uint32 GetFormatBytesPerBlock(TextureFormat format) {
+	switch (format) {
+	case TextureFormat::BC1_RGBA:
+	case TextureFormat::BC1_RGBA_SRGB:
+		return 8;
+	case TextureFormat::BC3_RGBA:
+	case TextureFormat::BC3_RGBA_SRGB:
+	case TextureFormat::BC5_RG:
+	case TextureFormat::BC6H_RGB_UF16:
+	case TextureFormat::BC7_RGBA:
+	case TextureFormat::BC7_RGBA_SRGB:
+		return 16;
+	default:
+		AQUILA_ASSERT(false, "Not a block-compressed TextureFormat");
+		return 0;
+	}
+}
+
+// Per-texel size; block-compressed formats have none, use GetFormatBytesPerBlock.
 AQUILA_FORCE_INLINE uint32 GetFormatBytesPerPixel(TextureFormat format) {
 	switch (format) {
 	case TextureFormat::R8:
@@ -63,4 +112,18 @@ AQUILA_FORCE_INLINE uint32 GetFormatBytesPerPixel(TextureFormat format) {
 	}
 }
 
+// Tightly packed size of one mip level, the layout CopyBufferToTexture expects.
+AQUILA_FORCE_INLINE uint64 GetTextureLevelSize(TextureFormat format, uint32 width, uint32 height, uint32 level = 0) {
+	const uint64 w = std::max(width >> level, 1u);
+	const uint64 h = std::max(height >> level, 1u);
+	if (IsBlockCompressedFormat(format)) {
+		return ((w + 3) / 4) * ((h + 3) / 4) * GetFormatBytesPerBlock(format);
+	}
+	return w * h * GetFormatBytesPerPixel(format);
+}
+
+AQUILA_FORCE_INLINE uint32 GetFullMipCount(uint32 width, uint32 height) {
+	return static_cast<uint32>(std::bit_width(std::max(std::max(width, height), 1u)));
+}
+
 } // namespace Aquila::RHI
@@ -13,7 +13,8 @@ class VulkanDevice;
 class VulkanBuffer final : public IRHIBuffer {
   public:
 	VulkanBuffer(VulkanDevice &device, const std::string &debugName, VkDeviceSize instanceSize, uint32_t instanceCount,
-				 VkBufferUsageFlags usageFlags, MemoryDomain domain, VkDeviceSize minOffsetAlignment);
+				 VkBufferUsageFlags usageFlags, MemoryDomain domain, VkDeviceSize minOffsetAlignment,
+				 bool transferQueueShared = false);
 	~VulkanBuffer() override;
 
 	AQUILA_NONCOPYABLE(VulkanBuffer);
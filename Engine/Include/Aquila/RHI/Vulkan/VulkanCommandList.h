@@ -14,6 +14,9 @@ class VulkanCommandList final : public IRHICommandList {
 	VulkanCommandList(VulkanDevice &device, VkCommandPool commandPool, CommandListType type, const std::string &name);
 	VulkanCommandList(VulkanDevice &device, VkCommandPool commandPool, VkCommandBuffer existingCmd,
 					  CommandListType type, const std::string &name);
+	// Secondary list, recorded for use inside a dynamic-rendering pass with the given attachments.
+	VulkanCommandList(VulkanDevice &device, VkCommandPool commandPool, VkCommandBuffer existingCmd,
+					  const SecondaryCommandListDesc &inheritance);
 	~VulkanCommandList() override;
 
 	AQUILA_NONCOPYABLE(VulkanCommandList);
@@ -31,6 +34,8 @@ class VulkanCommandList final : public IRHICommandList {
 	// IRHICommandList
 	void TransitionTexture(IRHITexture &texture, ResourceState oldState, ResourceState newState) override;
 	void TransitionBuffer(IRHIBuffer &buffer, ResourceState oldState, ResourceState newState) override;
+	void PipelineBarrier(std::span<const TextureBarrier> textures, std::span<const BufferBarrier> buffers) override;
+	void WaitForQueue(const QueueWait &wait) override;
 
 	// IRHICommandList
 	void BindPipeline(IRHIPipeline &pipeline) override;
@@ -38,7 +43,8 @@ class VulkanCommandList final : public IRHICommandList {
 	void SetScissor(int32 x, int32 y, uint32 width, uint32 height) override;
 
 	// IRHICommandList
-	void BindDescriptorSet(uint32 set, IRHIDescriptorSet &descriptorSet) override;
+	void BindDescriptorSet(uint32 set, IRHIDescriptorSet &descriptorSet,
+						   std::span<const uint32> dynamicOffsets) override;
 	void PushConstants(const void *data, uint32 size, ShaderStageFlags stages, uint32 offset) override;
 	void BindVertexBuffer(IRHIBuffer &buffer, uint32 binding, uint64 offset) override;
 	void BindIndexBuffer(IRHIBuffer &buffer, IndexFormat format, uint64 offset) override;
@@ -51,7 +57,7 @@ class VulkanCommandList final : public IRHICommandList {
 	void DrawIndexedIndirect(IRHIBuffer &buffer, uint64 offset, uint32 drawCount, uint32 stride) override;
 
 	void CopyBufferToTexture(IRHIBuffer &src, IRHITexture &dst, uint32 width, uint32 height, uint32 dstArrayLayer = 0,
-							 uint32 dstMipLevel = 0) override;
+							 uint32 dstMipLevel = 0, uint64 srcOffset = 0) override;
 
 	void FillBuffer(IRHIBuffer &buffer, uint64 offset, uint64 size, uint32 value) override;
 
@@ -61,11 +67,28 @@ class VulkanCommandList final : public IRHICommandList {
 	void PushDebugGroup(const char *name) override;
 	void PopDebugGroup() override;
 
+	// IRHICommandList
+	void ExecuteSecondary(std::span<IRHICommandList *const> secondaries) override;
+	[[nodiscard]] bool IsSecondary() const override { return m_IsSecondary; }
+
 	// Vulkan-specific accessors for internal use (RenderPass, Device, etc.)
 	[[nodiscard]] VkCommandBuffer GetHandle() const { return m_CommandBuffer; }
 	[[nodiscard]] VkCommandPool GetPool() const { return m_CommandPool; }
 
+	// Consumed by the device when the list is submitted.
+	[[nodiscard]] std::vector<QueueWait> TakePendingWaits();
+
+	// Frame lists flushed mid-frame continue in another buffer from the same pool;
+	// RestoreHomeBuffer switches back once the frame has been submitted.
+	void Retarget(VkCommandBuffer commandBuffer);
+	void RestoreHomeBuffer();
+
   private:
+	bool ResolveQueueHandOff(CommandListType srcQueue, CommandListType dstQueue, bool layoutChange,
+							 VkPipelineStageFlags2 &srcStage, VkAccessFlags2 &srcAccess,
+							 VkPipelineStageFlags2 &dstStage, VkAccessFlags2 &dstAccess, uint32 &srcFamily,
+							 uint32 &dstFamily) const;
+
 	VkCommandBuffer m_CommandBuffer = VK_NULL_HANDLE;
 	VkCommandPool m_CommandPool = VK_NULL_HANDLE;
 	CommandListType m_Type;
@@ -76,6 +99,20 @@ class VulkanCommandList final : public IRHICommandList {
 	// Captured by BindPipeline; required for BindDescriptorSet, PushConstants, and Dispatch.
 	VkPipelineLayout m_BoundPipelineLayout = VK_NULL_HANDLE;
 	VkPipelineBindPoint m_BoundBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+
+	// Reused by PipelineBarrier so batching does not allocate every pass
+	std::vector<VkImageMemoryBarrier2> m_ImageBarrierScratch;
+	std::vector<VkBufferMemoryBarrier2> m_BufferBarrierScratch;
+
+	std::vector<QueueWait> m_PendingWaits;
+	VkCommandBuffer m_HomeCommandBuffer = VK_NULL_HANDLE;
+
+	// Secondary-only: the render pass this list continues.
+	bool m_IsSecondary = false;
+	std::vector<VkFormat> m_InheritedColorFormats;
+	VkFormat m_InheritedDepthFormat = VK_FORMAT_UNDEFINED;
+	VkFormat m_InheritedStencilFormat = VK_FORMAT_UNDEFINED;
+	VkSampleCountFlagBits m_InheritedSamples = VK_SAMPLE_COUNT_1_BIT;
 };
 
 } // namespace Aquila::RHI
@@ -28,12 +28,9 @@ class VulkanComputePipeline final : public IRHIPipeline {
 	[[nodiscard]] VkPipelineLayout GetLayout() const { return m_Layout; }
 
   private:
-	void CreatePipelineCache();
-
 	VulkanDevice &m_Device;
 	VkPipeline m_Pipeline = VK_NULL_HANDLE;
 	VkPipelineLayout m_Layout = VK_NULL_HANDLE;
-	VkPipelineCache m_PipelineCache = VK_NULL_HANDLE;
 };
 
 } // namespace Aquila::RHI
@@ -18,7 +18,7 @@ class VulkanDescriptorSet final : public IRHIDescriptorSet {
 	AQUILA_NONCOPYABLE(VulkanDescriptorSet);
 
 	void SetBuffer(uint32 binding, IRHIBuffer &buffer, uint64 offset = 0, uint64 range = 0) override;
-	void SetTexture(uint32 binding, IRHITexture &texture) override;
+	void SetTexture(uint32 binding, IRHITexture &texture, uint32 arrayElement = 0) override;
 	void Flush() override;
 
 	[[nodiscard]] VkDescriptorSet GetDescriptorSet() const { return m_Set; }
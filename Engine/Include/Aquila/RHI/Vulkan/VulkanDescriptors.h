@@ -16,15 +16,17 @@ class VulkanDescriptorSetLayout final : public IRHIDescriptorSetLayout {
 	  public:
 		Builder(VulkanDevice &device) : m_Device(device) {}
 		Builder &AddBinding(uint32 binding, VkDescriptorType descriptorType, VkShaderStageFlags stageFlags,
-							uint32 count = 1);
+							uint32 count = 1, VkDescriptorBindingFlags bindingFlags = 0);
 		Unique<VulkanDescriptorSetLayout> Build() const;
 
 	  private:
 		VulkanDevice &m_Device;
 		std::unordered_map<uint32, VkDescriptorSetLayoutBinding> m_Bindings{};
+		std::unordered_map<uint32, VkDescriptorBindingFlags> m_BindingFlags{};
 	};
 
-	VulkanDescriptorSetLayout(VulkanDevice &device, std::unordered_map<uint32, VkDescriptorSetLayoutBinding> bindings);
+	VulkanDescriptorSetLayout(VulkanDevice &device, std::unordered_map<uint32, VkDescriptorSetLayoutBinding> bindings,
+							  const std::unordered_map<uint32, VkDescriptorBindingFlags> &bindingFlags = {});
 	~VulkanDescriptorSetLayout() override;
 	AQUILA_NONCOPYABLE(VulkanDescriptorSetLayout);
 
@@ -19,6 +19,7 @@ namespace Aquila::RHI {
 
 class DeletionQueue;
 class VulkanDescriptorPool;
+class VulkanPipelineCache;
 class VulkanBuffer;
 class VulkanTexture;
 class VulkanSwapchain;
@@ -42,6 +43,9 @@ class VulkanDevice final : public IRHIDevice {
 	[[nodiscard]] Unique<IRHICommandList> CreateCommandList(CommandListType type,
 															const std::string &name = "") override;
 	[[nodiscard]] Unique<IRHICommandList> CreateFrameCommandList(uint32 slot) override;
+	[[nodiscard]] Unique<IRHICommandList> CreateSecondaryCommandList(const SecondaryCommandListDesc &desc) override;
+	[[nodiscard]] Unique<IRHICommandList> CreateAsyncComputeCommandList() override;
+	[[nodiscard]] Unique<IRHICommandList> CreateUploadCommandList(const std::string &name) override;
 	[[nodiscard]] Unique<IRHISwapchain> CreateSwapchain(const SwapchainDesc &desc) override;
 	[[nodiscard]] Unique<IRHIPipeline> CreateGraphicsPipeline(const GraphicsPipelineDesc &desc) override;
 	[[nodiscard]] Unique<IRHIPipeline> CreateComputePipeline(const ComputePipelineDesc &desc) override;
@@ -55,6 +59,15 @@ class VulkanDevice final : public IRHIDevice {
 	void Submit(IRHICommandList &cmd) override;
 	void SubmitAndWait(IRHICommandList &cmd) override;
 	void SubmitFrame(IRHICommandList &cmd, IRHISwapchain *swapchain, uint32 imageIndex) override;
+	[[nodiscard]] bool HasAsyncCompute() const override { return m_ComputeQueue != m_GraphicsQueue; }
+	[[nodiscard]] bool SupportsDescriptorIndexing() const override { return m_DescriptorIndexing; }
+	[[nodiscard]] bool SupportsBlockCompression() const override { return m_BlockCompression; }
+	uint64 SubmitAsyncCompute(IRHICommandList &cmd) override;
+	uint64 SubmitTransfer(IRHICommandList &cmd) override;
+	uint64 FlushFrameCommandList(IRHICommandList &cmd) override;
+	[[nodiscard]] uint64 GetLastSubmittedValue(CommandListType queue) const override;
+	[[nodiscard]] uint64 GetCompletedValue(CommandListType queue) const override;
+	void WaitForTimeline(CommandListType queue, uint64 value) override;
 	void PresentFrame(IRHISwapchain &swapchain, uint32 imageIndex,
 					  vec4 clearColor = { 0.0f, 0.0f, 0.0f, 1.0f }) override;
 	void WaitIdle() override { vkDeviceWaitIdle(m_Device); }
@@ -66,17 +79,25 @@ class VulkanDevice final : public IRHIDevice {
 	void WaitTransferQueueIdle();
 
 	void ResetFrameCommandPool(uint32 slot);
+	// Blocks until the async compute work recorded for `slot` has finished. The slot fence
+	// only covers the graphics queue, so this runs next to the fence wait.
+	void WaitForAsyncCompute(uint32 slot);
+	[[nodiscard]] uint32 GetQueueFamilyIndex(CommandListType queue) const;
+	// Graphics, compute and transfer families without duplicates. Returns the count.
+	uint32 GetDistinctQueueFamilies(std::array<uint32, 3> &out) const;
 	void Wait() const { vkDeviceWaitIdle(m_Device); }
+	// Error-severity validation messages reported since startup; tests compare it around a path.
+	[[nodiscard]] static uint32 GetValidationErrorCount() { return s_ValidationErrors.load(); }
 
 	VkCommandPool GetOrCreateThreadLocalGraphicsPool();
 
 	template <typename Func> void ExecuteGraphicsCommands(Func &&func) {
 		VkCommandPool pool = GetOrCreateThreadLocalGraphicsPool();
-		ExecuteSingleTimeCommands(pool, m_GraphicsQueue, m_GraphicsQueueMutex, std::forward<Func>(func));
+		ExecuteSingleTimeCommands(pool, m_GraphicsQueue, QueueMutex(m_GraphicsQueue), std::forward<Func>(func));
 	}
 
 	template <typename Func> void ExecuteTransferCommands(Func &&func) {
-		ExecuteSingleTimeCommands(m_TransferCommandPool, m_TransferQueue, m_TransferQueueMutex,
+		ExecuteSingleTimeCommands(m_TransferCommandPool, m_TransferQueue, QueueMutex(m_TransferQueue),
 								  std::forward<Func>(func));
 	}
 
@@ -98,7 +119,8 @@ class VulkanDevice final : public IRHIDevice {
 	void CreateFrameCommandPools();
 
 	template <MemoryDomain Domain>
-	BufferAllocation CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, const char *debugName = nullptr) {
+	BufferAllocation CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, const char *debugName = nullptr,
+								  bool transferQueueShared = false) {
 		AQUILA_ASSERT(size > 0, "Buffer size must be > 0");
 		AQUILA_ASSERT(m_Allocator != VK_NULL_HANDLE, "VMA allocator is null");
 
@@ -108,6 +130,14 @@ class VulkanDevice final : public IRHIDevice {
 		bufferInfo.usage = usage;
 		bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
+		std::array<uint32, 3> families{};
+		const uint32 familyCount = transferQueueShared ? GetDistinctQueueFamilies(families) : 1u;
+		if (familyCount > 1) {
+			bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+			bufferInfo.queueFamilyIndexCount = familyCount;
+			bufferInfo.pQueueFamilyIndices = families.data();
+		}
+
 		VmaAllocationCreateInfo allocInfo{};
 		if constexpr (Domain == MemoryDomain::GPU_ONLY) {
 			allocInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
@@ -215,6 +245,8 @@ class VulkanDevice final : public IRHIDevice {
 	void DestroySamplerCache();
 
 	[[nodiscard]] RHI::DeletionQueue &GetDeletionQueue() const;
+	// Shared by every pipeline; persisted across runs.
+	[[nodiscard]] VkPipelineCache GetPipelineCache() const;
 	[[nodiscard]] VkCommandPool GetGraphicsCommandPool() const { return m_GraphicsCommandPool; }
 	[[nodiscard]] VkCommandPool GetComputeCommandPool() const { return m_ComputeCommandPool; }
 	[[nodiscard]] VkCommandPool GetTransferCommandPool() const { return m_TransferCommandPool; }
@@ -247,6 +279,13 @@ class VulkanDevice final : public IRHIDevice {
 	VkQueueFamilyIndices FindQueueFamilies(VkPhysicalDevice vkPhysicalDevice) const;
 	VkSwapChainSupportDetails QuerySwapChainSupport(VkPhysicalDevice vkPhysicalDevice) const;
 	void LogDeviceInfo() const;
+	void CreateQueueTimelines();
+	// Compute and transfer may alias the graphics queue, so the lock follows the VkQueue: every
+	// type submitting to the same queue gets the same mutex.
+	std::mutex &QueueMutex(VkQueue queue);
+	uint64 SubmitTimeline(CommandListType queue, VulkanCommandList &cmd,
+						  std::span<const VkSemaphoreSubmitInfo> extraWaits,
+						  std::span<const VkSemaphoreSubmitInfo> extraSignals, VkFence fence);
 
 	template <typename Func>
 	void ExecuteSingleTimeCommands(VkCommandPool pool, VkQueue queue, std::mutex &queueMutex, Func &&func) {
@@ -294,6 +333,7 @@ class VulkanDevice final : public IRHIDevice {
 														const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData,
 														void *pUserData);
 	static const char *GetObjectTypeName(VkObjectType objectType);
+	static inline std::atomic<uint32> s_ValidationErrors{ 0 };
 
 	// Vulkan handles
 	VkInstance m_VulkanInstance{};
@@ -303,6 +343,8 @@ class VulkanDevice final : public IRHIDevice {
 	VkSurfaceKHR m_Surface{};
 	VmaAllocator m_Allocator{};
 	VkPhysicalDeviceProperties m_Properties{};
+	bool m_DescriptorIndexing = false; // descriptorBindingPartiallyBound enabled
+	bool m_BlockCompression = false;   // textureCompressionBC enabled
 	PFN_vkSetDebugUtilsObjectNameEXT m_vkSetDebugUtilsObjectNameEXT = nullptr;
 	PFN_vkCmdBeginDebugUtilsLabelEXT m_vkCmdBeginDebugUtilsLabelEXT = nullptr;
 	PFN_vkCmdEndDebugUtilsLabelEXT m_vkCmdEndDebugUtilsLabelEXT = nullptr;
@@ -322,18 +364,32 @@ class VulkanDevice final : public IRHIDevice {
 	VkCommandPool m_GraphicsCommandPool{};
 	VkCommandPool m_ComputeCommandPool{};
 	VkCommandPool m_TransferCommandPool{};
+	VkCommandPool m_UploadCommandPool{}; // only touched under GfxUploadBatcher's lock
 	std::mutex m_TransferCommandPoolMutex;
 	std::mutex m_GraphicsCommandPoolMutex;
 
+	// Besides the frame's own buffer, a slot hands out extra primaries for frame lists
+	// flushed mid-frame and async compute buffers from a pool on the compute family.
+	// Both are handed out linearly and recycled in ResetFrameCommandPool.
 	struct FrameCommandSlot {
 		VkCommandPool pool = VK_NULL_HANDLE;
 		VkCommandBuffer cmd = VK_NULL_HANDLE;
+		std::vector<VkCommandBuffer> extra;
+		uint32 extraUsed = 0;
+
+		VkCommandPool computePool = VK_NULL_HANDLE;
+		std::vector<VkCommandBuffer> computeBuffers;
+		uint32 computeUsed = 0;
+		uint64 computeValue = 0; // last compute timeline value submitted from this slot
 	};
 	std::array<FrameCommandSlot, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_FrameSlots{};
 
 	Unique<RHI::DeletionQueue> m_DeletionQueue;
+	Unique<VulkanPipelineCache> m_PipelineCache;
+	void CreatePipelineCache();
 
 	std::unordered_map<SamplerDesc, VkSampler, SamplerDescHash> m_SamplerCache;
+	std::mutex m_SamplerMutex; // textures are created on loader workers too
 
 	Unique<VulkanDescriptorPool> m_GlobalPool;
 	void CreateGlobalDescriptorPool();
@@ -345,6 +401,27 @@ class VulkanDevice final : public IRHIDevice {
 	std::unordered_map<std::thread::id, ThreadLocalPool> m_ThreadPools;
 	std::mutex m_ThreadPoolMapMutex;
 
+	// Secondary command buffers for parallel recording, one pool per (frame slot, thread).
+	// Buffers are handed out linearly and the whole pool is reset in ResetFrameCommandPool,
+	// i.e. once that slot's fence has signalled.
+	struct SecondaryPool {
+		VkCommandPool pool = VK_NULL_HANDLE;
+		std::vector<VkCommandBuffer> buffers;
+		uint32 used = 0;
+	};
+	std::array<std::unordered_map<std::thread::id, SecondaryPool>, SharedConstants::MAX_FRAMES_IN_FLIGHT>
+		m_SecondaryPools;
+	std::mutex m_SecondaryPoolMutex;
+	uint32 m_RecordingSlot = 0;
+
+	// One timeline semaphore per queue: [0] graphics, [1] compute, [2] transfer.
+	// Values are bumped under QueueMutex at submit time.
+	std::array<VkSemaphore, 3> m_QueueTimelines{};
+	std::array<uint64, 3> m_QueueTimelineValues{};
+	uint32 m_GraphicsFamily = 0;
+	uint32 m_ComputeFamily = 0;
+	uint32 m_TransferFamily = 0;
+
 	GLFWwindow &m_WindowHandle;
 
 	struct OffscreenPendingCmdBuf {
@@ -34,6 +34,8 @@ class VulkanDynamicRendering {
 		uint32 height = 0;
 		std::vector<ColorAttachmentDesc> colorAttachments;
 		std::optional<DepthAttachmentDesc> depthAttachment;
+		// Body comes from vkCmdExecuteCommands only; no inline state may be recorded.
+		bool secondaryContents = false;
 	};
 
 	static void Begin(VulkanCommandList &cmd, const BeginDesc &desc) {
@@ -76,8 +78,14 @@ class VulkanDynamicRendering {
 		renderingInfo.colorAttachmentCount = static_cast<uint32>(colorInfos.size());
 		renderingInfo.pColorAttachments = colorInfos.empty() ? nullptr : colorInfos.data();
 		renderingInfo.pDepthAttachment = desc.depthAttachment.has_value() ? &depthInfo : nullptr;
+		if (desc.secondaryContents) {
+			renderingInfo.flags = VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT;
+		}
 
 		vkCmdBeginRendering(cmd.GetHandle(), &renderingInfo);
+		if (desc.secondaryContents) {
+			return;
+		}
 
 		VkViewport viewport{};
 		viewport.width = static_cast<float>(desc.width);
@@ -51,6 +51,22 @@ AQUILA_FORCE_INLINE VkFormat ToVkFormat(TextureFormat format) {
 		return VK_FORMAT_D24_UNORM_S8_UINT;
 	case TextureFormat::Depth32Stencil8:
 		return VK_FORMAT_D32_SFLOAT_S8_UINT;
+	case TextureFormat::BC1_RGBA:
+		return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+	case TextureFormat::BC1_RGBA_SRGB:
+		return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+	case TextureFormat::BC3_RGBA:
+		return VK_FORMAT_BC3_UNORM_BLOCK;
+	case TextureFormat::BC3_RGBA_SRGB:
+		return VK_FORMAT_BC3_SRGB_BLOCK;
+	case TextureFormat::BC5_RG:
+		return VK_FORMAT_BC5_UNORM_BLOCK;
+	case TextureFormat::BC6H_RGB_UF16:
+		return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+	case TextureFormat::BC7_RGBA:
+		return VK_FORMAT_BC7_UNORM_BLOCK;
+	case TextureFormat::BC7_RGBA_SRGB:
+		return VK_FORMAT_BC7_SRGB_BLOCK;
 	default:
 		AQUILA_ASSERT(false, "Unknown TextureFormat");
 		return VK_FORMAT_UNDEFINED;
@@ -101,6 +117,22 @@ AQUILA_FORCE_INLINE TextureFormat FromVkFormat(VkFormat format) {
 		return TextureFormat::Depth24Stencil8;
 	case VK_FORMAT_D32_SFLOAT_S8_UINT:
 		return TextureFormat::Depth32Stencil8;
+	case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+		return TextureFormat::BC1_RGBA;
+	case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+		return TextureFormat::BC1_RGBA_SRGB;
+	case VK_FORMAT_BC3_UNORM_BLOCK:
+		return TextureFormat::BC3_RGBA;
+	case VK_FORMAT_BC3_SRGB_BLOCK:
+		return TextureFormat::BC3_RGBA_SRGB;
+	case VK_FORMAT_BC5_UNORM_BLOCK:
+		return TextureFormat::BC5_RG;
+	case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+		return TextureFormat::BC6H_RGB_UF16;
+	case VK_FORMAT_BC7_UNORM_BLOCK:
+		return TextureFormat::BC7_RGBA;
+	case VK_FORMAT_BC7_SRGB_BLOCK:
+		return TextureFormat::BC7_RGBA_SRGB;
 	default:
 		AQUILA_ASSERT(false, "Unknown VkFormat");
 		return TextureFormat::RGBA8;
@@ -329,6 +361,10 @@ AQUILA_FORCE_INLINE VkDescriptorType ToVkDescriptorType(DescriptorType t) {
 		return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
 	case DescriptorType::StorageBuffer:
 		return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	case DescriptorType::UniformBufferDynamic:
+		return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	case DescriptorType::StorageBufferDynamic:
+		return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
 	case DescriptorType::CombinedImageSampler:
 		return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
 	case DescriptorType::StorageImage:
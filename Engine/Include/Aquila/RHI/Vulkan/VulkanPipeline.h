@@ -58,12 +58,10 @@ class VulkanPipeline final : public IRHIPipeline {
   private:
 	void CreatePipelineFromStages(const std::vector<VkPipelineShaderStageCreateInfo> &stages,
 								  const VulkanPipelineConfig &configInfo);
-	void CreatePipelineCache();
 
 	VulkanDevice &m_Device;
 	VkPipeline m_GraphicsPipeline = VK_NULL_HANDLE;
 	VkPipelineLayout m_Layout = VK_NULL_HANDLE;
-	VkPipelineCache m_PipelineCache = VK_NULL_HANDLE;
 };
 
 } // namespace Aquila::RHI
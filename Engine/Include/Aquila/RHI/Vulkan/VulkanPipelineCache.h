@@ -0,0 +1,42 @@
+#ifndef AQUILA_VULKAN_PIPELINE_CACHE_H
+#define AQUILA_VULKAN_PIPELINE_CACHE_H
+
+#include "GraphicsPCH.h"
+#include "Aquila/Foundation/Defines.h"
+#include "Aquila/Foundation/PrimitiveTypes.h"
+
+namespace Aquila::RHI {
+
+// VulkanPipelineCache
+//
+// One VkPipelineCache shared by every pipeline the device creates, seeded from disk at
+// startup and written back on shutdown. The file carries a small header of our own
+// (magic, driver version, payload size and hash) in front of the driver's blob; the blob's
+// own header is checked against the device's vendor ID, device ID and pipelineCacheUUID.
+// Anything that doesn't match is discarded and the cache starts empty.
+class VulkanPipelineCache {
+  public:
+	VulkanPipelineCache(VkDevice device, const VkPhysicalDeviceProperties &properties, std::string path);
+	~VulkanPipelineCache();
+
+	AQUILA_NONCOPYABLE(VulkanPipelineCache);
+	AQUILA_NONMOVEABLE(VulkanPipelineCache);
+
+	[[nodiscard]] VkPipelineCache GetHandle() const { return m_Cache; }
+	[[nodiscard]] bool WasLoaded() const { return m_Loaded; }
+
+	// Writes the current contents to disk via a temp file and rename. Called on destruction.
+	bool Save() const;
+
+  private:
+	[[nodiscard]] bool Validate(const std::vector<uint8> &file) const;
+
+	VkDevice m_Device = VK_NULL_HANDLE;
+	VkPhysicalDeviceProperties m_Properties{};
+	VkPipelineCache m_Cache = VK_NULL_HANDLE;
+	std::string m_Path;
+	bool m_Loaded = false;
+};
+
+} // namespace Aquila::RHI
+#endif
@@ -0,0 +1,35 @@
+#ifndef AQUILA_VULKAN_SHADER_CACHE_H
+#define AQUILA_VULKAN_SHADER_CACHE_H
+
+#include "GraphicsPCH.h"
+#include "Aquila/Foundation/PrimitiveTypes.h"
+
+namespace Aquila::RHI {
+
+struct VulkanCompiledStage;
+
+// Reads a shader from disk, or through the VFS for "scheme://" paths.
+bool ReadShaderSource(const std::string &path, std::string &out);
+
+// VulkanShaderCache
+//
+// Content-addressed store for compiled stages (SPIR-V plus flattened reflection) under
+// <user cache>/shaders. An entry's key hashes the compiler configuration, the shader source
+// and the path and contents of every file the compile pulled in. Those dependencies aren't
+// known before compiling, so each source path also gets a small manifest listing what its
+// last compile read; a lookup rehashes exactly those files.
+//
+// Entries are written with FileWriteAtomic, so concurrent compiles of the same shader, from
+// threads or from several editor instances, can't leave a torn file behind.
+class VulkanShaderCache {
+  public:
+	static bool Load(const std::string &path, const std::string &source, uint64 configHash,
+					 std::vector<VulkanCompiledStage> &outStages, std::vector<std::string> *outDependencies = nullptr);
+	static void Store(const std::string &path, const std::string &source, uint64 configHash,
+					  const std::vector<std::string> &dependencies, const std::vector<VulkanCompiledStage> &stages);
+
+	[[nodiscard]] static const std::string &GetDirectory();
+};
+
+} // namespace Aquila::RHI
+#endif
@@ -2,166 +2,283 @@
 #define AQUILA_VULKAN_SHADER_COMPILER_H
 
 #include "GraphicsPCH.h"
-#include "Aquila/Platform/Filesystem/VirtualFileSystem.h"
+#include "Aquila/Foundation/Hash.h"
+#include "Aquila/Foundation/Job.h"
+#include "Aquila/Foundation/Timer.h"
+#include "Aquila/RHI/Backend/RHITypes.h"
+#include "Aquila/RHI/Vulkan/VulkanShaderCache.h"
 #include <slang/slang-com-ptr.h>
 #include <slang/slang.h>
+#include <exception>
 
 namespace Aquila::RHI {
 
+// A member of a uniform block, as much as material parameters need to know about it.
+struct VulkanReflectedField {
+	std::string name;
+	uint32 scalarType = 0; // slang::TypeReflection::ScalarType; None unless a scalar or vector
+	uint32 columns = 1;
+};
+
+// One global shader parameter, flattened out of Slang's program layout so it can be cached
+// next to the SPIR-V instead of keeping the Slang session alive.
+struct VulkanReflectedParameter {
+	std::string name;
+	uint32 set = 0;
+	uint32 binding = 0;
+	bool isDescriptor = false; // a uniform buffer, sampled texture or storage buffer
+	DescriptorType type = DescriptorType::UniformBuffer;
+	std::vector<VulkanReflectedField> fields; // uniform buffers only
+};
+
 struct VulkanCompiledStage {
 	VkShaderStageFlagBits stage{};
 	std::vector<uint32> spirv;
 	std::string entryPointName;
-	Slang::ComPtr<slang::IComponentType> linkedComponent;
-	Slang::ComPtr<slang::ISession> session;
+	std::vector<VulkanReflectedParameter> parameters;
 };
 
+// VulkanShaderCompiler
+//
+// Slang to SPIR-V. CompileFile goes through VulkanShaderCache first and only creates a Slang
+// session on a miss; CompileSource always compiles.
+//
+// A Slang global session must not be used from two threads at once, so every thread that
+// compiles gets its own, created on first use and released in Shutdown. PrecompileFiles uses
+// that to compile a batch of files across the JobSystem workers; each result is parked until
+// the first CompileFile call for that path picks it up.
 class VulkanShaderCompiler {
   public:
 	static void Initialize() {
 		if (s_Initialized) {
 			return;
 		}
-		slang::createGlobalSession(s_GlobalSession.writeRef());
+		s_ConfigHash = ComputeConfigHash();
 		s_Initialized = true;
 	}
 
 	static void Shutdown() {
-		s_GlobalSession = nullptr;
+		{
+			std::lock_guard lock(s_PrecompiledMutex);
+			s_Precompiled.clear();
+		}
+		{
+			std::lock_guard lock(s_SessionMutex);
+			s_GlobalSessions.clear();
+		}
 		s_Initialized = false;
 	}
 
+	// outDependencies, if given, receives every file besides `filepath` that the compile read.
 	static bool CompileFile(const std::string &filepath, std::vector<VulkanCompiledStage> &outStages,
-							std::string &errorLog) {
+							std::string &errorLog, std::vector<std::string> *outDependencies = nullptr) {
 		AQUILA_ASSERT(s_Initialized, "VulkanShaderCompiler::Initialize() was not called");
 
-		slang::TargetDesc targetDesc{};
-		targetDesc.format = SLANG_SPIRV;
-		targetDesc.profile = s_GlobalSession->findProfile("spirv_1_0");
+		{
+			std::lock_guard lock(s_PrecompiledMutex);
+			auto it = s_Precompiled.find(filepath);
+			if (it != s_Precompiled.end()) {
+				const bool succeeded = it->second.succeeded;
+				outStages = std::move(it->second.stages);
+				errorLog = std::move(it->second.errorLog);
+				if (outDependencies != nullptr) {
+					*outDependencies = std::move(it->second.dependencies);
+				}
+				s_Precompiled.erase(it); // taken once, so a later reload compiles fresh
+				return succeeded;
+			}
+		}
+		return Compile(filepath, outStages, errorLog, outDependencies);
+	}
 
-		const char *searchPaths[] = { AQUILA_SHADERS_DIR };
-		slang::SessionDesc sessionDesc{};
-		sessionDesc.targets = &targetDesc;
-		sessionDesc.targetCount = 1;
-		sessionDesc.searchPaths = searchPaths;
-		sessionDesc.searchPathCount = 1;
+	// Compiles every file concurrently and blocks until all are done. The calling thread takes
+	// a share of the work, so this must not be called from a job. Duplicates are compiled once.
+	static void PrecompileFiles(std::vector<std::string> filepaths) {
+		AQUILA_ASSERT(s_Initialized, "VulkanShaderCompiler::Initialize() was not called");
 
-		Slang::ComPtr<slang::ISession> session;
-		if (SLANG_FAILED(s_GlobalSession->createSession(sessionDesc, session.writeRef()))) {
-			errorLog = "Failed to create Slang session";
-			return false;
+		std::sort(filepaths.begin(), filepaths.end());
+		filepaths.erase(std::unique(filepaths.begin(), filepaths.end()), filepaths.end());
+		if (filepaths.empty()) {
+			return;
 		}
 
-		std::string sourceCode;
-		const bool isVirtualPath = filepath.find("://") != std::string::npos;
-		if (isVirtualPath) {
-			auto *vfs = Platform::Filesystem::VirtualFileSystem::Get();
-			sourceCode = vfs->ReadTextFile(filepath);
-			if (sourceCode.empty()) {
-				errorLog = "VFS: failed to read shader source from '" + filepath + "'";
-				return false;
+		std::vector<PrecompiledResult> results(filepaths.size());
+		std::vector<double> jobMilliseconds(filepaths.size(), 0.0);
+		auto compileOne = [&](usize index) {
+			const Foundation::TimePoint jobStart = Foundation::Now();
+			PrecompiledResult &result = results[index];
+			result.succeeded = Compile(filepaths[index], result.stages, result.errorLog, &result.dependencies);
+			jobMilliseconds[index] = Foundation::ElapsedMilliseconds(jobStart, Foundation::Now());
+		};
+
+		const Foundation::TimePoint start = Foundation::Now();
+		Foundation::JobSystem &jobs = Foundation::JobSystem::Get();
+		std::vector<Foundation::JobHandle<void>> handles;
+		handles.reserve(filepaths.size() - 1);
+		std::exception_ptr firstError;
+		try {
+			for (usize i = 1; i < filepaths.size(); ++i) {
+				if (jobs.GetThreadCount() > 0) {
+					handles.push_back(jobs.ScheduleHigh(filepaths[i], compileOne, i));
+				} else {
+					compileOne(i);
+				}
 			}
-		} else {
-			std::ifstream file(filepath);
-			if (!file.is_open()) {
-				errorLog = "Failed to open shader file '" + filepath + "'";
-				return false;
+			compileOne(0);
+		} catch (...) {
+			firstError = std::current_exception();
+		}
+		// The jobs reference the locals above, so every one finishes before anything propagates.
+		for (Foundation::JobHandle<void> &handle : handles) {
+			try {
+				handle.Get(); // rethrows anything a worker threw
+			} catch (...) {
+				if (!firstError) {
+					firstError = std::current_exception();
+				}
 			}
-			sourceCode = { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+		}
+		if (firstError) {
+			std::rethrow_exception(firstError);
+		}
+		const double wallMilliseconds = Foundation::ElapsedMilliseconds(start, Foundation::Now());
+
+		double serialMilliseconds = 0.0;
+		{
+			std::lock_guard lock(s_PrecompiledMutex);
+			for (usize i = 0; i < filepaths.size(); ++i) {
+				serialMilliseconds += jobMilliseconds[i];
+				s_Precompiled[filepaths[i]] = std::move(results[i]);
+			}
+		}
+		AQUILA_LOG_INFO("VulkanShaderCompiler: precompiled {} shaders in {:.1f} ms, {:.1f} ms back to back "
+						"(saved {:.1f} ms)",
+						filepaths.size(), wallMilliseconds, serialMilliseconds,
+						std::max(serialMilliseconds - wallMilliseconds, 0.0));
+	}
+
+	static bool CompileSource(const std::string &name, const std::string &source,
+							  std::vector<VulkanCompiledStage> &outStages, std::string &errorLog) {
+		AQUILA_ASSERT(s_Initialized, "VulkanShaderCompiler::Initialize() was not called");
+
+		Slang::ComPtr<slang::ISession> session;
+		if (!CreateSession(session, errorLog)) {
+			return false;
 		}
 
 		slang::IModule *slangModule = nullptr;
 		{
 			Slang::ComPtr<slang::IBlob> diagnostics;
-			slangModule = session->loadModuleFromSourceString(filepath.c_str(), filepath.c_str(), sourceCode.c_str(),
-															  diagnostics.writeRef());
+			slangModule =
+				session->loadModuleFromSourceString(name.c_str(), name.c_str(), source.c_str(), diagnostics.writeRef());
 			if (slangModule == nullptr) {
 				errorLog = (diagnostics != nullptr) ? static_cast<const char *>(diagnostics->getBufferPointer())
-													: "Failed to load Slang module from '" + filepath + "'";
+													: "Failed to load Slang module '" + name + "'";
 				return false;
 			}
 		}
 
-		int32 entryPointCount = slangModule->getDefinedEntryPointCount();
-		if (entryPointCount == 0) {
-			errorLog = "No entry points found in '" + filepath + "'";
-			return false;
-		}
-
-		bool anyFailed = false;
-		for (int32 ep = 0; ep < entryPointCount; ++ep) {
-			Slang::ComPtr<slang::IEntryPoint> entryPoint;
-			if (SLANG_FAILED(slangModule->getDefinedEntryPoint(ep, entryPoint.writeRef()))) {
-				AQUILA_LOG_WARNING("VulkanShaderCompiler: failed to get entry point {} from '{}'", ep, filepath);
-				anyFailed = true;
-				continue;
-			}
+		return CompileEntryPoints(*session, *slangModule, name, outStages, errorLog);
+	}
 
-			slang::IComponentType *components[] = { slangModule, entryPoint };
-			Slang::ComPtr<slang::IComponentType> composed;
-			session->createCompositeComponentType(components, 2, composed.writeRef());
+	static VkShaderStageFlagBits SlangStageToVkStage(SlangStage stage) {
+		switch (stage) {
+		case SLANG_STAGE_VERTEX:
+			return VK_SHADER_STAGE_VERTEX_BIT;
+		case SLANG_STAGE_FRAGMENT:
+			return VK_SHADER_STAGE_FRAGMENT_BIT;
+		case SLANG_STAGE_COMPUTE:
+			return VK_SHADER_STAGE_COMPUTE_BIT;
+		case SLANG_STAGE_GEOMETRY:
+			return VK_SHADER_STAGE_GEOMETRY_BIT;
+		default:
+			AQUILA_LOG_WARNING("VulkanShaderCompiler: unhandled SlangStage {}, defaulting to VERTEX",
+							   static_cast<int>(stage));
+			return VK_SHADER_STAGE_VERTEX_BIT;
+		}
+	}
 
-			slang::ProgramLayout *layout = composed->getLayout();
-			slang::EntryPointReflection *epRef = layout->getEntryPointByIndex(0);
-			VkShaderStageFlagBits vkStage = SlangStageToVkStage(epRef->getStage());
-			std::string epName = epRef->getName();
+  private:
+	struct PrecompiledResult {
+		bool succeeded = false;
+		std::vector<VulkanCompiledStage> stages;
+		std::string errorLog;
+		std::vector<std::string> dependencies;
+	};
+
+	static slang::IGlobalSession &GetGlobalSession() {
+		std::lock_guard lock(s_SessionMutex);
+		Slang::ComPtr<slang::IGlobalSession> &session = s_GlobalSessions[std::this_thread::get_id()];
+		if (session == nullptr) {
+			slang::createGlobalSession(session.writeRef());
+		}
+		return *session;
+	}
 
-			Slang::ComPtr<slang::IComponentType> linked;
-			{
-				Slang::ComPtr<slang::IBlob> diagnostics;
-				composed->link(linked.writeRef(), diagnostics.writeRef());
-				if (linked == nullptr) {
-					errorLog = (diagnostics != nullptr) ? static_cast<const char *>(diagnostics->getBufferPointer())
-														: "Link failed for entry point '" + epName + "'";
-					anyFailed = true;
-					continue;
-				}
-			}
+	// The cache-or-compile path behind CompileFile, minus the precompiled results.
+	static bool Compile(const std::string &filepath, std::vector<VulkanCompiledStage> &outStages,
+						std::string &errorLog, std::vector<std::string> *outDependencies) {
+		std::string sourceCode;
+		if (!ReadShaderSource(filepath, sourceCode)) {
+			errorLog = "Failed to read shader source from '" + filepath + "'";
+			return false;
+		}
 
-			Slang::ComPtr<slang::IBlob> spirvBlob;
-			{
-				Slang::ComPtr<slang::IBlob> diagnostics;
-				linked->getEntryPointCode(0, 0, spirvBlob.writeRef(), diagnostics.writeRef());
-				if (spirvBlob == nullptr) {
-					errorLog = (diagnostics != nullptr) ? static_cast<const char *>(diagnostics->getBufferPointer())
-														: "Code generation failed for entry point '" + epName + "'";
-					anyFailed = true;
-					continue;
-				}
-			}
+		// A cache hit must not create a global session for this thread, so the hash is fixed up front.
+		const uint64 configHash = s_ConfigHash;
+		if (VulkanShaderCache::Load(filepath, sourceCode, configHash, outStages, outDependencies)) {
+			return true;
+		}
 
-			VulkanCompiledStage result;
-			result.stage = vkStage;
-			result.entryPointName = "main"; // Slang always emits "main" in the SPIR-V binary
-			result.linkedComponent = linked;
-			result.session = session;
-			const auto *data = static_cast<const uint32 *>(spirvBlob->getBufferPointer());
-			result.spirv.assign(data, data + (spirvBlob->getBufferSize() / sizeof(uint32)));
-			outStages.push_back(std::move(result));
+		Slang::ComPtr<slang::ISession> session;
+		if (!CreateSession(session, errorLog)) {
+			return false;
 		}
 
-		if (outStages.empty()) {
-			if (errorLog.empty()) {
-				errorLog = "All entry points failed to compile in '" + filepath + "'";
+		slang::IModule *slangModule = nullptr;
+		{
+			Slang::ComPtr<slang::IBlob> diagnostics;
+			slangModule = session->loadModuleFromSourceString(filepath.c_str(), filepath.c_str(), sourceCode.c_str(),
+															  diagnostics.writeRef());
+			if (slangModule == nullptr) {
+				errorLog = (diagnostics != nullptr) ? static_cast<const char *>(diagnostics->getBufferPointer())
+													: "Failed to load Slang module from '" + filepath + "'";
+				return false;
 			}
-			return false;
 		}
 
-		if (anyFailed) {
-			outStages.clear();
+		if (!CompileEntryPoints(*session, *slangModule, filepath, outStages, errorLog)) {
 			return false;
 		}
 
+		// Everything the module imported or included, so editing a shared file invalidates this entry.
+		std::vector<std::string> dependencies;
+		for (int32 i = 0; i < slangModule->getDependencyFileCount(); ++i) {
+			const char *dependency = slangModule->getDependencyFilePath(i);
+			if (dependency != nullptr && filepath != dependency) {
+				dependencies.emplace_back(dependency);
+			}
+		}
+		VulkanShaderCache::Store(filepath, sourceCode, configHash, dependencies, outStages);
+		if (outDependencies != nullptr) {
+			*outDependencies = std::move(dependencies);
+		}
 		return true;
 	}
 
-	static bool CompileSource(const std::string &name, const std::string &source,
-							  std::vector<VulkanCompiledStage> &outStages, std::string &errorLog) {
-		AQUILA_ASSERT(s_Initialized, "VulkanShaderCompiler::Initialize() was not called");
+	// Everything besides the sources that changes the output. There are no preprocessor
+	// defines yet; when there are, they belong in here too. Computed once by Initialize.
+	static uint64 ComputeConfigHash() {
+		uint64 hash = Foundation::HashFnv1a64(GetGlobalSession().getBuildTagString());
+		hash = Foundation::HashFnv1a64(kTargetProfile, hash);
+		return Foundation::HashFnv1a64(AQUILA_SHADERS_DIR, hash);
+	}
 
+	static bool CreateSession(Slang::ComPtr<slang::ISession> &session, std::string &errorLog) {
 		slang::TargetDesc targetDesc{};
 		targetDesc.format = SLANG_SPIRV;
-		targetDesc.profile = s_GlobalSession->findProfile("spirv_1_0");
+		slang::IGlobalSession &globalSession = GetGlobalSession();
+		targetDesc.profile = globalSession.findProfile(kTargetProfile);
 
 		const char *searchPaths[] = { AQUILA_SHADERS_DIR };
 		slang::SessionDesc sessionDesc{};
@@ -170,25 +287,17 @@ class VulkanShaderCompiler {
 		sessionDesc.searchPaths = searchPaths;
 		sessionDesc.searchPathCount = 1;
 
-		Slang::ComPtr<slang::ISession> session;
-		if (SLANG_FAILED(s_GlobalSession->createSession(sessionDesc, session.writeRef()))) {
+		if (SLANG_FAILED(globalSession.createSession(sessionDesc, session.writeRef()))) {
 			errorLog = "Failed to create Slang session";
 			return false;
 		}
+		return true;
+	}
 
-		slang::IModule *slangModule = nullptr;
-		{
-			Slang::ComPtr<slang::IBlob> diagnostics;
-			slangModule =
-				session->loadModuleFromSourceString(name.c_str(), name.c_str(), source.c_str(), diagnostics.writeRef());
-			if (slangModule == nullptr) {
-				errorLog = (diagnostics != nullptr) ? static_cast<const char *>(diagnostics->getBufferPointer())
-													: "Failed to load Slang module '" + name + "'";
-				return false;
-			}
-		}
-
-		int32 entryPointCount = slangModule->getDefinedEntryPointCount();
+	// Links and generates code for every entry point in the module. All or nothing.
+	static bool CompileEntryPoints(slang::ISession &session, slang::IModule &slangModule, const std::string &name,
+								   std::vector<VulkanCompiledStage> &outStages, std::string &errorLog) {
+		int32 entryPointCount = slangModule.getDefinedEntryPointCount();
 		if (entryPointCount == 0) {
 			errorLog = "No entry points found in '" + name + "'";
 			return false;
@@ -197,14 +306,15 @@ class VulkanShaderCompiler {
 		bool anyFailed = false;
 		for (int32 ep = 0; ep < entryPointCount; ++ep) {
 			Slang::ComPtr<slang::IEntryPoint> entryPoint;
-			if (SLANG_FAILED(slangModule->getDefinedEntryPoint(ep, entryPoint.writeRef()))) {
+			if (SLANG_FAILED(slangModule.getDefinedEntryPoint(ep, entryPoint.writeRef()))) {
+				AQUILA_LOG_WARNING("VulkanShaderCompiler: failed to get entry point {} from '{}'", ep, name);
 				anyFailed = true;
 				continue;
 			}
 
-			slang::IComponentType *components[] = { slangModule, entryPoint };
+			slang::IComponentType *components[] = { &slangModule, entryPoint };
 			Slang::ComPtr<slang::IComponentType> composed;
-			session->createCompositeComponentType(components, 2, composed.writeRef());
+			session.createCompositeComponentType(components, 2, composed.writeRef());
 
 			slang::ProgramLayout *layout = composed->getLayout();
 			slang::EntryPointReflection *epRef = layout->getEntryPointByIndex(0);
@@ -229,7 +339,7 @@ class VulkanShaderCompiler {
 				linked->getEntryPointCode(0, 0, spirvBlob.writeRef(), diagnostics.writeRef());
 				if (spirvBlob == nullptr) {
 					errorLog = (diagnostics != nullptr) ? static_cast<const char *>(diagnostics->getBufferPointer())
-														: "Code gen failed for entry point '" + epName + "'";
+														: "Code generation failed for entry point '" + epName + "'";
 					anyFailed = true;
 					continue;
 				}
@@ -238,39 +348,107 @@ class VulkanShaderCompiler {
 			VulkanCompiledStage result;
 			result.stage = vkStage;
 			result.entryPointName = "main"; // Slang always emits "main" in the SPIR-V binary
-			result.linkedComponent = linked;
-			result.session = session;
 			const auto *data = static_cast<const uint32 *>(spirvBlob->getBufferPointer());
 			result.spirv.assign(data, data + (spirvBlob->getBufferSize() / sizeof(uint32)));
+			ReflectParameters(linked->getLayout(), result.parameters);
 			outStages.push_back(std::move(result));
 		}
 
 		if (outStages.empty() || anyFailed) {
+			if (errorLog.empty()) {
+				errorLog = "All entry points failed to compile in '" + name + "'";
+			}
 			outStages.clear();
 			return false;
 		}
 		return true;
 	}
 
-	static VkShaderStageFlagBits SlangStageToVkStage(SlangStage stage) {
-		switch (stage) {
-		case SLANG_STAGE_VERTEX:
-			return VK_SHADER_STAGE_VERTEX_BIT;
-		case SLANG_STAGE_FRAGMENT:
-			return VK_SHADER_STAGE_FRAGMENT_BIT;
-		case SLANG_STAGE_COMPUTE:
-			return VK_SHADER_STAGE_COMPUTE_BIT;
-		case SLANG_STAGE_GEOMETRY:
-			return VK_SHADER_STAGE_GEOMETRY_BIT;
+	static void ReflectParameters(slang::ProgramLayout *layout, std::vector<VulkanReflectedParameter> &out) {
+		if (layout == nullptr) {
+			return;
+		}
+		for (uint32 i = 0; i < static_cast<uint32>(layout->getParameterCount()); ++i) {
+			slang::VariableLayoutReflection *var = layout->getParameterByIndex(i);
+			if (var == nullptr) {
+				continue;
+			}
+
+			VulkanReflectedParameter param{};
+			param.name = var->getName() != nullptr ? var->getName() : "";
+			param.binding = static_cast<uint32>(var->getBindingIndex());
+			param.set = static_cast<uint32>(var->getBindingSpace());
+
+			slang::TypeLayoutReflection *typeLayout = var->getTypeLayout();
+			param.isDescriptor = ClassifyDescriptor(typeLayout, param.type);
+			if (param.isDescriptor && param.type == DescriptorType::UniformBuffer) {
+				ReflectFields(typeLayout->getElementTypeLayout(), param.fields);
+			}
+			out.push_back(std::move(param));
+		}
+	}
+
+	static bool ClassifyDescriptor(slang::TypeLayoutReflection *typeLayout, DescriptorType &outType) {
+		slang::TypeReflection *type = typeLayout != nullptr ? typeLayout->getType() : nullptr;
+		if (type == nullptr) {
+			return false;
+		}
+
+		using Kind = slang::TypeReflection::Kind;
+		switch (type->getKind()) {
+		case Kind::ConstantBuffer:
+		case Kind::ParameterBlock:
+			outType = DescriptorType::UniformBuffer;
+			return true;
+		case Kind::Resource: {
+			auto base = static_cast<SlangResourceShape>(type->getResourceShape() & SLANG_RESOURCE_BASE_SHAPE_MASK);
+			if (base == SLANG_TEXTURE_1D || base == SLANG_TEXTURE_2D || base == SLANG_TEXTURE_3D ||
+				base == SLANG_TEXTURE_CUBE) {
+				outType = DescriptorType::CombinedImageSampler;
+				return true;
+			}
+			if (base == SLANG_STRUCTURED_BUFFER || base == SLANG_BYTE_ADDRESS_BUFFER) {
+				outType = DescriptorType::StorageBuffer;
+				return true;
+			}
+			return false;
+		}
 		default:
-			AQUILA_LOG_WARNING("VulkanShaderCompiler: unhandled SlangStage {}, defaulting to VERTEX",
-							   static_cast<int>(stage));
-			return VK_SHADER_STAGE_VERTEX_BIT;
+			return false;
 		}
 	}
 
-  private:
-	static inline Slang::ComPtr<slang::IGlobalSession> s_GlobalSession;
+	static void ReflectFields(slang::TypeLayoutReflection *inner, std::vector<VulkanReflectedField> &out) {
+		if (inner == nullptr) {
+			return;
+		}
+		using Kind = slang::TypeReflection::Kind;
+		for (uint32 f = 0; f < static_cast<uint32>(inner->getFieldCount()); ++f) {
+			slang::VariableLayoutReflection *field = inner->getFieldByIndex(f);
+			if (field == nullptr || field->getName() == nullptr) {
+				continue;
+			}
+			slang::TypeReflection *type = field->getTypeLayout() ? field->getTypeLayout()->getType() : nullptr;
+			if (type == nullptr) {
+				continue;
+			}
+			VulkanReflectedField reflected{};
+			reflected.name = field->getName();
+			if (type->getKind() == Kind::Scalar || type->getKind() == Kind::Vector) {
+				reflected.scalarType = static_cast<uint32>(type->getScalarType());
+				reflected.columns = static_cast<uint32>(type->getColumnCount());
+			}
+			out.push_back(std::move(reflected));
+		}
+	}
+
+	static constexpr const char *kTargetProfile = "spirv_1_0";
+
+	static inline std::mutex s_SessionMutex;
+	static inline std::unordered_map<std::thread::id, Slang::ComPtr<slang::IGlobalSession>> s_GlobalSessions;
+	static inline std::mutex s_PrecompiledMutex;
+	static inline std::unordered_map<std::string, PrecompiledResult> s_Precompiled;
+	static inline uint64 s_ConfigHash = 0;
 	static inline bool s_Initialized = false;
 };
 
@@ -5,8 +5,13 @@
 #include "Aquila/Foundation/PrimitiveTypes.h"
 #include "Aquila/Foundation/Math/MathTypes.h"
 
+#include <span>
+#include <glm/gtc/packing.hpp>
+
 namespace Aquila::RHI {
 
+// Full-precision vertex used on the CPU side: importing, cooking, optimizing, picking.
+// What reaches the GPU is its PackedVertex.
 struct Vertex {
 	vec3 pos{};
 	vec3 color{};
@@ -18,21 +23,101 @@ struct Vertex {
 		return pos == other.pos && color == other.color && normals == other.normals && texcoord == other.texcoord &&
 			tangent == other.tangent;
 	}
+};
+
+// PackedVertex
+//
+// The layout the geometry arena stores and default pipelines read: 28 bytes against Vertex's 60.
+// Normal and tangent are octahedral-encoded into one RGBA16_SNORM attribute, UVs are half floats
+// and the color is RGBA8 with the bitangent sign in alpha. Positions stay full float since all
+// meshes share the arena's stride; normalized-int positions would need a per-draw dequantize.
+// Shaders decode it with Utility/VertexData.slang.
+struct PackedVertex {
+	vec3 pos{};
+	uint32 color = 0;			 // RGBA8_UNORM, a = bitangent sign (0 -> -1, 255 -> +1)
+	int16 normalTangent[4] = {}; // RGBA16_SNORM, xy = octahedral normal, zw = octahedral tangent
+	uint16 texcoord[2] = {};	 // RG16_SFLOAT
 
 	static std::vector<VkVertexInputBindingDescription> GetBindingDescriptions() {
-		return { { 0, sizeof(Vertex), VK_VERTEX_INPUT_RATE_VERTEX } };
+		return { { 0, sizeof(PackedVertex), VK_VERTEX_INPUT_RATE_VERTEX } };
 	}
 
 	static std::vector<VkVertexInputAttributeDescription> GetAttributeDescriptions() {
 		return {
-			{ 0, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Vertex, pos) },
-			{ 1, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Vertex, color) },
-			{ 2, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Vertex, normals) },
-			{ 3, 0, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(Vertex, tangent) },
-			{ 4, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(Vertex, texcoord) },
+			{ 0, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(PackedVertex, pos) },
+			{ 1, 0, VK_FORMAT_R8G8B8A8_UNORM, offsetof(PackedVertex, color) },
+			{ 2, 0, VK_FORMAT_R16G16B16A16_SNORM, offsetof(PackedVertex, normalTangent) },
+			{ 3, 0, VK_FORMAT_R16G16_SFLOAT, offsetof(PackedVertex, texcoord) },
 		};
 	}
 };
+static_assert(sizeof(PackedVertex) == 28, "PackedVertex layout must match Utility/VertexData.slang");
+
+// Maps a unit vector onto the [-1, 1]^2 octahedron parameterization.
+inline vec2 OctEncode(vec3 n) {
+	n /= glm::abs(n.x) + glm::abs(n.y) + glm::abs(n.z);
+	vec2 p(n.x, n.y);
+	if (n.z < 0.F) {
+		const vec2 sign(p.x >= 0.F ? 1.F : -1.F, p.y >= 0.F ? 1.F : -1.F);
+		p = (vec2(1.F) - glm::abs(vec2(p.y, p.x))) * sign;
+	}
+	return p;
+}
+
+inline vec3 OctDecode(vec2 e) {
+	vec3 n(e.x, e.y, 1.F - glm::abs(e.x) - glm::abs(e.y));
+	const f32 t = glm::clamp(-n.z, 0.F, 1.F);
+	n.x += n.x >= 0.F ? -t : t;
+	n.y += n.y >= 0.F ? -t : t;
+	return glm::normalize(n);
+}
+
+inline PackedVertex PackVertex(const Vertex &v) {
+	const auto snorm = [](f32 value) {
+		return static_cast<int16>(std::round(glm::clamp(value, -1.F, 1.F) * 32767.F));
+	};
+
+	PackedVertex packed;
+	packed.pos = v.pos;
+	packed.color = glm::packUnorm4x8(vec4(v.color, v.tangent.w < 0.F ? 0.F : 1.F));
+
+	const vec3 normal = glm::length(v.normals) > 0.F ? v.normals : vec3(0.F, 1.F, 0.F);
+	const vec3 tangent = glm::length(vec3(v.tangent)) > 0.F ? vec3(v.tangent) : vec3(1.F, 0.F, 0.F);
+	const vec2 n = OctEncode(normal);
+	const vec2 t = OctEncode(tangent);
+	packed.normalTangent[0] = snorm(n.x);
+	packed.normalTangent[1] = snorm(n.y);
+	packed.normalTangent[2] = snorm(t.x);
+	packed.normalTangent[3] = snorm(t.y);
+
+	packed.texcoord[0] = static_cast<uint16>(glm::packHalf1x16(v.texcoord.x));
+	packed.texcoord[1] = static_cast<uint16>(glm::packHalf1x16(v.texcoord.y));
+	return packed;
+}
+
+// CPU mirror of the shader-side decode.
+inline Vertex UnpackVertex(const PackedVertex &packed) {
+	const auto snorm = [](int16 value) { return glm::max(static_cast<f32>(value) / 32767.F, -1.F); };
+
+	const vec4 color = glm::unpackUnorm4x8(packed.color);
+	Vertex v;
+	v.pos = packed.pos;
+	v.color = vec3(color);
+	v.normals = OctDecode(vec2(snorm(packed.normalTangent[0]), snorm(packed.normalTangent[1])));
+	v.tangent = vec4(OctDecode(vec2(snorm(packed.normalTangent[2]), snorm(packed.normalTangent[3]))),
+					 color.a < 0.5F ? -1.F : 1.F);
+	v.texcoord = vec2(glm::unpackHalf1x16(packed.texcoord[0]), glm::unpackHalf1x16(packed.texcoord[1]));
+	return v;
+}
+
+inline std::vector<PackedVertex> PackVertices(std::span<const Vertex> vertices) {
+	std::vector<PackedVertex> packed;
+	packed.reserve(vertices.size());
+	for (const Vertex &v : vertices) {
+		packed.push_back(PackVertex(v));
+	}
+	return packed;
+}
 
 } // namespace Aquila::RHI
 #endif
@@ -0,0 +1,74 @@
+#pragma once
+#include "Aquila/Foundation/Defines.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/Foundation/SharedConstants.h"
+#include "Aquila/GFX/GfxDescriptorSet.h"
+#include "Aquila/GFX/GfxTexture.h"
+
+namespace Aquila::GFX {
+class GfxContext;
+}
+
+namespace Aquila::Rendering {
+
+// BindlessTextures
+//
+// Slot allocator for the sampled-image array in the scene descriptor set (binding 6,
+// MAX_BINDLESS_TEXTURES elements). Shaders reach a texture through the slot stored in the
+// material table, so binding a new texture to a material never touches a descriptor set
+// at draw time.
+//
+// Acquire is reference counted per texture: materials sharing a texture share its slot.
+// Writes are queued per frame-in-flight and applied by Update to the set of the frame being
+// recorded, whose previous use has completed, so no update-after-bind is needed. A slot
+// whose last reference goes away is pointed back at the 1x1 white default texture and only
+// handed out again once every frame that could still sample it has retired.
+//
+// Without descriptorBindingPartiallyBound the whole array is filled with the default
+// texture up front.
+
+class BindlessTextures {
+  public:
+	static constexpr uint32 kBinding = 6;
+
+	explicit BindlessTextures(GFX::GfxContext &ctx);
+	~BindlessTextures() = default;
+
+	AQUILA_NONCOPYABLE(BindlessTextures);
+
+	// Returns the texture's slot, allocating one on first use; kNoBindlessTexture if full.
+	[[nodiscard]] uint32 Acquire(const Ref<GFX::GfxTexture> &texture);
+	void Release(uint32 slot);
+
+	// Applies the writes queued for frameSlot to that frame's scene set.
+	void Update(uint32 frameSlot, GFX::GfxDescriptorSet &set);
+
+	[[nodiscard]] uint32 GetLiveCount() const { return static_cast<uint32>(m_SlotLookup.size()); }
+
+  private:
+	struct Slot {
+		Ref<GFX::GfxTexture> texture;
+		uint32 refCount = 0;
+	};
+
+	struct RetiredSlot {
+		uint32 slot = 0;
+		uint64 retiredAt = 0;
+	};
+
+	void QueueWrite(uint32 slot);
+
+	Ref<GFX::GfxTexture> m_DefaultTexture;
+
+	std::vector<Slot> m_Slots;
+	std::unordered_map<GFX::GfxTexture *, uint32> m_SlotLookup;
+	std::priority_queue<uint32, std::vector<uint32>, std::greater<>> m_FreeSlots;
+	std::deque<RetiredSlot> m_Retired;
+	uint64 m_UpdateIndex = 0;
+	bool m_OverflowReported = false;
+
+	std::array<std::vector<uint32>, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_PendingWrites;
+};
+
+} // namespace Aquila::Rendering
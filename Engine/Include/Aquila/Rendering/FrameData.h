@@ -41,7 +41,7 @@ struct GpuFrameData {
 	uint32 frameIndex;
 
 	vec2 screenResolution;
-	uint32 lightCount;
+	uint32 lightCount; // light slots, disabled holes included
 	uint32 _pad;
 };
 
@@ -1,24 +1,20 @@
 #pragma once
+#include <atomic>
 #include "Aquila/Foundation/Singleton.h"
 
 namespace Aquila::Rendering {
 
 class FrameScheduler : public Foundation::Singleton<FrameScheduler> {
   public:
+	// Safe from any thread, e.g. a file watcher waking an idle loop.
 	void RequestFrame() { m_Dirty = true; }
 
-	bool Consume() {
-		if (!m_Dirty) {
-			return false;
-		}
-		m_Dirty = false;
-		return true;
-	}
+	bool Consume() { return m_Dirty.exchange(false); }
 
   private:
 	friend class Foundation::Singleton<FrameScheduler>;
 	FrameScheduler() = default;
-	bool m_Dirty = true; // always render the first frame
+	std::atomic<bool> m_Dirty{ true }; // always render the first frame
 };
 
 } // namespace Aquila::Rendering
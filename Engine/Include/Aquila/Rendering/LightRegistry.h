@@ -0,0 +1,66 @@
+#pragma once
+#include "entt.h"
+#include "Aquila/Foundation/Defines.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/Foundation/SharedConstants.h"
+#include "Aquila/Rendering/LightData.h"
+#include "Aquila/Rendering/PerFrameStorageBuffer.h"
+
+namespace Aquila::Rendering {
+
+// LightRegistry
+//
+// Persistent GPU light table. Every active light entity owns a slot for as long as it
+// lives, so a light that did not change costs nothing to upload. Slots are reused
+// lowest-first, which keeps the table dense and the slot count (what the cull shader
+// iterates) close to the live count.
+//
+// The GPU copies live in a PerFrameStorageBuffer: Sync marks changed slots dirty, Upload
+// writes only those into the copy of the frame being recorded. Copies grow up to MAX_LIGHTS.
+//
+// Freed slots are written as disabled lights (no LIGHT_FLAG_ENABLED) rather than
+// compacted, so slot indices stay stable for anything that cached them.
+
+class LightRegistry {
+  public:
+	static constexpr uint32 kLightFlagEnabled = 1u << 0;
+
+	explicit LightRegistry(GFX::GfxContext &ctx);
+	~LightRegistry() = default;
+
+	AQUILA_NONCOPYABLE(LightRegistry);
+
+	// Reconciles slots with the light entities of the registry: allocates slots for new
+	// lights, rewrites changed ones and frees slots of lights that went away or inactive.
+	void Sync(entt::registry &registry);
+
+	// Writes the dirty range of frameSlot's copy. Returns true if the copy was reallocated.
+	bool Upload(uint32 frameSlot);
+
+	[[nodiscard]] GFX::GfxBuffer &GetBuffer(uint32 frameSlot) const { return m_Buffers.GetBuffer(frameSlot); }
+
+	// Upper bound of used slots; slots below it may be disabled holes.
+	[[nodiscard]] uint32 GetSlotCount() const { return static_cast<uint32>(m_Lights.size()); }
+	[[nodiscard]] uint32 GetLiveCount() const { return static_cast<uint32>(m_EntitySlots.size()); }
+
+  private:
+	struct SlotRef {
+		uint32 slot = 0;
+		uint64 lastSeen = 0;
+	};
+
+	[[nodiscard]] uint32 AllocateSlot();
+	void ReleaseSlot(uint32 slot);
+
+	std::unordered_map<entt::entity, SlotRef> m_EntitySlots;
+	std::vector<GpuLightData> m_Lights; // CPU mirror, indexed by slot
+	std::vector<bool> m_SlotUsed;
+	std::priority_queue<uint32, std::vector<uint32>, std::greater<>> m_FreeSlots;
+	uint64 m_SyncIndex = 0;
+	bool m_OverflowReported = false;
+
+	PerFrameStorageBuffer<GpuLightData> m_Buffers;
+};
+
+} // namespace Aquila::Rendering
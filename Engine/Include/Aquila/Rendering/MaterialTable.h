@@ -0,0 +1,75 @@
+#pragma once
+#include <unordered_set>
+#include "entt.h"
+#include "Aquila/Foundation/Defines.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/Foundation/SharedConstants.h"
+#include "Aquila/Foundation/UUID.h"
+#include "Aquila/Graphics/SurfaceData.h"
+#include "Aquila/Rendering/BindlessTextures.h"
+#include "Aquila/Rendering/PerFrameStorageBuffer.h"
+
+namespace Aquila::SceneManagement {
+class Scene;
+}
+
+namespace Aquila::Rendering {
+
+// MaterialTable
+//
+// Persistent GPU table of surface parameters. A MaterialComponent gets a slot the first
+// time the table sees it and keeps it (materialIndex) until the component is destroyed;
+// freed slots are reused lowest-first.
+//
+// Changes come from the scene (GetDirtyMaterials / GetReleasedMaterials), so a frame in
+// which no material changed uploads nothing. The GPU copies live in a PerFrameStorageBuffer
+// like LightRegistry's and grow up to MAX_MATERIALS; components that find the table full
+// keep an invalid index and are assigned again as soon as a slot frees up. Switching scenes
+// rebuilds the table from scratch.
+//
+// The component's textures are resolved to BindlessTextures slots here and written into
+// textureIndices; the table holds one reference per texture per material slot.
+
+class MaterialTable {
+  public:
+	MaterialTable(GFX::GfxContext &ctx, BindlessTextures &textures);
+	~MaterialTable() = default;
+
+	AQUILA_NONCOPYABLE(MaterialTable);
+
+	// Applies and consumes the scene's pending material changes.
+	void Sync(SceneManagement::Scene &scene);
+
+	// Writes the dirty range of frameSlot's copy. Returns true if the copy was reallocated.
+	bool Upload(uint32 frameSlot);
+
+	[[nodiscard]] GFX::GfxBuffer &GetBuffer(uint32 frameSlot) const { return m_Copies.GetBuffer(frameSlot); }
+
+	[[nodiscard]] uint32 GetSlotCount() const { return static_cast<uint32>(m_SlotOwners.size()); }
+	[[nodiscard]] uint32 GetLiveCount() const { return m_LiveCount; }
+
+  private:
+	void Rebuild(SceneManagement::Scene &scene);
+	void Assign(entt::registry &registry, entt::entity entity);
+	void RetryOverflowed(entt::registry &registry);
+
+	[[nodiscard]] uint32 AllocateSlot();
+	void ReleaseSlot(uint32 slot);
+	void ReleaseTextures(const Graphics::GpuSurfaceData &surface);
+
+	BindlessTextures &m_Textures;
+
+	std::vector<Graphics::GpuSurfaceData> m_Surfaces; // CPU mirror, indexed by slot
+	std::vector<entt::entity> m_SlotOwners;			  // entt::null for free slots
+	std::priority_queue<uint32, std::vector<uint32>, std::greater<>> m_FreeSlots;
+	uint32 m_LiveCount = 0;
+	std::unordered_set<entt::entity> m_Overflowed; // components left without a slot
+	bool m_OverflowReported = false;
+
+	std::optional<Foundation::UUID> m_SceneId;
+
+	PerFrameStorageBuffer<Graphics::GpuSurfaceData> m_Copies;
+};
+
+} // namespace Aquila::Rendering
@@ -0,0 +1,37 @@
+#pragma once
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/Foundation/SharedConstants.h"
+#include "Aquila/Graphics/Resources/MeshSimplifier.h"
+
+namespace Aquila::Graphics::Resources {
+class Mesh;
+}
+
+namespace Aquila::Rendering {
+
+struct FrameContext;
+
+// MeshLodSelector
+//
+// Picks the LOD to draw for one instance from the screen-space size of each level's error:
+// the coarsest level whose error projects to at most MESH_LOD_ERROR_PIXELS. The projection
+// uses the mesh's bounding sphere, so it is conservative for the nearest point of the mesh.
+//
+// Against popping the choice is sticky: a finer level is taken as soon as the current one
+// exceeds the threshold, but a coarser one only once it is under threshold x
+// MESH_LOD_HYSTERESIS. Applying the rule to its own result changes nothing, so every pass
+// that draws an instance can call Select with the instance's stored LOD and they agree.
+class MeshLodSelector {
+  public:
+	// Pixels covered by one object-space unit of error at the instance's nearest point.
+	static f32 PixelsPerUnit(const Graphics::Resources::Mesh &mesh, const mat4 &model, const FrameContext &ctx);
+
+	static uint32 Select(std::span<const Graphics::Resources::MeshLod> lods, uint32 current, f32 pixelsPerUnit,
+						 f32 thresholdPixels = SharedConstants::MESH_LOD_ERROR_PIXELS,
+						 f32 hysteresis = SharedConstants::MESH_LOD_HYSTERESIS);
+
+	static uint32 Select(const Graphics::Resources::Mesh &mesh, const mat4 &model, uint32 current,
+						 const FrameContext &ctx);
+};
+
+} // namespace Aquila::Rendering
@@ -0,0 +1,103 @@
+#pragma once
+#include "Aquila/Foundation/Defines.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/Foundation/SharedConstants.h"
+#include "Aquila/GFX/GfxBuffer.h"
+#include "Aquila/GFX/GfxContext.h"
+
+#include <span>
+
+namespace Aquila::Rendering {
+
+// PerFrameStorageBuffer
+//
+// A persistent storage-buffer table of T with one copy per frame-in-flight, mirroring a
+// CPU array the owner keeps. MarkDirty widens the dirty element range of every copy;
+// Upload writes only that range into the copy of the frame being recorded.
+//
+// Copies grow by doubling from initialCapacity up to maxCapacity. A copy is reallocated
+// only on its own frame, when its fence has been waited on, so it can be replaced outright
+// while the other frames' copies are still in use; a reallocated copy is rewritten in full
+// and Upload reports it so the caller can rebind it.
+
+template <typename T> class PerFrameStorageBuffer {
+  public:
+	PerFrameStorageBuffer(GFX::GfxContext &ctx, std::string debugName, uint32 initialCapacity, uint32 maxCapacity)
+		: m_Ctx(ctx), m_DebugName(std::move(debugName)), m_InitialCapacity(initialCapacity),
+		  m_MaxCapacity(maxCapacity) {
+		for (uint32 i = 0; i < SharedConstants::MAX_FRAMES_IN_FLIGHT; ++i) {
+			m_Copies[i].buffer = CreateBuffer(initialCapacity, i);
+			m_Copies[i].capacity = initialCapacity;
+		}
+	}
+	~PerFrameStorageBuffer() = default;
+
+	AQUILA_NONCOPYABLE(PerFrameStorageBuffer);
+
+	void MarkDirty(uint32 begin, uint32 end) {
+		for (FrameCopy &copy : m_Copies) {
+			copy.dirtyBegin = std::min(copy.dirtyBegin, begin);
+			copy.dirtyEnd = std::max(copy.dirtyEnd, end);
+		}
+	}
+
+	// Writes the dirty part of elements into frameSlot's copy. Returns true if the copy was reallocated.
+	bool Upload(uint32 frameSlot, std::span<const T> elements) {
+		FrameCopy &copy = m_Copies[frameSlot];
+		const auto count = static_cast<uint32>(elements.size());
+
+		bool reallocated = false;
+		if (count > copy.capacity) {
+			uint32 capacity = std::max(copy.capacity, m_InitialCapacity);
+			while (capacity < count) {
+				capacity *= 2;
+			}
+			capacity = std::min(capacity, m_MaxCapacity);
+
+			copy.buffer = CreateBuffer(capacity, frameSlot);
+			copy.capacity = capacity;
+			copy.dirtyBegin = 0;
+			copy.dirtyEnd = count;
+			reallocated = true;
+		}
+
+		const uint32 end = std::min(copy.dirtyEnd, count);
+		if (copy.dirtyBegin < end) {
+			copy.buffer->Write(elements.data() + copy.dirtyBegin, sizeof(T) * (end - copy.dirtyBegin),
+							   sizeof(T) * copy.dirtyBegin);
+		}
+		copy.dirtyBegin = UINT32_MAX;
+		copy.dirtyEnd = 0;
+
+		return reallocated;
+	}
+
+	[[nodiscard]] GFX::GfxBuffer &GetBuffer(uint32 frameSlot) const { return *m_Copies[frameSlot].buffer; }
+
+  private:
+	struct FrameCopy {
+		Ref<GFX::GfxBuffer> buffer;
+		uint32 capacity = 0;
+		uint32 dirtyBegin = UINT32_MAX;
+		uint32 dirtyEnd = 0;
+	};
+
+	[[nodiscard]] Ref<GFX::GfxBuffer> CreateBuffer(uint32 capacity, uint32 frameSlot) const {
+		return m_Ctx.CreateBuffer({
+			.size = sizeof(T) * capacity,
+			.usage = RHI::BufferUsage::StorageBuffer,
+			.domain = RHI::MemoryDomain::CPU_TO_GPU,
+			.debugName = m_DebugName + "_" + std::to_string(frameSlot),
+		});
+	}
+
+	GFX::GfxContext &m_Ctx;
+	std::string m_DebugName;
+	uint32 m_InitialCapacity;
+	uint32 m_MaxCapacity;
+
+	std::array<FrameCopy, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_Copies;
+};
+
+} // namespace Aquila::Rendering
@@ -30,11 +30,18 @@ class RenderPipeline {
 		static_assert(std::is_base_of_v<IRenderer, T>, "T must derive from IRenderer");
 		auto renderer = CreateUnique<T>(std::forward<Args>(args)...);
 		T &ref = *renderer;
-		renderer->OnInit(m_Ctx);
+		if (m_Initialized) {
+			renderer->OnInit(m_Ctx);
+		}
 		m_Renderers.push_back(std::move(renderer));
 		return ref;
 	}
 
+	// Compiles every shader the renderers and their systems declared across the JobSystem,
+	// then runs their OnInit, which creates the pipelines from the precompiled results.
+	// Renderers added afterwards are initialized straight away.
+	void Initialize();
+
 	void Render(GFX::GfxCommandList &cmd, SceneManagement::Scene &scene, f32 deltaTime);
 	void Render(GFX::GfxCommandList &cmd, SceneManagement::Scene &scene, f32 deltaTime, uint32 width, uint32 height);
 	void Resize(uint32 width, uint32 height);
@@ -59,6 +66,7 @@ class RenderPipeline {
 
 	// Rotates 0..MAX_FRAMES_IN_FLIGHT-1 each Render() call, matching swapchain fence rotation.
 	uint32 m_FrameSlot = 0;
+	bool m_Initialized = false;
 };
 
 } // namespace Aquila::Rendering
@@ -20,6 +20,8 @@ class IRenderer {
 	AQUILA_NONCOPYABLE(IRenderer);
 	AQUILA_NONMOVEABLE(IRenderer);
 
+	// Shader files OnInit will compile, its systems' included. Called before OnInit.
+	virtual void DeclareShaders(std::vector<std::string> & /*outPaths*/) const {}
 	virtual void OnInit(GFX::GfxContext &ctx) = 0;
 	virtual void AddPasses(Graphics::RG::RenderGraph &graph, FrameContext &ctx) = 0;
 	virtual void BlitToSwapchain(Graphics::RG::RenderGraph & /*graph*/, FrameContext & /*ctx*/) {}
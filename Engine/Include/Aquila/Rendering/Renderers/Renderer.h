@@ -20,17 +20,21 @@ class Renderer : public IRenderer {
 	AQUILA_NONCOPYABLE(Renderer);
 	AQUILA_NONMOVEABLE(Renderer);
 
+	void DeclareShaders(std::vector<std::string> &outPaths) const override;
 	void OnInit(GFX::GfxContext &ctx) override;
 	void OnShutdown() override;
 	void AddPasses(Graphics::RG::RenderGraph &graph, FrameContext &ctx) override;
 	void BlitToSwapchain(Graphics::RG::RenderGraph &graph, FrameContext &ctx) override;
 	void SetSwapchainTarget(GFX::GfxSwapchain &swapchain, uint32 imageIndex);
 
+	// Systems added before OnInit are initialized by it, after their shaders were precompiled.
 	template <typename T, typename... Args> T &AddSystem(Args &&...args) {
 		static_assert(std::is_base_of_v<IRenderingSystem, T>);
 		auto sys = CreateUnique<T>(std::forward<Args>(args)...);
 		T &ref = *sys;
-		sys->OnInit(*m_Ctx);
+		if (m_Ctx != nullptr) {
+			sys->OnInit(*m_Ctx);
+		}
 		m_Systems.push_back(std::move(sys));
 		return ref;
 	}
@@ -19,6 +19,7 @@ class Renderer2D : public IRenderer {
 	AQUILA_NONCOPYABLE(Renderer2D);
 	AQUILA_NONMOVEABLE(Renderer2D);
 
+	void DeclareShaders(std::vector<std::string> &outPaths) const override;
 	void OnInit(GFX::GfxContext &ctx) override;
 	void OnShutdown() override;
 	void AddPasses(Graphics::RG::RenderGraph &graph, FrameContext &ctx) override;
@@ -27,11 +28,14 @@ class Renderer2D : public IRenderer {
 	void SetSwapchainTarget(GFX::GfxSwapchain &swapchain, uint32 imageIndex);
 	void SetUIDirty(bool dirty) { m_UIDirty = dirty; }
 
+	// Systems added before OnInit are initialized by it, after their shaders were precompiled.
 	template <typename T, typename... Args> T &AddSystem(Args &&...args) {
 		static_assert(std::is_base_of_v<I2DRenderingSystem, T>);
 		auto sys = CreateUnique<T>(std::forward<Args>(args)...);
 		T &ref = *sys;
-		sys->OnInit(*m_Ctx);
+		if (m_Ctx != nullptr) {
+			sys->OnInit(*m_Ctx);
+		}
 		m_Systems.push_back(std::move(sys));
 		return ref;
 	}
@@ -1,13 +1,18 @@
 #pragma once
+#include <span>
 #include "Aquila/Foundation/Defines.h"
 #include "Aquila/Foundation/PrimitiveTypes.h"
 #include "Aquila/Foundation/SharedConstants.h"
 #include "Aquila/Foundation/Singleton.h"
+#include "Aquila/Rendering/BindlessTextures.h"
 #include "Aquila/Rendering/FrameData.h"
 #include "Aquila/Rendering/LightData.h"
+#include "Aquila/Rendering/LightRegistry.h"
+#include "Aquila/Rendering/MaterialTable.h"
 #include "Aquila/Graphics/SurfaceData.h"
 #include "Aquila/GFX/GfxBuffer.h"
 #include "Aquila/GFX/GfxDescriptorSet.h"
+#include "Aquila/GFX/GfxUploadRing.h"
 
 namespace Aquila::GFX {
 class GfxContext;
@@ -28,12 +33,25 @@ class SceneFrameData : public Foundation::Singleton<SceneFrameData> {
 	void OnResize(uint32 width, uint32 height);
 
 	[[nodiscard]] GFX::GfxDescriptorSet &GetDescriptorSet(uint32 frameSlot) const;
+	// Frame and environment constants live in the upload ring: pass these with every bind of the set.
+	[[nodiscard]] std::span<const uint32> GetDynamicOffsets(uint32 frameSlot) const {
+		return m_RingBindings[frameSlot].offsets;
+	}
 	[[nodiscard]] GFX::GfxDescriptorSetLayout &GetLayout() const { return *m_Layout; }
 
 	[[nodiscard]] GFX::GfxBuffer &GetLightIndexListBuffer() const { return *m_LightIndexListBuffer; }
 	[[nodiscard]] GFX::GfxBuffer &GetClusterLightInfoBuffer() const { return *m_ClusterLightInfoBuffer; }
+	[[nodiscard]] const LightRegistry &GetLightRegistry() const { return *m_LightRegistry; }
+	[[nodiscard]] const MaterialTable &GetMaterialTable() const { return *m_MaterialTable; }
+	[[nodiscard]] const BindlessTextures &GetBindlessTextures() const { return *m_BindlessTextures; }
 
   private:
+	struct RingBindings {
+		uint32 frameBufferId = 0;
+		uint32 envBufferId = 0;
+		std::array<uint32, 2> offsets{}; // bindings 0 and 2
+	};
+
 	GFX::GfxContext &m_Ctx;
 	uint32 m_Width = 0;
 	uint32 m_Height = 0;
@@ -42,19 +60,18 @@ class SceneFrameData : public Foundation::Singleton<SceneFrameData> {
 
 	Ref<GFX::GfxDescriptorSetLayout> m_Layout;
 
-	std::array<Ref<GFX::GfxBuffer>, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_FrameBuffers;
-
-	std::array<Ref<GFX::GfxBuffer>, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_LightBuffers;
-
-	std::array<Ref<GFX::GfxBuffer>, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_EnvBuffers;
+	Unique<LightRegistry> m_LightRegistry;
 
-	std::array<Ref<GFX::GfxBuffer>, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_MaterialBuffers;
+	// Declared first so it outlives the material table, which releases slots into it.
+	Unique<BindlessTextures> m_BindlessTextures;
+	Unique<MaterialTable> m_MaterialTable;
 
 	Ref<GFX::GfxBuffer> m_LightIndexListBuffer;
 
 	Ref<GFX::GfxBuffer> m_ClusterLightInfoBuffer;
 
 	std::array<Ref<GFX::GfxDescriptorSet>, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_Sets;
+	std::array<RingBindings, SharedConstants::MAX_FRAMES_IN_FLIGHT> m_RingBindings;
 };
 
 } // namespace Aquila::Rendering
@@ -25,6 +25,8 @@ class I2DRenderingSystem {
 	AQUILA_NONCOPYABLE(I2DRenderingSystem);
 	AQUILA_NONMOVEABLE(I2DRenderingSystem);
 
+	// Shader files OnInit will compile. Called before OnInit so they can be compiled in parallel.
+	virtual void DeclareShaders(std::vector<std::string> & /*outPaths*/) const {}
 	virtual void OnInit(GFX::GfxContext &ctx) = 0;
 	virtual void AddPasses(Graphics::RG::RenderGraph &graph, FrameContext &ctx, Graphics::QuadBatcher &r2d) {}
 	virtual void Render(Graphics::QuadBatcher &r2d, GFX::GfxCommandList &cmd) {}
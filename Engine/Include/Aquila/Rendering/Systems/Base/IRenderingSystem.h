@@ -19,6 +19,8 @@ class IRenderingSystem {
 	AQUILA_NONCOPYABLE(IRenderingSystem);
 	AQUILA_NONMOVEABLE(IRenderingSystem);
 
+	// Shader files OnInit will compile. Called before OnInit so they can be compiled in parallel.
+	virtual void DeclareShaders(std::vector<std::string> & /*outPaths*/) const {}
 	virtual void OnInit(GFX::GfxContext &ctx) = 0;
 	virtual void AddPasses(Graphics::RG::RenderGraph &graph, FrameContext &ctx) = 0;
 	virtual void OnShutdown() {}
@@ -20,17 +20,41 @@ class ClusterComputeSystem : public RenderingSystemBase {
 	ClusterComputeSystem() = default;
 	~ClusterComputeSystem() override = default;
 
+	void DeclareShaders(std::vector<std::string> &outPaths) const override;
 	void OnInit(GFX::GfxContext &ctx) override;
 	void AddPasses(Graphics::RG::RenderGraph &graph, FrameContext &ctx) override;
 
+	// Debug: after every rebuild, copy the AABBs back and log them. Waits for the device
+	// to go idle, so leave it off outside of debugging.
+	void SetDebugReadback(bool enabled) { m_DebugReadback = enabled; }
+	[[nodiscard]] bool IsDebugReadbackEnabled() const { return m_DebugReadback; }
+
+	// Forces a rebuild next frame.
+	void Invalidate() { m_BuiltKey.reset(); }
+
   private:
+	// The AABBs depend only on the projection and the viewport; the dispatch is skipped
+	// while both stay the same.
+	struct GridKey {
+		mat4 projection = mat4(1.f);
+		uint32 width = 0;
+		uint32 height = 0;
+
+		bool operator==(const GridKey &) const = default;
+	};
+
+	void ReadBackAABBs();
+
 	Ref<GFX::GfxPipeline> m_Pipeline;
 	Ref<GFX::GfxDescriptorSetLayout> m_StorageLayout;
 	Ref<GFX::GfxBuffer> m_OutputBuffer;
 	Ref<GFX::GfxBuffer> m_GridBuffer;
 	Ref<GFX::GfxDescriptorSet> m_StorageSet;
-	bool m_Verified = false;
 	GridData m_GridData{};
+
+	std::optional<GridKey> m_BuiltKey;
+	bool m_DebugReadback = false;
+	bool m_ReadbackPending = false;
 };
 
 } // namespace Aquila::Rendering
@@ -10,6 +10,7 @@ class DepthPrepassSystem : public RenderingSystemBase {
 	DepthPrepassSystem() = default;
 	~DepthPrepassSystem() override = default;
 
+	void DeclareShaders(std::vector<std::string> &outPaths) const override;
 	void OnInit(GFX::GfxContext &ctx) override;
 	void AddPasses(Graphics::RG::RenderGraph &graph, FrameContext &ctx) override;
 
@@ -11,13 +11,13 @@ class LightCullingSystem : public RenderingSystemBase {
 	LightCullingSystem() = default;
 	~LightCullingSystem() override = default;
 
+	void DeclareShaders(std::vector<std::string> &outPaths) const override;
 	void OnInit(GFX::GfxContext &ctx) override;
 	void AddPasses(Graphics::RG::RenderGraph &graph, FrameContext &ctx) override;
 
   private:
 	Ref<GFX::GfxPipeline> m_Pipeline;
 	Ref<GFX::GfxDescriptorSetLayout> m_StorageLayout;
-	Ref<GFX::GfxBuffer> m_GlobalIndexCounter; // atomic counter reset each frame before dispatch
 	Ref<GFX::GfxDescriptorSet> m_StorageSet;
 	bool m_AABBBufferBound = false;
 };
@@ -3,6 +3,7 @@
 #include "Aquila/Foundation/PrimitiveTypes.h"
 #include "Aquila/GFX/GfxContext.h"
 #include "Aquila/GFX/GfxMesh.h"
+#include "Aquila/GFX/GfxMeshRegistry.h"
 #include "Aquila/Graphics/Resources/Mesh.h"
 #include "Aquila/Rendering/Systems/Base/IRenderingSystem.h"
 
@@ -12,8 +13,8 @@ namespace Aquila::Rendering {
 //
 // Convenient base for concrete rendering systems. Adds:
 //   - m_Ctx pointer set during OnInit so subclasses don't hold it separately.
-//   - GetOrUploadMesh() — uploads a CPU Mesh to the GPU on first call and caches the
-//     result by pointer, avoiding redundant uploads across frames and systems.
+//   - GetOrUploadMesh() — forwards to the context's GfxMeshRegistry, so every system
+//     drawing the same CPU Mesh shares a single GPU upload.
 //
 // Subclasses must implement AddPasses(). OnInit / OnShutdown are open for extension
 // (call the base version when you do).
@@ -27,23 +28,14 @@ class RenderingSystemBase : public IRenderingSystem {
 
 	void OnInit(GFX::GfxContext &ctx) override { m_Ctx = &ctx; }
 
-	void OnShutdown() override { m_MeshCache.clear(); }
+	void OnShutdown() override {}
 
   protected:
 	Ref<GFX::GfxMesh> GetOrUploadMesh(const Ref<Graphics::Resources::Mesh> &mesh) {
-		auto it = m_MeshCache.find(mesh.get());
-		if (it != m_MeshCache.end()) {
-			return it->second;
-		}
-		auto gpu = GFX::GfxMesh::Create(*m_Ctx, *mesh);
-		m_MeshCache[mesh.get()] = gpu;
-		return gpu;
+		return m_Ctx->GetMeshRegistry().GetOrUpload(mesh);
 	}
 
 	GFX::GfxContext *m_Ctx = nullptr;
-
-  private:
-	std::unordered_map<Graphics::Resources::Mesh *, Ref<GFX::GfxMesh>> m_MeshCache;
 };
 
 } // namespace Aquila::Rendering
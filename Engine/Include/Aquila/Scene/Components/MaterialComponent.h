@@ -2,6 +2,7 @@
 #include "Aquila/Graphics/Material/Material.h"
 #include "Aquila/Graphics/Material/MaterialDefinition.h"
 #include "Aquila/Graphics/SurfaceData.h"
+#include "Aquila/GFX/GfxTexture.h"
 
 namespace Aquila::SceneManagement::Components {
 
@@ -10,8 +11,14 @@ struct MaterialComponent {
 
 	Graphics::MaterialType type = Graphics::MaterialType::Lit;
 
+	// Edit through Entity::PatchComponent after the first frame, or the GPU copy goes stale.
 	Graphics::GpuSurfaceData surfaceProperties;
 
+	// Sampled through the scene's bindless texture array, indexed by SurfaceTexture; null
+	// slots fall back to the constants above. Same edit rule as surfaceProperties.
+	std::array<Ref<GFX::GfxTexture>, static_cast<usize>(Graphics::SurfaceTexture::Count)> textures;
+
+	// Slot in the renderer's material table, assigned and recycled by Rendering::MaterialTable.
 	uint32 materialIndex = UINT32_MAX;
 
 	MaterialComponent() = default;
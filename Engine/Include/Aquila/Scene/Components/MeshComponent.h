@@ -27,6 +27,12 @@ struct MeshComponent {
 	 */
 	uint32 version = 0;
 
+	/**
+	 * @brief LOD drawn last frame, runtime only
+	 * Fed back into Rendering::MeshLodSelector so the choice has hysteresis
+	 */
+	uint32 lodIndex = 0;
+
 	/**
 	 * @brief Set a new mesh and automatically increment version
 	 * @param newMesh The mesh to assign
@@ -35,6 +41,7 @@ struct MeshComponent {
 		if (data != newMesh) {
 			data = newMesh;
 			version++;
+			lodIndex = 0;
 
 			// Reset materials when mesh changes
 			materials.clear();
@@ -86,6 +86,11 @@ class Entity {
 		return m_Scene->GetRegistry().get_or_emplace<T>(m_EntityHandle, std::forward<Args>(args)...);
 	}
 
+	// Edits a component in place and notifies on_update listeners (e.g. material uploads).
+	template <typename T, typename Func> T &PatchComponent(Func &&func) {
+		return m_Scene->GetRegistry().patch<T>(m_EntityHandle, std::forward<Func>(func));
+	}
+
 	template <typename T> [[nodiscard]] bool HasComponent() const {
 		AQUILA_ASSERT(m_Scene, "There should be an active scene");
 		return m_Scene->GetRegistry().all_of<T>(m_EntityHandle);
@@ -19,6 +19,11 @@ class EntityManager;
 
 class Scene final {
   public:
+	struct ReleasedMaterial {
+		entt::entity entity;
+		uint32 slot;
+	};
+
 	explicit Scene();
 	explicit Scene(const std::string &name);
 
@@ -41,6 +46,13 @@ class Scene final {
 	void UpdateTransformRecursive(Entity entity, const glm::mat4 &parentWorld);
 	void MarkTransformDirty(entt::entity entity);
 
+	// Material components created or patched since the last ClearMaterialChanges, and the
+	// GPU material slots of those destroyed meanwhile. Edits made by writing the component
+	// in place are not seen; go through Entity::PatchComponent.
+	[[nodiscard]] const std::vector<entt::entity> &GetDirtyMaterials() const { return m_DirtyMaterials.GetOrdered(); }
+	[[nodiscard]] const std::vector<ReleasedMaterial> &GetReleasedMaterials() const { return m_ReleasedMaterials; }
+	void ClearMaterialChanges();
+
 	bool Serialize(const std::string &filepath);
 	bool Deserialize(const std::string &filepath, Assets::AssetManager &assetManager);
 
@@ -57,8 +69,12 @@ class Scene final {
 	entt::entity m_ActiveCameraEntity = entt::null;
 	Assets::AssetManager *m_AssetManager = nullptr;
 	Foundation::DirtySet<entt::entity> m_DirtyTransforms;
+	Foundation::DirtySet<entt::entity> m_DirtyMaterials;
+	std::vector<ReleasedMaterial> m_ReleasedMaterials;
 
 	void OnTransformConstruct(entt::registry &registry, entt::entity entity);
+	void OnMaterialChanged(entt::registry &registry, entt::entity entity);
+	void OnMaterialDestroy(entt::registry &registry, entt::entity entity);
 	[[nodiscard]] bool HasDirtyAncestor(entt::entity entity) const;
 	[[nodiscard]] int GetEntityDepth(entt::entity entity) const;
 
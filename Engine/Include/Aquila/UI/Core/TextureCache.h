@@ -1,14 +1,23 @@
 #pragma once
 
 #include "Aquila/Foundation/Defines.h"
+#include "Aquila/Foundation/Job.h"
 #include "Aquila/GFX/GfxContext.h"
 #include "Aquila/GFX/GfxTexture.h"
 
 namespace Aquila::UI::Core {
 
+// TextureCache
+//
+// Load reads the file and its header on the calling thread and hands back the texture at its
+// final size right away, so layout does not wait on pixels. Decoding runs on JobSystem
+// workers, which queue the result on the context's GfxUploadBatcher; many textures thus share
+// one transfer submission, and each draws as a placeholder until it is resident. One that
+// fails to decode is marked failed and stays a placeholder.
 class TextureCache {
   public:
 	explicit TextureCache(GFX::GfxContext &ctx, std::string basePath = {});
+	~TextureCache();
 
 	AQUILA_NONCOPYABLE(TextureCache);
 	AQUILA_NONMOVEABLE(TextureCache);
@@ -19,6 +28,9 @@ class TextureCache {
 
 	void Clear();
 
+	// Blocks until every queued decode has handed its pixels to the upload batcher.
+	void WaitForDecodes();
+
   private:
 	[[nodiscard]] std::string Resolve(const std::string &path) const;
 
@@ -26,6 +38,7 @@ class TextureCache {
 	std::string m_BasePath;
 
 	std::unordered_map<std::string, Ref<GFX::GfxTexture>> m_Cache;
+	std::vector<Foundation::JobHandle<void>> m_Decodes;
 };
 
 } // namespace Aquila::UI::Core
@@ -1,9 +1,11 @@
 #include "Aquila/Application/ApplicationNew.h"
 #include "Aquila/Foundation/Profiler.h"
+#include "Aquila/Foundation/Job.h"
 #include "Aquila/Platform/Filesystem/VirtualFileSystem.h"
 #include "Aquila/Platform/Input.h"
 
 #include "Aquila/GFX/GfxCommandList.h"
+#include "Aquila/GFX/GfxUploadBatcher.h"
 #include "Aquila/RHI/Vulkan/VulkanShaderCompiler.h"
 
 #include "Aquila/Rendering/Systems/LightCullingSystem.h"
@@ -40,6 +42,8 @@ Application::Application(const ApplicationSpec &spec) : m_Spec(spec) {
 }
 
 Application::~Application() {
+	// Drain the workers first: queued loads still read through the VFS and record uploads on the context
+	Foundation::JobSystem::Get().Shutdown();
 	m_Ctx->WaitIdle();
 
 	Platform::Filesystem::VirtualFileSystem::Shutdown();
@@ -48,6 +52,7 @@ Application::~Application() {
 	Rendering::FrameScheduler::Shutdown();
 
 	m_Scene.reset();
+	m_Assets.reset(); // releases its textures while the context is still alive
 	m_RenderPipeline.reset();
 	m_Swapchain.reset();
 	m_Ctx.reset();
@@ -85,14 +90,22 @@ void Application::Close() {
 void Application::InitRendering(uint32 width, uint32 height) {
 	// TODO: replace with a generic shader compiler abstraction
 	RHI::VulkanShaderCompiler::Initialize();
+	Foundation::JobSystem::Get().Initialize(); // render graph records heavy passes on the workers
 	Graphics::MaterialFactory::Init();
 	Rendering::FrameScheduler::Init();
+	// A shader saved while the loop sits in WaitEvents would otherwise wait for the next input event.
+	Graphics::MaterialFactory::Get()->SetHotReloadWakeCallback([] {
+		Rendering::FrameScheduler::Get()->RequestFrame();
+		Window::PostEmptyEvent();
+	});
 
 	using namespace Platform::Filesystem;
 	VirtualFileSystem::Get()->Mount("/resources", CreateRef<NativeFileSystem>(SharedConstants::RESOURCES_DIR));
 	VirtualFileSystem::Get()->Mount("/shaders", CreateRef<NativeFileSystem>(SharedConstants::SHADERS_DIR));
 
 	m_Ctx = GFX::GfxContext::Create(*GetWindow().GetNativeWindow());
+	m_Assets = CreateUnique<Assets::AssetManager>();
+	m_Assets->RegisterDefaultLoaders(*m_Ctx);
 
 	m_Swapchain = m_Ctx->CreateSwapchain({
 		.width = width,
@@ -110,6 +123,9 @@ void Application::InitRendering(uint32 width, uint32 height) {
 	m_Renderer->AddSystem<Rendering::ClusterComputeSystem>();
 	m_Renderer->AddSystem<Rendering::LightCullingSystem>();
 	m_Renderer->AddSystem<Rendering::GeometrySystem>();
+
+	// Compiles every declared shader on the workers, then creates the pipelines
+	m_RenderPipeline->Initialize();
 }
 
 void Application::InternalUpdate(f32 deltaTime) {
@@ -155,6 +171,11 @@ void Application::InternalUpdate(f32 deltaTime) {
 		PROFILE_SCOPE("SubmitFrame");
 		m_Ctx->SubmitFrame(cmd, m_Swapchain.get(), imageIndex);
 	}
+
+	m_Assets->CollectGarbage();
+	if (m_Assets->HasPendingLoads() || m_Ctx->GetUploadBatcher().HasPending()) {
+		Rendering::FrameScheduler::Get()->RequestFrame(); // keep ticking until loads and uploads land
+	}
 }
 
 void Application::InternalOnEvent(Events::Event &event) {
@@ -167,6 +167,10 @@ void Window::WaitEvents() {
 	}
 }
 
+void Window::PostEmptyEvent() {
+	glfwPostEmptyEvent();
+}
+
 bool Window::ShouldClose() const {
 	return glfwWindowShouldClose(m_Window) != 0;
 }
@@ -0,0 +1,89 @@
+#include "Aquila/Foundation/Cache/ResidencyManager.h"
+#include "Aquila/Foundation/SharedConstants.h"
+
+namespace Aquila::Foundation {
+
+ResidencyManager &ResidencyManager::Get() {
+	static ResidencyManager s_Instance;
+	return s_Instance;
+}
+
+ResidencyManager::ResidencyManager() : m_GlobalBudget(SharedConstants::RESIDENT_MEMORY_BUDGET) {}
+
+void ResidencyManager::Register(IResidentCache &cache) {
+	std::lock_guard lock(m_Mutex);
+	m_Caches.push_back(&cache);
+}
+
+void ResidencyManager::Unregister(IResidentCache &cache) {
+	std::lock_guard lock(m_Mutex);
+	std::erase(m_Caches, &cache);
+}
+
+void ResidencyManager::SetGlobalBudget(uint64 bytes) {
+	std::lock_guard lock(m_Mutex);
+	m_GlobalBudget = bytes;
+}
+
+uint64 ResidencyManager::GetGlobalBudget() const {
+	std::lock_guard lock(m_Mutex);
+	return m_GlobalBudget;
+}
+
+void ResidencyManager::EndFrame() {
+	m_Frame.fetch_add(1, std::memory_order_relaxed);
+
+	std::lock_guard lock(m_Mutex);
+	for (IResidentCache *cache : m_Caches) {
+		cache->Trim();
+	}
+	TrimToGlobalBudget();
+}
+
+void ResidencyManager::TrimToGlobalBudget() {
+	if (m_GlobalBudget == 0) {
+		return;
+	}
+	auto total = [this] {
+		uint64 bytes = 0;
+		for (const IResidentCache *cache : m_Caches) {
+			bytes += cache->GetResidentBytes().Total();
+		}
+		return bytes;
+	};
+	while (total() > m_GlobalBudget) {
+		IResidentCache *oldest = nullptr;
+		uint64 oldestFrame = 0;
+		for (IResidentCache *cache : m_Caches) {
+			const std::optional<uint64> frame = cache->GetOldestEvictableFrame();
+			if (frame && (oldest == nullptr || *frame < oldestFrame)) {
+				oldest = cache;
+				oldestFrame = *frame;
+			}
+		}
+		if (oldest == nullptr || !oldest->EvictOldest()) {
+			return; // everything left is in use
+		}
+	}
+}
+
+ResidentBytes ResidencyManager::GetResidentBytes() const {
+	std::lock_guard lock(m_Mutex);
+	ResidentBytes total;
+	for (const IResidentCache *cache : m_Caches) {
+		total += cache->GetResidentBytes();
+	}
+	return total;
+}
+
+std::vector<ResidentCacheStats> ResidencyManager::GetStats() const {
+	std::lock_guard lock(m_Mutex);
+	std::vector<ResidentCacheStats> stats;
+	stats.reserve(m_Caches.size());
+	for (const IResidentCache *cache : m_Caches) {
+		stats.push_back(cache->GetStats());
+	}
+	return stats;
+}
+
+} // namespace Aquila::Foundation
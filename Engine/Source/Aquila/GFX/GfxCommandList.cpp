@@ -32,6 +32,15 @@ void GfxCommandList::TransitionBuffer(GfxBuffer &buffer, RHI::ResourceState oldS
 	m_Cmd->TransitionBuffer(buffer.GetRHI(), oldState, newState);
 }
 
+void GfxCommandList::PipelineBarrier(std::span<const RHI::TextureBarrier> textures,
+									 std::span<const RHI::BufferBarrier> buffers) {
+	m_Cmd->PipelineBarrier(textures, buffers);
+}
+
+void GfxCommandList::WaitForQueue(const RHI::QueueWait &wait) {
+	m_Cmd->WaitForQueue(wait);
+}
+
 void GfxCommandList::BindPipeline(GfxPipeline &pipeline) {
 	m_Cmd->BindPipeline(pipeline.GetRHI());
 }
@@ -44,8 +53,9 @@ void GfxCommandList::SetScissor(int32 x, int32 y, uint32 width, uint32 height) {
 	m_Cmd->SetScissor(x, y, width, height);
 }
 
-void GfxCommandList::BindDescriptorSet(uint32 set, GfxDescriptorSet &descriptorSet) {
-	m_Cmd->BindDescriptorSet(set, descriptorSet.GetRHI());
+void GfxCommandList::BindDescriptorSet(uint32 set, GfxDescriptorSet &descriptorSet,
+									   std::span<const uint32> dynamicOffsets) {
+	m_Cmd->BindDescriptorSet(set, descriptorSet.GetRHI(), dynamicOffsets);
 }
 
 void GfxCommandList::BindVertexBuffer(GfxBuffer &buf, uint32 binding, uint64 offset) {
@@ -74,8 +84,8 @@ void GfxCommandList::DrawIndexedIndirect(GfxBuffer &buffer, uint64 offset, uint3
 }
 
 void GfxCommandList::CopyBufferToTexture(GfxBuffer &src, GfxTexture &dst, uint32 width, uint32 height,
-										 uint32 dstArrayLayer, uint32 dstMipLevel) {
-	m_Cmd->CopyBufferToTexture(src.GetRHI(), dst.GetRHI(), width, height, dstArrayLayer, dstMipLevel);
+										 uint32 dstArrayLayer, uint32 dstMipLevel, uint64 srcOffset) {
+	m_Cmd->CopyBufferToTexture(src.GetRHI(), dst.GetRHI(), width, height, dstArrayLayer, dstMipLevel, srcOffset);
 }
 
 void GfxCommandList::FillBuffer(GfxBuffer &buffer, uint32 value, uint64 offset, uint64 size) {
@@ -93,4 +103,17 @@ void GfxCommandList::PopDebugGroup() {
 	m_Cmd->PopDebugGroup();
 }
 
+void GfxCommandList::ExecuteSecondary(std::span<GfxCommandList *const> secondaries) {
+	std::vector<RHI::IRHICommandList *> rhi;
+	rhi.reserve(secondaries.size());
+	for (GfxCommandList *secondary : secondaries) {
+		rhi.push_back(&secondary->GetRHI());
+	}
+	m_Cmd->ExecuteSecondary(rhi);
+}
+
+bool GfxCommandList::IsSecondary() const {
+	return m_Cmd->IsSecondary();
+}
+
 } // namespace Aquila::GFX
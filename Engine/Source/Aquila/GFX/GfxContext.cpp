@@ -1,7 +1,13 @@
 #include "Aquila/GFX/GfxContext.h"
 #include "Aquila/GFX/GfxBuffer.h"
 #include "Aquila/GFX/GfxTexture.h"
+#include "Aquila/GFX/GfxMeshRegistry.h"
+#include "Aquila/GFX/GfxGeometryArena.h"
+#include "Aquila/GFX/GfxUploadRing.h"
+#include "Aquila/GFX/GfxUploadBatcher.h"
+#include "Aquila/GFX/GfxStagingPool.h"
 #include "Aquila/RHI/RHIBackend.h"
+#include "Aquila/RHI/FormatUtils.h"
 #include "Aquila/Foundation/Macros.h"
 
 namespace Aquila::GFX {
@@ -10,6 +16,11 @@ GfxContext::GfxContext(Unique<RHI::IRHIDevice> device) : m_Device(std::move(devi
 	for (uint32 i = 0; i < SharedConstants::MAX_FRAMES_IN_FLIGHT; ++i) {
 		m_FrameCommandLists[i] = Unique<GfxCommandList>(new GfxCommandList(m_Device->CreateFrameCommandList(i)));
 	}
+	m_StagingPool = CreateUnique<GfxStagingPool>(*this);
+	m_UploadBatcher = CreateUnique<GfxUploadBatcher>(*this);
+	m_GeometryArena = CreateUnique<GfxGeometryArena>(*this);
+	m_MeshRegistry = CreateUnique<GfxMeshRegistry>(*this);
+	m_UploadRing = CreateUnique<GfxUploadRing>(*this);
 }
 GfxContext::~GfxContext() = default;
 
@@ -56,6 +67,12 @@ Ref<GfxDescriptorSetLayout> GfxContext::CreateDescriptorSetLayout(const RHI::Des
 Ref<GfxDescriptorSet> GfxContext::AllocateDescriptorSet(GfxDescriptorSetLayout &layout) {
 	return Ref<GfxDescriptorSet>(new GfxDescriptorSet(m_Device->AllocateDescriptorSet(layout.GetRHI())));
 }
+bool GfxContext::SupportsDescriptorIndexing() const {
+	return m_Device->SupportsDescriptorIndexing();
+}
+bool GfxContext::SupportsBlockCompression() const {
+	return m_Device->SupportsBlockCompression();
+}
 Ref<GfxRenderPass> GfxContext::CreateRenderPass(const RHI::RenderPassDesc &desc) {
 	return Ref<GfxRenderPass>(new GfxRenderPass(m_Device->CreateRenderPass(desc)));
 }
@@ -63,6 +80,18 @@ Ref<GfxCommandList> GfxContext::CreateCommandList(RHI::CommandListType type, con
 	return Ref<GfxCommandList>(new GfxCommandList(m_Device->CreateCommandList(type, name)));
 }
 
+Unique<GfxCommandList> GfxContext::CreateSecondaryCommandList(const RHI::SecondaryCommandListDesc &desc) {
+	return Unique<GfxCommandList>(new GfxCommandList(m_Device->CreateSecondaryCommandList(desc)));
+}
+
+Unique<GfxCommandList> GfxContext::CreateAsyncComputeCommandList() {
+	return Unique<GfxCommandList>(new GfxCommandList(m_Device->CreateAsyncComputeCommandList()));
+}
+
+Ref<GfxCommandList> GfxContext::CreateUploadCommandList(const std::string &name) {
+	return Ref<GfxCommandList>(new GfxCommandList(m_Device->CreateUploadCommandList(name)));
+}
+
 GfxCommandList &GfxContext::AcquireFrameCommandList(uint32 frameSlot) {
 	AQUILA_ASSERT(frameSlot < SharedConstants::MAX_FRAMES_IN_FLIGHT, "Frame slot out of range");
 	return *m_FrameCommandLists[frameSlot];
@@ -72,6 +101,34 @@ void GfxContext::SubmitFrame(GfxCommandList &cmd, GfxSwapchain *swapchain, uint3
 	m_Device->SubmitFrame(cmd.GetRHI(), (swapchain != nullptr) ? &swapchain->GetRHI() : nullptr, imageIndex);
 }
 
+bool GfxContext::HasAsyncCompute() const {
+	return m_Device->HasAsyncCompute();
+}
+
+uint64 GfxContext::SubmitAsyncCompute(GfxCommandList &cmd) {
+	return m_Device->SubmitAsyncCompute(cmd.GetRHI());
+}
+
+uint64 GfxContext::SubmitTransfer(GfxCommandList &cmd) {
+	return m_Device->SubmitTransfer(cmd.GetRHI());
+}
+
+uint64 GfxContext::FlushFrameCommandList(GfxCommandList &cmd) {
+	return m_Device->FlushFrameCommandList(cmd.GetRHI());
+}
+
+uint64 GfxContext::GetLastSubmittedValue(RHI::CommandListType queue) const {
+	return m_Device->GetLastSubmittedValue(queue);
+}
+
+uint64 GfxContext::GetCompletedValue(RHI::CommandListType queue) const {
+	return m_Device->GetCompletedValue(queue);
+}
+
+void GfxContext::WaitForTimeline(RHI::CommandListType queue, uint64 value) {
+	m_Device->WaitForTimeline(queue, value);
+}
+
 void GfxContext::SubmitAndWait(GfxCommandList &cmd) {
 	if (!cmd.IsRecording()) {
 		return;
@@ -80,25 +137,26 @@ void GfxContext::SubmitAndWait(GfxCommandList &cmd) {
 }
 
 void GfxContext::UploadTextureData(GfxTexture &dst, const void *data, uint64 byteSize) {
-	RHI::BufferDesc stagingDesc{};
-	stagingDesc.size = byteSize;
-	stagingDesc.usage = RHI::BufferUsage::TransferSrc;
-	stagingDesc.domain = RHI::MemoryDomain::CPU_ONLY;
-	stagingDesc.debugName = "TextureUploadStaging";
-
-	Ref<GfxBuffer> staging = CreateBuffer(stagingDesc);
-	staging->GetRHI().Write(data, byteSize, 0);
+	StagingAllocation staging = m_StagingPool->Allocate(byteSize);
+	staging.Write(data, byteSize);
 
 	const uint32 w = dst.GetWidth();
 	const uint32 h = dst.GetHeight();
 
 	ExecuteImmediate(RHI::CommandListType::Graphics, [&](GfxCommandList &cmd) {
 		cmd.TransitionTexture(dst, RHI::ResourceState::Undefined, RHI::ResourceState::TransferDst);
-		cmd.CopyBufferToTexture(*staging, dst, w, h);
+		uint64 offset = 0;
+		for (uint32 level = 0; level < dst.GetMipLevels(); ++level) {
+			const uint64 levelSize = RHI::GetTextureLevelSize(dst.GetFormat(), w, h, level);
+			AQUILA_ASSERT(offset + levelSize <= byteSize, "UploadTextureData: data ends before the last mip level");
+			cmd.CopyBufferToTexture(*staging.buffer, dst, std::max(w >> level, 1u), std::max(h >> level, 1u), 0, level,
+									staging.offset + offset);
+			offset += levelSize;
+		}
 		cmd.TransitionTexture(dst, RHI::ResourceState::TransferDst, RHI::ResourceState::ShaderRead);
 	});
 
-	DestroyImmediateBuffer(*staging);
+	m_StagingPool->Free(staging);
 }
 
 void GfxContext::CopyBuffer(GfxBuffer &src, GfxBuffer &dst, uint64 size, uint64 srcOffset, uint64 dstOffset) {
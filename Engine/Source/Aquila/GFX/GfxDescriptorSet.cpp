@@ -16,8 +16,8 @@ GfxDescriptorSet &GfxDescriptorSet::SetBuffer(uint32 binding, GfxBuffer &buffer,
 	return *this;
 }
 
-GfxDescriptorSet &GfxDescriptorSet::SetTexture(uint32 binding, GfxTexture &texture) {
-	m_Set->SetTexture(binding, texture.GetRHI());
+GfxDescriptorSet &GfxDescriptorSet::SetTexture(uint32 binding, GfxTexture &texture, uint32 arrayElement) {
+	m_Set->SetTexture(binding, texture.GetRHI(), arrayElement);
 	return *this;
 }
 
@@ -0,0 +1,280 @@
+#include "Aquila/GFX/GfxGeometryArena.h"
+#include "Aquila/GFX/GfxContext.h"
+#include "Aquila/GFX/GfxCommandList.h"
+#include "Aquila/GFX/GfxUploadBatcher.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Foundation/SharedConstants.h"
+
+#include <algorithm>
+
+namespace Aquila::GFX {
+
+namespace {
+constexpr uint64 VertexStride = sizeof(RHI::PackedVertex);
+constexpr uint64 IndexStride = sizeof(uint32);
+
+// Free space outside the largest hole, as a share of capacity, past which Tick defragments.
+constexpr uint64 DefragmentWasteDivisor = 4;
+
+bool IsFragmented(const Foundation::RangeAllocator &alloc) {
+	return (alloc.GetFree() - alloc.GetLargestFreeBlock()) * DefragmentWasteDivisor > alloc.GetCapacity();
+}
+} // namespace
+
+GfxGeometryArena::GfxGeometryArena(GfxContext &ctx) : m_Ctx(ctx) {
+	m_VertexBuffer = CreateVertexBuffer(InitialVertexCapacity);
+	m_IndexBuffer = CreateIndexBuffer(InitialIndexCapacity);
+	m_VertexAlloc.Reset(InitialVertexCapacity);
+	m_IndexAlloc.Reset(InitialIndexCapacity);
+}
+
+Ref<GfxBuffer> GfxGeometryArena::CreateVertexBuffer(uint64 vertexCount) const {
+	return m_Ctx.CreateBuffer({
+		.size = vertexCount * VertexStride,
+		.usage = RHI::BufferUsage::VertexBuffer | RHI::BufferUsage::StorageBuffer | RHI::BufferUsage::TransferDst |
+			RHI::BufferUsage::TransferSrc,
+		.domain = RHI::MemoryDomain::GPU_ONLY,
+		.transferQueueShared = true,
+		.debugName = "GeometryArena_VB",
+	});
+}
+
+Ref<GfxBuffer> GfxGeometryArena::CreateIndexBuffer(uint64 indexCount) const {
+	return m_Ctx.CreateBuffer({
+		.size = indexCount * IndexStride,
+		.usage = RHI::BufferUsage::IndexBuffer | RHI::BufferUsage::StorageBuffer | RHI::BufferUsage::TransferDst |
+			RHI::BufferUsage::TransferSrc,
+		.domain = RHI::MemoryDomain::GPU_ONLY,
+		.transferQueueShared = true,
+		.debugName = "GeometryArena_IB",
+	});
+}
+
+GfxGeometryArena::Handle GfxGeometryArena::Allocate(std::span<const RHI::PackedVertex> vertices,
+													std::span<const uint32> indices) {
+	if (vertices.empty() || indices.empty()) {
+		return InvalidHandle;
+	}
+
+	std::lock_guard lock(m_Mutex);
+
+	const auto vertexCount = static_cast<uint64>(vertices.size());
+	const auto indexCount = static_cast<uint64>(indices.size());
+
+	auto vertexOffset = m_VertexAlloc.Allocate(vertexCount);
+	if (!vertexOffset) {
+		GrowVertices(m_VertexAlloc.GetCapacity() + vertexCount);
+		vertexOffset = m_VertexAlloc.Allocate(vertexCount);
+	}
+	auto firstIndex = m_IndexAlloc.Allocate(indexCount);
+	if (!firstIndex) {
+		GrowIndices(m_IndexAlloc.GetCapacity() + indexCount);
+		firstIndex = m_IndexAlloc.Allocate(indexCount);
+	}
+	AQUILA_ASSERT(vertexOffset && firstIndex, "GeometryArena: allocation failed after growth");
+
+	// One staging buffer for both halves; the copies ride the frame's transfer batch.
+	const GfxUploadBatcher::Region regions[] = {
+		{ .dst = m_VertexBuffer,
+		  .data = vertices.data(),
+		  .size = vertexCount * VertexStride,
+		  .dstOffset = *vertexOffset * VertexStride },
+		{ .dst = m_IndexBuffer,
+		  .data = indices.data(),
+		  .size = indexCount * IndexStride,
+		  .dstOffset = *firstIndex * IndexStride },
+	};
+	m_Ctx.GetUploadBatcher().UploadBuffers(regions);
+
+	Handle handle = InvalidHandle;
+	if (!m_FreeHandles.empty()) {
+		handle = m_FreeHandles.back();
+		m_FreeHandles.pop_back();
+	} else {
+		handle = static_cast<Handle>(m_Ranges.size());
+		m_Ranges.emplace_back();
+		m_Live.push_back(false);
+	}
+
+	m_Ranges[handle] = {
+		.vertexOffset = static_cast<uint32>(*vertexOffset),
+		.vertexCount = static_cast<uint32>(vertexCount),
+		.firstIndex = static_cast<uint32>(*firstIndex),
+		.indexCount = static_cast<uint32>(indexCount),
+	};
+	m_Live[handle] = true;
+	m_AllocatedSinceTick = true;
+	return handle;
+}
+
+void GfxGeometryArena::Free(Handle handle) {
+	if (handle == InvalidHandle) {
+		return;
+	}
+	std::lock_guard lock(m_Mutex);
+	AQUILA_ASSERT(handle < m_Live.size() && m_Live[handle], "GeometryArena: freeing a dead handle");
+	// Dead from here on, so a second Free asserts instead of releasing the ranges twice. The range
+	// itself stays readable until Release, for the frames still in flight.
+	m_Live[handle] = false;
+	m_PendingFrees.push_back({ .handle = handle, .retireFrame = m_FrameIndex + SharedConstants::MAX_FRAMES_IN_FLIGHT });
+}
+
+void GfxGeometryArena::Tick() {
+	std::lock_guard lock(m_Mutex);
+	++m_FrameIndex;
+	std::erase_if(m_PendingFrees, [this](const PendingFree &pending) {
+		if (pending.retireFrame > m_FrameIndex) {
+			return false;
+		}
+		Release(pending.handle);
+		return true;
+	});
+
+	if (!m_AllocatedSinceTick && NeedsDefragment()) {
+		DefragmentLocked();
+	}
+	m_AllocatedSinceTick = false;
+}
+
+bool GfxGeometryArena::NeedsDefragment() const {
+	return IsFragmented(m_VertexAlloc) || IsFragmented(m_IndexAlloc);
+}
+
+void GfxGeometryArena::Release(Handle handle) {
+	const GeometryRange &range = m_Ranges[handle];
+	m_VertexAlloc.Free(range.vertexOffset);
+	m_IndexAlloc.Free(range.firstIndex);
+	m_Ranges[handle] = {};
+	m_FreeHandles.push_back(handle);
+}
+
+void GfxGeometryArena::GrowVertices(uint64 minCapacity) {
+	uint64 capacity = m_VertexAlloc.GetCapacity();
+	while (capacity < minCapacity) {
+		capacity *= 2;
+	}
+	AQUILA_LOG_INFO("GeometryArena: growing vertex buffer {} -> {} vertices", m_VertexAlloc.GetCapacity(), capacity);
+
+	auto grown = CreateVertexBuffer(capacity);
+	m_Ctx.GetUploadBatcher().SubmitAndWait(); // queued copies must land before the old contents move
+	m_Ctx.CopyBuffer(*m_VertexBuffer, *grown, m_VertexAlloc.GetCapacity() * VertexStride);
+	m_VertexBuffer = std::move(grown); // old buffer goes through the deletion queue
+	m_VertexAlloc.Grow(capacity);
+}
+
+void GfxGeometryArena::GrowIndices(uint64 minCapacity) {
+	uint64 capacity = m_IndexAlloc.GetCapacity();
+	while (capacity < minCapacity) {
+		capacity *= 2;
+	}
+	AQUILA_LOG_INFO("GeometryArena: growing index buffer {} -> {} indices", m_IndexAlloc.GetCapacity(), capacity);
+
+	auto grown = CreateIndexBuffer(capacity);
+	m_Ctx.GetUploadBatcher().SubmitAndWait();
+	m_Ctx.CopyBuffer(*m_IndexBuffer, *grown, m_IndexAlloc.GetCapacity() * IndexStride);
+	m_IndexBuffer = std::move(grown);
+	m_IndexAlloc.Grow(capacity);
+}
+
+void GfxGeometryArena::Defragment() {
+	std::lock_guard lock(m_Mutex);
+	DefragmentLocked();
+}
+
+void GfxGeometryArena::DefragmentLocked() {
+	// Nothing in flight may reference the old offsets once we're done, so flush pending
+	// frees now rather than letting them land on top of compacted data later.
+	m_Ctx.GetUploadBatcher().SubmitAndWait();
+	m_Ctx.WaitIdle();
+	for (const auto &pending : m_PendingFrees) {
+		Release(pending.handle);
+	}
+	m_PendingFrees.clear();
+
+	const auto vertexMoves = m_VertexAlloc.Compact();
+	const auto indexMoves = m_IndexAlloc.Compact();
+	if (vertexMoves.empty() && indexMoves.empty()) {
+		return;
+	}
+
+	// Copy into fresh buffers: vkCmdCopyBuffer forbids overlapping src/dst regions in the
+	// same buffer, and compaction moves overlap all the time.
+	auto vb = CreateVertexBuffer(m_VertexAlloc.GetCapacity());
+	auto ib = CreateIndexBuffer(m_IndexAlloc.GetCapacity());
+
+	std::unordered_map<uint64, uint64> vertexRemap;
+	std::unordered_map<uint64, uint64> indexRemap;
+	for (const auto &move : vertexMoves) {
+		vertexRemap.emplace(move.from, move.to);
+	}
+	for (const auto &move : indexMoves) {
+		indexRemap.emplace(move.from, move.to);
+	}
+	const auto remap = [](const std::unordered_map<uint64, uint64> &table, uint32 offset) {
+		auto it = table.find(offset);
+		return it == table.end() ? offset : static_cast<uint32>(it->second);
+	};
+
+	auto &device = m_Ctx.GetDevice();
+	m_Ctx.ExecuteImmediate(RHI::CommandListType::Transfer, [&](GfxCommandList &cmd) {
+		for (usize i = 0; i < m_Ranges.size(); ++i) {
+			if (!m_Live[i]) {
+				continue;
+			}
+			GeometryRange &range = m_Ranges[i];
+			const uint32 newVertexOffset = remap(vertexRemap, range.vertexOffset);
+			const uint32 newFirstIndex = remap(indexRemap, range.firstIndex);
+
+			device.CopyBuffer(cmd.GetRHI(), m_VertexBuffer->GetRHI(), vb->GetRHI(), range.vertexCount * VertexStride,
+							  range.vertexOffset * VertexStride, newVertexOffset * VertexStride);
+			device.CopyBuffer(cmd.GetRHI(), m_IndexBuffer->GetRHI(), ib->GetRHI(), range.indexCount * IndexStride,
+							  range.firstIndex * IndexStride, newFirstIndex * IndexStride);
+
+			range.vertexOffset = newVertexOffset;
+			range.firstIndex = newFirstIndex;
+		}
+	});
+
+	m_VertexBuffer = std::move(vb);
+	m_IndexBuffer = std::move(ib);
+
+	AQUILA_LOG_INFO("GeometryArena: defragmented ({} vertex moves, {} index moves)", vertexMoves.size(),
+					indexMoves.size());
+}
+
+GeometryRange GfxGeometryArena::GetRange(Handle handle) const {
+	std::lock_guard lock(m_Mutex);
+	AQUILA_ASSERT(handle < m_Ranges.size(), "GeometryArena: handle out of range");
+	return m_Ranges[handle];
+}
+
+Ref<GfxBuffer> GfxGeometryArena::GetVertexBuffer() const {
+	std::lock_guard lock(m_Mutex);
+	return m_VertexBuffer;
+}
+
+Ref<GfxBuffer> GfxGeometryArena::GetIndexBuffer() const {
+	std::lock_guard lock(m_Mutex);
+	return m_IndexBuffer;
+}
+
+void GfxGeometryArena::Bind(GfxCommandList &cmd) const {
+	std::lock_guard lock(m_Mutex);
+	cmd.BindVertexBuffer(*m_VertexBuffer);
+	cmd.BindIndexBuffer(*m_IndexBuffer, RHI::IndexFormat::UInt32);
+}
+
+GfxGeometryArena::Stats GfxGeometryArena::GetStats() const {
+	std::lock_guard lock(m_Mutex);
+	return {
+		.vertexCapacity = m_VertexAlloc.GetCapacity(),
+		.vertexUsed = m_VertexAlloc.GetUsed(),
+		.indexCapacity = m_IndexAlloc.GetCapacity(),
+		.indexUsed = m_IndexAlloc.GetUsed(),
+		.liveRanges = static_cast<usize>(std::ranges::count(m_Live, true)),
+		.vertexFragmentation = m_VertexAlloc.GetFragmentation(),
+		.indexFragmentation = m_IndexAlloc.GetFragmentation(),
+	};
+}
+
+} // namespace Aquila::GFX
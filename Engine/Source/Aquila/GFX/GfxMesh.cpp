@@ -5,44 +5,45 @@ namespace Aquila::GFX {
 
 Ref<GfxMesh> GfxMesh::Create(GfxContext &ctx, const Graphics::Resources::Mesh &mesh) {
 	auto gfxMesh = Ref<GfxMesh>(new GfxMesh());
-	gfxMesh->m_IndexCount = mesh.GetIndexCount();
-
-	const uint64 vbSize = mesh.GetVertexCount() * sizeof(RHI::Vertex);
-	const uint64 ibSize = mesh.GetIndexCount() * sizeof(uint32);
-
-	gfxMesh->m_VertexBuffer = ctx.CreateBuffer({
-		.size = vbSize,
-		.usage = RHI::BufferUsage::VertexBuffer | RHI::BufferUsage::TransferDst,
-		.domain = RHI::MemoryDomain::GPU_ONLY,
-		.debugName = "GfxMesh_VB",
-	});
-	gfxMesh->m_IndexBuffer = ctx.CreateBuffer({
-		.size = ibSize,
-		.usage = RHI::BufferUsage::IndexBuffer | RHI::BufferUsage::TransferDst,
-		.domain = RHI::MemoryDomain::GPU_ONLY,
-		.debugName = "GfxMesh_IB",
-	});
-
-	auto vbStage = ctx.CreateBuffer({
-		.size = vbSize,
-		.usage = RHI::BufferUsage::TransferSrc,
-		.domain = RHI::MemoryDomain::CPU_ONLY,
-		.debugName = "GfxMesh_VB_Stage",
-	});
-	auto ibStage = ctx.CreateBuffer({
-		.size = ibSize,
-		.usage = RHI::BufferUsage::TransferSrc,
-		.domain = RHI::MemoryDomain::CPU_ONLY,
-		.debugName = "GfxMesh_IB_Stage",
-	});
+	gfxMesh->m_Arena = &ctx.GetGeometryArena();
+
+	const std::vector<RHI::PackedVertex> vertices = RHI::PackVertices(mesh.GetVertices());
+	if (mesh.HasIndexBuffer()) {
+		gfxMesh->m_Handle = gfxMesh->m_Arena->Allocate(vertices, mesh.GetIndices());
+		gfxMesh->m_IndexCount = mesh.GetIndexCount();
+		gfxMesh->m_Lods = mesh.GetLods();
+	} else {
+		// Everything in the arena is drawn indexed, so give unindexed meshes a trivial list.
+		std::vector<uint32> indices(mesh.GetVertexCount());
+		std::iota(indices.begin(), indices.end(), 0u);
+		gfxMesh->m_Handle = gfxMesh->m_Arena->Allocate(vertices, indices);
+		gfxMesh->m_IndexCount = static_cast<uint32>(indices.size());
+		gfxMesh->m_Lods = { { .firstIndex = 0, .indexCount = gfxMesh->m_IndexCount, .error = 0.F } };
+	}
+	return gfxMesh;
+}
 
-	vbStage->Write(mesh.GetVertices().data(), vbSize);
-	ibStage->Write(mesh.GetIndices().data(), ibSize);
+uint64 GfxMesh::GetGpuBytes() const {
+	const GeometryRange range = GetRange();
+	return static_cast<uint64>(range.vertexCount) * sizeof(RHI::PackedVertex) +
+		   static_cast<uint64>(range.indexCount) * sizeof(uint32);
+}
 
-	ctx.CopyBuffer(*vbStage, *gfxMesh->m_VertexBuffer, vbSize);
-	ctx.CopyBuffer(*ibStage, *gfxMesh->m_IndexBuffer, ibSize);
+GeometryRange GfxMesh::GetLodRange(uint32 lod) const {
+	GeometryRange range = GetRange();
+	if (range.indexCount == 0 || m_Lods.empty()) {
+		return range;
+	}
+	const Graphics::Resources::MeshLod &level = m_Lods[std::min<usize>(lod, m_Lods.size() - 1)];
+	range.firstIndex += level.firstIndex;
+	range.indexCount = level.indexCount;
+	return range;
+}
 
-	return gfxMesh;
+GfxMesh::~GfxMesh() {
+	if (m_Arena) {
+		m_Arena->Free(m_Handle);
+	}
 }
 
 } // namespace Aquila::GFX
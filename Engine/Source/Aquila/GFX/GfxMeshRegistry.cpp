@@ -0,0 +1,46 @@
+#include "Aquila/GFX/GfxMeshRegistry.h"
+#include "Aquila/GFX/GfxContext.h"
+#include "Aquila/Graphics/Resources/MeshCache.h"
+
+namespace Aquila::GFX {
+
+Ref<GfxMesh> GfxMeshRegistry::GetOrUpload(const Ref<Graphics::Resources::Mesh> &mesh) {
+	if (!mesh) {
+		return nullptr;
+	}
+
+	std::lock_guard lock(m_Mutex);
+
+	auto it = m_Entries.find(mesh.get());
+	if (it != m_Entries.end()) {
+		// owner_before both ways == same control block, i.e. the entry really belongs to this mesh
+		// and not to a previous one that died at the same address.
+		const bool sameOwner = !it->second.cpu.owner_before(mesh) && !mesh.owner_before(it->second.cpu);
+		if (sameOwner && !it->second.cpu.expired()) {
+			return it->second.gpu;
+		}
+		m_Entries.erase(it);
+	}
+
+	auto gpu = GfxMesh::Create(m_Ctx, *mesh);
+	m_Entries.emplace(mesh.get(), Entry{ .cpu = mesh, .gpu = gpu });
+	Graphics::Resources::MeshCache::Get().SetGpuBytes(*mesh, gpu->GetGpuBytes());
+	return gpu;
+}
+
+usize GfxMeshRegistry::CollectGarbage() {
+	std::lock_guard lock(m_Mutex);
+	return std::erase_if(m_Entries, [](const auto &kv) { return kv.second.cpu.expired(); });
+}
+
+void GfxMeshRegistry::Clear() {
+	std::lock_guard lock(m_Mutex);
+	m_Entries.clear();
+}
+
+usize GfxMeshRegistry::GetEntryCount() const {
+	std::lock_guard lock(m_Mutex);
+	return m_Entries.size();
+}
+
+} // namespace Aquila::GFX
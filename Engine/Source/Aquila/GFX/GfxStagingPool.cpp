@@ -0,0 +1,148 @@
+#include "Aquila/GFX/GfxStagingPool.h"
+#include "Aquila/GFX/GfxContext.h"
+
+namespace Aquila::GFX {
+
+GfxStagingPool::GfxStagingPool(GfxContext &ctx, uint64 capacity) : m_Ctx(ctx), m_Capacity(capacity) {
+	m_Buffer = m_Ctx.CreateBuffer({
+		.size = capacity,
+		.usage = RHI::BufferUsage::TransferSrc,
+		.domain = RHI::MemoryDomain::CPU_ONLY,
+		.debugName = "StagingPool",
+	});
+	m_Mapped = static_cast<uint8 *>(m_Buffer->Map());
+}
+
+StagingAllocation GfxStagingPool::Allocate(uint64 size, uint64 alignment) {
+	AQUILA_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0, "Staging alignment must be a power of two");
+	if (size > m_Capacity / 2) {
+		return AllocateDedicated(size);
+	}
+
+	std::unique_lock lock(m_Mutex);
+	for (;;) {
+		Reclaim();
+
+		uint64 position = (m_Head + alignment - 1) & ~(alignment - 1);
+		if (position % m_Capacity + size > m_Capacity) {
+			position = (position / m_Capacity + 1) * m_Capacity; // wrap, skipping the end of the ring
+		}
+		if (position + size - m_Tail <= m_Capacity) {
+			const uint64 id = m_NextId++;
+			m_Blocks.push_back({ .id = id, .end = position + size, .size = size });
+			m_Head = position + size;
+			UpdatePeak();
+
+			const uint64 offset = position % m_Capacity;
+			return { .buffer = m_Buffer.get(), .offset = offset, .size = size, .data = m_Mapped + offset, .id = id };
+		}
+
+		// Full. If the oldest block hasn't even been submitted, waiting could deadlock the
+		// thread that owns it, so step around the ring instead.
+		if (m_Blocks.empty() || !m_Blocks.front().retired) {
+			lock.unlock();
+			return AllocateDedicated(size);
+		}
+		const RHI::CommandListType queue = m_Blocks.front().queue;
+		const uint64 value = m_Blocks.front().value;
+		lock.unlock();
+		m_Ctx.WaitForTimeline(queue, value);
+		lock.lock();
+	}
+}
+
+void GfxStagingPool::Retire(StagingAllocation &alloc, RHI::CommandListType queue, uint64 value) {
+	if (!alloc.IsValid()) {
+		return;
+	}
+	std::lock_guard lock(m_Mutex);
+	Block *block = FindBlock(alloc.id);
+	AQUILA_ASSERT(block && !block->retired, "StagingPool: allocation retired twice");
+	block->queue = queue;
+	block->value = value;
+	block->retired = true;
+	alloc = {};
+}
+
+void GfxStagingPool::Free(StagingAllocation &alloc) {
+	Retire(alloc, RHI::CommandListType::Graphics, 0);
+}
+
+GfxStagingPool::Stats GfxStagingPool::GetStats() const {
+	std::lock_guard lock(m_Mutex);
+	return {
+		.capacity = m_Capacity,
+		.ringInUse = m_Head - m_Tail,
+		.dedicatedInUse = m_DedicatedInUse,
+		.peakInUse = m_PeakInUse,
+		.dedicatedAllocations = m_DedicatedAllocations,
+	};
+}
+
+void GfxStagingPool::ResetPeak() {
+	std::lock_guard lock(m_Mutex);
+	m_PeakInUse = m_Head - m_Tail + m_DedicatedInUse;
+}
+
+void GfxStagingPool::Reclaim() {
+	while (!m_Blocks.empty() && IsComplete(m_Blocks.front())) {
+		m_Tail = m_Blocks.front().end;
+		m_Blocks.pop_front();
+	}
+	if (m_Blocks.empty()) {
+		m_Tail = m_Head;
+	}
+
+	std::erase_if(m_DedicatedBlocks, [this](const Block &block) {
+		if (!IsComplete(block)) {
+			return false;
+		}
+		m_DedicatedInUse -= block.size;
+		return true;
+	});
+}
+
+bool GfxStagingPool::IsComplete(const Block &block) const {
+	return block.retired && (block.value == 0 || m_Ctx.GetCompletedValue(block.queue) >= block.value);
+}
+
+GfxStagingPool::Block *GfxStagingPool::FindBlock(uint64 id) {
+	// Ids are handed out in order, so the ring deque is sorted by them.
+	auto it = std::lower_bound(m_Blocks.begin(), m_Blocks.end(), id,
+							   [](const Block &block, uint64 value) { return block.id < value; });
+	if (it != m_Blocks.end() && it->id == id) {
+		return &*it;
+	}
+	for (Block &block : m_DedicatedBlocks) {
+		if (block.id == id) {
+			return &block;
+		}
+	}
+	return nullptr;
+}
+
+StagingAllocation GfxStagingPool::AllocateDedicated(uint64 size) {
+	auto buffer = m_Ctx.CreateBuffer({
+		.size = size,
+		.usage = RHI::BufferUsage::TransferSrc,
+		.domain = RHI::MemoryDomain::CPU_ONLY,
+		.debugName = "StagingPool_Dedicated",
+	});
+	auto *mapped = static_cast<uint8 *>(buffer->Map());
+
+	std::lock_guard lock(m_Mutex);
+	Reclaim();
+	const uint64 id = m_NextId++;
+	StagingAllocation alloc{ .buffer = buffer.get(), .offset = 0, .size = size, .data = mapped, .id = id };
+	m_DedicatedBlocks.push_back({ .id = id, .size = size, .dedicated = std::move(buffer) });
+	m_DedicatedInUse += size;
+	++m_DedicatedAllocations;
+	UpdatePeak();
+	return alloc;
+}
+
+void GfxStagingPool::UpdatePeak() {
+	m_PeakInUse = std::max(m_PeakInUse, m_Head - m_Tail + m_DedicatedInUse);
+}
+
+} // namespace Aquila::GFX
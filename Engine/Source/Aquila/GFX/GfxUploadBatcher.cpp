@@ -0,0 +1,192 @@
+#include "Aquila/GFX/GfxUploadBatcher.h"
+#include "Aquila/GFX/GfxContext.h"
+#include "Aquila/GFX/GfxStagingPool.h"
+#include "Aquila/RHI/FormatUtils.h"
+
+namespace Aquila::GFX {
+
+GfxUploadBatcher::GfxUploadBatcher(GfxContext &ctx) : m_Ctx(ctx) {}
+
+GfxUploadBatcher::~GfxUploadBatcher() {
+	std::lock_guard lock(m_Mutex);
+	m_Ctx.WaitForTimeline(RHI::CommandListType::Transfer, SubmitOpenBatch());
+	m_InFlight.clear();
+}
+
+void GfxUploadBatcher::UploadBuffer(const Ref<GfxBuffer> &dst, const void *data, uint64 size, uint64 dstOffset) {
+	const Region region{ .dst = dst, .data = data, .size = size, .dstOffset = dstOffset };
+	UploadBuffers({ &region, 1 });
+}
+
+void GfxUploadBatcher::UploadBuffers(std::span<const Region> regions) {
+	uint64 total = 0;
+	for (const Region &region : regions) {
+		total += region.size;
+	}
+	if (total == 0) {
+		return;
+	}
+
+	// Filled outside the lock: the memcpy is the expensive part for large meshes.
+	StagingAllocation staging = m_Ctx.GetStagingPool().Allocate(total);
+	uint64 offset = 0;
+	for (const Region &region : regions) {
+		memcpy(staging.data + offset, region.data, region.size);
+		offset += region.size;
+	}
+	staging.buffer->Flush(total, staging.offset);
+
+	std::lock_guard lock(m_Mutex);
+	Batch &batch = OpenBatch();
+	auto &device = m_Ctx.GetDevice();
+	offset = 0;
+	for (const Region &region : regions) {
+		if (region.size > 0) {
+			device.CopyBuffer(batch.cmd->GetRHI(), staging.buffer->GetRHI(), region.dst->GetRHI(), region.size,
+							  staging.offset + offset, region.dstOffset);
+			batch.keepAlive.push_back(region.dst);
+		}
+		offset += region.size;
+	}
+	batch.staging.push_back(staging);
+}
+
+void GfxUploadBatcher::UploadTexture(const Ref<GfxTexture> &dst, const void *data, uint64 size) {
+	if (size == 0) {
+		return;
+	}
+	dst->SetResident(false);
+
+	StagingAllocation staging = m_Ctx.GetStagingPool().Allocate(size);
+	staging.Write(data, size);
+
+	const uint32 w = dst->GetWidth();
+	const uint32 h = dst->GetHeight();
+	const RHI::TextureBarrier release{ .texture = &dst->GetRHI(),
+									   .oldState = RHI::ResourceState::TransferDst,
+									   .newState = RHI::ResourceState::ShaderRead,
+									   .srcQueue = RHI::CommandListType::Transfer,
+									   .dstQueue = RHI::CommandListType::Graphics };
+
+	std::lock_guard lock(m_Mutex);
+	Batch &batch = OpenBatch();
+	GfxCommandList &cmd = *batch.cmd;
+	cmd.TransitionTexture(*dst, RHI::ResourceState::Undefined, RHI::ResourceState::TransferDst);
+	uint64 offset = 0;
+	for (uint32 level = 0; level < dst->GetMipLevels(); ++level) {
+		const uint64 levelSize = RHI::GetTextureLevelSize(dst->GetFormat(), w, h, level);
+		AQUILA_ASSERT(offset + levelSize <= size, "UploadTexture: data ends before the texture's last mip level");
+		cmd.CopyBufferToTexture(*staging.buffer, *dst, std::max(w >> level, 1u), std::max(h >> level, 1u), 0, level,
+								staging.offset + offset);
+		offset += levelSize;
+	}
+	cmd.PipelineBarrier({ &release, 1 }, {});
+	batch.staging.push_back(staging);
+	batch.textures.push_back(dst);
+}
+
+void GfxUploadBatcher::Record(std::function<void(GfxCommandList &)> record, std::function<void()> onComplete) {
+	std::lock_guard lock(m_Mutex);
+	Batch &batch = OpenBatch();
+	record(*batch.cmd);
+	if (onComplete) {
+		batch.onComplete.push_back(std::move(onComplete));
+	}
+}
+
+void GfxUploadBatcher::Submit(GfxCommandList &frameCmd) {
+	std::lock_guard lock(m_Mutex);
+	const bool submitted = m_Open.has_value();
+	const uint64 value = SubmitOpenBatch();
+	if (submitted || !m_PendingAcquires.empty()) {
+		frameCmd.WaitForQueue({ .queue = RHI::CommandListType::Transfer, .value = value });
+	}
+	if (m_PendingAcquires.empty()) {
+		return;
+	}
+
+	// The acquire half of each batch's release; everything recorded after it may sample.
+	std::vector<RHI::TextureBarrier> acquires;
+	acquires.reserve(m_PendingAcquires.size());
+	for (const Ref<GfxTexture> &texture : m_PendingAcquires) {
+		acquires.push_back({ .texture = &texture->GetRHI(),
+							 .oldState = RHI::ResourceState::TransferDst,
+							 .newState = RHI::ResourceState::ShaderRead,
+							 .srcQueue = RHI::CommandListType::Transfer,
+							 .dstQueue = RHI::CommandListType::Graphics });
+	}
+	frameCmd.PipelineBarrier(acquires, {});
+	for (const Ref<GfxTexture> &texture : m_PendingAcquires) {
+		texture->SetResident(true);
+	}
+	m_PendingAcquires.clear();
+}
+
+void GfxUploadBatcher::SubmitAndWait() {
+	uint64 value = 0;
+	{
+		std::lock_guard lock(m_Mutex);
+		value = SubmitOpenBatch();
+	}
+	m_Ctx.WaitForTimeline(RHI::CommandListType::Transfer, value);
+	Collect();
+}
+
+void GfxUploadBatcher::Collect() {
+	std::vector<std::function<void()>> callbacks;
+	{
+		std::lock_guard lock(m_Mutex);
+		if (m_InFlight.empty()) {
+			return;
+		}
+		const uint64 completed = m_Ctx.GetCompletedValue(RHI::CommandListType::Transfer);
+		while (!m_InFlight.empty() && m_InFlight.front().value <= completed) {
+			for (auto &callback : m_InFlight.front().onComplete) {
+				callbacks.push_back(std::move(callback));
+			}
+			m_FreeLists.push_back(std::move(m_InFlight.front().cmd));
+			m_InFlight.pop_front();
+		}
+	}
+	// Outside the lock, so a callback may queue the next upload.
+	for (auto &callback : callbacks) {
+		callback();
+	}
+}
+
+bool GfxUploadBatcher::HasPending() const {
+	std::lock_guard lock(m_Mutex);
+	return m_Open.has_value() || !m_InFlight.empty();
+}
+
+GfxUploadBatcher::Batch &GfxUploadBatcher::OpenBatch() {
+	if (!m_Open) {
+		m_Open.emplace();
+		if (m_FreeLists.empty()) {
+			m_Open->cmd = m_Ctx.CreateUploadCommandList("UploadBatch");
+		} else {
+			m_Open->cmd = std::move(m_FreeLists.back());
+			m_FreeLists.pop_back();
+		}
+		m_Open->cmd->Begin();
+	}
+	return *m_Open;
+}
+
+uint64 GfxUploadBatcher::SubmitOpenBatch() {
+	if (!m_Open) {
+		return m_LastValue;
+	}
+	m_Open->value = m_Ctx.SubmitTransfer(*m_Open->cmd);
+	m_LastValue = m_Open->value;
+	for (StagingAllocation &staging : m_Open->staging) {
+		m_Ctx.GetStagingPool().Retire(staging, RHI::CommandListType::Transfer, m_LastValue);
+	}
+	m_Open->staging.clear();
+	m_PendingAcquires.insert(m_PendingAcquires.end(), m_Open->textures.begin(), m_Open->textures.end());
+	m_InFlight.push_back(std::move(*m_Open));
+	m_Open.reset();
+	return m_LastValue;
+}
+
+} // namespace Aquila::GFX
@@ -0,0 +1,68 @@
+#include "Aquila/GFX/GfxUploadRing.h"
+#include "Aquila/GFX/GfxContext.h"
+
+namespace Aquila::GFX {
+
+GfxUploadRing::GfxUploadRing(GfxContext &ctx) : m_Ctx(ctx) {
+	for (FrameRing &ring : m_Frames) {
+		CreateBuffer(ring, SharedConstants::UPLOAD_RING_INITIAL_SIZE);
+	}
+}
+
+void GfxUploadRing::BeginFrame(uint32 frameSlot) {
+	std::lock_guard lock(m_Mutex);
+	m_FrameSlot = frameSlot;
+	FrameRing &ring = m_Frames[frameSlot];
+	ring.head = 0;
+	ring.retired.clear();
+}
+
+void GfxUploadRing::EndFrame() {
+	std::lock_guard lock(m_Mutex);
+	FrameRing &ring = m_Frames[m_FrameSlot];
+	if (ring.head > 0) {
+		ring.buffer->Flush(ring.head, 0);
+	}
+}
+
+UploadAllocation GfxUploadRing::Allocate(uint64 size, uint64 alignment) {
+	AQUILA_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0, "Upload ring alignment must be a power of two");
+
+	std::lock_guard lock(m_Mutex);
+	FrameRing &ring = m_Frames[m_FrameSlot];
+
+	uint64 offset = (ring.head + alignment - 1) & ~(alignment - 1);
+	if (offset + size > ring.capacity) {
+		const uint64 capacity = std::max<uint64>(ring.capacity * 2, size);
+		AQUILA_LOG_INFO("UploadRing: frame {} outgrew {} KB, growing to {} KB", m_FrameSlot, ring.capacity / 1024,
+						capacity / 1024);
+		ring.buffer->Flush(ring.head, 0);
+		ring.retired.push_back(std::move(ring.buffer));
+		CreateBuffer(ring, capacity);
+		offset = 0;
+	}
+
+	ring.head = offset + size;
+	return {
+		.buffer = ring.buffer.get(),
+		.bufferId = ring.bufferId,
+		.offset = static_cast<uint32>(offset),
+		.data = ring.mapped + offset,
+	};
+}
+
+void GfxUploadRing::CreateBuffer(FrameRing &ring, uint64 capacity) {
+	ring.buffer = m_Ctx.CreateBuffer({
+		.size = capacity,
+		.usage = RHI::BufferUsage::UniformBuffer | RHI::BufferUsage::StorageBuffer | RHI::BufferUsage::VertexBuffer |
+			RHI::BufferUsage::IndexBuffer,
+		.domain = RHI::MemoryDomain::CPU_TO_GPU,
+		.debugName = "UploadRing",
+	});
+	ring.mapped = static_cast<uint8 *>(ring.buffer->Map());
+	ring.bufferId = m_NextBufferId++;
+	ring.capacity = capacity;
+	ring.head = 0;
+}
+
+} // namespace Aquila::GFX
@@ -14,6 +14,9 @@ static constexpr const char *kGUIShader = AQUILA_SHADERS_DIR "2D/GUI2D.slang";
 static constexpr const char *kTextShader = AQUILA_SHADERS_DIR "2D/Text2D.slang";
 static constexpr const char *kShadowShader = AQUILA_SHADERS_DIR "2D/Shadow2D.slang";
 
+// Drawn, times the sprite's tint, in place of a texture that is still uploading.
+static constexpr vec4 kPlaceholderTint = { 0.5F, 0.5F, 0.5F, 0.25F };
+
 static Ref<GFX::GfxPipeline> BuildPipeline(GFX::GfxContext &ctx, const char *shaderPath,
 										   const std::vector<GFX::GfxDescriptorSetLayout *> &setLayouts,
 										   uint32 pushConstantSize, RHI::TextureFormat colorFormat,
@@ -105,6 +108,10 @@ static std::vector<uint32> GenerateQuadIndices(uint32 maxQuads) {
 	return indices;
 }
 
+void QuadBatcher::DeclareShaders(std::vector<std::string> &outPaths) {
+	outPaths.insert(outPaths.end(), { kFlatShader, kTextureShader, kGUIShader, kTextShader, kShadowShader });
+}
+
 QuadBatcher::QuadBatcher(GFX::GfxContext &ctx) : m_Ctx(ctx) {
 	const uint64 quadVbSize = sizeof(QuadVertex) * SharedConstants::MAX_QUADS * SharedConstants::VERTS_PER_QUAD;
 	const uint64 textVbSize = sizeof(TextVertex) * SharedConstants::MAX_QUADS * SharedConstants::VERTS_PER_QUAD;
@@ -214,6 +221,7 @@ void QuadBatcher::End() {
 
 void QuadBatcher::BeginCapture() {
 	m_ReplayList.clear();
+	m_CapturedPlaceholders = false;
 	m_Capturing = true;
 }
 
@@ -453,6 +461,15 @@ void QuadBatcher::DrawSprite(const SpriteSpec &spec) {
 	if (spec.texture != nullptr && !spec.texture->IsReady()) {
 		return;
 	}
+	if (spec.texture != nullptr && !spec.texture->IsResident()) {
+		SpriteSpec placeholder = spec;
+		placeholder.texture = nullptr;
+		placeholder.tint = spec.tint * kPlaceholderTint;
+		// A failed texture never lands, so it does not hold replay back.
+		m_CapturedPlaceholders |= m_Capturing && !spec.texture->HasFailed();
+		DrawSprite(placeholder);
+		return;
+	}
 	if (m_BatchTexture != spec.texture) {
 		Flush();
 		StartBatch();
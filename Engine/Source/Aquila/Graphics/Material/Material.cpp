@@ -1,6 +1,8 @@
 #include "Aquila/Graphics/Material/Material.h"
 #include "Aquila/Graphics/Shader/ShaderProgram.h"
 #include "Aquila/GFX/GfxContext.h"
+#include "Aquila/GFX/GfxUploadRing.h"
+#include "Aquila/Foundation/Macros.h"
 #include "Aquila/Foundation/SharedConstants.h"
 #include <cstring>
 
@@ -111,7 +113,7 @@ Ref<Material> Material::CreateFromShader(GFX::GfxContext &ctx, Shader::ShaderPro
 				p.uboOffset = offset;
 				p.value = DefaultValue(field.paramType);
 				p.defaultValue = p.value;
-				mat->m_Parameters.push_back(std::move(p));
+				mat->AddParameter(std::move(p));
 
 				offset += Std140Stride(field.paramType);
 			}
@@ -121,7 +123,7 @@ Ref<Material> Material::CreateFromShader(GFX::GfxContext &ctx, Shader::ShaderPro
 			p.name = binding.name;
 			p.type = ParameterType::Texture2D;
 			p.textureBinding = binding.bindingIndex;
-			mat->m_Parameters.push_back(std::move(p));
+			mat->AddParameter(std::move(p));
 		}
 	}
 
@@ -130,15 +132,6 @@ Ref<Material> Material::CreateFromShader(GFX::GfxContext &ctx, Shader::ShaderPro
 
 	if (uboSize > 0 && mat->m_Sets[0]) {
 		mat->m_UBOData.assign(uboSize, 0);
-		for (uint32 i = 0; i < SharedConstants::MAX_FRAMES_IN_FLIGHT; ++i) {
-			mat->m_UniformBuffers[i] = ctx.CreateBuffer({
-				.size = uboSize,
-				.usage = RHI::BufferUsage::UniformBuffer,
-				.domain = RHI::MemoryDomain::CPU_TO_GPU,
-				.debugName = ("MaterialUBO_" + std::to_string(i)).c_str(),
-			});
-		}
-		mat->m_DirtySlotMask = (1u << SharedConstants::MAX_FRAMES_IN_FLIGHT) - 1u;
 	}
 
 	return mat;
@@ -161,13 +154,11 @@ Ref<Material> Material::Create(GFX::GfxContext &ctx, Ref<GFX::GfxPipeline> pipel
 }
 
 void Material::RegisterParameter(std::string paramName, ParameterType type, uint32 uboOffset, uint32 textureBinding) {
-	for (auto &p : m_Parameters) {
-		if (p.name == paramName) {
-			p.type = type;
-			p.uboOffset = uboOffset;
-			p.textureBinding = textureBinding;
-			return;
-		}
+	if (auto *p = FindParameter(paramName)) {
+		p->type = type;
+		p->uboOffset = uboOffset;
+		p->textureBinding = textureBinding;
+		return;
 	}
 	MaterialParameter p;
 	p.name = std::move(paramName);
@@ -176,120 +167,129 @@ void Material::RegisterParameter(std::string paramName, ParameterType type, uint
 	p.textureBinding = textureBinding;
 	p.value = DefaultValue(type);
 	p.defaultValue = p.value;
-	m_Parameters.push_back(std::move(p));
+	AddParameter(std::move(p));
 }
 
-MaterialParameter *Material::FindParameter(const std::string &paramName) {
-	for (auto &p : m_Parameters) {
-		if (p.name == paramName) {
-			return &p;
-		}
+void Material::AddParameter(MaterialParameter param) {
+	const uint32 hash = Foundation::HashFnv1a(param.name);
+	const auto [it, inserted] = m_ParameterLookup.try_emplace(hash, static_cast<uint32>(m_Parameters.size()));
+	if (!inserted) {
+		AQUILA_LOG_ERROR("Material '{}': parameter '{}' collides with '{}', it can not be set by name", name,
+						 param.name, m_Parameters[it->second].name);
 	}
-	return nullptr;
+	m_Parameters.push_back(std::move(param));
 }
 
-const MaterialParameter *Material::GetParameter(const std::string &paramName) const {
-	for (const auto &p : m_Parameters) {
-		if (p.name == paramName) {
-			return &p;
-		}
+ParamHandle Material::FindHandle(ParamName paramName) const {
+	auto it = m_ParameterLookup.find(paramName.hash);
+	if (it == m_ParameterLookup.end() || m_Parameters[it->second].name != paramName.name) {
+		return {};
 	}
-	return nullptr;
+	return { it->second };
 }
 
-template <typename T> void Material::WriteUBO(uint32 offset, const T &v) {
-	if (m_UBOData.empty()) {
-		uint32 needed = offset + static_cast<uint32>(sizeof(T));
-		if (needed > m_UBOData.size()) {
-			m_UBOData.resize((needed + 15u) & ~15u, 0);
-		}
-	}
-	if (offset + sizeof(T) <= m_UBOData.size()) {
-		std::memcpy(m_UBOData.data() + offset, &v, sizeof(T));
-	}
+MaterialParameter *Material::FindParameter(const std::string &paramName) {
+	const ParamHandle handle = FindHandle(ParamName(paramName));
+	return handle.IsValid() ? &m_Parameters[handle.index] : nullptr;
+}
+
+const MaterialParameter *Material::GetParameter(const std::string &paramName) const {
+	const ParamHandle handle = FindHandle(ParamName(paramName));
+	return handle.IsValid() ? &m_Parameters[handle.index] : nullptr;
 }
 
-void Material::EnsureUniformBuffers() {
-	if (m_UniformBuffers[0] || m_UBOData.empty() || !m_Context || !m_Sets[0]) {
+void Material::WriteParameter(ParamHandle handle, ParameterValue value, const void *data, uint32 size) {
+	if (!handle.IsValid() || handle.index >= m_Parameters.size()) {
 		return;
 	}
-	uint32 size = static_cast<uint32>(m_UBOData.size());
-	for (uint32 i = 0; i < SharedConstants::MAX_FRAMES_IN_FLIGHT; ++i) {
-		m_UniformBuffers[i] = m_Context->CreateBuffer({
-			.size = size,
-			.usage = RHI::BufferUsage::UniformBuffer,
-			.domain = RHI::MemoryDomain::CPU_TO_GPU,
-			.debugName = ("MaterialUBO_" + std::to_string(i)).c_str(),
-		});
+	auto &p = m_Parameters[handle.index];
+	if (p.uboOffset == UINT32_MAX) {
+		return;
 	}
-}
+	AQUILA_ASSERT(size == ValueSize(p.type), "Material parameter written with the wrong type");
 
-Material &Material::Set(const std::string &paramName, f32 v) {
-	if (auto *p = FindParameter(paramName); p && p->uboOffset != UINT32_MAX) {
-		p->value = v;
-		WriteUBO(p->uboOffset, v);
-		m_DirtySlotMask = (1u << SharedConstants::MAX_FRAMES_IN_FLIGHT) - 1u;
+	// Manually registered parameters grow the block; Flush picks up the new size.
+	const uint32 end = p.uboOffset + size;
+	if (end > m_UBOData.size()) {
+		m_UBOData.resize((end + 15u) & ~15u, 0);
 	}
+
+	p.value = std::move(value);
+	std::memcpy(m_UBOData.data() + p.uboOffset, data, size);
+}
+
+Material &Material::Set(ParamHandle handle, f32 v) {
+	WriteParameter(handle, v, &v, sizeof(v));
 	return *this;
 }
 
-Material &Material::Set(const std::string &paramName, int v) {
-	if (auto *p = FindParameter(paramName); p && p->uboOffset != UINT32_MAX) {
-		p->value = v;
-		WriteUBO(p->uboOffset, v);
-		m_DirtySlotMask = (1u << SharedConstants::MAX_FRAMES_IN_FLIGHT) - 1u;
-	}
+Material &Material::Set(ParamHandle handle, int v) {
+	WriteParameter(handle, v, &v, sizeof(v));
 	return *this;
 }
 
-Material &Material::Set(const std::string &paramName, bool v) {
-	if (auto *p = FindParameter(paramName); p && p->uboOffset != UINT32_MAX) {
-		p->value = v;
-		int asInt = v ? 1 : 0;
-		WriteUBO(p->uboOffset, asInt);
-		m_DirtySlotMask = (1u << SharedConstants::MAX_FRAMES_IN_FLIGHT) - 1u;
-	}
+Material &Material::Set(ParamHandle handle, bool v) {
+	const int asInt = v ? 1 : 0;
+	WriteParameter(handle, v, &asInt, sizeof(asInt));
 	return *this;
 }
 
-Material &Material::Set(const std::string &paramName, const vec2 &v) {
-	if (auto *p = FindParameter(paramName); p && p->uboOffset != UINT32_MAX) {
-		p->value = v;
-		WriteUBO(p->uboOffset, v);
-		m_DirtySlotMask = (1u << SharedConstants::MAX_FRAMES_IN_FLIGHT) - 1u;
-	}
+Material &Material::Set(ParamHandle handle, const vec2 &v) {
+	WriteParameter(handle, v, &v, sizeof(v));
 	return *this;
 }
 
-Material &Material::Set(const std::string &paramName, const vec3 &v) {
-	if (auto *p = FindParameter(paramName); p && p->uboOffset != UINT32_MAX) {
-		p->value = v;
-		// Only copy 12 bytes; the 4-byte pad is left as zero.
-		if (p->uboOffset + ValueSize(ParameterType::Vec3) <= m_UBOData.size()) {
-			std::memcpy(m_UBOData.data() + p->uboOffset, &v, ValueSize(ParameterType::Vec3));
-		}
-		m_DirtySlotMask = (1u << SharedConstants::MAX_FRAMES_IN_FLIGHT) - 1u;
-	}
+Material &Material::Set(ParamHandle handle, const vec3 &v) {
+	// Only 12 bytes are copied; the std140 pad stays zero.
+	WriteParameter(handle, v, &v, sizeof(v));
 	return *this;
 }
 
-Material &Material::Set(const std::string &paramName, const vec4 &v) {
-	if (auto *p = FindParameter(paramName); p && p->uboOffset != UINT32_MAX) {
-		p->value = v;
-		WriteUBO(p->uboOffset, v);
-		m_DirtySlotMask = (1u << SharedConstants::MAX_FRAMES_IN_FLIGHT) - 1u;
-	}
+Material &Material::Set(ParamHandle handle, const vec4 &v) {
+	WriteParameter(handle, v, &v, sizeof(v));
 	return *this;
 }
 
-Material &Material::Set(const std::string &paramName, Ref<GFX::GfxTexture> tex) {
-	if (auto *p = FindParameter(paramName); p && p->textureBinding != UINT32_MAX && tex) {
-		p->value = tex;
-		m_PendingTextures.push_back({ p->textureBinding, tex.get() });
+Material &Material::Set(ParamHandle handle, Ref<GFX::GfxTexture> tex) {
+	if (!handle.IsValid() || handle.index >= m_Parameters.size() || !tex) {
+		return *this;
+	}
+	auto &p = m_Parameters[handle.index];
+	if (p.textureBinding != UINT32_MAX) {
+		SetTexture(p.textureBinding, *tex);
+		p.value = std::move(tex);
 	}
 	return *this;
 }
 
+Material &Material::Set(const std::string &paramName, f32 v) {
+	return Set(FindHandle(ParamName(paramName)), v);
+}
+
+Material &Material::Set(const std::string &paramName, int v) {
+	return Set(FindHandle(ParamName(paramName)), v);
+}
+
+Material &Material::Set(const std::string &paramName, bool v) {
+	return Set(FindHandle(ParamName(paramName)), v);
+}
+
+Material &Material::Set(const std::string &paramName, const vec2 &v) {
+	return Set(FindHandle(ParamName(paramName)), v);
+}
+
+Material &Material::Set(const std::string &paramName, const vec3 &v) {
+	return Set(FindHandle(ParamName(paramName)), v);
+}
+
+Material &Material::Set(const std::string &paramName, const vec4 &v) {
+	return Set(FindHandle(ParamName(paramName)), v);
+}
+
+Material &Material::Set(const std::string &paramName, Ref<GFX::GfxTexture> tex) {
+	return Set(FindHandle(ParamName(paramName)), std::move(tex));
+}
+
 Material &Material::SetTexture(uint32 binding, GFX::GfxTexture &tex) {
 	for (auto &tb : m_PendingTextures) {
 		if (tb.binding == binding) {
@@ -308,34 +308,51 @@ void Material::Flush(uint32 frameSlot) {
 		return;
 	}
 
-	const uint32 slotBit = 1u << frameSlot;
-	if ((m_DirtySlotMask & slotBit) == 0) {
-		return;
+	bool writeDescriptors = false;
+
+	// The ring is rewound every frame, so the block is copied whenever the material is used;
+	// the descriptor only changes when the ring's buffer or the block size does.
+	SlotState &state = m_SlotStates[frameSlot];
+	if (!m_UBOData.empty() && m_Context) {
+		const auto size = static_cast<uint32>(m_UBOData.size());
+		const GFX::UploadAllocation alloc = m_Context->GetUploadRing().Allocate(size);
+		std::memcpy(alloc.data, m_UBOData.data(), size);
+		state.uboOffset = alloc.offset;
+		if (state.boundBufferId != alloc.bufferId || state.boundSize != size) {
+			m_Sets[frameSlot]->SetBuffer(0, *alloc.buffer, 0, size);
+			state.boundBufferId = alloc.bufferId;
+			state.boundSize = size;
+			writeDescriptors = true;
+		}
 	}
 
-	if (!m_UBOData.empty()) {
-		EnsureUniformBuffers();
-		if (m_UniformBuffers[frameSlot]) {
-			m_UniformBuffers[frameSlot]->Write(m_UBOData.data(), static_cast<uint32>(m_UBOData.size()));
-			m_Sets[frameSlot]->SetBuffer(0, *m_UniformBuffers[frameSlot]);
+	const uint32 slotBit = 1u << frameSlot;
+	if ((m_DirtySlotMask & slotBit) != 0) {
+		for (auto &tb : m_PendingTextures) {
+			m_Sets[frameSlot]->SetTexture(tb.binding, *tb.tex);
 		}
-	}
+		writeDescriptors = writeDescriptors || !m_PendingTextures.empty();
 
-	for (auto &tb : m_PendingTextures) {
-		m_Sets[frameSlot]->SetTexture(tb.binding, *tb.tex);
+		m_DirtySlotMask &= ~slotBit;
+		if (m_DirtySlotMask == 0) {
+			m_PendingTextures.clear();
+		}
 	}
 
-	m_Sets[frameSlot]->Flush();
-
-	m_DirtySlotMask &= ~slotBit;
-	if (m_DirtySlotMask == 0) {
-		m_PendingTextures.clear();
+	if (writeDescriptors) {
+		m_Sets[frameSlot]->Flush();
 	}
 }
 
 void Material::Bind(GFX::GfxCommandList &cmd, uint32 setIndex, uint32 frameSlot) {
 	cmd.BindPipeline(*m_Pipeline);
-	if (m_Sets[frameSlot]) {
+	if (!m_Sets[frameSlot]) {
+		return;
+	}
+	const SlotState &state = m_SlotStates[frameSlot];
+	if (state.boundBufferId != 0) {
+		cmd.BindDescriptorSet(setIndex, *m_Sets[frameSlot], std::span(&state.uboOffset, 1));
+	} else {
 		cmd.BindDescriptorSet(setIndex, *m_Sets[frameSlot]);
 	}
 }
@@ -348,9 +365,7 @@ void Material::ReplacePipeline(Ref<GFX::GfxPipeline> newPipeline, Ref<GFX::GfxDe
 		for (uint32 i = 0; i < SharedConstants::MAX_FRAMES_IN_FLIGHT; ++i) {
 			m_Sets[i] = m_Context->AllocateDescriptorSet(*m_Layout);
 		}
-		if (m_UniformBuffers[0]) {
-			m_DirtySlotMask = (1u << SharedConstants::MAX_FRAMES_IN_FLIGHT) - 1u;
-		}
+		m_SlotStates = {};
 	}
 }
 
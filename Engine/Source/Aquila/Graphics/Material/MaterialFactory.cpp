@@ -68,7 +68,8 @@ Ref<Material> MaterialFactory::Create(GFX::GfxContext &ctx, const std::string &s
 		entry.info = info;
 
 		std::string err;
-		if (!entry.program->AddStageFromSlang(shaderPath, err)) {
+		std::vector<std::string> dependencies;
+		if (!entry.program->AddStageFromSlang(shaderPath, err, &dependencies)) {
 			AQUILA_LOG_ERROR("MaterialFactory: compile failed for '{}': {}", shaderPath, err);
 			m_Entries.erase(shaderPath);
 			return nullptr;
@@ -79,7 +80,7 @@ Ref<Material> MaterialFactory::Create(GFX::GfxContext &ctx, const std::string &s
 			return nullptr;
 		}
 
-		m_Watcher.WatchSlangFile(shaderPath, shaderPath);
+		m_Watcher.WatchSlangFile(shaderPath, shaderPath, dependencies);
 	}
 
 	auto pipeline = BuildPipeline(ctx, *entry.program, info);
@@ -96,28 +97,53 @@ Ref<Material> MaterialFactory::Create(GFX::GfxContext &ctx, const std::string &s
 	return mat;
 }
 
-void MaterialFactory::RebuildEntry(GFX::GfxContext &ctx, Entry &entry, const std::string &shaderPath) {
-	std::string err;
-	Ref<GFX::GfxDescriptorSetLayout> newLayout;
+void MaterialFactory::StartRecompile(const std::string &shaderPath, Entry &entry) {
+	entry.compiling = true;
+	entry.pendingCompile = Foundation::JobSystem::Get().ScheduleNormal("ShaderReload", [shaderPath]() {
+		CompileResult result;
+		result.succeeded = RHI::VulkanShaderCompiler::CompileFile(shaderPath, result.stages, result.errorLog,
+																  &result.dependencies);
+		return result;
+	});
+}
+
+void MaterialFactory::ApplyRecompile(GFX::GfxContext &ctx, Entry &entry, const std::string &shaderPath,
+									 CompileResult result) {
+	if (!result.succeeded) {
+		AQUILA_LOG_ERROR("MaterialFactory: hot-reload compile failed for '{}', keeping the old pipeline: {}",
+						 shaderPath, result.errorLog);
+		return;
+	}
+	m_Watcher.SetDependencies(shaderPath, result.dependencies);
 
-	if (!entry.program->Reload(err, newLayout)) {
-		AQUILA_LOG_ERROR("MaterialFactory: hot-reload compile failed for '{}': {}", shaderPath, err);
+	Ref<GFX::GfxDescriptorSetLayout> newLayout;
+	if (!entry.program->ApplyCompiled(std::move(result.stages), newLayout)) {
+		AQUILA_LOG_ERROR("MaterialFactory: hot-reload reflection failed for '{}'", shaderPath);
 		return;
 	}
 
+	// The pipeline layout is built from the program's set layout, so commit the new one first.
+	Ref<GFX::GfxDescriptorSetLayout> oldLayout = entry.program->m_DescriptorSetLayout;
+	entry.program->CommitNewLayout(newLayout);
 	auto newPipeline = BuildPipeline(ctx, *entry.program, entry.info);
 	if (!newPipeline) {
 		AQUILA_LOG_ERROR("MaterialFactory: hot-reload pipeline failed for '{}'", shaderPath);
+		entry.program->CommitNewLayout(std::move(oldLayout));
 		return;
 	}
 
-	entry.program->CommitNewLayout(newLayout);
-
-	ctx.WaitIdle();
+	const uint64 retireFrame = m_FrameIndex + SharedConstants::MAX_FRAMES_IN_FLIGHT;
+	m_Retired.push_back({ .layout = std::move(oldLayout), .retireFrame = retireFrame });
 
 	auto it = entry.instances.begin();
 	while (it != entry.instances.end()) {
 		if (auto mat = it->lock()) {
+			m_Retired.push_back({
+				.pipeline = mat->m_Pipeline,
+				.layout = mat->m_Layout,
+				.sets = mat->m_Sets,
+				.retireFrame = retireFrame,
+			});
 			mat->ReplacePipeline(newPipeline, newLayout);
 			++it;
 		} else {
@@ -128,14 +154,50 @@ void MaterialFactory::RebuildEntry(GFX::GfxContext &ctx, Entry &entry, const std
 	AQUILA_LOG_INFO("MaterialFactory: hot-reloaded '{}' ({} instances)", shaderPath, entry.instances.size());
 }
 
+MaterialFactory::~MaterialFactory() {
+	// Workers compile through the shader compiler, which is shut down right after this.
+	for (auto &[path, entry] : m_Entries) {
+		if (entry.compiling) {
+			entry.pendingCompile.Wait();
+		}
+	}
+}
+
 void MaterialFactory::Tick(GFX::GfxContext &ctx) {
-	auto changed = m_Watcher.CheckForChanges();
-	for (const auto &path : changed) {
+	++m_FrameIndex;
+	std::erase_if(m_Retired, [this](const RetiredResources &retired) { return retired.retireFrame <= m_FrameIndex; });
+
+	for (const auto &path : m_Watcher.CheckForChanges()) {
 		auto it = m_Entries.find(path);
-		if (it != m_Entries.end()) {
-			RebuildEntry(ctx, it->second, path);
-			Rendering::FrameScheduler::Get()->RequestFrame();
+		if (it == m_Entries.end()) {
+			continue;
+		}
+		if (it->second.compiling) {
+			it->second.recompileQueued = true;
+		} else {
+			StartRecompile(path, it->second);
+		}
+	}
+
+	for (auto &[path, entry] : m_Entries) {
+		if (!entry.compiling) {
+			continue;
+		}
+		if (!entry.pendingCompile.IsComplete()) {
+			Rendering::FrameScheduler::Get()->RequestFrame(); // keep ticking until the job lands
+			continue;
+		}
+		CompileResult result = entry.pendingCompile.Get();
+		entry.pendingCompile = {};
+		entry.compiling = false;
+
+		if (entry.recompileQueued) {
+			entry.recompileQueued = false;
+			StartRecompile(path, entry);
+			continue;
 		}
+		ApplyRecompile(ctx, entry, path, std::move(result));
+		Rendering::FrameScheduler::Get()->RequestFrame();
 	}
 }
 
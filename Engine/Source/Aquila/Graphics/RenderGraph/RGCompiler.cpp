@@ -1,12 +1,15 @@
 #include "Aquila/Graphics/RenderGraph/RGCompiler.h"
 
 #include "Aquila/Foundation/Macros.h"
+#include "Aquila/Foundation/Job.h"
 #include "Aquila/GFX/GfxContext.h"
 #include "Aquila/GFX/GfxTexture.h"
 #include "Aquila/GFX/GfxBuffer.h"
 #include "Aquila/GFX/GfxRenderpass.h"
 #include "Aquila/RHI/Backend/RHITypes.h"
 
+#include <cstring>
+
 // https://themaister.net/blog/2017/08/15/render-graphs-and-vulkan-a-deep-dive/
 namespace Aquila::Graphics::RG {
 
@@ -289,10 +292,10 @@ std::vector<bool> RGCompiler::CullPasses(const std::vector<RGPassData> &passes,
 }
 
 //  Lifetime analysis
-std::vector<RGCompiler::LifetimeInterval> RGCompiler::ComputeTexLifetimes(const std::vector<RGPassData> &passes,
-																		  const std::vector<uint32> &sortedOrder,
-																		  const std::vector<bool> &alive,
-																		  uint32 texCount, const RGRegistry &registry) {
+std::vector<RGCompiler::LifetimeInterval>
+RGCompiler::ComputeTexLifetimes(const std::vector<RGPassData> &passes, const std::vector<uint32> &sortedOrder,
+								const std::vector<bool> &alive, const std::vector<RHI::CommandListType> &queues,
+								uint32 texCount, const RGRegistry &registry) {
 	std::vector<LifetimeInterval> lifetimes(texCount);
 	// Use GetTextureVersion to build a current handle for validation-safe lookups
 	for (uint32 slot = 0; slot < texCount; ++slot) {
@@ -319,11 +322,14 @@ std::vector<RGCompiler::LifetimeInterval> RGCompiler::ComputeTexLifetimes(const
 		}
 		const RGPassData &pass = passes[passIndex];
 
+		const bool onCompute = queues[passIndex] == RHI::CommandListType::Compute;
+
 		// tell the texture its used at position X
 		auto touch = [&](RGTextureHandle handle) {
 			uint32 slot = SlotOf(handle.id);
 			lifetimes[slot].firstUse = std::min(lifetimes[slot].firstUse, pos);
 			lifetimes[slot].lastUse = std::max(lifetimes[slot].lastUse, pos);
+			lifetimes[slot].asyncCompute |= onCompute;
 		};
 
 		for (const auto &textureRead : pass.textureReads) {
@@ -344,10 +350,10 @@ std::vector<RGCompiler::LifetimeInterval> RGCompiler::ComputeTexLifetimes(const
 	return lifetimes;
 }
 
-std::vector<RGCompiler::LifetimeInterval> RGCompiler::ComputeBufLifetimes(const std::vector<RGPassData> &passes,
-																		  const std::vector<uint32> &sortedOrder,
-																		  const std::vector<bool> &alive,
-																		  uint32 bufCount, const RGRegistry &registry) {
+std::vector<RGCompiler::LifetimeInterval>
+RGCompiler::ComputeBufLifetimes(const std::vector<RGPassData> &passes, const std::vector<uint32> &sortedOrder,
+								const std::vector<bool> &alive, const std::vector<RHI::CommandListType> &queues,
+								uint32 bufCount, const RGRegistry &registry) {
 	// ! The usage is the same as for the textures so if you are lost, read the comments on the function above
 
 	std::vector<LifetimeInterval> lifetimes(bufCount);
@@ -364,10 +370,13 @@ std::vector<RGCompiler::LifetimeInterval> RGCompiler::ComputeBufLifetimes(const
 		}
 		const RGPassData &pass = passes[passIndex];
 
+		const bool onCompute = queues[passIndex] == RHI::CommandListType::Compute;
+
 		auto touch = [&](RGBufferHandle h) {
 			uint32 slot = SlotOf(h.id);
 			lifetimes[slot].firstUse = std::min(lifetimes[slot].firstUse, pos);
 			lifetimes[slot].lastUse = std::max(lifetimes[slot].lastUse, pos);
+			lifetimes[slot].asyncCompute |= onCompute;
 		};
 		for (const auto &bufferRead : pass.bufferReads) {
 			touch(bufferRead.handle);
@@ -387,12 +396,17 @@ std::vector<RGCompiler::LifetimeInterval> RGCompiler::ComputeBufLifetimes(const
 // Sort slots by firstUse, then for each slot try to find a free physical
 // resource from the pool whose lastUsedAt < slot.firstUse and whose descriptor
 // is compatible.  This achieves optimal aliasing for intervals sorted by start.
+//
+// Only the slot -> physical index mapping is decided here. The actual GPU objects
+// come from the RGTransientPool in Materialize(), so the mapping can be cached.
+//
+// Slots touched on the async compute queue never alias: schedule order says nothing
+// about when they run relative to graphics work.
 
-void RGCompiler::AllocateTransients(const std::vector<RGPassData> &passes, RGRegistry &registry,
-									const std::vector<LifetimeInterval> &texLifetimes,
-									const std::vector<LifetimeInterval> &bufLifetimes, GFX::GfxContext &ctx,
-									RGCompiledGraph &out) {
+void RGCompiler::AssignAliases(const RGRegistry &registry, const std::vector<LifetimeInterval> &texLifetimes,
+							   const std::vector<LifetimeInterval> &bufLifetimes, RGCompiledGraph &out) {
 	const uint32 texCount = registry.TextureCount();
+	out.texAlias.assign(texCount, -1);
 
 	// build a sorted list of what needs allocating
 	std::vector<std::pair<int32, uint32>> texOrder;
@@ -408,66 +422,43 @@ void RGCompiler::AllocateTransients(const std::vector<RGPassData> &passes, RGReg
 	// sort by first use (super hack to make greedy recycling work optimally)
 	std::ranges::stable_sort(texOrder);
 
-	std::vector<TexPoolEntry> texPool;
+	std::vector<TexAliasEntry> texPool;
 	texPool.reserve(texOrder.size());
 
-	// try to recylce whatever is recyclable, otherwise just allocate fresh
+	// try to recylce whatever is recyclable, otherwise open a new physical slot
 	for (auto [firstUse, slot] : texOrder) {
 		const uint32 tver = registry.GetTextureVersion(RGTextureHandle{ slot });
 		const uint32 tId = (tver << 24u) | (slot);
 		const RGTextureDesc &desc = registry.GetTextureDesc(RGTextureHandle{ tId });
-		const int32 last = texLifetimes[slot].lastUse;
+		const bool exclusive = texLifetimes[slot].asyncCompute;
+		const int32 last = exclusive ? INT32_MAX : texLifetimes[slot].lastUse;
 
 		// Try to find a free compatible physical texture
-		TexPoolEntry *match = nullptr;
+		int32 match = -1;
 		// foreach entry in the current texture pool
-		for (TexPoolEntry &entry : texPool) {
+		for (uint32 i = 0; i < texPool.size() && !exclusive; ++i) {
+			const TexAliasEntry &entry = texPool[i];
 			// is the texture free and is it compatible?
 			if (entry.lastUsedAt < firstUse && TexDescCompatible(entry.desc, desc)) {
-				if ((match == nullptr) || entry.lastUsedAt > match->lastUsedAt) {
-					match = &entry; // Prefer most-recently-freed for better cache locality
+				if (match < 0 || entry.lastUsedAt > texPool[match].lastUsedAt) {
+					match = static_cast<int32>(i); // Prefer most-recently-freed for better cache locality
 				}
 			}
 		}
 
-		// if we have a match => recycle it
-		if (match != nullptr) {
-			match->lastUsedAt = last;
-			registry.ResolveTexture(RGTextureHandle{ tId }, match->tex.get());
-		} else {
-			// if no match => allocate a new physical texture.
-			// Convert RGTextureDesc -> RHI::TextureDesc.
-			RHI::TextureDesc rhiDesc{};
-			rhiDesc.width = desc.width;
-			rhiDesc.height = desc.height;
-			rhiDesc.mipLevels = desc.mipLevels;
-			rhiDesc.arrayLayers = desc.arrayLayers;
-			rhiDesc.format = desc.format;
-			rhiDesc.usage = desc.usage;
-			rhiDesc.samples = desc.samples;
-			rhiDesc.debugName = desc.debugName.empty() ? "RG_Transient" : std::string(desc.debugName);
-
-			// viewType: derive from arrayLayers and format
-			if (rhiDesc.arrayLayers == 6) {
-				rhiDesc.viewType = RHI::TextureViewType::Cube;
-			} else if (rhiDesc.arrayLayers > 1) {
-				rhiDesc.viewType = RHI::TextureViewType::Tex2DArray;
-			} else {
-				rhiDesc.viewType = RHI::TextureViewType::Tex2D;
-			}
-
-			Ref<GFX::GfxTexture> newTex = ctx.CreateTexture(rhiDesc);
-			AQUILA_ASSERT(newTex, "Failed to allocate transient texture");
-
-			out.transientTextures.push_back(newTex);
-			registry.ResolveTexture(RGTextureHandle{ tId }, newTex.get());
-
-			texPool.push_back(TexPoolEntry{ .tex = newTex, .lastUsedAt = last, .desc = desc });
+		// if no match => this slot gets its own physical texture
+		if (match < 0) {
+			match = static_cast<int32>(texPool.size());
+			texPool.push_back(TexAliasEntry{ .lastUsedAt = last, .desc = desc });
+			out.texPhysicalSlot.push_back(slot);
 		}
+		texPool[match].lastUsedAt = last;
+		out.texAlias[slot] = match;
 	}
 
 	// do the same for buffers
 	const uint32 bufCount = registry.BufferCount();
+	out.bufAlias.assign(bufCount, -1);
 
 	std::vector<std::pair<int32, uint32>> bufOrder;
 	bufOrder.reserve(bufCount);
@@ -481,42 +472,33 @@ void RGCompiler::AllocateTransients(const std::vector<RGPassData> &passes, RGReg
 	}
 	std::ranges::stable_sort(bufOrder);
 
-	std::vector<BufPoolEntry> bufPool;
+	std::vector<BufAliasEntry> bufPool;
 	bufPool.reserve(bufOrder.size());
 
 	for (auto [firstUse, slot] : bufOrder) {
 		const uint32 bver = registry.GetBufferVersion(RGBufferHandle{ slot });
 		const uint32 bId = (bver << 24u) | (slot);
 		const RGBufferDesc &desc = registry.GetBufferDesc(RGBufferHandle{ bId });
-		const int32 last = bufLifetimes[slot].lastUse;
+		const bool exclusive = bufLifetimes[slot].asyncCompute;
+		const int32 last = exclusive ? INT32_MAX : bufLifetimes[slot].lastUse;
 
-		BufPoolEntry *match = nullptr;
-		for (BufPoolEntry &entry : bufPool) {
+		int32 match = -1;
+		for (uint32 i = 0; i < bufPool.size() && !exclusive; ++i) {
+			const BufAliasEntry &entry = bufPool[i];
 			if (entry.lastUsedAt < firstUse && BufDescCompatible(entry.desc, desc)) {
-				if ((match == nullptr) || entry.lastUsedAt > match->lastUsedAt) {
-					match = &entry;
+				if (match < 0 || entry.lastUsedAt > bufPool[match].lastUsedAt) {
+					match = static_cast<int32>(i);
 				}
 			}
 		}
 
-		if (match != nullptr) {
-			match->lastUsedAt = last;
-			registry.ResolveBuffer(RGBufferHandle{ bId }, match->buf.get());
-		} else {
-			RHI::BufferDesc rhiDesc{};
-			rhiDesc.size = desc.size;
-			rhiDesc.usage = desc.usage;
-			rhiDesc.domain = desc.domain;
-			rhiDesc.debugName = desc.debugName.empty() ? "RG_Transient" : std::string(desc.debugName);
-
-			Ref<GFX::GfxBuffer> newBuf = ctx.CreateBuffer(rhiDesc);
-			AQUILA_ASSERT(newBuf, "Failed to allocate transient buffer");
-
-			out.transientBuffers.push_back(newBuf);
-			registry.ResolveBuffer(RGBufferHandle{ bId }, newBuf.get());
-
-			bufPool.push_back(BufPoolEntry{ .buf = newBuf, .lastUsedAt = last, .desc = desc });
+		if (match < 0) {
+			match = static_cast<int32>(bufPool.size());
+			bufPool.push_back(BufAliasEntry{ .lastUsedAt = last, .desc = desc });
+			out.bufPhysicalSlot.push_back(slot);
 		}
+		bufPool[match].lastUsedAt = last;
+		out.bufAlias[slot] = match;
 	}
 }
 
@@ -524,10 +506,19 @@ void RGCompiler::AllocateTransients(const std::vector<RGPassData> &passes, RGReg
 // Walk the sorted, culled pass list.  Per-resource state is tracked in flat
 // arrays indexed by slot.  Whenever required state != current state, push a
 // barrier record into the flat table and update current state.
+//
+// The same walk cuts the schedule into queue segments. Each slot remembers the segment
+// that touched it last; a pass touching a slot last used on the other queue is a
+// hand-off: the pass starts a new segment waiting on that one, and the producing
+// segment is closed so nothing recorded after the hand-off delays the signal.
+// Waits only ever point backwards, so executing segments in order cannot deadlock.
+//
+// Imported resources are assumed to start the frame on the queue that first uses them;
+// ownership is only tracked within a frame.
 
 void RGCompiler::InferBarriers(const std::vector<RGPassData> &passes, const std::vector<uint32> &sortedOrder,
-							   const std::vector<bool> &alive, uint32 texCount, uint32 bufCount,
-							   const RGRegistry &registry, RGCompiledGraph &out) {
+							   const std::vector<bool> &alive, const std::vector<RHI::CommandListType> &queues,
+							   uint32 texCount, uint32 bufCount, const RGRegistry &registry, RGCompiledGraph &out) {
 	// Imported resources start from their declared initial state, not Undefined,
 	// so persistent textures don't get their contents discarded on first use.
 	std::vector<RHI::ResourceState> curTexState(texCount, RHI::ResourceState::Undefined);
@@ -544,6 +535,16 @@ void RGCompiler::InferBarriers(const std::vector<RGPassData> &passes, const std:
 		}
 	}
 
+	// Imported resources may have been touched by anything before the graph
+	std::vector<RHI::PipelineScope> curTexScope(texCount, RHI::PipelineScope::All);
+	std::vector<RHI::PipelineScope> curBufScope(bufCount, RHI::PipelineScope::All);
+
+	// Segment that last touched each slot, -1 before first use
+	std::vector<int32> texOwner(texCount, -1);
+	std::vector<int32> bufOwner(bufCount, -1);
+	std::vector<bool> segmentClosed;
+	std::array<int32, 2> openSegment{ -1, -1 }; // [graphics, compute]
+
 	const uint32 aliveCount = static_cast<uint32>(std::count(alive.begin(), alive.end(), true));
 
 	// texBarriers is a flat list of ALL barriers jammed together
@@ -555,41 +556,154 @@ void RGCompiler::InferBarriers(const std::vector<RGPassData> &passes, const std:
 	//  texBarriers[ passTexBarStart[N] ... passTexBarStart[N+1] ]
 	out.passTexBarStart.reserve(aliveCount + 1); // +1 for the sentinel
 	out.passBufBarStart.reserve(aliveCount + 1); // same as before
+	out.passQueue.reserve(aliveCount);
 
+	// Release records created for the current pass: (slot, segment, index into its releases)
+	struct HandOff {
+		uint32 slot;
+		int32 segment;
+		usize release;
+	};
+	std::vector<HandOff> texHandOffs;
+	std::vector<HandOff> bufHandOffs;
+
+	uint32 schedPos = 0;
 	for (const uint32 passIndex : sortedOrder) {
 		if (!alive[passIndex]) {
 			continue;
 		}
 		const RGPassData &pass = passes[passIndex];
+		const RHI::CommandListType queue = queues[passIndex];
+		out.passQueue.push_back(queue);
+
+		// Latest segment on the other queue this pass consumes from
+		int32 wait = -1;
+		auto consider = [&](int32 owner) {
+			if (owner >= 0 && out.segments[owner].queue != queue) {
+				wait = std::max(wait, owner);
+			}
+		};
+		for (const RGTextureAccess &access : pass.textureReads) {
+			consider(texOwner[SlotOf(access.handle.id)]);
+		}
+		for (const RGTextureAccess &access : pass.textureWrites) {
+			consider(texOwner[SlotOf(access.handle.id)]);
+		}
+		for (const RGBufferAccess &access : pass.bufferReads) {
+			consider(bufOwner[SlotOf(access.handle.id)]);
+		}
+		for (const RGBufferAccess &access : pass.bufferWrites) {
+			consider(bufOwner[SlotOf(access.handle.id)]);
+		}
+
+		int32 &open = openSegment[queue == RHI::CommandListType::Compute ? 1 : 0];
+		if (open < 0 || segmentClosed[open] || wait > out.segments[open].waitSegment) {
+			if (open >= 0) {
+				segmentClosed[open] = true;
+			}
+			open = static_cast<int32>(out.segments.size());
+			out.segments.push_back(RGQueueSegment{ .queue = queue, .waitSegment = wait });
+			segmentClosed.push_back(false);
+		}
+		if (wait >= 0) {
+			out.segments[wait].signalled = true;
+			segmentClosed[wait] = true;
+		}
+		const int32 segment = open;
+		out.segments[segment].passes.push_back(schedPos++);
 
 		// so if my texBarriers at this point is of size N, then the index table passTexBarStart begins at index N in the texBarriers vector
 		// when the pass runs and pushes its barriers into texBarriers,
 		// they naturally land at index N, N+1, etc.
 		// until the next pass comes along and starts recording its own start position
-		out.passTexBarStart.push_back(static_cast<uint32>(out.texBarriers.size()));
-		out.passBufBarStart.push_back(static_cast<uint32>(out.bufBarriers.size()));
+		const auto texBegin = static_cast<uint32>(out.texBarriers.size());
+		const auto bufBegin = static_cast<uint32>(out.bufBarriers.size());
+		out.passTexBarStart.push_back(texBegin);
+		out.passBufBarStart.push_back(bufBegin);
+		texHandOffs.clear();
+		bufHandOffs.clear();
+
+		const bool isGraphics = !pass.colorAttachments.empty() || pass.hasDepthAttachment;
+		const RHI::PipelineScope scope = isGraphics ? RHI::PipelineScope::Graphics : RHI::PipelineScope::Compute;
 
 		// Helper: emit a texture barrier if state changed
 		auto maybeTextureBarrier = [&](RGTextureHandle handle, RHI::ResourceState required) {
 			const uint32 slot = SlotOf(handle.id);
+			const int32 owner = texOwner[slot];
+			texOwner[slot] = segment;
+
+			// first touch since the other queue had it: release there, acquire here
+			if (owner >= 0 && out.segments[owner].queue != queue) {
+				const RGTexBarrier record{ handle, curTexState[slot], required, curTexScope[slot], scope,
+										   out.segments[owner].queue, queue };
+				texHandOffs.push_back({ slot, owner, out.segments[owner].texReleases.size() });
+				out.segments[owner].texReleases.push_back(record);
+				out.texBarriers.push_back(record);
+				curTexState[slot] = required;
+				curTexScope[slot] = scope;
+				return;
+			}
 
 			// if textures current state is not what the next pass needs
 			if (curTexState[slot] != required) {
-				// record a barrier from current state to required state
-				out.texBarriers.push_back({ handle, curTexState[slot], required });
+				// same slot already transitioned for this pass: fold into that record instead of
+				// chaining old -> A -> B, the executor submits the pass's barriers as one batch
+				auto existing = std::find_if(out.texBarriers.begin() + texBegin, out.texBarriers.end(),
+											 [slot](const RGTexBarrier &bar) { return SlotOf(bar.handle.id) == slot; });
+				if (existing != out.texBarriers.end()) {
+					existing->newState = required;
+					// both halves of a hand-off must describe the same transition
+					for (const HandOff &handOff : texHandOffs) {
+						if (handOff.slot == slot) {
+							out.segments[handOff.segment].texReleases[handOff.release].newState = required;
+						}
+					}
+				} else {
+					// record a barrier from current state to required state
+					out.texBarriers.push_back({ handle, curTexState[slot], required, curTexScope[slot], scope, queue,
+												queue });
+				}
 
 				// update current state
 				curTexState[slot] = required;
 			}
+			curTexScope[slot] = scope;
 		};
 
 		// the same as before just for buffers
 		auto maybeBufferBarrier = [&](RGBufferHandle handle, RHI::ResourceState required) {
 			const uint32 slot = SlotOf(handle.id);
+			const int32 owner = bufOwner[slot];
+			bufOwner[slot] = segment;
+
+			if (owner >= 0 && out.segments[owner].queue != queue) {
+				const RGBufBarrier record{ handle, curBufState[slot], required, curBufScope[slot], scope,
+										   out.segments[owner].queue, queue };
+				bufHandOffs.push_back({ slot, owner, out.segments[owner].bufReleases.size() });
+				out.segments[owner].bufReleases.push_back(record);
+				out.bufBarriers.push_back(record);
+				curBufState[slot] = required;
+				curBufScope[slot] = scope;
+				return;
+			}
+
 			if (curBufState[slot] != required) {
-				out.bufBarriers.push_back({ handle, curBufState[slot], required });
+				auto existing = std::find_if(out.bufBarriers.begin() + bufBegin, out.bufBarriers.end(),
+											 [slot](const RGBufBarrier &bar) { return SlotOf(bar.handle.id) == slot; });
+				if (existing != out.bufBarriers.end()) {
+					existing->newState = required;
+					for (const HandOff &handOff : bufHandOffs) {
+						if (handOff.slot == slot) {
+							out.segments[handOff.segment].bufReleases[handOff.release].newState = required;
+						}
+					}
+				} else {
+					out.bufBarriers.push_back({ handle, curBufState[slot], required, curBufScope[slot], scope, queue,
+												queue });
+				}
 				curBufState[slot] = required;
 			}
+			curBufScope[slot] = scope;
 		};
 
 		for (const RGTextureAccess &textureRead : pass.textureReads) {
@@ -618,17 +732,17 @@ void RGCompiler::InferBarriers(const std::vector<RGPassData> &passes, const std:
 	out.passBufBarStart.push_back(static_cast<uint32>(out.bufBarriers.size()));
 }
 
-void RGCompiler::CreateRenderPasses(const std::vector<RGPassData> &passes, const std::vector<uint32> &sortedOrder,
-									const std::vector<bool> &alive, const RGRegistry &registry, GFX::GfxContext &ctx,
-									RGCompiledGraph &out) {
+void RGCompiler::CreateRenderPasses(const std::vector<RGPassData> &passes, const RGRegistry &registry,
+									GFX::GfxContext &ctx, RGCompiledGraph &out) {
 	// passRenderPasses is indexed by position in passOrder (alive passes only)
 	out.passRenderPasses.resize(out.passOrder.size());
+	out.passParallel.assign(out.passOrder.size(), false);
+
+	// Without workers there is nobody to hand chunks to (or it was switched off); record inline.
+	const bool recordParallel = IsParallelRecordingEnabled() && Foundation::JobSystem::Get().GetThreadCount() > 0;
 
 	uint32 schedPos = 0;
-	for (const uint32 passIndex : sortedOrder) {
-		if (!alive[passIndex]) {
-			continue;
-		}
+	for (const uint32 passIndex : out.passOrder) {
 		const RGPassData &pass = passes[passIndex];
 
 		const bool hasColor = !pass.colorAttachments.empty();
@@ -643,6 +757,13 @@ void RGCompiler::CreateRenderPasses(const std::vector<RGPassData> &passes, const
 		rpDesc.debugName = pass.name;
 		rpDesc.externalBarriers = true; // Graph owns all barriers
 
+		// Split only when there are at least two chunks worth of work, otherwise the
+		// secondary list overhead is pure loss.
+		const bool parallel = recordParallel && pass.RenderPassExecuteRange &&
+							  pass.parallelItemCount >= 2 * pass.parallelMinItemsPerJob;
+		rpDesc.secondaryCommandLists = parallel;
+		out.passParallel[schedPos] = parallel;
+
 		// Color attachments
 		rpDesc.colorAttachments.reserve(pass.colorAttachments.size());
 		for (const RGColorAttachment &rga : pass.colorAttachments) {
@@ -693,8 +814,29 @@ void RGCompiler::CreateRenderPasses(const std::vector<RGPassData> &passes, const
 	}
 }
 
+RHI::CommandListType RGCompiler::ResolveQueue(const RGPassData &pass, bool asyncCompute) {
+	const bool hasAttachments = !pass.colorAttachments.empty() || pass.hasDepthAttachment;
+	if (pass.queue == RGQueue::AsyncCompute && asyncCompute && !hasAttachments) {
+		return RHI::CommandListType::Compute;
+	}
+	return RHI::CommandListType::Graphics;
+}
+
+namespace {
+std::atomic<bool> s_ParallelRecording{ true };
+} // namespace
+
+void RGCompiler::SetParallelRecording(bool enabled) {
+	s_ParallelRecording.store(enabled, std::memory_order_relaxed);
+}
+
+bool RGCompiler::IsParallelRecordingEnabled() {
+	return s_ParallelRecording.load(std::memory_order_relaxed);
+}
+
 // Public entry point
-RGCompiledGraph RGCompiler::Compile(const std::vector<RGPassData> &passes, RGRegistry &registry, GFX::GfxContext &ctx) {
+RGCompiledGraph RGCompiler::Compile(const std::vector<RGPassData> &passes, const RGRegistry &registry,
+									bool asyncCompute) {
 	RGCompiledGraph out;
 
 	if (passes.empty()) {
@@ -730,17 +872,145 @@ RGCompiledGraph RGCompiler::Compile(const std::vector<RGPassData> &passes, RGReg
 		}
 	}
 
-	std::vector<LifetimeInterval> texLifetimes = ComputeTexLifetimes(passes, sortedOrder, alive, texCount, registry);
-	std::vector<LifetimeInterval> bufLifetimes = ComputeBufLifetimes(passes, sortedOrder, alive, bufCount, registry);
+	std::vector<RHI::CommandListType> queues(passCount);
+	for (uint32 passIndex = 0; passIndex < passCount; ++passIndex) {
+		queues[passIndex] = ResolveQueue(passes[passIndex], asyncCompute);
+	}
 
-	AllocateTransients(passes, registry, texLifetimes, bufLifetimes, ctx, out);
+	std::vector<LifetimeInterval> texLifetimes =
+		ComputeTexLifetimes(passes, sortedOrder, alive, queues, texCount, registry);
+	std::vector<LifetimeInterval> bufLifetimes =
+		ComputeBufLifetimes(passes, sortedOrder, alive, queues, bufCount, registry);
 
-	InferBarriers(passes, sortedOrder, alive, texCount, bufCount, registry, out);
+	AssignAliases(registry, texLifetimes, bufLifetimes, out);
 
-	CreateRenderPasses(passes, sortedOrder, alive, registry, ctx, out);
+	InferBarriers(passes, sortedOrder, alive, queues, texCount, bufCount, registry, out);
 
 	out.valid = true;
 	return out;
 }
 
+void RGCompiler::Materialize(const std::vector<RGPassData> &passes, RGRegistry &registry, GFX::GfxContext &ctx,
+							 RGTransientPool &pool, RGCompiledGraph &compiled) {
+	compiled.ReleaseFrameResources();
+
+	compiled.transientTextures.reserve(compiled.texPhysicalSlot.size());
+	for (const uint32 slot : compiled.texPhysicalSlot) {
+		const RGTextureDesc &desc = registry.GetTextureDesc(RGTextureHandle{ slot });
+		compiled.transientTextures.push_back(pool.AcquireTexture(desc, ctx));
+	}
+	for (uint32 slot = 0; slot < compiled.texAlias.size(); ++slot) {
+		if (compiled.texAlias[slot] >= 0) {
+			registry.ResolveTexture(RGTextureHandle{ slot }, compiled.transientTextures[compiled.texAlias[slot]].get());
+		}
+	}
+
+	compiled.transientBuffers.reserve(compiled.bufPhysicalSlot.size());
+	for (const uint32 slot : compiled.bufPhysicalSlot) {
+		const RGBufferDesc &desc = registry.GetBufferDesc(RGBufferHandle{ slot });
+		compiled.transientBuffers.push_back(pool.AcquireBuffer(desc, ctx));
+	}
+	for (uint32 slot = 0; slot < compiled.bufAlias.size(); ++slot) {
+		if (compiled.bufAlias[slot] >= 0) {
+			registry.ResolveBuffer(RGBufferHandle{ slot }, compiled.transientBuffers[compiled.bufAlias[slot]].get());
+		}
+	}
+
+	CreateRenderPasses(passes, registry, ctx, compiled);
+}
+
+// Everything Compile() reads: declared accesses and attachments (by handle id, which
+// carries the version), culling flags, queue requests, and per-slot descriptors / import state.
+// Execute lambdas, clear values and imported pointers are deliberately left out; they
+// are consumed per frame by Materialize() and Execute().
+void RGCompiler::DescribeStructure(const std::vector<RGPassData> &passes, const RGRegistry &registry,
+								   bool asyncCompute, std::vector<uint64> &out) {
+	out.clear();
+	auto put = [&out](uint64 value) { out.push_back(value); };
+	// Length first, then the characters eight to a word, so names compare exactly.
+	auto putName = [&out](const std::string &name) {
+		out.push_back(name.size());
+		for (usize i = 0; i < name.size(); i += sizeof(uint64)) {
+			uint64 word = 0;
+			std::memcpy(&word, name.data() + i, std::min(sizeof(uint64), name.size() - i));
+			out.push_back(word);
+		}
+	};
+
+	put(passes.size());
+	put(asyncCompute ? 1u : 0u);
+	for (const RGPassData &pass : passes) {
+		putName(pass.name);
+		put((pass.hasSideEffect ? 1u : 0u) | (pass.hasUnsatisfiedDep ? 2u : 0u) | (pass.hasDepthAttachment ? 4u : 0u));
+		put(static_cast<uint64>(pass.queue));
+
+		put(pass.textureReads.size());
+		for (const RGTextureAccess &access : pass.textureReads) {
+			put(access.handle.id);
+			put(static_cast<uint64>(access.state));
+		}
+		put(pass.textureWrites.size());
+		for (const RGTextureAccess &access : pass.textureWrites) {
+			put(access.handle.id);
+			put(static_cast<uint64>(access.state));
+		}
+		put(pass.bufferReads.size());
+		for (const RGBufferAccess &access : pass.bufferReads) {
+			put(access.handle.id);
+			put(static_cast<uint64>(access.state));
+		}
+		put(pass.bufferWrites.size());
+		for (const RGBufferAccess &access : pass.bufferWrites) {
+			put(access.handle.id);
+			put(static_cast<uint64>(access.state));
+		}
+		put(pass.colorAttachments.size());
+		for (const RGColorAttachment &attachment : pass.colorAttachments) {
+			put(attachment.handle.id);
+		}
+		if (pass.hasDepthAttachment) {
+			put(pass.depthAttachment.handle.id);
+			put(pass.depthAttachment.readOnly ? 1u : 0u);
+		}
+	}
+
+	const uint32 texCount = registry.TextureCount();
+	put(texCount);
+	for (uint32 slot = 0; slot < texCount; ++slot) {
+		const RGTextureHandle handle{ slot };
+		const RGTextureDesc &desc = registry.GetTextureDesc(handle);
+		put(desc.width);
+		put(desc.height);
+		put(desc.mipLevels);
+		put(desc.arrayLayers);
+		put(static_cast<uint64>(desc.format));
+		put(static_cast<uint64>(desc.usage));
+		put(static_cast<uint64>(desc.samples));
+		put(registry.GetTextureVersion(handle));
+		put(registry.IsImportedTexture(handle) ? 1u : 0u);
+		put(static_cast<uint64>(registry.GetTextureInitialState(handle)));
+	}
+
+	const uint32 bufCount = registry.BufferCount();
+	put(bufCount);
+	for (uint32 slot = 0; slot < bufCount; ++slot) {
+		const RGBufferHandle handle{ slot };
+		const RGBufferDesc &desc = registry.GetBufferDesc(handle);
+		put(desc.size);
+		put(static_cast<uint64>(desc.usage));
+		put(static_cast<uint64>(desc.domain));
+		put(registry.GetBufferVersion(handle));
+		put(registry.IsImportedBuffer(handle) ? 1u : 0u);
+		put(static_cast<uint64>(registry.GetBufferInitialState(handle)));
+	}
+}
+
+uint64 RGCompiler::HashStructure(std::span<const uint64> description) {
+	uint64 seed = description.size();
+	for (const uint64 value : description) {
+		seed ^= value + 0x9E3779B97F4A7C15ull + (seed << 6u) + (seed >> 2u);
+	}
+	return seed;
+}
+
 } // namespace Aquila::Graphics::RG
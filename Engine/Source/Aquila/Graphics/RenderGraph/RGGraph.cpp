@@ -1,6 +1,8 @@
 #include "Aquila/Graphics/RenderGraph/RGGraph.h"
 #include "Aquila/Graphics/RenderGraph/RGCompiler.h"
 #include "Aquila/Foundation/Macros.h"
+#include "Aquila/Foundation/Job.h"
+#include "Aquila/Foundation/Profiler.h"
 #include "Aquila/GFX/GfxCommandList.h"
 #include "Aquila/GFX/GfxRenderpass.h"
 #include "Aquila/GFX/GfxContext.h"
@@ -11,62 +13,278 @@ namespace Aquila::Graphics::RG {
 
 void RenderGraph::Compile(GFX::GfxContext &ctx) {
 	AQUILA_ASSERT(!m_Passes.empty(), "RenderGraph::Compile called with no passes registered");
-	m_Compiled.Reset();
-	m_Compiled = RGCompiler::Compile(m_Passes, m_Registry, ctx);
+	m_Ctx = &ctx;
+	m_Compiled = nullptr;
+
+	m_TransientPool.BeginFrame();
+	const uint64 frame = m_TransientPool.GetFrameIndex();
+
+	std::erase_if(m_CompileCache, [frame](const auto &item) {
+		return frame - item.second.lastUsedFrame > kMaxCachedIdleFrames;
+	});
+
+	const bool asyncCompute = ctx.HasAsyncCompute();
+	RGCompiler::DescribeStructure(m_Passes, m_Registry, asyncCompute, m_Description);
+	const uint64 key = RGCompiler::HashStructure(m_Description);
+	auto it = m_CompileCache.find(key);
+	// The hash only picks the entry; a different graph that collides with it recompiles.
+	if (it == m_CompileCache.end() || it->second.description != m_Description) {
+		RGCompiledGraph compiled = RGCompiler::Compile(m_Passes, m_Registry, asyncCompute);
+		if (!compiled.valid) {
+			return; // cycle, already logged. Not cached so a fixed graph recompiles next frame
+		}
+		CachedGraph entry{ .compiled = std::move(compiled), .description = m_Description };
+		it = m_CompileCache.insert_or_assign(key, std::move(entry)).first;
+	}
+
+	it->second.lastUsedFrame = frame;
+	m_Compiled = &it->second.compiled;
+	RGCompiler::Materialize(m_Passes, m_Registry, ctx, m_TransientPool, *m_Compiled);
 }
 
+// Segments run in order. Graphics segments go to the frame command list, flushed in
+// between so the compute queue can wait on them; each compute segment is recorded into
+// its own list and submitted as soon as it is done. The last graphics segment is left
+// open for the caller to submit with the frame, unless something waits on it.
 void RenderGraph::Execute(GFX::GfxCommandList &cmd) {
-	AQUILA_ASSERT(m_Compiled.valid, "RenderGraph::Execute called before Compile()");
+	AQUILA_ASSERT(m_Compiled && m_Compiled->valid, "RenderGraph::Execute called before Compile()");
 
-	uint32 schedPos = 0;
+	const std::vector<RGQueueSegment> &segments = m_Compiled->segments;
 
-	for (const uint32 pi : m_Compiled.passOrder) {
-		const RGPassData &pass = m_Passes[pi];
-		AQUILA_ASSERT(pass.RenderPassExecute, "A pass has no execute function");
+	int32 lastGraphics = -1;
+	for (uint32 si = 0; si < segments.size(); ++si) {
+		if (segments[si].queue == RHI::CommandListType::Graphics) {
+			lastGraphics = static_cast<int32>(si);
+		}
+	}
+
+	// Imported resources outlive the frame, so compute work must not start before the
+	// previous frame's graphics submissions are done with them.
+	const uint64 previousGraphics = m_Ctx->GetLastSubmittedValue(RHI::CommandListType::Graphics);
+	bool firstCompute = true;
+
+	m_SegmentValues.assign(segments.size(), 0);
 
-		cmd.PushDebugGroup(pass.name.c_str());
+	for (uint32 si = 0; si < segments.size(); ++si) {
+		const RGQueueSegment &segment = segments[si];
+
+		Unique<GFX::GfxCommandList> computeList;
+		GFX::GfxCommandList *target = &cmd;
+		if (segment.queue == RHI::CommandListType::Compute) {
+			computeList = m_Ctx->CreateAsyncComputeCommandList();
+			computeList->Begin();
+			target = computeList.get();
+			if (firstCompute) {
+				target->WaitForQueue(
+					{ RHI::CommandListType::Graphics, previousGraphics, RHI::PipelineScope::Compute });
+				firstCompute = false;
+			}
+		}
+		if (segment.waitSegment >= 0) {
+			target->WaitForQueue({ segments[segment.waitSegment].queue, m_SegmentValues[segment.waitSegment],
+								   RHI::PipelineScope::All });
+		}
 
-		// Pre-pass texture barriers
-		const uint32 texBarBegin = m_Compiled.passTexBarStart[schedPos];
-		const uint32 texBarEnd = m_Compiled.passTexBarStart[schedPos + 1];
-		for (uint32 bi = texBarBegin; bi < texBarEnd; ++bi) {
-			const RGTexBarrier &bar = m_Compiled.texBarriers[bi];
-			GFX::GfxTexture &tex = m_Registry.GetTexture(bar.handle);
-			cmd.TransitionTexture(tex, bar.oldState, bar.newState);
+		for (const uint32 schedPos : segment.passes) {
+			ExecutePass(schedPos, *target);
 		}
 
-		//  Pre-pass buffer barriers
-		const uint32 bufBarBegin = m_Compiled.passBufBarStart[schedPos];
-		const uint32 bufBarEnd = m_Compiled.passBufBarStart[schedPos + 1];
-		for (uint32 bi = bufBarBegin; bi < bufBarEnd; ++bi) {
-			const RGBufBarrier &bar = m_Compiled.bufBarriers[bi];
-			GFX::GfxBuffer &buf = m_Registry.GetBuffer(bar.handle);
-			cmd.TransitionBuffer(buf, bar.oldState, bar.newState);
+		// Release halves of the hand-offs to the other queue
+		if (!segment.texReleases.empty() || !segment.bufReleases.empty()) {
+			SubmitBarriers(segment.texReleases, segment.bufReleases, *target);
 		}
 
-		// Begin renderpass (graphics passes only)
-		GFX::GfxRenderPass *renderPass = m_Compiled.passRenderPasses[schedPos].get();
-		if (renderPass != nullptr) {
-			renderPass->Begin(cmd);
+		if (computeList) {
+			m_SegmentValues[si] = m_Ctx->SubmitAsyncCompute(*computeList);
+		} else if (static_cast<int32>(si) != lastGraphics || segment.signalled) {
+			m_SegmentValues[si] = m_Ctx->FlushFrameCommandList(cmd);
 		}
+	}
+}
+
+void RenderGraph::ExecutePass(uint32 schedPos, GFX::GfxCommandList &cmd) {
+	const RGPassData &pass = m_Passes[m_Compiled->passOrder[schedPos]];
+	AQUILA_ASSERT(pass.RenderPassExecute || pass.RenderPassExecuteRange, "A pass has no execute function");
+
+	cmd.PushDebugGroup(pass.name.c_str());
 
-		// User execute callback
+	// Pre-pass barriers, textures and buffers together in one batch
+	const uint32 texBarBegin = m_Compiled->passTexBarStart[schedPos];
+	const uint32 texBarEnd = m_Compiled->passTexBarStart[schedPos + 1];
+	const uint32 bufBarBegin = m_Compiled->passBufBarStart[schedPos];
+	const uint32 bufBarEnd = m_Compiled->passBufBarStart[schedPos + 1];
+	if (texBarBegin != texBarEnd || bufBarBegin != bufBarEnd) {
+		SubmitBarriers({ m_Compiled->texBarriers.data() + texBarBegin, texBarEnd - texBarBegin },
+					   { m_Compiled->bufBarriers.data() + bufBarBegin, bufBarEnd - bufBarBegin }, cmd);
+	}
+
+	// Begin renderpass (graphics passes only)
+	GFX::GfxRenderPass *renderPass = m_Compiled->passRenderPasses[schedPos].get();
+	if (renderPass != nullptr) {
+		renderPass->Begin(cmd);
+	}
+
+	// User execute callback
+	if (m_Compiled->passParallel[schedPos]) {
+		RecordParallel(pass, *renderPass, cmd);
+	} else if (pass.RenderPassExecuteRange) {
+		pass.RenderPassExecuteRange(cmd, m_Registry, 0, pass.parallelItemCount);
+	} else {
 		pass.RenderPassExecute(cmd, m_Registry);
+	}
+
+	// End renderpass
+	if (renderPass != nullptr) {
+		renderPass->End(cmd);
+	}
+
+	cmd.PopDebugGroup();
+}
 
-		// End renderpass
-		if (renderPass != nullptr) {
-			renderPass->End(cmd);
+void RenderGraph::SubmitBarriers(std::span<const RGTexBarrier> textures, std::span<const RGBufBarrier> buffers,
+								 GFX::GfxCommandList &cmd) {
+	m_TexBarrierScratch.clear();
+	m_BufBarrierScratch.clear();
+
+	for (const RGTexBarrier &bar : textures) {
+		GFX::GfxTexture &tex = m_Registry.GetTexture(bar.handle);
+		m_TexBarrierScratch.push_back({ .texture = &tex.GetRHI(),
+										.oldState = bar.oldState,
+										.newState = bar.newState,
+										.srcScope = bar.srcScope,
+										.dstScope = bar.dstScope,
+										.srcQueue = bar.srcQueue,
+										.dstQueue = bar.dstQueue });
+	}
+
+	for (const RGBufBarrier &bar : buffers) {
+		GFX::GfxBuffer &buf = m_Registry.GetBuffer(bar.handle);
+		m_BufBarrierScratch.push_back({ .buffer = &buf.GetRHI(),
+										.oldState = bar.oldState,
+										.newState = bar.newState,
+										.srcScope = bar.srcScope,
+										.dstScope = bar.dstScope,
+										.srcQueue = bar.srcQueue,
+										.dstQueue = bar.dstQueue });
+	}
+
+	cmd.PipelineBarrier(m_TexBarrierScratch, m_BufBarrierScratch);
+}
+
+// Splits the pass range into chunks and records each into its own secondary command list.
+// The calling thread and the workers claim chunks from a shared counter, so the calling
+// thread keeps recording instead of waiting on jobs that other work holds back from starting.
+// The secondaries are executed in chunk order, so the result matches inline recording.
+void RenderGraph::RecordParallel(const RGPassData &pass, GFX::GfxRenderPass &renderPass, GFX::GfxCommandList &cmd) {
+	PROFILE_SCOPE("RenderGraph::RecordParallel");
+
+	Foundation::JobSystem &jobs = Foundation::JobSystem::Get();
+	const uint32 itemCount = pass.parallelItemCount;
+	const uint32 maxChunks = (jobs.GetThreadCount() + 1) * kChunksPerThread;
+	const uint32 chunkCount = std::clamp(itemCount / pass.parallelMinItemsPerJob, 1u, maxChunks);
+	const uint32 perChunk = (itemCount + chunkCount - 1) / chunkCount;
+
+	// Secondaries have to declare the attachment formats they will render into
+	RHI::SecondaryCommandListDesc secondaryDesc{};
+	secondaryDesc.debugName = pass.name;
+	for (const RGColorAttachment &rga : pass.colorAttachments) {
+		if (!rga.handle.IsValid()) {
+			continue;
 		}
+		const GFX::GfxTexture &tex = m_Registry.GetTexture(rga.handle);
+		secondaryDesc.colorFormats.push_back(tex.GetFormat());
+		secondaryDesc.samples = tex.GetDesc().samples;
+	}
+	if (pass.hasDepthAttachment) {
+		const GFX::GfxTexture &tex = m_Registry.GetTexture(pass.depthAttachment.handle);
+		secondaryDesc.depthFormat = tex.GetFormat();
+		secondaryDesc.samples = tex.GetDesc().samples;
+	}
+
+	const uint32 width = renderPass.GetWidth();
+	const uint32 height = renderPass.GetHeight();
+
+	std::vector<Unique<GFX::GfxCommandList>> secondaries(chunkCount);
 
-		cmd.PopDebugGroup();
-		++schedPos;
+	// Shared with the jobs, which can start after every chunk is taken and this function has
+	// returned. They then find no chunk left and never touch `record` or what it references.
+	struct ChunkQueue {
+		std::function<void(uint32)> record;
+		uint32 chunkCount = 0;
+		std::atomic<uint32> next{ 0 };
+		std::atomic<uint32> done{ 0 };
+		std::mutex errorMutex;
+		std::exception_ptr error;
+
+		void Drain() {
+			for (uint32 chunk = next.fetch_add(1, std::memory_order_relaxed); chunk < chunkCount;
+				 chunk = next.fetch_add(1, std::memory_order_relaxed)) {
+				try {
+					record(chunk);
+				} catch (...) {
+					std::lock_guard lock(errorMutex);
+					if (!error) {
+						error = std::current_exception();
+					}
+				}
+				if (done.fetch_add(1, std::memory_order_acq_rel) + 1 == chunkCount) {
+					done.notify_all();
+				}
+			}
+		}
+	};
+	auto queue = CreateRef<ChunkQueue>();
+	queue->chunkCount = chunkCount;
+	queue->record = [&](uint32 chunk) {
+		const uint32 begin = chunk * perChunk;
+		const uint32 end = std::min(begin + perChunk, itemCount);
+
+		// Allocated on the recording thread: the device hands out per-thread pools
+		Unique<GFX::GfxCommandList> secondary = m_Ctx->CreateSecondaryCommandList(secondaryDesc);
+		secondary->Begin();
+		secondary->SetViewport(0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height));
+		secondary->SetScissor(0, 0, width, height);
+		if (begin < end) {
+			pass.RenderPassExecuteRange(*secondary, m_Registry, begin, end);
+		}
+		secondary->End();
+		secondaries[chunk] = std::move(secondary);
+	};
+
+	const uint32 helperCount = std::min(chunkCount - 1, jobs.GetThreadCount());
+	for (uint32 i = 0; i < helperCount; ++i) {
+		jobs.ScheduleHigh(pass.name, [queue]() { queue->Drain(); });
+	}
+	queue->Drain();
+	for (uint32 finished = queue->done.load(std::memory_order_acquire); finished < chunkCount;
+		 finished = queue->done.load(std::memory_order_acquire)) {
+		queue->done.wait(finished, std::memory_order_acquire);
 	}
+	if (queue->error) {
+		std::rethrow_exception(queue->error); // the first thing a chunk threw
+	}
+
+	std::vector<GFX::GfxCommandList *> lists;
+	lists.reserve(chunkCount);
+	for (const Unique<GFX::GfxCommandList> &secondary : secondaries) {
+		lists.push_back(secondary.get());
+	}
+	cmd.ExecuteSecondary(lists);
 }
 
 void RenderGraph::Reset() {
-	m_Compiled.Reset();
+	if (m_Compiled != nullptr) {
+		m_Compiled->ReleaseFrameResources();
+		m_Compiled = nullptr;
+	}
 	m_Passes.clear();
 	m_Registry.Reset();
 }
 
+void RenderGraph::ClearCache() {
+	m_Compiled = nullptr;
+	m_CompileCache.clear();
+	m_TransientPool.Clear();
+}
+
 } // namespace Aquila::Graphics::RG
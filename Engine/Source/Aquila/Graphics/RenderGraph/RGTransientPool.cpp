@@ -0,0 +1,146 @@
+#include "Aquila/Graphics/RenderGraph/RGTransientPool.h"
+
+#include "Aquila/Foundation/SharedConstants.h"
+#include "Aquila/GFX/GfxContext.h"
+#include "Aquila/GFX/GfxTexture.h"
+#include "Aquila/GFX/GfxBuffer.h"
+
+namespace Aquila::Graphics::RG {
+
+namespace {
+
+void HashCombine(uint64 &seed, uint64 value) {
+	seed ^= value + 0x9E3779B97F4A7C15ull + (seed << 6u) + (seed >> 2u);
+}
+
+bool SameShape(const RGTextureDesc &a, const RGTextureDesc &b) {
+	return a.width == b.width && a.height == b.height && a.mipLevels == b.mipLevels && a.arrayLayers == b.arrayLayers &&
+		a.format == b.format && a.usage == b.usage && a.samples == b.samples;
+}
+
+bool SameShape(const RGBufferDesc &a, const RGBufferDesc &b) {
+	return a.size == b.size && a.usage == b.usage && a.domain == b.domain;
+}
+
+} // namespace
+
+uint64 RGTransientPool::HashDesc(const RGTextureDesc &desc) {
+	uint64 seed = 0;
+	HashCombine(seed, desc.width);
+	HashCombine(seed, desc.height);
+	HashCombine(seed, desc.mipLevels);
+	HashCombine(seed, desc.arrayLayers);
+	HashCombine(seed, static_cast<uint64>(desc.format));
+	HashCombine(seed, static_cast<uint64>(desc.usage));
+	HashCombine(seed, static_cast<uint64>(desc.samples));
+	return seed;
+}
+
+uint64 RGTransientPool::HashDesc(const RGBufferDesc &desc) {
+	uint64 seed = 0;
+	HashCombine(seed, desc.size);
+	HashCombine(seed, static_cast<uint64>(desc.usage));
+	HashCombine(seed, static_cast<uint64>(desc.domain));
+	return seed;
+}
+
+bool RGTransientPool::IsReusable(uint64 lastUsedFrame) const {
+	return lastUsedFrame + SharedConstants::MAX_FRAMES_IN_FLIGHT <= m_FrameIndex;
+}
+
+void RGTransientPool::BeginFrame() {
+	++m_FrameIndex;
+
+	auto isStale = [this](uint64 lastUsedFrame) { return m_FrameIndex - lastUsedFrame > kMaxIdleFrames; };
+
+	for (auto it = m_Textures.begin(); it != m_Textures.end();) {
+		std::erase_if(it->second, [&](const TexEntry &entry) { return isStale(entry.lastUsedFrame); });
+		it = it->second.empty() ? m_Textures.erase(it) : std::next(it);
+	}
+	for (auto it = m_Buffers.begin(); it != m_Buffers.end();) {
+		std::erase_if(it->second, [&](const BufEntry &entry) { return isStale(entry.lastUsedFrame); });
+		it = it->second.empty() ? m_Buffers.erase(it) : std::next(it);
+	}
+}
+
+Ref<GFX::GfxTexture> RGTransientPool::AcquireTexture(const RGTextureDesc &desc, GFX::GfxContext &ctx) {
+	std::vector<TexEntry> &bucket = m_Textures[HashDesc(desc)];
+	for (TexEntry &entry : bucket) {
+		if (IsReusable(entry.lastUsedFrame) && SameShape(entry.desc, desc)) {
+			entry.lastUsedFrame = m_FrameIndex;
+			return entry.tex;
+		}
+	}
+
+	RHI::TextureDesc rhiDesc{};
+	rhiDesc.width = desc.width;
+	rhiDesc.height = desc.height;
+	rhiDesc.mipLevels = desc.mipLevels;
+	rhiDesc.arrayLayers = desc.arrayLayers;
+	rhiDesc.format = desc.format;
+	rhiDesc.usage = desc.usage;
+	rhiDesc.samples = desc.samples;
+	rhiDesc.debugName = desc.debugName.empty() ? "RG_Transient" : std::string(desc.debugName);
+
+	// viewType: derive from arrayLayers
+	if (rhiDesc.arrayLayers == 6) {
+		rhiDesc.viewType = RHI::TextureViewType::Cube;
+	} else if (rhiDesc.arrayLayers > 1) {
+		rhiDesc.viewType = RHI::TextureViewType::Tex2DArray;
+	} else {
+		rhiDesc.viewType = RHI::TextureViewType::Tex2D;
+	}
+
+	Ref<GFX::GfxTexture> tex = ctx.CreateTexture(rhiDesc);
+	AQUILA_ASSERT(tex, "Failed to allocate transient texture");
+
+	TexEntry &entry = bucket.emplace_back(TexEntry{ .tex = tex, .desc = desc, .lastUsedFrame = m_FrameIndex });
+	entry.desc.debugName = {};
+	return tex;
+}
+
+Ref<GFX::GfxBuffer> RGTransientPool::AcquireBuffer(const RGBufferDesc &desc, GFX::GfxContext &ctx) {
+	std::vector<BufEntry> &bucket = m_Buffers[HashDesc(desc)];
+	for (BufEntry &entry : bucket) {
+		if (IsReusable(entry.lastUsedFrame) && SameShape(entry.desc, desc)) {
+			entry.lastUsedFrame = m_FrameIndex;
+			return entry.buf;
+		}
+	}
+
+	RHI::BufferDesc rhiDesc{};
+	rhiDesc.size = desc.size;
+	rhiDesc.usage = desc.usage;
+	rhiDesc.domain = desc.domain;
+	rhiDesc.debugName = desc.debugName.empty() ? "RG_Transient" : std::string(desc.debugName);
+
+	Ref<GFX::GfxBuffer> buf = ctx.CreateBuffer(rhiDesc);
+	AQUILA_ASSERT(buf, "Failed to allocate transient buffer");
+
+	BufEntry &entry = bucket.emplace_back(BufEntry{ .buf = buf, .desc = desc, .lastUsedFrame = m_FrameIndex });
+	entry.desc.debugName = {};
+	return buf;
+}
+
+void RGTransientPool::Clear() {
+	m_Textures.clear();
+	m_Buffers.clear();
+}
+
+usize RGTransientPool::GetTextureCount() const {
+	usize count = 0;
+	for (const auto &[key, bucket] : m_Textures) {
+		count += bucket.size();
+	}
+	return count;
+}
+
+usize RGTransientPool::GetBufferCount() const {
+	usize count = 0;
+	for (const auto &[key, bucket] : m_Buffers) {
+		count += bucket.size();
+	}
+	return count;
+}
+
+} // namespace Aquila::Graphics::RG
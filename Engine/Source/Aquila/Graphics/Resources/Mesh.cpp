@@ -1,4 +1,8 @@
 #include "Aquila/Graphics/Resources/Mesh.h"
+#include "Aquila/Graphics/Resources/MeshCooker.h"
+#include "Aquila/Graphics/Resources/MeshOptimizer.h"
+#include "Aquila/Graphics/Resources/MeshSimplifier.h"
+#include "Aquila/Foundation/SharedConstants.h"
 
 #include "assimp/Importer.hpp"
 #include "assimp/postprocess.h"
@@ -9,6 +13,17 @@ namespace Aquila::Graphics::Resources {
 Mesh::Mesh(const std::string &debugName) : m_DebugName(debugName) {}
 
 void Mesh::Load(const std::string &filepath) {
+	if (MeshCooker::TryLoad(filepath, *this)) {
+		AQUILA_LOG_INFO("Loaded cooked mesh '{}' - {} vertices, {} indices", m_DebugName, m_VertexCount, m_IndexCount);
+		return;
+	}
+
+	Import(filepath);
+	MeshCooker::Store(filepath, *this);
+	AQUILA_LOG_INFO("Loaded mesh '{}' - {} vertices, {} indices", m_DebugName, m_VertexCount, m_IndexCount);
+}
+
+void Mesh::Import(const std::string &filepath) {
 	Assimp::Importer importer;
 
 	const auto file =
@@ -41,6 +56,12 @@ void Mesh::Load(const std::string &filepath) {
 	m_Vertices.clear();
 	m_Indices.clear();
 	m_Primitives.clear();
+	m_PrimitiveMaterialSlots.clear();
+
+	m_MaterialSlots.clear();
+	for (uint32 i = 0; i < scene->mNumMaterials; i++) {
+		m_MaterialSlots.emplace_back(scene->mMaterials[i]->GetName().C_Str());
+	}
 
 	size_t totalVertices = 0, totalIndices = 0;
 	Delegate<void(aiNode *)> Count = [&](aiNode *node) {
@@ -102,6 +123,7 @@ void Mesh::Load(const std::string &filepath) {
 			prim.firstIndex = indexOffset;
 			prim.indexCount = mesh->mNumFaces * 3;
 			m_Primitives.push_back(prim);
+			m_PrimitiveMaterialSlots.push_back(mesh->mMaterialIndex);
 		}
 		for (uint32 i = 0; i < node->mNumChildren; i++) {
 			ProcessNode(node->mChildren[i], s);
@@ -111,11 +133,19 @@ void Mesh::Load(const std::string &filepath) {
 
 	CenterMeshAtOrigin();
 
-	m_VertexCount = static_cast<uint32>(m_Vertices.size());
-	m_IndexCount = static_cast<uint32>(m_Indices.size());
-	m_HasIndexBuffer = m_IndexCount > 0;
-
-	AQUILA_LOG_INFO("Loaded mesh '{}' - {} vertices, {} indices", m_DebugName, m_VertexCount, m_IndexCount);
+	const MeshOptimizeStats stats = MeshOptimizer::Optimize(m_Vertices, m_Indices, m_Primitives);
+	AQUILA_LOG_INFO("Optimized mesh '{}': ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, overfetch {:.2f} -> {:.2f}, "
+					"vertex data {} KB -> {} KB",
+					m_DebugName, stats.acmrBefore, stats.acmrAfter, stats.atvrBefore, stats.atvrAfter,
+					stats.overfetchBefore, stats.overfetchAfter, stats.vertexBytesBefore / 1024,
+					stats.vertexBytesAfter / 1024);
+
+	// LODs go after the optimize pass so they index the final vertex order; they only append
+	// to m_Indices, so LOD 0 keeps its optimized layout.
+	m_Lods = MeshSimplifier::GenerateLods(m_Vertices, m_Indices, m_Primitives, SharedConstants::MAX_MESH_LODS);
+	AQUILA_LOG_INFO("Generated {} LODs for mesh '{}': {} -> {} triangles, error {:.4f}", m_Lods.size(), m_DebugName,
+					m_Lods.front().indexCount / 3, m_Lods.back().indexCount / 3, m_Lods.back().error);
+	FinishLoad();
 }
 
 void Mesh::LoadFromData(const MeshData &meshData) {
@@ -127,10 +157,9 @@ void Mesh::LoadFromData(const MeshData &meshData) {
 	m_Vertices = meshData.vertices;
 	m_Indices = meshData.indices;
 	m_Path = meshData.path;
-
-	m_VertexCount = static_cast<uint32>(m_Vertices.size());
-	m_IndexCount = static_cast<uint32>(m_Indices.size());
-	m_HasIndexBuffer = m_IndexCount > 0;
+	m_Lods.clear();
+	FinishLoad();
+	ComputeBounds();
 
 	RHI::GPUMeshPrimitive prim{};
 	prim.firstVertex = 0;
@@ -138,6 +167,8 @@ void Mesh::LoadFromData(const MeshData &meshData) {
 	prim.firstIndex = 0;
 	prim.indexCount = m_IndexCount;
 	m_Primitives = { prim };
+	m_MaterialSlots = { "Default" };
+	m_PrimitiveMaterialSlots = { 0 };
 
 	AQUILA_LOG_INFO("Loaded mesh '{}' - {} vertices, {} indices", m_DebugName, m_VertexCount, m_IndexCount);
 }
@@ -158,10 +189,34 @@ void Mesh::CenterMeshAtOrigin() {
 	for (auto &v : m_Vertices) {
 		v.pos = vec4(vec3(v.pos) - center, 1.f);
 	}
+	m_BoundsMin = minB - center;
+	m_BoundsMax = maxB - center;
 
 	AQUILA_LOG_INFO("Centered mesh '{}' by ({}, {}, {})", m_DebugName, center.x, center.y, center.z);
 }
 
+void Mesh::ComputeBounds() {
+	if (m_Vertices.empty()) {
+		m_BoundsMin = m_BoundsMax = vec3(0.f);
+		return;
+	}
+
+	m_BoundsMin = m_BoundsMax = vec3(m_Vertices[0].pos);
+	for (const auto &v : m_Vertices) {
+		m_BoundsMin = glm::min(m_BoundsMin, vec3(v.pos));
+		m_BoundsMax = glm::max(m_BoundsMax, vec3(v.pos));
+	}
+}
+
+void Mesh::FinishLoad() {
+	if (m_Lods.empty()) {
+		m_Lods = { { .firstIndex = 0, .indexCount = static_cast<uint32>(m_Indices.size()), .error = 0.F } };
+	}
+	m_VertexCount = static_cast<uint32>(m_Vertices.size());
+	m_IndexCount = m_Lods.front().indexCount;
+	m_HasIndexBuffer = m_IndexCount > 0;
+}
+
 MeshData Mesh::GenerateCube(f32 size) {
 	MeshData data;
 	data.path = "procedural://cube";
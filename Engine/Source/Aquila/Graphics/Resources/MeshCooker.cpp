@@ -0,0 +1,246 @@
+#include "Aquila/Graphics/Resources/MeshCooker.h"
+#include "Aquila/Graphics/Resources/Mesh.h"
+#include "Aquila/Foundation/Hash.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Platform/Filesystem/Filesystem.h"
+#include "Aquila/Platform/Filesystem/VirtualFileSystem.h"
+
+namespace Aquila::Graphics::Resources {
+
+namespace {
+
+constexpr uint32 kMagic = 0x534D5141; // "AQMS"
+// 2: geometry is reordered by MeshOptimizer at import
+// 3: LOD table after the primitives, simplified levels appended to the indices
+constexpr uint32 kVersion = 3;
+
+struct FileHeader {
+	uint32 magic = kMagic;
+	uint32 version = kVersion;
+	uint64 sourceSize = 0;
+	uint64 sourceWriteTime = 0;
+	uint32 vertexStride = sizeof(RHI::Vertex);
+	uint32 vertexCount = 0;
+	uint32 indexCount = 0;
+	uint32 primitiveCount = 0;
+	uint32 materialSlotCount = 0;
+	uint32 lodCount = 0;
+	f32 boundsMin[3] = {};
+	f32 boundsMax[3] = {};
+};
+
+struct PrimitiveRecord {
+	uint32 firstIndex = 0;
+	uint32 firstVertex = 0;
+	uint32 indexCount = 0;
+	uint32 vertexCount = 0;
+	uint32 materialSlot = 0;
+};
+
+struct LodRecord {
+	uint32 firstIndex = 0;
+	uint32 indexCount = 0;
+	f32 error = 0.F;
+};
+
+// What identifies the source revision a blob was cooked from.
+bool StatSource(const std::string &sourcePath, uint64 &outSize, uint64 &outWriteTime) {
+	auto *vfs = Platform::Filesystem::VirtualFileSystem::Get();
+	const int64 size = vfs->GetFileSize(sourcePath);
+	if (size <= 0) {
+		return false;
+	}
+	outSize = static_cast<uint64>(size);
+	outWriteTime = vfs->GetLastWriteTime(sourcePath);
+	return true;
+}
+
+template <typename T> void Append(std::vector<uint8> &out, const T *data, usize count) {
+	const auto *bytes = reinterpret_cast<const uint8 *>(data);
+	out.insert(out.end(), bytes, bytes + count * sizeof(T));
+}
+
+// Copies `count` elements out of `blob` at `offset`, failing instead of reading past the end.
+template <typename T> bool Take(const std::vector<uint8> &blob, usize &offset, T *out, usize count) {
+	const usize bytes = count * sizeof(T);
+	if (blob.size() - offset < bytes) {
+		return false;
+	}
+	if (bytes > 0) {
+		memcpy(out, blob.data() + offset, bytes);
+	}
+	offset += bytes;
+	return true;
+}
+
+} // namespace
+
+bool MeshCooker::Cook(const std::string &sourcePath) {
+	Mesh mesh(sourcePath);
+	try {
+		mesh.Import(sourcePath);
+	} catch (const std::exception &e) {
+		AQUILA_LOG_ERROR("MeshCooker: failed to import '{}': {}", sourcePath, e.what());
+		return false;
+	}
+	return Store(sourcePath, mesh);
+}
+
+bool MeshCooker::TryLoad(const std::string &sourcePath, Mesh &mesh) {
+	uint64 sourceSize = 0;
+	uint64 sourceWriteTime = 0;
+	std::vector<uint8> blob;
+	if (!StatSource(sourcePath, sourceSize, sourceWriteTime) ||
+		!Platform::Filesystem::FileReadAll(GetCookedPath(sourcePath), blob)) {
+		return false;
+	}
+
+	usize offset = 0;
+	FileHeader header{};
+	if (!Take(blob, offset, &header, 1) || header.magic != kMagic || header.version != kVersion ||
+		header.vertexStride != sizeof(RHI::Vertex)) {
+		return false;
+	}
+	if (header.sourceSize != sourceSize || header.sourceWriteTime != sourceWriteTime) {
+		AQUILA_LOG_INFO("MeshCooker: '{}' changed since it was cooked, reimporting", sourcePath);
+		return false;
+	}
+
+	// Checked before allocating so a corrupt header can't ask for gigabytes.
+	const uint64 payload = uint64(header.primitiveCount) * sizeof(PrimitiveRecord) +
+						   uint64(header.lodCount) * sizeof(LodRecord) +
+						   uint64(header.vertexCount) * sizeof(RHI::Vertex) +
+						   (uint64(header.indexCount) + header.materialSlotCount) * sizeof(uint32);
+	if (blob.size() - offset < payload) {
+		AQUILA_LOG_WARNING("MeshCooker: cooked data for '{}' is truncated, reimporting", sourcePath);
+		return false;
+	}
+	std::vector<PrimitiveRecord> records(header.primitiveCount);
+	std::vector<LodRecord> lodRecords(header.lodCount);
+	std::vector<RHI::Vertex> vertices(header.vertexCount);
+	std::vector<uint32> indices(header.indexCount);
+	Take(blob, offset, records.data(), records.size());
+	Take(blob, offset, lodRecords.data(), lodRecords.size());
+	Take(blob, offset, vertices.data(), vertices.size());
+	Take(blob, offset, indices.data(), indices.size());
+
+	std::vector<std::string> materialSlots(header.materialSlotCount);
+	for (std::string &slot : materialSlots) {
+		uint32 length = 0;
+		if (!Take(blob, offset, &length, 1) || blob.size() - offset < length) {
+			return false;
+		}
+		slot.assign(reinterpret_cast<const char *>(blob.data() + offset), length);
+		offset += length;
+	}
+	if (offset != blob.size()) {
+		return false;
+	}
+	// Ranges and indices go straight to the GPU, so anything pointing outside the arrays is
+	// treated like a stale blob rather than trusted.
+	for (const LodRecord &lod : lodRecords) {
+		if (uint64(lod.firstIndex) + lod.indexCount > header.indexCount) {
+			return false;
+		}
+	}
+	for (const PrimitiveRecord &record : records) {
+		if (uint64(record.firstIndex) + record.indexCount > header.indexCount ||
+			uint64(record.firstVertex) + record.vertexCount > header.vertexCount) {
+			return false;
+		}
+	}
+	if (std::ranges::any_of(indices, [&](uint32 index) { return index >= header.vertexCount; })) {
+		return false;
+	}
+
+	mesh.m_Path = sourcePath;
+	mesh.m_Vertices = std::move(vertices);
+	mesh.m_Indices = std::move(indices);
+	mesh.m_MaterialSlots = std::move(materialSlots);
+	mesh.m_Primitives.clear();
+	mesh.m_PrimitiveMaterialSlots.clear();
+	for (const PrimitiveRecord &record : records) {
+		mesh.m_Primitives.push_back({
+			.firstIndex = record.firstIndex,
+			.firstVertex = record.firstVertex,
+			.indexCount = record.indexCount,
+			.vertexCount = record.vertexCount,
+		});
+		mesh.m_PrimitiveMaterialSlots.push_back(record.materialSlot);
+	}
+	mesh.m_Lods.clear();
+	for (const LodRecord &record : lodRecords) {
+		mesh.m_Lods.push_back(
+			{ .firstIndex = record.firstIndex, .indexCount = record.indexCount, .error = record.error });
+	}
+	mesh.m_BoundsMin = vec3(header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]);
+	mesh.m_BoundsMax = vec3(header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]);
+	mesh.FinishLoad();
+	return true;
+}
+
+bool MeshCooker::Store(const std::string &sourcePath, const Mesh &mesh) {
+	FileHeader header{};
+	if (!StatSource(sourcePath, header.sourceSize, header.sourceWriteTime)) {
+		return false;
+	}
+	header.vertexCount = static_cast<uint32>(mesh.m_Vertices.size());
+	header.indexCount = static_cast<uint32>(mesh.m_Indices.size());
+	header.primitiveCount = static_cast<uint32>(mesh.m_Primitives.size());
+	header.materialSlotCount = static_cast<uint32>(mesh.m_MaterialSlots.size());
+	header.lodCount = static_cast<uint32>(mesh.m_Lods.size());
+	for (int32 i = 0; i < 3; ++i) {
+		header.boundsMin[i] = mesh.m_BoundsMin[i];
+		header.boundsMax[i] = mesh.m_BoundsMax[i];
+	}
+
+	std::vector<uint8> blob;
+	blob.reserve(sizeof(FileHeader) + header.primitiveCount * sizeof(PrimitiveRecord) +
+				 header.lodCount * sizeof(LodRecord) +
+				 mesh.m_Vertices.size() * sizeof(RHI::Vertex) + mesh.m_Indices.size() * sizeof(uint32));
+	Append(blob, &header, 1);
+	for (usize i = 0; i < mesh.m_Primitives.size(); ++i) {
+		const RHI::GPUMeshPrimitive &prim = mesh.m_Primitives[i];
+		const PrimitiveRecord record{
+			.firstIndex = prim.firstIndex,
+			.firstVertex = prim.firstVertex,
+			.indexCount = prim.indexCount,
+			.vertexCount = prim.vertexCount,
+			.materialSlot = i < mesh.m_PrimitiveMaterialSlots.size() ? mesh.m_PrimitiveMaterialSlots[i] : 0,
+		};
+		Append(blob, &record, 1);
+	}
+	for (const MeshLod &lod : mesh.m_Lods) {
+		const LodRecord record{ .firstIndex = lod.firstIndex, .indexCount = lod.indexCount, .error = lod.error };
+		Append(blob, &record, 1);
+	}
+	Append(blob, mesh.m_Vertices.data(), mesh.m_Vertices.size());
+	Append(blob, mesh.m_Indices.data(), mesh.m_Indices.size());
+	for (const std::string &slot : mesh.m_MaterialSlots) {
+		const auto length = static_cast<uint32>(slot.size());
+		Append(blob, &length, 1);
+		Append(blob, slot.data(), slot.size());
+	}
+
+	if (!Platform::Filesystem::FileWriteAtomic(GetCookedPath(sourcePath), blob.data(), blob.size())) {
+		AQUILA_LOG_WARNING("MeshCooker: failed to write cooked data for '{}'", sourcePath);
+		return false;
+	}
+	return true;
+}
+
+std::string MeshCooker::GetCookedPath(const std::string &sourcePath) {
+	static const std::string s_Directory = [] {
+		std::string dir = Platform::Filesystem::PathJoin(Platform::Filesystem::DirGetUserCache(), "meshes");
+		std::error_code ec;
+		std::filesystem::create_directories(dir, ec);
+		return dir;
+	}();
+	// The cache is shared by every project, and they all mount their assets at the same virtual
+	// paths: key by where the source actually is too.
+	const std::string nativePath = Platform::Filesystem::VirtualFileSystem::Get()->GetNativePath(sourcePath);
+	const uint64 key = Foundation::HashFnv1a64(std::format("{}|{}", sourcePath, nativePath));
+	return Platform::Filesystem::PathJoin(s_Directory, std::format("{:016x}.aqmesh", key));
+}
+
+} // namespace Aquila::Graphics::Resources
@@ -0,0 +1,418 @@
+#include "Aquila/Graphics/Resources/MeshOptimizer.h"
+
+namespace Aquila::Graphics::Resources {
+
+namespace {
+
+constexpr uint32 kForsythCacheSize = 32;
+constexpr f32 kCacheDecayPower = 1.5F;
+constexpr f32 kLastTriangleScore = 0.75F;
+constexpr f32 kValenceBoostScale = 2.0F;
+constexpr f32 kValenceBoostPower = 0.5F;
+
+// Post-transform caches on current GPUs behave closer to a small FIFO than to the LRU the
+// optimizer models, so results are measured against that.
+constexpr uint32 kAnalyzeCacheSize = 16;
+constexpr uint32 kFetchLineSize = 64;
+constexpr uint32 kFetchCacheLines = 64;
+
+f32 VertexScore(int32 cachePosition, uint32 remainingValence) {
+	if (remainingValence == 0) {
+		return -1.F; // nothing left to draw with it
+	}
+
+	f32 score = 0.F;
+	if (cachePosition >= 0) {
+		// The last triangle's vertices get a fixed score so the next pick doesn't just
+		// fan around the most recent vertex.
+		score = cachePosition < 3 ? kLastTriangleScore
+								  : std::pow(1.F - static_cast<f32>(cachePosition - 3) /
+													 static_cast<f32>(kForsythCacheSize - 3),
+											 kCacheDecayPower);
+	}
+	// Favor vertices with few triangles left so they get finished off and leave the cache.
+	return score + kValenceBoostScale * std::pow(static_cast<f32>(remainingValence), -kValenceBoostPower);
+}
+
+// FIFO cache over ids in [0, count). An id is resident while fewer than `size` insertions
+// happened since its own, which makes Reset() a counter bump instead of a clear.
+class FifoCache {
+  public:
+	FifoCache(usize count, uint32 size) : m_InsertedAt(count, 0), m_Size(size), m_Clock(size + 1) {}
+
+	// Returns true on a miss.
+	bool Access(uint32 id) {
+		if (m_Clock - m_InsertedAt[id] <= m_Size) {
+			return false;
+		}
+		m_InsertedAt[id] = m_Clock++;
+		return true;
+	}
+
+	void Reset() { m_Clock += m_Size + 1; }
+
+  private:
+	std::vector<uint64> m_InsertedAt;
+	uint64 m_Size;
+	uint64 m_Clock;
+};
+
+uint32 TriangleMisses(FifoCache &cache, const uint32 *triangle, uint32 base) {
+	uint32 misses = 0;
+	for (uint32 k = 0; k < 3; ++k) {
+		misses += cache.Access(triangle[k] - base) ? 1 : 0;
+	}
+	return misses;
+}
+
+} // namespace
+
+MeshOptimizeStats MeshOptimizer::Optimize(std::vector<RHI::Vertex> &vertices, std::vector<uint32> &indices,
+										  std::vector<RHI::GPUMeshPrimitive> &primitives) {
+	MeshOptimizeStats stats;
+	stats.vertexBytesBefore = vertices.size() * sizeof(RHI::Vertex);
+	if (indices.empty()) {
+		stats.vertexBytesAfter = vertices.size() * sizeof(RHI::PackedVertex);
+		return stats;
+	}
+
+	stats.acmrBefore = AnalyzeVertexCache(indices, kAnalyzeCacheSize, &stats.atvrBefore);
+	stats.overfetchBefore = AnalyzeVertexFetch(indices, sizeof(RHI::PackedVertex));
+
+	for (const RHI::GPUMeshPrimitive &prim : primitives) {
+		if (prim.indexCount % 3 != 0 || static_cast<uint64>(prim.firstIndex) + prim.indexCount > indices.size()) {
+			continue;
+		}
+		const std::span<uint32> range(indices.data() + prim.firstIndex, prim.indexCount);
+		OptimizeVertexCache(range);
+		OptimizeOverdraw(range, vertices);
+	}
+	OptimizeVertexFetch(vertices, indices, primitives);
+
+	stats.acmrAfter = AnalyzeVertexCache(indices, kAnalyzeCacheSize, &stats.atvrAfter);
+	stats.overfetchAfter = AnalyzeVertexFetch(indices, sizeof(RHI::PackedVertex));
+	stats.vertexBytesAfter = vertices.size() * sizeof(RHI::PackedVertex);
+	return stats;
+}
+
+void MeshOptimizer::OptimizeVertexCache(std::span<uint32> indices) {
+	const usize triangleCount = indices.size() / 3;
+	if (triangleCount < 2) {
+		return;
+	}
+
+	const auto [minIt, maxIt] = std::minmax_element(indices.begin(), indices.end());
+	const uint32 base = *minIt;
+	const usize vertexCount = static_cast<usize>(*maxIt - base) + 1;
+
+	std::vector<uint32> local(indices.size());
+	for (usize i = 0; i < indices.size(); ++i) {
+		local[i] = indices[i] - base;
+	}
+
+	// Per-vertex lists of the triangles still to be drawn; the live ones are kept at the
+	// front of each list, `valence` long.
+	std::vector<uint32> valence(vertexCount, 0);
+	for (uint32 v : local) {
+		++valence[v];
+	}
+	std::vector<uint32> adjacencyOffset(vertexCount + 1, 0);
+	for (usize v = 0; v < vertexCount; ++v) {
+		adjacencyOffset[v + 1] = adjacencyOffset[v] + valence[v];
+	}
+	std::vector<uint32> adjacency(local.size());
+	{
+		std::vector<uint32> cursor(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+		for (usize i = 0; i < local.size(); ++i) {
+			adjacency[cursor[local[i]]++] = static_cast<uint32>(i / 3);
+		}
+	}
+
+	std::vector<int32> cachePosition(vertexCount, -1);
+	std::vector<f32> vertexScore(vertexCount);
+	for (usize v = 0; v < vertexCount; ++v) {
+		vertexScore[v] = VertexScore(-1, valence[v]);
+	}
+
+	std::vector<f32> triangleScore(triangleCount);
+	std::vector<bool> emitted(triangleCount, false);
+	int64 best = 0;
+	for (usize t = 0; t < triangleCount; ++t) {
+		triangleScore[t] = vertexScore[local[t * 3]] + vertexScore[local[t * 3 + 1]] + vertexScore[local[t * 3 + 2]];
+		if (triangleScore[t] > triangleScore[best]) {
+			best = static_cast<int64>(t);
+		}
+	}
+
+	std::vector<uint32> cache;
+	std::vector<uint32> nextCache;
+	std::vector<uint32> evicted;
+	cache.reserve(kForsythCacheSize + 3);
+	nextCache.reserve(kForsythCacheSize + 3);
+
+	usize output = 0;
+	usize scanCursor = 0;
+	for (usize step = 0; step < triangleCount; ++step) {
+		if (best < 0) {
+			// Nothing adjacent to the cache is left; continue with the next undrawn triangle.
+			while (emitted[scanCursor]) {
+				++scanCursor;
+			}
+			best = static_cast<int64>(scanCursor);
+		}
+
+		const auto triangle = static_cast<usize>(best);
+		const uint32 *tri = &local[triangle * 3];
+		emitted[triangle] = true;
+		for (uint32 k = 0; k < 3; ++k) {
+			indices[output++] = tri[k] + base;
+
+			const uint32 v = tri[k];
+			uint32 *list = &adjacency[adjacencyOffset[v]];
+			const uint32 live = valence[v]--;
+			for (uint32 i = 0; i < live; ++i) {
+				if (list[i] == triangle) {
+					std::swap(list[i], list[live - 1]);
+					break;
+				}
+			}
+		}
+
+		// LRU update: this triangle's vertices move to the front.
+		nextCache.clear();
+		for (uint32 k = 0; k < 3; ++k) {
+			if (std::find(nextCache.begin(), nextCache.end(), tri[k]) == nextCache.end()) {
+				nextCache.push_back(tri[k]); // degenerate triangles repeat a vertex
+			}
+		}
+		for (uint32 v : cache) {
+			if (v != tri[0] && v != tri[1] && v != tri[2]) {
+				nextCache.push_back(v);
+			}
+		}
+		evicted.clear();
+		for (usize i = kForsythCacheSize; i < nextCache.size(); ++i) {
+			evicted.push_back(nextCache[i]);
+			cachePosition[nextCache[i]] = -1;
+			vertexScore[nextCache[i]] = VertexScore(-1, valence[nextCache[i]]);
+		}
+		nextCache.resize(std::min<usize>(nextCache.size(), kForsythCacheSize));
+		cache.swap(nextCache);
+		for (usize i = 0; i < cache.size(); ++i) {
+			cachePosition[cache[i]] = static_cast<int32>(i);
+			vertexScore[cache[i]] = VertexScore(static_cast<int32>(i), valence[cache[i]]);
+		}
+
+		// Only triangles around vertices whose score moved can change, and the next pick
+		// comes from among them.
+		best = -1;
+		f32 bestScore = -1.F;
+		const auto rescore = [&](uint32 v) {
+			const uint32 *list = &adjacency[adjacencyOffset[v]];
+			for (uint32 i = 0; i < valence[v]; ++i) {
+				const uint32 t = list[i];
+				triangleScore[t] =
+					vertexScore[local[t * 3]] + vertexScore[local[t * 3 + 1]] + vertexScore[local[t * 3 + 2]];
+				if (triangleScore[t] > bestScore) {
+					bestScore = triangleScore[t];
+					best = t;
+				}
+			}
+		};
+		for (uint32 v : cache) {
+			rescore(v);
+		}
+		for (uint32 v : evicted) {
+			rescore(v);
+		}
+	}
+}
+
+void MeshOptimizer::OptimizeOverdraw(std::span<uint32> indices, std::span<const RHI::Vertex> vertices,
+									 f32 threshold) {
+	const usize triangleCount = indices.size() / 3;
+	if (triangleCount < 2) {
+		return;
+	}
+
+	const auto [minIt, maxIt] = std::minmax_element(indices.begin(), indices.end());
+	const uint32 base = *minIt;
+	FifoCache cache(static_cast<usize>(*maxIt - base) + 1, kAnalyzeCacheSize);
+
+	// Hard boundaries: where the cache order restarted anyway (every vertex missed), so
+	// moving the following run costs nothing.
+	std::vector<usize> hardStarts;
+	for (usize t = 0; t < triangleCount; ++t) {
+		if (TriangleMisses(cache, &indices[t * 3], base) == 3) {
+			hardStarts.push_back(t);
+		}
+	}
+	hardStarts.push_back(triangleCount);
+
+	// Soft boundaries: inside each run, cut as soon as the piece so far is within
+	// `threshold` of the run's own ACMR.
+	std::vector<usize> clusterStarts;
+	for (usize h = 0; h + 1 < hardStarts.size(); ++h) {
+		const usize start = hardStarts[h];
+		const usize end = hardStarts[h + 1];
+
+		cache.Reset();
+		uint32 runMisses = 0;
+		for (usize t = start; t < end; ++t) {
+			runMisses += TriangleMisses(cache, &indices[t * 3], base);
+		}
+		const f32 target = threshold * static_cast<f32>(runMisses) / static_cast<f32>(end - start);
+
+		cache.Reset();
+		usize pieceStart = start;
+		uint32 pieceMisses = 0;
+		clusterStarts.push_back(start);
+		for (usize t = start; t < end; ++t) {
+			pieceMisses += TriangleMisses(cache, &indices[t * 3], base);
+			const f32 acmr = static_cast<f32>(pieceMisses) / static_cast<f32>(t - pieceStart + 1);
+			if (t + 1 < end && acmr <= target) {
+				clusterStarts.push_back(t + 1);
+				pieceStart = t + 1;
+				pieceMisses = 0;
+				cache.Reset();
+			}
+		}
+	}
+	if (clusterStarts.size() < 2) {
+		return;
+	}
+	clusterStarts.push_back(triangleCount);
+
+	// Sort key: how much a cluster faces away from the mesh center. Outward-facing clusters
+	// tend to be in front from any view that sees them, so drawing them first lets depth
+	// testing reject more of what's behind.
+	struct Cluster {
+		usize start = 0;
+		usize end = 0;
+		vec3 centroid{ 0.F };
+		vec3 normal{ 0.F };
+		f32 area = 0.F;
+		f32 key = 0.F;
+	};
+	std::vector<Cluster> clusters(clusterStarts.size() - 1);
+	vec3 meshCentroid(0.F);
+	f32 meshArea = 0.F;
+	for (usize c = 0; c < clusters.size(); ++c) {
+		Cluster &cluster = clusters[c];
+		cluster.start = clusterStarts[c];
+		cluster.end = clusterStarts[c + 1];
+		for (usize t = cluster.start; t < cluster.end; ++t) {
+			const vec3 &p0 = vertices[indices[t * 3]].pos;
+			const vec3 &p1 = vertices[indices[t * 3 + 1]].pos;
+			const vec3 &p2 = vertices[indices[t * 3 + 2]].pos;
+			const vec3 areaNormal = glm::cross(p1 - p0, p2 - p0);
+			const f32 area = glm::length(areaNormal);
+			cluster.centroid += (p0 + p1 + p2) * (area / 3.F);
+			cluster.normal += areaNormal;
+			cluster.area += area;
+		}
+		meshCentroid += cluster.centroid;
+		meshArea += cluster.area;
+		if (cluster.area > 0.F) {
+			cluster.centroid /= cluster.area;
+		}
+	}
+	if (meshArea <= 0.F) {
+		return; // degenerate geometry, nothing to sort by
+	}
+	meshCentroid /= meshArea;
+
+	for (Cluster &cluster : clusters) {
+		const f32 length = glm::length(cluster.normal);
+		cluster.key = length > 0.F ? glm::dot(cluster.centroid - meshCentroid, cluster.normal / length) : 0.F;
+	}
+	std::stable_sort(clusters.begin(), clusters.end(),
+					 [](const Cluster &a, const Cluster &b) { return a.key > b.key; });
+
+	std::vector<uint32> sorted;
+	sorted.reserve(indices.size());
+	for (const Cluster &cluster : clusters) {
+		sorted.insert(sorted.end(), indices.begin() + static_cast<isize>(cluster.start * 3),
+					  indices.begin() + static_cast<isize>(cluster.end * 3));
+	}
+	std::copy(sorted.begin(), sorted.end(), indices.begin());
+}
+
+void MeshOptimizer::OptimizeVertexFetch(std::vector<RHI::Vertex> &vertices, std::vector<uint32> &indices,
+										std::vector<RHI::GPUMeshPrimitive> &primitives) {
+	constexpr uint32 kUnassigned = ~0u;
+	std::vector<uint32> remap(vertices.size(), kUnassigned);
+	std::vector<RHI::Vertex> reordered;
+	reordered.reserve(vertices.size());
+	for (uint32 &index : indices) {
+		if (remap[index] == kUnassigned) {
+			remap[index] = static_cast<uint32>(reordered.size());
+			reordered.push_back(vertices[index]);
+		}
+		index = remap[index];
+	}
+	vertices = std::move(reordered);
+
+	for (RHI::GPUMeshPrimitive &prim : primitives) {
+		if (prim.indexCount == 0 || static_cast<uint64>(prim.firstIndex) + prim.indexCount > indices.size()) {
+			continue;
+		}
+		const auto begin = indices.begin() + prim.firstIndex;
+		const auto [minIt, maxIt] = std::minmax_element(begin, begin + prim.indexCount);
+		prim.firstVertex = *minIt;
+		prim.vertexCount = *maxIt - *minIt + 1;
+	}
+}
+
+f32 MeshOptimizer::AnalyzeVertexCache(std::span<const uint32> indices, uint32 cacheSize, f32 *outAtvr) {
+	if (indices.size() < 3) {
+		return 0.F;
+	}
+
+	const auto [minIt, maxIt] = std::minmax_element(indices.begin(), indices.end());
+	const usize vertexCount = static_cast<usize>(*maxIt - *minIt) + 1;
+	FifoCache cache(vertexCount, cacheSize);
+	std::vector<bool> referenced(vertexCount, false);
+	usize misses = 0;
+	usize unique = 0;
+	for (uint32 index : indices) {
+		const uint32 v = index - *minIt;
+		misses += cache.Access(v) ? 1 : 0;
+		if (!referenced[v]) {
+			referenced[v] = true;
+			++unique;
+		}
+	}
+
+	if (outAtvr) {
+		*outAtvr = static_cast<f32>(misses) / static_cast<f32>(unique);
+	}
+	return static_cast<f32>(misses) / static_cast<f32>(indices.size() / 3);
+}
+
+f32 MeshOptimizer::AnalyzeVertexFetch(std::span<const uint32> indices, uint32 vertexStride) {
+	if (indices.empty()) {
+		return 0.F;
+	}
+
+	const uint32 maxIndex = *std::max_element(indices.begin(), indices.end());
+	const usize lineCount = (static_cast<usize>(maxIndex) + 1) * vertexStride / kFetchLineSize + 1;
+	FifoCache cache(lineCount, kFetchCacheLines);
+	std::vector<bool> referenced(static_cast<usize>(maxIndex) + 1, false);
+	uint64 fetched = 0;
+	uint64 unique = 0;
+	for (uint32 index : indices) {
+		const uint64 first = static_cast<uint64>(index) * vertexStride / kFetchLineSize;
+		const uint64 last = (static_cast<uint64>(index) * vertexStride + vertexStride - 1) / kFetchLineSize;
+		for (uint64 line = first; line <= last; ++line) {
+			fetched += cache.Access(static_cast<uint32>(line)) ? kFetchLineSize : 0;
+		}
+		if (!referenced[index]) {
+			referenced[index] = true;
+			++unique;
+		}
+	}
+	return static_cast<f32>(fetched) / static_cast<f32>(unique * vertexStride);
+}
+
+} // namespace Aquila::Graphics::Resources
@@ -0,0 +1,457 @@
+#include "Aquila/Graphics/Resources/MeshSimplifier.h"
+#include "Aquila/Graphics/Resources/MeshOptimizer.h"
+
+namespace Aquila::Graphics::Resources {
+
+namespace {
+
+// Border planes count this much more than surface area of the same size, so sliding a border
+// vertex along a curved edge shows up in the error.
+constexpr f64 kBorderWeight = 2.0;
+// A level must drop at least this fraction of the previous level's triangles to be kept.
+constexpr f32 kMinLodReduction = 0.15F;
+
+struct Quadric {
+	f64 a2 = 0, b2 = 0, c2 = 0, ab = 0, ac = 0, bc = 0, ad = 0, bd = 0, cd = 0, d2 = 0;
+	f64 weight = 0;
+
+	void AddPlane(const vec3 &normal, f64 d, f64 w) {
+		const f64 a = normal.x;
+		const f64 b = normal.y;
+		const f64 c = normal.z;
+		a2 += w * a * a;
+		b2 += w * b * b;
+		c2 += w * c * c;
+		ab += w * a * b;
+		ac += w * a * c;
+		bc += w * b * c;
+		ad += w * a * d;
+		bd += w * b * d;
+		cd += w * c * d;
+		d2 += w * d * d;
+		weight += w;
+	}
+
+	Quadric &operator+=(const Quadric &o) {
+		a2 += o.a2, b2 += o.b2, c2 += o.c2, ab += o.ab, ac += o.ac, bc += o.bc;
+		ad += o.ad, bd += o.bd, cd += o.cd, d2 += o.d2, weight += o.weight;
+		return *this;
+	}
+
+	// Weighted mean squared distance of `p` to the accumulated planes.
+	[[nodiscard]] f64 Error(const vec3 &p) const {
+		const f64 x = p.x;
+		const f64 y = p.y;
+		const f64 z = p.z;
+		const f64 e = a2 * x * x + b2 * y * y + c2 * z * z + 2 * (ab * x * y + ac * x * z + bc * y * z) +
+			2 * (ad * x + bd * y + cd * z) + d2;
+		return weight > 0 ? std::max(e, 0.0) / weight : 0.0;
+	}
+};
+
+uint64 EdgeKey(uint32 a, uint32 b) {
+	return a < b ? (static_cast<uint64>(a) << 32) | b : (static_cast<uint64>(b) << 32) | a;
+}
+
+// Simplification state for one index list. Positions are rescaled to the unit cube so the
+// error threshold and the quadrics behave the same for any mesh size; Run() can be called
+// again with a lower target to continue from where the last call stopped.
+class Simplifier {
+  public:
+	Simplifier(std::span<const RHI::Vertex> vertices, std::span<const uint32> indices) {
+		const auto [minIt, maxIt] = std::minmax_element(indices.begin(), indices.end());
+		m_Base = *minIt;
+		const usize count = static_cast<usize>(*maxIt - m_Base) + 1;
+
+		vec3 lo(std::numeric_limits<f32>::max());
+		vec3 hi(std::numeric_limits<f32>::lowest());
+		for (usize v = 0; v < count; ++v) {
+			lo = glm::min(lo, vertices[m_Base + v].pos);
+			hi = glm::max(hi, vertices[m_Base + v].pos);
+		}
+		const vec3 extent = hi - lo;
+		m_Scale = std::max(std::max(extent.x, extent.y), std::max(extent.z, 1e-6F));
+
+		m_Positions.resize(count);
+		for (usize v = 0; v < count; ++v) {
+			m_Positions[v] = (vertices[m_Base + v].pos - lo) / m_Scale;
+		}
+
+		m_Indices.resize(indices.size());
+		for (usize i = 0; i < indices.size(); ++i) {
+			m_Indices[i] = indices[i] - m_Base;
+		}
+
+		BuildWedges();
+		BuildQuadrics();
+	}
+
+	// `maxError` is in object-space units.
+	void Run(usize targetIndexCount, f32 maxError) {
+		const f64 limit = static_cast<f64>(maxError) / m_Scale;
+		const f64 maxErrorSq = limit * limit;
+		while (m_Indices.size() > targetIndexCount) {
+			if (!CollapsePass(targetIndexCount, maxErrorSq)) {
+				break;
+			}
+		}
+	}
+
+	void AppendIndices(std::vector<uint32> &out) const {
+		for (uint32 index : m_Indices) {
+			out.push_back(index + m_Base);
+		}
+	}
+
+	[[nodiscard]] usize GetIndexCount() const { return m_Indices.size(); }
+	[[nodiscard]] f32 GetError() const { return static_cast<f32>(std::sqrt(m_ErrorSq)) * m_Scale; }
+
+  private:
+	struct Collapse {
+		uint32 from = 0; // both are position (canonical) ids
+		uint32 to = 0;
+		f64 cost = 0;
+	};
+
+	// Vertices with bit-identical positions share one canonical id; the rest of a position's
+	// vertices ("wedges") are linked in a ring through m_NextWedge.
+	void BuildWedges() {
+		const usize count = m_Positions.size();
+		m_Canonical.resize(count);
+		m_NextWedge.resize(count);
+		std::unordered_map<uint64, uint32> first;
+		first.reserve(count);
+		for (usize v = 0; v < count; ++v) {
+			const vec3 &p = m_Positions[v];
+			uint32 bits[3];
+			memcpy(bits, &p, sizeof(bits));
+			const uint64 key = (static_cast<uint64>(bits[0]) * 73856093ULL) ^ (static_cast<uint64>(bits[1]) << 21) ^
+				(static_cast<uint64>(bits[2]) << 42) ^ bits[2];
+
+			// Hash collisions fall back to a linear probe over the ring.
+			uint32 canonical = static_cast<uint32>(v);
+			auto it = first.find(key);
+			if (it != first.end()) {
+				uint32 w = it->second;
+				do {
+					if (m_Positions[w] == p) {
+						canonical = w;
+						break;
+					}
+					w = m_NextWedge[w];
+				} while (w != it->second);
+			}
+
+			m_Canonical[v] = canonical;
+			if (canonical == v) {
+				m_NextWedge[v] = static_cast<uint32>(v);
+				first.try_emplace(key, static_cast<uint32>(v));
+			} else {
+				m_NextWedge[v] = m_NextWedge[canonical];
+				m_NextWedge[canonical] = static_cast<uint32>(v);
+			}
+		}
+	}
+
+	void BuildQuadrics() {
+		m_Quadrics.assign(m_Positions.size(), {});
+		std::unordered_map<uint64, uint32> edgeUse;
+		for (usize t = 0; t + 2 < m_Indices.size(); t += 3) {
+			for (uint32 k = 0; k < 3; ++k) {
+				++edgeUse[EdgeKey(m_Canonical[m_Indices[t + k]], m_Canonical[m_Indices[t + (k + 1) % 3]])];
+			}
+		}
+
+		for (usize t = 0; t + 2 < m_Indices.size(); t += 3) {
+			const uint32 c[3] = { m_Canonical[m_Indices[t]], m_Canonical[m_Indices[t + 1]],
+								  m_Canonical[m_Indices[t + 2]] };
+			const vec3 &p0 = m_Positions[c[0]];
+			const vec3 &p1 = m_Positions[c[1]];
+			const vec3 &p2 = m_Positions[c[2]];
+			vec3 normal = glm::cross(p1 - p0, p2 - p0);
+			const f32 length = glm::length(normal);
+			if (length <= 0.F) {
+				continue;
+			}
+			normal /= length;
+
+			Quadric face;
+			face.AddPlane(normal, -glm::dot(normal, p0), 0.5 * length);
+			for (uint32 v : c) {
+				m_Quadrics[v] += face;
+			}
+
+			for (uint32 k = 0; k < 3; ++k) {
+				const uint32 a = c[k];
+				const uint32 b = c[(k + 1) % 3];
+				if (edgeUse[EdgeKey(a, b)] != 1) {
+					continue;
+				}
+				const vec3 edge = m_Positions[b] - m_Positions[a];
+				vec3 side = glm::cross(edge, normal);
+				const f32 sideLength = glm::length(side);
+				if (sideLength <= 0.F) {
+					continue;
+				}
+				side /= sideLength;
+
+				Quadric border;
+				border.AddPlane(side, -glm::dot(side, m_Positions[a]), kBorderWeight * glm::dot(edge, edge));
+				m_Quadrics[a] += border;
+				m_Quadrics[b] += border;
+			}
+		}
+	}
+
+	// One round of independent collapses, cheapest first. Returns false if nothing collapsed.
+	bool CollapsePass(usize targetIndexCount, f64 maxErrorSq) {
+		const usize count = m_Positions.size();
+		const usize triangleCount = m_Indices.size() / 3;
+
+		// Classify positions by their edges: an edge used once is a border, more than twice
+		// is non-manifold and its vertices stay put.
+		std::unordered_map<uint64, uint32> edgeUse;
+		edgeUse.reserve(m_Indices.size());
+		for (usize t = 0; t < triangleCount; ++t) {
+			for (uint32 k = 0; k < 3; ++k) {
+				++edgeUse[EdgeKey(Corner(t, k), Corner(t, (k + 1) % 3))];
+			}
+		}
+		std::vector<uint8> kind(count, 0); // 0 interior, 1 border, 2 locked
+		for (const auto &[key, uses] : edgeUse) {
+			const uint8 edgeKind = uses == 1 ? 1 : (uses > 2 ? 2 : 0);
+			for (const uint32 v : { static_cast<uint32>(key >> 32), static_cast<uint32>(key) }) {
+				kind[v] = std::max(kind[v], edgeKind);
+			}
+		}
+
+		// Triangles around each position.
+		std::vector<uint32> adjacencyOffset(count + 1, 0);
+		for (uint32 index : m_Indices) {
+			++adjacencyOffset[m_Canonical[index] + 1];
+		}
+		for (usize v = 0; v < count; ++v) {
+			adjacencyOffset[v + 1] += adjacencyOffset[v];
+		}
+		std::vector<uint32> adjacency(m_Indices.size());
+		{
+			std::vector<uint32> cursor(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+			for (usize i = 0; i < m_Indices.size(); ++i) {
+				adjacency[cursor[m_Canonical[m_Indices[i]]]++] = static_cast<uint32>(i / 3);
+			}
+		}
+
+		std::vector<Collapse> candidates;
+		candidates.reserve(m_Indices.size() * 2);
+		for (usize t = 0; t < triangleCount; ++t) {
+			for (uint32 k = 0; k < 3; ++k) {
+				const uint32 a = Corner(t, k);
+				const uint32 b = Corner(t, (k + 1) % 3);
+				const bool borderEdge = edgeUse[EdgeKey(a, b)] == 1;
+				for (const auto [from, to] : { std::pair{ a, b }, std::pair{ b, a } }) {
+					if (kind[from] == 2 || (kind[from] == 1 && !borderEdge)) {
+						continue;
+					}
+					Quadric merged = m_Quadrics[from];
+					merged += m_Quadrics[to];
+					candidates.push_back({ .from = from, .to = to, .cost = merged.Error(m_Positions[to]) });
+				}
+			}
+		}
+		std::ranges::sort(candidates, {}, &Collapse::cost);
+
+		std::vector<uint32> remap(count);
+		std::iota(remap.begin(), remap.end(), 0U);
+		std::vector<bool> touched(count, false);
+		std::vector<std::pair<uint32, uint32>> wedgeMap;
+		usize trianglesLeft = triangleCount;
+		const usize targetTriangles = targetIndexCount / 3;
+		bool collapsed = false;
+
+		for (const Collapse &c : candidates) {
+			if (trianglesLeft <= targetTriangles || c.cost > maxErrorSq) {
+				break;
+			}
+			if (touched[c.from] || touched[c.to]) {
+				continue;
+			}
+
+			const std::span<const uint32> around(adjacency.data() + adjacencyOffset[c.from],
+												 adjacencyOffset[c.from + 1] - adjacencyOffset[c.from]);
+			if (!MapWedges(c, around, wedgeMap) || Flips(c, around)) {
+				continue;
+			}
+
+			for (const auto &[wedge, target] : wedgeMap) {
+				remap[wedge] = target;
+			}
+			m_Quadrics[c.to] += m_Quadrics[c.from];
+			m_ErrorSq = std::max(m_ErrorSq, c.cost);
+			collapsed = true;
+
+			// Neighbours are frozen for the rest of the pass: the flip test above assumed
+			// they stay where they are.
+			for (uint32 t : around) {
+				bool shared = false;
+				for (uint32 k = 0; k < 3; ++k) {
+					touched[Corner(t, k)] = true;
+					shared |= Corner(t, k) == c.to;
+				}
+				trianglesLeft -= shared ? 1 : 0;
+			}
+		}
+		if (!collapsed) {
+			return false;
+		}
+
+		// Remap, then drop triangles that collapsed to a line or point.
+		usize write = 0;
+		for (usize t = 0; t < triangleCount; ++t) {
+			const uint32 v0 = remap[m_Indices[t * 3]];
+			const uint32 v1 = remap[m_Indices[t * 3 + 1]];
+			const uint32 v2 = remap[m_Indices[t * 3 + 2]];
+			const uint32 c0 = m_Canonical[v0];
+			const uint32 c1 = m_Canonical[v1];
+			const uint32 c2 = m_Canonical[v2];
+			if (c0 == c1 || c1 == c2 || c0 == c2) {
+				continue;
+			}
+			m_Indices[write++] = v0;
+			m_Indices[write++] = v1;
+			m_Indices[write++] = v2;
+		}
+		m_Indices.resize(write);
+		return true;
+	}
+
+	// Every wedge of `from` in use must land on exactly one wedge of `to` that it shares a
+	// triangle with; otherwise the collapse would drag attributes across a seam.
+	bool MapWedges(const Collapse &c, std::span<const uint32> around,
+				   std::vector<std::pair<uint32, uint32>> &wedgeMap) const {
+		wedgeMap.clear();
+		std::vector<uint32> used;
+		for (uint32 t : around) {
+			uint32 wedge = ~0u;
+			uint32 target = ~0u;
+			for (uint32 k = 0; k < 3; ++k) {
+				const uint32 v = m_Indices[t * 3 + k];
+				if (m_Canonical[v] == c.from) {
+					wedge = v;
+				} else if (m_Canonical[v] == c.to) {
+					target = v;
+				}
+			}
+			if (std::ranges::find(used, wedge) == used.end()) {
+				used.push_back(wedge);
+			}
+			if (target == ~0u) {
+				continue;
+			}
+
+			auto it = std::ranges::find(wedgeMap, wedge, &std::pair<uint32, uint32>::first);
+			if (it == wedgeMap.end()) {
+				wedgeMap.emplace_back(wedge, target);
+			} else if (it->second != target) {
+				return false;
+			}
+		}
+		return wedgeMap.size() == used.size();
+	}
+
+	bool Flips(const Collapse &c, std::span<const uint32> around) const {
+		const vec3 &moved = m_Positions[c.to];
+		for (uint32 t : around) {
+			vec3 before[3];
+			vec3 after[3];
+			bool shared = false;
+			for (uint32 k = 0; k < 3; ++k) {
+				const uint32 v = Corner(t, k);
+				shared |= v == c.to;
+				before[k] = m_Positions[v];
+				after[k] = v == c.from ? moved : before[k];
+			}
+			if (shared) {
+				continue; // this one disappears
+			}
+			const vec3 n0 = glm::cross(before[1] - before[0], before[2] - before[0]);
+			const vec3 n1 = glm::cross(after[1] - after[0], after[2] - after[0]);
+			if (glm::dot(n0, n1) <= 0.F) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	[[nodiscard]] uint32 Corner(usize triangle, uint32 k) const { return m_Canonical[m_Indices[triangle * 3 + k]]; }
+
+	uint32 m_Base = 0;
+	f32 m_Scale = 1.F;
+	f64 m_ErrorSq = 0;
+	std::vector<vec3> m_Positions;
+	std::vector<uint32> m_Canonical;
+	std::vector<uint32> m_NextWedge;
+	std::vector<Quadric> m_Quadrics;
+	std::vector<uint32> m_Indices;
+};
+
+} // namespace
+
+f32 MeshSimplifier::Simplify(std::span<const RHI::Vertex> vertices, std::vector<uint32> &indices,
+							 usize targetIndexCount, f32 maxError) {
+	if (indices.size() < 6 || indices.size() <= targetIndexCount) {
+		return 0.F;
+	}
+
+	Simplifier simplifier(vertices, indices);
+	simplifier.Run(targetIndexCount, maxError);
+	indices.clear();
+	simplifier.AppendIndices(indices);
+	return simplifier.GetError();
+}
+
+std::vector<MeshLod> MeshSimplifier::GenerateLods(std::span<const RHI::Vertex> vertices, std::vector<uint32> &indices,
+												  std::span<const RHI::GPUMeshPrimitive> primitives, uint32 maxLods) {
+	std::vector<MeshLod> lods{ { .firstIndex = 0, .indexCount = static_cast<uint32>(indices.size()), .error = 0.F } };
+
+	struct Source {
+		RHI::GPUMeshPrimitive prim;
+		Unique<Simplifier> simplifier;
+	};
+	std::vector<Source> sources;
+	for (const RHI::GPUMeshPrimitive &prim : primitives) {
+		if (prim.indexCount < 6 || prim.indexCount % 3 != 0 ||
+			static_cast<uint64>(prim.firstIndex) + prim.indexCount > indices.size()) {
+			continue;
+		}
+		const std::span<const uint32> range(indices.data() + prim.firstIndex, prim.indexCount);
+		sources.push_back({ prim, CreateUnique<Simplifier>(vertices, range) });
+	}
+	if (sources.empty()) {
+		return lods;
+	}
+
+	for (uint32 level = 1; level < maxLods; ++level) {
+		const auto first = static_cast<uint32>(indices.size());
+		f32 error = 0.F;
+		for (Source &source : sources) {
+			const usize target = (source.prim.indexCount >> level) / 3 * 3;
+			source.simplifier->Run(target, std::numeric_limits<f32>::max());
+
+			const usize chunkStart = indices.size();
+			source.simplifier->AppendIndices(indices);
+			MeshOptimizer::OptimizeVertexCache(std::span<uint32>(indices).subspan(chunkStart));
+			error = std::max(error, source.simplifier->GetError());
+		}
+
+		const auto count = static_cast<uint32>(indices.size() - first);
+		const f32 kept = static_cast<f32>(count) / static_cast<f32>(lods.back().indexCount);
+		if (count == 0 || kept > 1.F - kMinLodReduction) {
+			indices.resize(first);
+			break;
+		}
+		lods.push_back({ .firstIndex = first, .indexCount = count, .error = error });
+	}
+	return lods;
+}
+
+} // namespace Aquila::Graphics::Resources
@@ -21,28 +21,21 @@ static RHI::ShaderStageFlags VkStageToRHI(VkShaderStageFlagBits stage) {
 	}
 }
 
-static Graphics::ParameterType SlangScalarToParamType(slang::TypeReflection *type) {
-	using Kind = slang::TypeReflection::Kind;
+static Graphics::ParameterType FieldToParamType(const RHI::VulkanReflectedField &field) {
 	using Scalar = slang::TypeReflection::ScalarType;
 
-	Kind kind = type->getKind();
-	if (kind != Kind::Scalar && kind != Kind::Vector) {
-		return Graphics::ParameterType::Float;
-	}
-
-	int cols = type->getColumnCount();
-	switch (type->getScalarType()) {
+	switch (static_cast<Scalar>(field.scalarType)) {
 	case Scalar::Float32:
-		if (cols == 1) {
+		if (field.columns == 1) {
 			return Graphics::ParameterType::Float;
 		}
-		if (cols == 2) {
+		if (field.columns == 2) {
 			return Graphics::ParameterType::Vec2;
 		}
-		if (cols == 3) {
+		if (field.columns == 3) {
 			return Graphics::ParameterType::Vec3;
 		}
-		if (cols == 4) {
+		if (field.columns == 4) {
 			return Graphics::ParameterType::Vec4;
 		}
 		break;
@@ -56,23 +49,29 @@ static Graphics::ParameterType SlangScalarToParamType(slang::TypeReflection *typ
 	return Graphics::ParameterType::Float;
 }
 
-bool ShaderProgram::AddStageFromSlang(const std::string &slangPath, std::string &errorLog) {
+static ShaderProgram::ReflectedBindingType ToReflectedType(RHI::DescriptorType type) {
+	switch (type) {
+	case RHI::DescriptorType::UniformBuffer:
+		return ShaderProgram::ReflectedBindingType::UniformBuffer;
+	case RHI::DescriptorType::CombinedImageSampler:
+		return ShaderProgram::ReflectedBindingType::CombinedImageSampler;
+	case RHI::DescriptorType::StorageBuffer:
+		return ShaderProgram::ReflectedBindingType::StorageBuffer;
+	default:
+		return ShaderProgram::ReflectedBindingType::Unknown;
+	}
+}
+
+bool ShaderProgram::AddStageFromSlang(const std::string &slangPath, std::string &errorLog,
+									  std::vector<std::string> *outDependencies) {
 	m_SlangPath = slangPath;
 
 	std::vector<RHI::VulkanCompiledStage> compiled;
-	if (!RHI::VulkanShaderCompiler::CompileFile(slangPath, compiled, errorLog)) {
+	if (!RHI::VulkanShaderCompiler::CompileFile(slangPath, compiled, errorLog, outDependencies)) {
 		return false;
 	}
 
-	for (auto &stage : compiled) {
-		ShaderStage s;
-		s.stage = VkStageToRHI(stage.stage);
-		s.spirv = std::move(stage.spirv);
-		s.entryPointName = std::move(stage.entryPointName);
-		s.linkedComponent = std::move(stage.linkedComponent);
-		s.session = std::move(stage.session);
-		m_Stages.push_back(std::move(s));
-	}
+	SetStages(std::move(compiled));
 	return true;
 }
 
@@ -87,18 +86,25 @@ bool ShaderProgram::Reload(std::string &errorLog, Ref<GFX::GfxDescriptorSetLayou
 		return false;
 	}
 
+	return ApplyCompiled(std::move(compiled), outNewLayout);
+}
+
+bool ShaderProgram::ApplyCompiled(std::vector<RHI::VulkanCompiledStage> compiled,
+								  Ref<GFX::GfxDescriptorSetLayout> &outNewLayout) {
 	m_Stages.clear();
+	SetStages(std::move(compiled));
+	return ReflectInto(outNewLayout);
+}
+
+void ShaderProgram::SetStages(std::vector<RHI::VulkanCompiledStage> compiled) {
 	for (auto &stage : compiled) {
 		ShaderStage s;
 		s.stage = VkStageToRHI(stage.stage);
 		s.spirv = std::move(stage.spirv);
 		s.entryPointName = std::move(stage.entryPointName);
-		s.linkedComponent = std::move(stage.linkedComponent);
-		s.session = std::move(stage.session);
+		s.parameters = std::move(stage.parameters);
 		m_Stages.push_back(std::move(s));
 	}
-
-	return ReflectInto(outNewLayout);
 }
 
 void ShaderProgram::CommitNewLayout(Ref<GFX::GfxDescriptorSetLayout> newLayout) {
@@ -124,102 +130,28 @@ RHI::ShaderStageDesc ShaderProgram::GetStageDesc(RHI::ShaderStageFlags stage) co
 	return {};
 }
 
-bool ShaderProgram::SlangTypeToDescriptor(slang::TypeLayoutReflection *typeLayout, RHI::DescriptorType &outType,
-										  ReflectedBindingType &outReflectedType) {
-	if (!typeLayout) {
-		return false;
-	}
-	slang::TypeReflection *type = typeLayout->getType();
-	if (!type) {
-		return false;
-	}
-
-	using Kind = slang::TypeReflection::Kind;
-	switch (type->getKind()) {
-	case Kind::ConstantBuffer:
-	case Kind::ParameterBlock:
-		outType = RHI::DescriptorType::UniformBuffer;
-		outReflectedType = ReflectedBindingType::UniformBuffer;
-		return true;
-
-	case Kind::Resource: {
-		SlangResourceShape base = (SlangResourceShape)(type->getResourceShape() & SLANG_RESOURCE_BASE_SHAPE_MASK);
-
-		if (base == SLANG_TEXTURE_1D || base == SLANG_TEXTURE_2D || base == SLANG_TEXTURE_3D ||
-			base == SLANG_TEXTURE_CUBE) {
-			outType = RHI::DescriptorType::CombinedImageSampler;
-			outReflectedType = ReflectedBindingType::CombinedImageSampler;
-			return true;
-		}
-		if (base == SLANG_STRUCTURED_BUFFER || base == SLANG_BYTE_ADDRESS_BUFFER) {
-			outType = RHI::DescriptorType::StorageBuffer;
-			outReflectedType = ReflectedBindingType::StorageBuffer;
-			return true;
-		}
-		return false;
-	}
-
-	case Kind::SamplerState:
-
-		return false;
-
-	default:
-		return false;
-	}
-}
-
-void ShaderProgram::ProcessBinding(slang::VariableLayoutReflection *var, RHI::ShaderStageFlags stageFlags,
+void ShaderProgram::ProcessBinding(const RHI::VulkanReflectedParameter &param, RHI::ShaderStageFlags stageFlags,
 								   std::map<uint32, std::map<uint32, BindingInfo>> &sets) {
-	if (!var) {
-		return;
-	}
-
-	uint32 bindingIndex = (uint32)var->getBindingIndex();
-	uint32 set = (uint32)var->getBindingSpace();
-
-	slang::TypeLayoutReflection *typeLayout = var->getTypeLayout();
-	if (!typeLayout) {
-		return;
-	}
-
-	RHI::DescriptorType descType{};
-	ReflectedBindingType reflType{};
-	if (!SlangTypeToDescriptor(typeLayout, descType, reflType)) {
+	if (!param.isDescriptor) {
 		return;
 	}
 
-	auto &bi = sets[set][bindingIndex];
-	bi.descriptorType = descType;
+	auto &bi = sets[param.set][param.binding];
+	bi.descriptorType = param.type;
 	bi.stageFlags = bi.stageFlags | stageFlags;
 	bi.descriptorCount = 1;
 	bi.occupied = true;
 
 	ReflectedBinding rb{};
-	rb.name = var->getName() ? var->getName() : "";
-	rb.set = set;
-	rb.bindingIndex = bindingIndex;
+	rb.name = param.name;
+	rb.set = param.set;
+	rb.bindingIndex = param.binding;
 	rb.descriptorCount = 1;
-	rb.type = reflType;
+	rb.type = ToReflectedType(param.type);
 	rb.stageFlags = stageFlags;
 
-	if (reflType == ReflectedBindingType::UniformBuffer) {
-		slang::TypeLayoutReflection *inner = typeLayout->getElementTypeLayout();
-		if (inner) {
-			for (uint32 f = 0; f < (uint32)inner->getFieldCount(); ++f) {
-				slang::VariableLayoutReflection *field = inner->getFieldByIndex(f);
-				if (!field || !field->getName()) {
-					continue;
-				}
-				slang::TypeReflection *ft = field->getTypeLayout() ? field->getTypeLayout()->getType() : nullptr;
-				if (!ft) {
-					continue;
-				}
-				ReflectedBinding::UBOField uf{};
-				uf.name = field->getName();
-				uf.paramType = SlangScalarToParamType(ft);
-				rb.uboFields.push_back(std::move(uf));
-			}
-		}
+	for (const auto &field : param.fields) {
+		rb.uboFields.push_back({ .name = field.name, .paramType = FieldToParamType(field) });
 	}
 
 	m_ReflectedBindings.push_back(std::move(rb));
@@ -234,37 +166,15 @@ bool ShaderProgram::ReflectInto(Ref<GFX::GfxDescriptorSetLayout> &outLayout) {
 	std::map<uint32, std::map<uint32, BindingInfo>> sets;
 
 	const auto &primary = m_Stages[0];
-	if (!primary.linkedComponent) {
-		outLayout = nullptr;
-		return true;
-	}
-
-	slang::ProgramLayout *pl = primary.linkedComponent->getLayout();
-	if (!pl) {
-		outLayout = nullptr;
-		return true;
-	}
-
-	for (uint32 i = 0; i < (uint32)pl->getParameterCount(); ++i) {
-		ProcessBinding(pl->getParameterByIndex(i), primary.stage, sets);
+	for (const auto &param : primary.parameters) {
+		ProcessBinding(param, primary.stage, sets);
 	}
 
 	for (size_t si = 1; si < m_Stages.size(); ++si) {
 		const auto &stage = m_Stages[si];
-		if (!stage.linkedComponent) {
-			continue;
-		}
-		slang::ProgramLayout *spl = stage.linkedComponent->getLayout();
-		if (!spl) {
-			continue;
-		}
-		for (uint32 i = 0; i < (uint32)spl->getParameterCount(); ++i) {
-			auto *var = spl->getParameterByIndex(i);
-			if (!var) {
-				continue;
-			}
-			uint32 b = (uint32)var->getBindingIndex();
-			uint32 s = (uint32)var->getBindingSpace();
+		for (const auto &param : stage.parameters) {
+			const uint32 b = param.binding;
+			const uint32 s = param.set;
 			if (sets.count(s) && sets[s].count(b)) {
 				sets[s][b].stageFlags = sets[s][b].stageFlags | stage.stage;
 			}
@@ -282,9 +192,11 @@ bool ShaderProgram::ReflectInto(Ref<GFX::GfxDescriptorSetLayout> &outLayout) {
 		if (!info.occupied) {
 			continue;
 		}
+		// Material constants are sub-allocated from the upload ring, offset given at bind time.
+		const bool ringBacked = info.descriptorType == RHI::DescriptorType::UniformBuffer;
 		desc.bindings.push_back({
 			.binding = idx,
-			.type = info.descriptorType,
+			.type = ringBacked ? RHI::DescriptorType::UniformBufferDynamic : info.descriptorType,
 			.stages = info.stageFlags,
 			.count = info.descriptorCount,
 		});
@@ -0,0 +1,140 @@
+#include "Aquila/Graphics/Shader/ShaderWatcher.h"
+#include "Aquila/Platform/Filesystem/VirtualFileSystem.h"
+#include "Aquila/Foundation/Macros.h"
+
+namespace Aquila::Graphics::Shader {
+
+using Platform::Filesystem::FileWatcher;
+
+void ShaderWatcher::WatchSlangFile(const std::string &slangPath, const std::string &programName,
+								   const std::vector<std::string> &dependencies) {
+	const bool native = IsNativePath(slangPath);
+	if (native && !std::filesystem::exists(slangPath)) {
+		AQUILA_LOG_WARNING("ShaderWatcher: cannot watch non-existent file '{}'", slangPath);
+		return;
+	}
+
+	auto *vfs = Platform::Filesystem::VirtualFileSystem::Get();
+	if (!native && !vfs->Exists(slangPath)) {
+		AQUILA_LOG_WARNING("ShaderWatcher: cannot watch non-existent VFS file '{}'", slangPath);
+		return;
+	}
+
+	Unwatch(programName);
+	m_Programs[programName] = { .slangPath = slangPath,
+								.lastModified = native ? 0 : vfs->GetLastWriteTime(slangPath),
+								.isNative = native };
+	SetDependencies(programName, dependencies);
+
+	AQUILA_LOG_INFO("ShaderWatcher: watching '{}' ({}, {} dependencies) -> program '{}'", slangPath,
+					native ? "native" : "VFS", dependencies.size(), programName);
+}
+
+void ShaderWatcher::SetDependencies(const std::string &programName, const std::vector<std::string> &dependencies) {
+	auto it = m_Programs.find(programName);
+	if (it == m_Programs.end()) {
+		return;
+	}
+
+	RemoveFiles(programName);
+	if (it->second.isNative) {
+		AddFile(programName, it->second.slangPath);
+	}
+	for (const std::string &dependency : dependencies) {
+		if (IsNativePath(dependency) && std::filesystem::exists(dependency)) {
+			AddFile(programName, dependency);
+		}
+	}
+}
+
+void ShaderWatcher::Unwatch(const std::string &programName) {
+	RemoveFiles(programName);
+	m_Programs.erase(programName);
+}
+
+void ShaderWatcher::Clear() {
+	m_Programs.clear();
+	m_FileUsers.clear();
+	m_FileWatcher.Clear();
+}
+
+std::unordered_set<std::string> ShaderWatcher::CheckForChanges() {
+	// Drained even while disabled, so enabling later doesn't replay old saves.
+	const std::vector<std::string> changedFiles = m_FileWatcher.Poll();
+	if (!m_Enabled) {
+		return {};
+	}
+
+	std::unordered_set<std::string> changed;
+	for (const std::string &file : changedFiles) {
+		auto users = m_FileUsers.find(file);
+		if (users == m_FileUsers.end()) {
+			continue;
+		}
+		for (const std::string &programName : users->second) {
+			AQUILA_LOG_INFO("ShaderWatcher: '{}' modified, queuing reload of program '{}'", file, programName);
+			changed.insert(programName);
+		}
+	}
+
+	auto *vfs = Platform::Filesystem::VirtualFileSystem::Get();
+	for (auto &[programName, watch] : m_Programs) {
+		if (watch.isNative || !vfs->Exists(watch.slangPath)) {
+			continue;
+		}
+		const uint64 current = vfs->GetLastWriteTime(watch.slangPath);
+		if (current > watch.lastModified) {
+			AQUILA_LOG_INFO("ShaderWatcher: '{}' modified, queuing reload of program '{}'", watch.slangPath,
+							programName);
+			watch.lastModified = current;
+			changed.insert(programName);
+		}
+	}
+
+	return changed;
+}
+
+// A path is treated as native if it is an absolute filesystem path
+// (starts with a drive letter on Windows, or '/' on Unix) and does NOT
+// contain "://" which is the VFS scheme separator.
+bool ShaderWatcher::IsNativePath(const std::string &path) {
+	if (path.find("://") != std::string::npos) {
+		return false; // VFS virtual path
+	}
+
+	// std::filesystem considers "C:\..." and "/home/..." as absolute
+	return std::filesystem::path(path).is_absolute();
+}
+
+void ShaderWatcher::AddFile(const std::string &programName, const std::string &path) {
+	const std::string file = FileWatcher::Normalize(path);
+	auto &users = m_FileUsers[file];
+	if (users.empty() && !m_FileWatcher.Watch(file)) {
+		m_FileUsers.erase(file);
+		return;
+	}
+	users.insert(programName);
+	m_Programs[programName].files.push_back(file);
+}
+
+void ShaderWatcher::RemoveFiles(const std::string &programName) {
+	auto it = m_Programs.find(programName);
+	if (it == m_Programs.end()) {
+		return;
+	}
+
+	for (const std::string &file : it->second.files) {
+		auto users = m_FileUsers.find(file);
+		if (users == m_FileUsers.end()) {
+			continue;
+		}
+		users->second.erase(programName);
+		if (users->second.empty()) {
+			m_FileWatcher.Unwatch(file);
+			m_FileUsers.erase(users);
+		}
+	}
+	it->second.files.clear();
+}
+
+} // namespace Aquila::Graphics::Shader
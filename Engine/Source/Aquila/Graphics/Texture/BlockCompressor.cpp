@@ -0,0 +1,617 @@
+#include "Aquila/Graphics/Texture/BlockCompressor.h"
+#include "Aquila/RHI/FormatUtils.h"
+
+#include <glm/gtc/packing.hpp>
+
+namespace Aquila::Graphics::Texture {
+
+namespace {
+
+constexpr uint32 kTexels = 16;
+constexpr uint32 kRefineIterations = 2;
+// BC7 / BC6H interpolation weights for 4-bit indices, out of 64.
+constexpr uint32 kWeights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+template <usize N> using Point = std::array<f32, N>;
+
+// Writes fields least significant bit first, the order every BCn block is read in.
+class BitWriter {
+  public:
+	BitWriter(uint8 *out, usize bytes) : m_Out(out) { memset(out, 0, bytes); }
+
+	void Put(uint32 value, uint32 bits) {
+		for (uint32 i = 0; i < bits; ++i, ++m_Bit) {
+			if ((value >> i) & 1u) {
+				m_Out[m_Bit >> 3] |= static_cast<uint8>(1u << (m_Bit & 7));
+			}
+		}
+	}
+
+  private:
+	uint8 *m_Out;
+	uint32 m_Bit = 0;
+};
+
+// The segment through the block's points along their principal axis (power iteration on
+// the covariance), as the two extreme projections.
+template <usize N> void FitLine(const Point<N> *points, Point<N> &outLow, Point<N> &outHigh) {
+	Point<N> mean{};
+	Point<N> lo;
+	Point<N> hi;
+	lo.fill(std::numeric_limits<f32>::max());
+	hi.fill(std::numeric_limits<f32>::lowest());
+	for (uint32 i = 0; i < kTexels; ++i) {
+		for (usize c = 0; c < N; ++c) {
+			mean[c] += points[i][c] / kTexels;
+			lo[c] = std::min(lo[c], points[i][c]);
+			hi[c] = std::max(hi[c], points[i][c]);
+		}
+	}
+
+	f32 cov[N][N] = {};
+	for (uint32 i = 0; i < kTexels; ++i) {
+		for (usize a = 0; a < N; ++a) {
+			for (usize b = 0; b < N; ++b) {
+				cov[a][b] += (points[i][a] - mean[a]) * (points[i][b] - mean[b]);
+			}
+		}
+	}
+
+	Point<N> axis;
+	for (usize c = 0; c < N; ++c) {
+		axis[c] = hi[c] - lo[c];
+	}
+	for (uint32 iteration = 0; iteration < 8; ++iteration) {
+		Point<N> next{};
+		f32 length = 0.F;
+		for (usize a = 0; a < N; ++a) {
+			for (usize b = 0; b < N; ++b) {
+				next[a] += cov[a][b] * axis[b];
+			}
+			length = std::max(length, std::abs(next[a]));
+		}
+		if (length <= 1e-12F) {
+			break;
+		}
+		for (usize c = 0; c < N; ++c) {
+			axis[c] = next[c] / length;
+		}
+	}
+
+	f32 tMin = 0.F;
+	f32 tMax = 0.F;
+	f32 axisLengthSq = 0.F;
+	for (usize c = 0; c < N; ++c) {
+		axisLengthSq += axis[c] * axis[c];
+	}
+	if (axisLengthSq > 1e-12F) {
+		tMin = std::numeric_limits<f32>::max();
+		tMax = std::numeric_limits<f32>::lowest();
+		for (uint32 i = 0; i < kTexels; ++i) {
+			f32 t = 0.F;
+			for (usize c = 0; c < N; ++c) {
+				t += (points[i][c] - mean[c]) * axis[c];
+			}
+			tMin = std::min(tMin, t / axisLengthSq);
+			tMax = std::max(tMax, t / axisLengthSq);
+		}
+	}
+	for (usize c = 0; c < N; ++c) {
+		outLow[c] = mean[c] + axis[c] * tMin;
+		outHigh[c] = mean[c] + axis[c] * tMax;
+	}
+}
+
+// Endpoints minimizing the squared error for fixed per-texel weights (0 = e0, 1 = e1).
+// Returns false when the weights don't pin down two endpoints (all equal).
+template <usize N> bool SolveEndpoints(const Point<N> *points, const f32 *weights, Point<N> &e0, Point<N> &e1) {
+	f32 a = 0.F;
+	f32 b = 0.F;
+	f32 c = 0.F;
+	Point<N> x0{};
+	Point<N> x1{};
+	for (uint32 i = 0; i < kTexels; ++i) {
+		const f32 w = weights[i];
+		a += (1.F - w) * (1.F - w);
+		b += (1.F - w) * w;
+		c += w * w;
+		for (usize k = 0; k < N; ++k) {
+			x0[k] += (1.F - w) * points[i][k];
+			x1[k] += w * points[i][k];
+		}
+	}
+	const f32 det = a * c - b * b;
+	if (std::abs(det) < 1e-6F) {
+		return false;
+	}
+	for (usize k = 0; k < N; ++k) {
+		e0[k] = (c * x0[k] - b * x1[k]) / det;
+		e1[k] = (a * x1[k] - b * x0[k]) / det;
+	}
+	return true;
+}
+
+template <usize N> Point<N> Clamp(Point<N> p, f32 hi) {
+	for (f32 &v : p) {
+		v = std::clamp(v, 0.F, hi);
+	}
+	return p;
+}
+
+// BC1
+
+uint16 Quantize565(const Point<3> &c) {
+	const auto r = static_cast<uint32>(std::lround(std::clamp(c[0], 0.F, 255.F) * 31.F / 255.F));
+	const auto g = static_cast<uint32>(std::lround(std::clamp(c[1], 0.F, 255.F) * 63.F / 255.F));
+	const auto b = static_cast<uint32>(std::lround(std::clamp(c[2], 0.F, 255.F) * 31.F / 255.F));
+	return static_cast<uint16>((r << 11) | (g << 5) | b);
+}
+
+Point<3> Expand565(uint16 c) {
+	const uint32 r = (c >> 11) & 31;
+	const uint32 g = (c >> 5) & 63;
+	const uint32 b = c & 31;
+	return { static_cast<f32>((r << 3) | (r >> 2)), static_cast<f32>((g << 2) | (g >> 4)),
+			 static_cast<f32>((b << 3) | (b >> 2)) };
+}
+
+// Picks the nearest of the four 4-color-mode entries per texel; returns the total error.
+f32 AssignBC1(const Point<3> *points, uint16 c0, uint16 c1, uint8 *indices) {
+	const Point<3> a = Expand565(c0);
+	const Point<3> b = Expand565(c1);
+	Point<3> palette[4] = { a, b };
+	for (usize k = 0; k < 3; ++k) {
+		palette[2][k] = (2.F * a[k] + b[k]) / 3.F;
+		palette[3][k] = (a[k] + 2.F * b[k]) / 3.F;
+	}
+
+	f32 total = 0.F;
+	for (uint32 i = 0; i < kTexels; ++i) {
+		f32 best = std::numeric_limits<f32>::max();
+		for (uint8 p = 0; p < 4; ++p) {
+			f32 d = 0.F;
+			for (usize k = 0; k < 3; ++k) {
+				d += (points[i][k] - palette[p][k]) * (points[i][k] - palette[p][k]);
+			}
+			if (d < best) {
+				best = d;
+				indices[i] = p;
+			}
+		}
+		total += best;
+	}
+	return total;
+}
+
+// BC7 mode 6 / BC6H mode 11 share the 16-entry palette; only endpoint coding differs.
+
+struct Mode6Endpoints {
+	uint32 q[2][4] = {}; // 7-bit RGBA per endpoint
+	uint32 p[2] = {};	 // p-bit per endpoint
+};
+
+uint32 Mode6Value(const Mode6Endpoints &e, uint32 endpoint, usize channel) {
+	return (e.q[endpoint][channel] << 1) | e.p[endpoint];
+}
+
+f32 AssignMode6(const Point<4> *points, const Mode6Endpoints &e, uint8 *indices) {
+	f32 palette[16][4];
+	for (uint32 i = 0; i < 16; ++i) {
+		for (usize c = 0; c < 4; ++c) {
+			const uint32 v = ((64 - kWeights4[i]) * Mode6Value(e, 0, c) + kWeights4[i] * Mode6Value(e, 1, c) + 32) >> 6;
+			palette[i][c] = static_cast<f32>(v);
+		}
+	}
+
+	f32 total = 0.F;
+	for (uint32 t = 0; t < kTexels; ++t) {
+		f32 best = std::numeric_limits<f32>::max();
+		for (uint8 i = 0; i < 16; ++i) {
+			f32 d = 0.F;
+			for (usize c = 0; c < 4; ++c) {
+				d += (points[t][c] - palette[i][c]) * (points[t][c] - palette[i][c]);
+			}
+			if (d < best) {
+				best = d;
+				indices[t] = i;
+			}
+		}
+		total += best;
+	}
+	return total;
+}
+
+// Tries the p-bit combinations for a pair of endpoints and keeps the best. Opaque blocks only
+// try p = 1, the only way to hit alpha 255 exactly.
+f32 QuantizeMode6(const Point<4> *points, const Point<4> &e0, const Point<4> &e1, bool opaque, Mode6Endpoints &out,
+				  uint8 *outIndices) {
+	f32 bestError = std::numeric_limits<f32>::max();
+	for (uint32 p0 = opaque ? 1 : 0; p0 < 2; ++p0) {
+		for (uint32 p1 = opaque ? 1 : 0; p1 < 2; ++p1) {
+			Mode6Endpoints candidate;
+			candidate.p[0] = p0;
+			candidate.p[1] = p1;
+			for (usize c = 0; c < 4; ++c) {
+				candidate.q[0][c] = static_cast<uint32>(std::clamp(std::lround((e0[c] - p0) / 2.F), 0L, 127L));
+				candidate.q[1][c] = static_cast<uint32>(std::clamp(std::lround((e1[c] - p1) / 2.F), 0L, 127L));
+			}
+			uint8 indices[kTexels];
+			const f32 error = AssignMode6(points, candidate, indices);
+			if (error < bestError) {
+				bestError = error;
+				out = candidate;
+				memcpy(outIndices, indices, kTexels);
+			}
+		}
+	}
+	return bestError;
+}
+
+// BC6H
+
+// Unsigned BC6H works on half-float bit patterns: the decoder scales its 16-bit interpolated
+// value by 31/64 to get the half bits, so fitting happens in that pre-scaled space.
+constexpr f32 kHalfToUnquantized = 64.F / 31.F;
+
+uint32 UnquantizeBC6H(uint32 q) {
+	if (q == 0) {
+		return 0;
+	}
+	if (q == 1023) {
+		return 0xFFFF;
+	}
+	return ((q << 16) + 0x8000) >> 10;
+}
+
+uint32 QuantizeBC6H(f32 value) {
+	const auto guess = static_cast<int32>(std::lround(std::clamp(value, 0.F, 65535.F) * 1023.F / 65535.F));
+	uint32 best = 0;
+	f32 bestError = std::numeric_limits<f32>::max();
+	for (int32 q = std::max(guess - 1, 0); q <= std::min(guess + 1, 1023); ++q) {
+		const f32 error = std::abs(static_cast<f32>(UnquantizeBC6H(static_cast<uint32>(q))) - value);
+		if (error < bestError) {
+			bestError = error;
+			best = static_cast<uint32>(q);
+		}
+	}
+	return best;
+}
+
+f32 AssignBC6H(const Point<3> *halfBits, const uint32 q[2][3], uint8 *indices) {
+	f32 palette[16][3];
+	for (uint32 i = 0; i < 16; ++i) {
+		for (usize c = 0; c < 3; ++c) {
+			const uint32 a = UnquantizeBC6H(q[0][c]);
+			const uint32 b = UnquantizeBC6H(q[1][c]);
+			const uint32 v = ((64 - kWeights4[i]) * a + kWeights4[i] * b + 32) >> 6;
+			palette[i][c] = static_cast<f32>((v * 31) >> 6);
+		}
+	}
+
+	f32 total = 0.F;
+	for (uint32 t = 0; t < kTexels; ++t) {
+		f32 best = std::numeric_limits<f32>::max();
+		for (uint8 i = 0; i < 16; ++i) {
+			f32 d = 0.F;
+			for (usize c = 0; c < 3; ++c) {
+				d += (halfBits[t][c] - palette[i][c]) * (halfBits[t][c] - palette[i][c]);
+			}
+			if (d < best) {
+				best = d;
+				indices[t] = i;
+			}
+		}
+		total += best;
+	}
+	return total;
+}
+
+// Gathers the 4x4 block at (bx, by), clamping to the image so partial blocks repeat edges.
+template <typename T>
+void LoadBlock(const T *rgba, uint32 width, uint32 height, uint32 bx, uint32 by, T out[64]) {
+	for (uint32 y = 0; y < 4; ++y) {
+		const uint32 sy = std::min(by * 4 + y, height - 1);
+		for (uint32 x = 0; x < 4; ++x) {
+			const uint32 sx = std::min(bx * 4 + x, width - 1);
+			memcpy(out + (y * 4 + x) * 4, rgba + (static_cast<usize>(sy) * width + sx) * 4, 4 * sizeof(T));
+		}
+	}
+}
+
+} // namespace
+
+void BlockCompressor::EncodeBC1(const uint8 rgba[64], uint8 out[8]) {
+	Point<3> points[kTexels];
+	for (uint32 i = 0; i < kTexels; ++i) {
+		points[i] = { static_cast<f32>(rgba[i * 4]), static_cast<f32>(rgba[i * 4 + 1]),
+					  static_cast<f32>(rgba[i * 4 + 2]) };
+	}
+
+	Point<3> e0;
+	Point<3> e1;
+	FitLine(points, e1, e0);
+
+	uint16 bestC0 = 0;
+	uint16 bestC1 = 0;
+	uint8 bestIndices[kTexels] = {};
+	f32 bestError = std::numeric_limits<f32>::max();
+	for (uint32 iteration = 0; iteration <= kRefineIterations; ++iteration) {
+		const uint16 c0 = Quantize565(e0);
+		const uint16 c1 = Quantize565(e1);
+		uint8 indices[kTexels];
+		const f32 error = AssignBC1(points, c0, c1, indices);
+		if (error < bestError) {
+			bestError = error;
+			bestC0 = c0;
+			bestC1 = c1;
+			memcpy(bestIndices, indices, kTexels);
+		}
+
+		constexpr f32 kIndexWeight[4] = { 0.F, 1.F, 1.F / 3.F, 2.F / 3.F };
+		f32 weights[kTexels];
+		for (uint32 i = 0; i < kTexels; ++i) {
+			weights[i] = kIndexWeight[indices[i]];
+		}
+		if (!SolveEndpoints(points, weights, e0, e1)) {
+			break;
+		}
+		e0 = Clamp(e0, 255.F);
+		e1 = Clamp(e1, 255.F);
+	}
+
+	// 4-color mode needs c0 > c1; equal endpoints fall into 3-color mode, where index 0
+	// is still c0.
+	if (bestC0 < bestC1) {
+		std::swap(bestC0, bestC1);
+		for (uint8 &index : bestIndices) {
+			index ^= 1;
+		}
+	} else if (bestC0 == bestC1) {
+		memset(bestIndices, 0, sizeof(bestIndices));
+	}
+
+	uint32 bits = 0;
+	for (uint32 i = 0; i < kTexels; ++i) {
+		bits |= static_cast<uint32>(bestIndices[i]) << (i * 2);
+	}
+	memcpy(out, &bestC0, 2);
+	memcpy(out + 2, &bestC1, 2);
+	memcpy(out + 4, &bits, 4);
+}
+
+void BlockCompressor::EncodeBC4(const uint8 values[16], uint8 out[8]) {
+	const auto [lo, hi] = std::minmax_element(values, values + kTexels);
+	const uint32 a0 = *hi;
+	const uint32 a1 = *lo;
+
+	// a0 > a1 selects the 8-value mode: the endpoints plus six evenly spaced steps.
+	uint32 palette[8] = { a0, a1 };
+	for (uint32 i = 2; i < 8; ++i) {
+		palette[i] = ((8 - i) * a0 + (i - 1) * a1 + 3) / 7;
+	}
+
+	uint64 bits = 0;
+	if (a0 != a1) {
+		for (uint32 t = 0; t < kTexels; ++t) {
+			uint32 best = 0;
+			uint32 bestError = ~0u;
+			for (uint32 i = 0; i < 8; ++i) {
+				const int32 delta = static_cast<int32>(values[t]) - static_cast<int32>(palette[i]);
+				const auto error = static_cast<uint32>(std::abs(delta));
+				if (error < bestError) {
+					bestError = error;
+					best = i;
+				}
+			}
+			bits |= static_cast<uint64>(best) << (t * 3);
+		}
+	}
+	out[0] = static_cast<uint8>(a0);
+	out[1] = static_cast<uint8>(a1);
+	for (uint32 i = 0; i < 6; ++i) {
+		out[2 + i] = static_cast<uint8>(bits >> (i * 8));
+	}
+}
+
+void BlockCompressor::EncodeBC3(const uint8 rgba[64], uint8 out[16]) {
+	uint8 alpha[kTexels];
+	for (uint32 i = 0; i < kTexels; ++i) {
+		alpha[i] = rgba[i * 4 + 3];
+	}
+	EncodeBC4(alpha, out);
+	EncodeBC1(rgba, out + 8); // BC3 color blocks always decode in 4-color mode
+}
+
+void BlockCompressor::EncodeBC5(const uint8 rgba[64], uint8 out[16]) {
+	uint8 red[kTexels];
+	uint8 green[kTexels];
+	for (uint32 i = 0; i < kTexels; ++i) {
+		red[i] = rgba[i * 4];
+		green[i] = rgba[i * 4 + 1];
+	}
+	EncodeBC4(red, out);
+	EncodeBC4(green, out + 8);
+}
+
+void BlockCompressor::EncodeBC7(const uint8 rgba[64], uint8 out[16]) {
+	Point<4> points[kTexels];
+	bool opaque = true;
+	for (uint32 i = 0; i < kTexels; ++i) {
+		for (usize c = 0; c < 4; ++c) {
+			points[i][c] = static_cast<f32>(rgba[i * 4 + c]);
+		}
+		opaque &= rgba[i * 4 + 3] == 255;
+	}
+
+	Point<4> e0;
+	Point<4> e1;
+	FitLine(points, e0, e1);
+
+	Mode6Endpoints best;
+	uint8 bestIndices[kTexels] = {};
+	f32 bestError = std::numeric_limits<f32>::max();
+	for (uint32 iteration = 0; iteration <= kRefineIterations; ++iteration) {
+		Mode6Endpoints endpoints;
+		uint8 indices[kTexels];
+		const f32 error = QuantizeMode6(points, e0, e1, opaque, endpoints, indices);
+		if (error < bestError) {
+			bestError = error;
+			best = endpoints;
+			memcpy(bestIndices, indices, kTexels);
+		}
+		if (error == 0.F) {
+			break;
+		}
+
+		f32 weights[kTexels];
+		for (uint32 i = 0; i < kTexels; ++i) {
+			weights[i] = static_cast<f32>(kWeights4[indices[i]]) / 64.F;
+		}
+		if (!SolveEndpoints(points, weights, e0, e1)) {
+			break;
+		}
+		e0 = Clamp(e0, 255.F);
+		e1 = Clamp(e1, 255.F);
+	}
+
+	// The anchor (texel 0) index is stored without its top bit, so it must be below 8.
+	if (bestIndices[0] >= 8) {
+		std::swap(best.q[0], best.q[1]);
+		std::swap(best.p[0], best.p[1]);
+		for (uint8 &index : bestIndices) {
+			index = static_cast<uint8>(15 - index);
+		}
+	}
+
+	BitWriter writer(out, 16);
+	writer.Put(1u << 6, 7); // mode 6
+	for (usize c = 0; c < 4; ++c) {
+		writer.Put(best.q[0][c], 7);
+		writer.Put(best.q[1][c], 7);
+	}
+	writer.Put(best.p[0], 1);
+	writer.Put(best.p[1], 1);
+	for (uint32 i = 0; i < kTexels; ++i) {
+		writer.Put(bestIndices[i], i == 0 ? 3 : 4);
+	}
+}
+
+void BlockCompressor::EncodeBC6H(const f32 rgba[64], uint8 out[16]) {
+	Point<3> halfBits[kTexels];
+	Point<3> points[kTexels];
+	for (uint32 i = 0; i < kTexels; ++i) {
+		for (usize c = 0; c < 3; ++c) {
+			const f32 value = std::isfinite(rgba[i * 4 + c]) ? std::clamp(rgba[i * 4 + c], 0.F, 65504.F) : 0.F;
+			halfBits[i][c] = static_cast<f32>(glm::packHalf1x16(value));
+			points[i][c] = halfBits[i][c] * kHalfToUnquantized;
+		}
+	}
+
+	Point<3> e0;
+	Point<3> e1;
+	FitLine(points, e0, e1);
+
+	uint32 best[2][3] = {};
+	uint8 bestIndices[kTexels] = {};
+	f32 bestError = std::numeric_limits<f32>::max();
+	for (uint32 iteration = 0; iteration <= kRefineIterations; ++iteration) {
+		uint32 q[2][3];
+		for (usize c = 0; c < 3; ++c) {
+			q[0][c] = QuantizeBC6H(e0[c]);
+			q[1][c] = QuantizeBC6H(e1[c]);
+		}
+		uint8 indices[kTexels];
+		const f32 error = AssignBC6H(halfBits, q, indices);
+		if (error < bestError) {
+			bestError = error;
+			memcpy(best, q, sizeof(best));
+			memcpy(bestIndices, indices, kTexels);
+		}
+		if (error == 0.F) {
+			break;
+		}
+
+		f32 weights[kTexels];
+		for (uint32 i = 0; i < kTexels; ++i) {
+			weights[i] = static_cast<f32>(kWeights4[indices[i]]) / 64.F;
+		}
+		if (!SolveEndpoints(points, weights, e0, e1)) {
+			break;
+		}
+		e0 = Clamp(e0, 65535.F);
+		e1 = Clamp(e1, 65535.F);
+	}
+
+	if (bestIndices[0] >= 8) {
+		std::swap(best[0], best[1]);
+		for (uint8 &index : bestIndices) {
+			index = static_cast<uint8>(15 - index);
+		}
+	}
+
+	BitWriter writer(out, 16);
+	writer.Put(0x03, 5); // mode 11: one region, 10-bit endpoints, no deltas
+	for (uint32 endpoint = 0; endpoint < 2; ++endpoint) {
+		for (usize c = 0; c < 3; ++c) {
+			writer.Put(best[endpoint][c], 10);
+		}
+	}
+	for (uint32 i = 0; i < kTexels; ++i) {
+		writer.Put(bestIndices[i], i == 0 ? 3 : 4);
+	}
+}
+
+std::vector<uint8> BlockCompressor::Compress(const uint8 *rgba, uint32 width, uint32 height,
+											 RHI::TextureFormat format) {
+	using RHI::TextureFormat;
+	void (*encode)(const uint8 *, uint8 *) = nullptr;
+	switch (format) {
+	case TextureFormat::BC1_RGBA:
+	case TextureFormat::BC1_RGBA_SRGB:
+		encode = &EncodeBC1;
+		break;
+	case TextureFormat::BC3_RGBA:
+	case TextureFormat::BC3_RGBA_SRGB:
+		encode = &EncodeBC3;
+		break;
+	case TextureFormat::BC5_RG:
+		encode = &EncodeBC5;
+		break;
+	case TextureFormat::BC7_RGBA:
+	case TextureFormat::BC7_RGBA_SRGB:
+		encode = &EncodeBC7;
+		break;
+	default:
+		AQUILA_ASSERT(false, "BlockCompressor: not an 8-bit BCn format");
+		return {};
+	}
+
+	const uint32 blocksX = (width + BlockDim - 1) / BlockDim;
+	const uint32 blocksY = (height + BlockDim - 1) / BlockDim;
+	const uint32 blockBytes = RHI::GetFormatBytesPerBlock(format);
+	std::vector<uint8> out(static_cast<usize>(blocksX) * blocksY * blockBytes);
+	uint8 block[64];
+	for (uint32 by = 0; by < blocksY; ++by) {
+		for (uint32 bx = 0; bx < blocksX; ++bx) {
+			LoadBlock(rgba, width, height, bx, by, block);
+			encode(block, out.data() + (static_cast<usize>(by) * blocksX + bx) * blockBytes);
+		}
+	}
+	return out;
+}
+
+std::vector<uint8> BlockCompressor::CompressBC6H(const f32 *rgba, uint32 width, uint32 height) {
+	const uint32 blocksX = (width + BlockDim - 1) / BlockDim;
+	const uint32 blocksY = (height + BlockDim - 1) / BlockDim;
+	std::vector<uint8> out(static_cast<usize>(blocksX) * blocksY * 16);
+	f32 block[64];
+	for (uint32 by = 0; by < blocksY; ++by) {
+		for (uint32 bx = 0; bx < blocksX; ++bx) {
+			LoadBlock(rgba, width, height, bx, by, block);
+			EncodeBC6H(block, out.data() + (static_cast<usize>(by) * blocksX + bx) * 16);
+		}
+	}
+	return out;
+}
+
+} // namespace Aquila::Graphics::Texture
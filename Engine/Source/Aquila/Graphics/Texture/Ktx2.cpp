@@ -0,0 +1,315 @@
+#include "Aquila/Graphics/Texture/Ktx2.h"
+#include "Aquila/RHI/FormatUtils.h"
+#include "Aquila/Foundation/Macros.h"
+
+namespace Aquila::Graphics::Texture {
+
+namespace {
+
+constexpr std::array<uint8, 12> kIdentifier = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32,
+												0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A }; // «KTX 20»\r\n\x1A\n
+
+struct FileHeader {
+	uint8 identifier[12] = {};
+	uint32 vkFormat = 0;
+	uint32 typeSize = 0;
+	uint32 pixelWidth = 0;
+	uint32 pixelHeight = 0;
+	uint32 pixelDepth = 0;
+	uint32 layerCount = 0;
+	uint32 faceCount = 1;
+	uint32 levelCount = 0;
+	uint32 supercompressionScheme = 0;
+	uint32 dfdByteOffset = 0;
+	uint32 dfdByteLength = 0;
+	uint32 kvdByteOffset = 0;
+	uint32 kvdByteLength = 0;
+	uint64 sgdByteOffset = 0;
+	uint64 sgdByteLength = 0;
+};
+static_assert(sizeof(FileHeader) == 80, "KTX2 header is 80 bytes");
+
+struct LevelIndex {
+	uint64 byteOffset = 0;
+	uint64 byteLength = 0;
+	uint64 uncompressedByteLength = 0;
+};
+
+// Khronos Data Format values used by the basic descriptor block.
+constexpr uint8 kModelRgbsda = 1;
+constexpr uint8 kModelBc1a = 128;
+constexpr uint8 kModelBc3 = 130;
+constexpr uint8 kModelBc5 = 132;
+constexpr uint8 kModelBc6h = 133;
+constexpr uint8 kModelBc7 = 134;
+constexpr uint8 kPrimariesBt709 = 1;
+constexpr uint8 kTransferLinear = 1;
+constexpr uint8 kTransferSrgb = 2;
+constexpr uint8 kChannelAlpha = 15;
+constexpr uint8 kQualifierLinear = 0x10;
+constexpr uint8 kQualifierSigned = 0x40;
+constexpr uint8 kQualifierFloat = 0x80;
+constexpr uint8 kSignedFloat = kQualifierFloat | kQualifierSigned;
+constexpr uint32 kFloatMinusOne = 0xBF800000;
+constexpr uint32 kFloatOne = 0x3F800000;
+
+struct Sample {
+	uint16 bitOffset = 0;
+	uint8 bitLength = 0; // minus one
+	uint8 channel = 0;
+	uint32 lower = 0;
+	uint32 upper = 0;
+};
+
+struct FormatInfo {
+	RHI::TextureFormat format;
+	uint32 vkFormat;
+	uint32 typeSize;
+	uint8 colorModel;
+	std::vector<Sample> samples;
+};
+
+const std::vector<FormatInfo> &Formats() {
+	static const std::vector<FormatInfo> s_Formats = [] {
+		auto rgba = [](uint8 bits, uint8 qualifiers, uint8 alphaQualifier, uint32 lower, uint32 upper) {
+			std::vector<Sample> samples;
+			for (uint8 c = 0; c < 4; ++c) {
+				const uint8 channel = c == 3 ? static_cast<uint8>(kChannelAlpha | alphaQualifier) : c;
+				samples.push_back({ .bitOffset = static_cast<uint16>(c * bits),
+									.bitLength = static_cast<uint8>(bits - 1),
+									.channel = static_cast<uint8>(channel | qualifiers),
+									.lower = lower,
+									.upper = upper });
+			}
+			return samples;
+		};
+		auto block = [](uint8 channel, uint16 offset, uint32 lower = 0, uint32 upper = UINT32_MAX) {
+			return Sample{ .bitOffset = offset, .bitLength = 63, .channel = channel, .lower = lower, .upper = upper };
+		};
+		using enum RHI::TextureFormat;
+		const Sample bc6h{ .bitLength = 127, .channel = kQualifierFloat, .lower = 0, .upper = kFloatOne };
+		const Sample bc7{ .bitLength = 127, .channel = 0, .lower = 0, .upper = UINT32_MAX };
+		return std::vector<FormatInfo>{
+			{ RGBA8, 37, 1, kModelRgbsda, rgba(8, 0, 0, 0, 255) },
+			{ RGBA8_SRGB, 43, 1, kModelRgbsda, rgba(8, 0, kQualifierLinear, 0, 255) },
+			{ RGBA16F, 97, 2, kModelRgbsda, rgba(16, kSignedFloat, 0, kFloatMinusOne, kFloatOne) },
+			{ RGBA32F, 109, 4, kModelRgbsda, rgba(32, kSignedFloat, 0, kFloatMinusOne, kFloatOne) },
+			{ BC1_RGBA, 133, 1, kModelBc1a, { block(1, 0) } },
+			{ BC1_RGBA_SRGB, 134, 1, kModelBc1a, { block(1, 0) } },
+			{ BC3_RGBA, 137, 1, kModelBc3, { block(kChannelAlpha, 0), block(0, 64) } },
+			{ BC3_RGBA_SRGB, 138, 1, kModelBc3, { block(kChannelAlpha | kQualifierLinear, 0), block(0, 64) } },
+			{ BC5_RG, 141, 1, kModelBc5, { block(0, 0), block(1, 64) } },
+			{ BC6H_RGB_UF16, 143, 1, kModelBc6h, { bc6h } },
+			{ BC7_RGBA, 145, 1, kModelBc7, { bc7 } },
+			{ BC7_RGBA_SRGB, 146, 1, kModelBc7, { bc7 } },
+		};
+	}();
+	return s_Formats;
+}
+
+const FormatInfo *FindFormat(RHI::TextureFormat format) {
+	const auto &formats = Formats();
+	const auto it = std::ranges::find(formats, format, &FormatInfo::format);
+	return it != formats.end() ? &*it : nullptr;
+}
+
+const FormatInfo *FindVkFormat(uint32 vkFormat) {
+	const auto &formats = Formats();
+	const auto it = std::ranges::find(formats, vkFormat, &FormatInfo::vkFormat);
+	return it != formats.end() ? &*it : nullptr;
+}
+
+// Bytes per texel, or per block for block-compressed formats.
+uint32 TexelBlockBytes(RHI::TextureFormat format) {
+	return RHI::IsBlockCompressedFormat(format) ? RHI::GetFormatBytesPerBlock(format)
+												: RHI::GetFormatBytesPerPixel(format);
+}
+
+template <typename T> void Append(std::vector<uint8> &out, const T &value) {
+	const auto *bytes = reinterpret_cast<const uint8 *>(&value);
+	out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+void PadTo(std::vector<uint8> &out, usize alignment) {
+	out.resize((out.size() + alignment - 1) / alignment * alignment, 0);
+}
+
+std::vector<uint8> BuildDfd(const FormatInfo &info) {
+	const bool compressed = RHI::IsBlockCompressedFormat(info.format);
+	const auto blockSize = static_cast<uint32>(24 + 16 * info.samples.size());
+	const uint32 blockDim = compressed ? 3 : 0; // texel block dimensions minus one
+
+	std::vector<uint8> dfd;
+	Append(dfd, uint32(4 + blockSize)); // dfdTotalSize
+	Append(dfd, uint32(0));				// vendorId 0 (Khronos), descriptorType 0 (basic)
+	Append(dfd, uint32(2 | blockSize << 16));
+	const uint8 transfer = RHI::IsSrgbFormat(info.format) ? kTransferSrgb : kTransferLinear;
+	Append(dfd, uint32(info.colorModel | kPrimariesBt709 << 8 | transfer << 16));
+	Append(dfd, uint32(blockDim | blockDim << 8));
+	Append(dfd, uint32(TexelBlockBytes(info.format))); // bytesPlane0, planes 1-3 unused
+	Append(dfd, uint32(0));							   // bytesPlane4-7
+	for (const Sample &sample : info.samples) {
+		Append(dfd, uint32(sample.bitOffset | sample.bitLength << 16 | uint32(sample.channel) << 24));
+		Append(dfd, uint32(0)); // sample position
+		Append(dfd, sample.lower);
+		Append(dfd, sample.upper);
+	}
+	return dfd;
+}
+
+std::vector<uint8> BuildKvd(const Ktx2Texture &texture) {
+	auto entries = texture.keyValues;
+	if (std::ranges::find(entries, std::string("KTXwriter"), &decltype(entries)::value_type::first) ==
+		entries.end()) {
+		const std::string_view writer = "Aquila";
+		entries.emplace_back("KTXwriter", std::vector<uint8>(writer.begin(), writer.end()));
+		entries.back().second.push_back(0);
+	}
+	std::ranges::sort(entries, {}, &decltype(entries)::value_type::first);
+
+	std::vector<uint8> kvd;
+	for (const auto &[key, value] : entries) {
+		Append(kvd, static_cast<uint32>(key.size() + 1 + value.size()));
+		kvd.insert(kvd.end(), key.begin(), key.end());
+		kvd.push_back(0);
+		kvd.insert(kvd.end(), value.begin(), value.end());
+		PadTo(kvd, 4);
+	}
+	return kvd;
+}
+
+bool ParseKvd(std::span<const uint8> kvd, Ktx2Texture &out) {
+	usize offset = 0;
+	while (kvd.size() - offset >= sizeof(uint32)) {
+		uint32 length = 0;
+		memcpy(&length, kvd.data() + offset, sizeof(length));
+		offset += sizeof(length);
+		if (kvd.size() - offset < length) {
+			return false;
+		}
+		const auto entry = kvd.subspan(offset, length);
+		const auto terminator = std::ranges::find(entry, uint8(0));
+		if (terminator == entry.end()) {
+			return false;
+		}
+		out.keyValues.emplace_back(std::string(entry.begin(), terminator),
+								   std::vector<uint8>(terminator + 1, entry.end()));
+		offset += (length + 3) & ~3u;
+	}
+	return true;
+}
+
+} // namespace
+
+const std::vector<uint8> *Ktx2Texture::FindValue(std::string_view key) const {
+	for (const auto &[entryKey, value] : keyValues) {
+		if (entryKey == key) {
+			return &value;
+		}
+	}
+	return nullptr;
+}
+
+std::vector<uint8> Ktx2::Write(const Ktx2Texture &texture) {
+	const FormatInfo *info = FindFormat(texture.format);
+	AQUILA_ASSERT(info != nullptr, "TextureFormat has no KTX2 mapping");
+	AQUILA_ASSERT(texture.levelCount > 0, "KTX2 texture needs at least one level");
+
+	const std::vector<uint8> dfd = BuildDfd(*info);
+	const std::vector<uint8> kvd = BuildKvd(texture);
+
+	FileHeader header{};
+	std::ranges::copy(kIdentifier, header.identifier);
+	header.vkFormat = info->vkFormat;
+	header.typeSize = info->typeSize;
+	header.pixelWidth = texture.width;
+	header.pixelHeight = texture.height;
+	header.levelCount = texture.levelCount;
+	header.dfdByteOffset = static_cast<uint32>(sizeof(FileHeader) + texture.levelCount * sizeof(LevelIndex));
+	header.dfdByteLength = static_cast<uint32>(dfd.size());
+	header.kvdByteOffset = kvd.empty() ? 0 : header.dfdByteOffset + header.dfdByteLength;
+	header.kvdByteLength = static_cast<uint32>(kvd.size());
+
+	std::vector<uint64> sourceOffsets(texture.levelCount);
+	std::vector<LevelIndex> levels(texture.levelCount);
+	uint64 sourceOffset = 0;
+	for (uint32 level = 0; level < texture.levelCount; ++level) {
+		sourceOffsets[level] = sourceOffset;
+		levels[level].byteLength = RHI::GetTextureLevelSize(texture.format, texture.width, texture.height, level);
+		levels[level].uncompressedByteLength = levels[level].byteLength;
+		sourceOffset += levels[level].byteLength;
+	}
+	AQUILA_ASSERT(sourceOffset <= texture.data.size(), "KTX2 texture data is shorter than its levels");
+
+	std::vector<uint8> file;
+	file.reserve(header.dfdByteOffset + dfd.size() + kvd.size() + texture.data.size() + 16 * texture.levelCount);
+	Append(file, header);
+	file.resize(header.dfdByteOffset); // level index, filled in below
+	file.insert(file.end(), dfd.begin(), dfd.end());
+	file.insert(file.end(), kvd.begin(), kvd.end());
+
+	// Levels go smallest first, each aligned to lcm(texel block size, 4).
+	const usize alignment = std::lcm(TexelBlockBytes(texture.format), 4u);
+	for (uint32 level = texture.levelCount; level-- > 0;) {
+		PadTo(file, alignment);
+		levels[level].byteOffset = file.size();
+		const auto first = texture.data.begin() + static_cast<std::ptrdiff_t>(sourceOffsets[level]);
+		file.insert(file.end(), first, first + static_cast<std::ptrdiff_t>(levels[level].byteLength));
+	}
+	memcpy(file.data() + sizeof(FileHeader), levels.data(), levels.size() * sizeof(LevelIndex));
+	return file;
+}
+
+bool Ktx2::Read(std::span<const uint8> file, Ktx2Texture &out) {
+	FileHeader header{};
+	if (file.size() < sizeof(FileHeader)) {
+		return false;
+	}
+	memcpy(&header, file.data(), sizeof(FileHeader));
+	if (!std::ranges::equal(kIdentifier, header.identifier)) {
+		return false;
+	}
+	const FormatInfo *info = FindVkFormat(header.vkFormat);
+	if (info == nullptr) {
+		AQUILA_LOG_WARNING("Ktx2: unsupported vkFormat {}", header.vkFormat);
+		return false;
+	}
+	if (header.pixelWidth == 0 || header.pixelHeight == 0 || header.pixelDepth != 0 || header.layerCount > 1 ||
+		header.faceCount != 1 || header.supercompressionScheme != 0 || header.levelCount == 0 ||
+		header.levelCount > RHI::GetFullMipCount(header.pixelWidth, header.pixelHeight)) {
+		AQUILA_LOG_WARNING("Ktx2: only single-image 2D textures without supercompression are supported");
+		return false;
+	}
+	if (file.size() - sizeof(FileHeader) < header.levelCount * sizeof(LevelIndex) ||
+		uint64(header.kvdByteOffset) + header.kvdByteLength > file.size()) {
+		return false;
+	}
+	std::vector<LevelIndex> levels(header.levelCount);
+	memcpy(levels.data(), file.data() + sizeof(FileHeader), levels.size() * sizeof(LevelIndex));
+
+	uint64 totalSize = 0;
+	for (uint32 level = 0; level < header.levelCount; ++level) {
+		const uint64 expected = RHI::GetTextureLevelSize(info->format, header.pixelWidth, header.pixelHeight, level);
+		const LevelIndex &index = levels[level];
+		if (index.byteLength != expected || index.byteOffset > file.size() ||
+			file.size() - index.byteOffset < index.byteLength) {
+			return false;
+		}
+		totalSize += expected;
+	}
+
+	out = {};
+	out.format = info->format;
+	out.width = header.pixelWidth;
+	out.height = header.pixelHeight;
+	out.levelCount = header.levelCount;
+	out.data.resize(totalSize);
+	uint8 *dst = out.data.data();
+	for (const LevelIndex &index : levels) {
+		memcpy(dst, file.data() + index.byteOffset, index.byteLength);
+		dst += index.byteLength;
+	}
+	return ParseKvd(file.subspan(header.kvdByteOffset, header.kvdByteLength), out);
+}
+
+} // namespace Aquila::Graphics::Texture
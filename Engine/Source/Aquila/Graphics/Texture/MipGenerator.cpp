@@ -0,0 +1,128 @@
+#include "Aquila/Graphics/Texture/MipGenerator.h"
+#include "Aquila/RHI/FormatUtils.h"
+
+namespace Aquila::Graphics::Texture {
+
+namespace {
+
+const std::array<f32, 256> &SrgbToLinearTable() {
+	static const std::array<f32, 256> s_Table = [] {
+		std::array<f32, 256> table{};
+		for (uint32 i = 0; i < 256; ++i) {
+			const f32 c = static_cast<f32>(i) / 255.F;
+			table[i] = c <= 0.04045F ? c / 12.92F : std::pow((c + 0.055F) / 1.055F, 2.4F);
+		}
+		return table;
+	}();
+	return s_Table;
+}
+
+uint8 LinearToSrgb(f32 c) {
+	c = std::clamp(c, 0.F, 1.F);
+	const f32 s = c <= 0.0031308F ? c * 12.92F : 1.055F * std::pow(c, 1.F / 2.4F) - 0.055F;
+	return static_cast<uint8>(std::lround(s * 255.F));
+}
+
+uint8 ToUnorm8(f32 c) {
+	return static_cast<uint8>(std::lround(std::clamp(c, 0.F, 1.F) * 255.F));
+}
+
+// Visits the up to 2x2 source texels behind destination texel (x, y).
+template <typename T, typename Fn>
+void ForEachSource(const T *src, uint32 srcWidth, uint32 srcHeight, uint32 x, uint32 y, Fn &&fn) {
+	const uint32 x1 = std::min(x * 2 + 1, srcWidth - 1);
+	const uint32 y1 = std::min(y * 2 + 1, srcHeight - 1);
+	for (const uint32 sy : { y * 2, y1 }) {
+		for (const uint32 sx : { x * 2, x1 }) {
+			fn(src + (static_cast<usize>(sy) * srcWidth + sx) * 4);
+		}
+	}
+}
+
+void Downsample(const uint8 *src, uint32 srcWidth, uint32 srcHeight, uint8 *dst, uint32 dstWidth, uint32 dstHeight,
+				MipFilter filter) {
+	const auto &toLinear = SrgbToLinearTable();
+	for (uint32 y = 0; y < dstHeight; ++y) {
+		for (uint32 x = 0; x < dstWidth; ++x) {
+			f32 sum[4] = {};
+			ForEachSource(src, srcWidth, srcHeight, x, y, [&](const uint8 *texel) {
+				for (uint32 c = 0; c < 3; ++c) {
+					switch (filter) {
+					case MipFilter::Linear:
+						sum[c] += static_cast<f32>(texel[c]) / 255.F;
+						break;
+					case MipFilter::Srgb:
+						sum[c] += toLinear[texel[c]];
+						break;
+					case MipFilter::NormalMap:
+						sum[c] += static_cast<f32>(texel[c]) / 127.5F - 1.F;
+						break;
+					}
+				}
+				sum[3] += static_cast<f32>(texel[3]) / 255.F;
+			});
+
+			uint8 *out = dst + (static_cast<usize>(y) * dstWidth + x) * 4;
+			if (filter == MipFilter::NormalMap) {
+				const f32 length = std::sqrt(sum[0] * sum[0] + sum[1] * sum[1] + sum[2] * sum[2]);
+				const f32 scale = length > 1e-6F ? 1.F / length : 0.F;
+				for (uint32 c = 0; c < 3; ++c) {
+					out[c] = ToUnorm8(length > 1e-6F ? sum[c] * scale * 0.5F + 0.5F : (c == 2 ? 1.F : 0.5F));
+				}
+			} else {
+				for (uint32 c = 0; c < 3; ++c) {
+					out[c] = filter == MipFilter::Srgb ? LinearToSrgb(sum[c] * 0.25F) : ToUnorm8(sum[c] * 0.25F);
+				}
+			}
+			out[3] = ToUnorm8(sum[3] * 0.25F);
+		}
+	}
+}
+
+void Downsample(const f32 *src, uint32 srcWidth, uint32 srcHeight, f32 *dst, uint32 dstWidth, uint32 dstHeight) {
+	for (uint32 y = 0; y < dstHeight; ++y) {
+		for (uint32 x = 0; x < dstWidth; ++x) {
+			f32 *out = dst + (static_cast<usize>(y) * dstWidth + x) * 4;
+			std::fill_n(out, 4, 0.F);
+			ForEachSource(src, srcWidth, srcHeight, x, y, [&](const f32 *texel) {
+				for (uint32 c = 0; c < 4; ++c) {
+					out[c] += texel[c] * 0.25F;
+				}
+			});
+		}
+	}
+}
+
+template <typename T, typename DownsampleFn>
+std::vector<std::vector<T>> BuildChain(const T *rgba, uint32 width, uint32 height, DownsampleFn &&downsample) {
+	const uint32 levelCount = RHI::GetFullMipCount(width, height);
+	std::vector<std::vector<T>> levels(levelCount);
+	levels[0].assign(rgba, rgba + static_cast<usize>(width) * height * 4);
+	for (uint32 level = 1; level < levelCount; ++level) {
+		const uint32 srcWidth = std::max(width >> (level - 1), 1u);
+		const uint32 srcHeight = std::max(height >> (level - 1), 1u);
+		const uint32 dstWidth = std::max(width >> level, 1u);
+		const uint32 dstHeight = std::max(height >> level, 1u);
+		levels[level].resize(static_cast<usize>(dstWidth) * dstHeight * 4);
+		downsample(levels[level - 1].data(), srcWidth, srcHeight, levels[level].data(), dstWidth, dstHeight);
+	}
+	return levels;
+}
+
+} // namespace
+
+std::vector<std::vector<uint8>> MipGenerator::Generate(const uint8 *rgba, uint32 width, uint32 height,
+														MipFilter filter) {
+	return BuildChain(rgba, width, height,
+					  [filter](const uint8 *src, uint32 sw, uint32 sh, uint8 *dst, uint32 dw, uint32 dh) {
+						  Downsample(src, sw, sh, dst, dw, dh, filter);
+					  });
+}
+
+std::vector<std::vector<f32>> MipGenerator::Generate(const f32 *rgba, uint32 width, uint32 height) {
+	return BuildChain(rgba, width, height, [](const f32 *src, uint32 sw, uint32 sh, f32 *dst, uint32 dw, uint32 dh) {
+		Downsample(src, sw, sh, dst, dw, dh);
+	});
+}
+
+} // namespace Aquila::Graphics::Texture
@@ -0,0 +1,220 @@
+#include "Aquila/Graphics/Texture/TextureCooker.h"
+#include "Aquila/Graphics/Texture/BlockCompressor.h"
+#include "Aquila/Graphics/Texture/MipGenerator.h"
+#include "Aquila/Graphics/Texture/TextureLoader.h"
+#include "Aquila/RHI/FormatUtils.h"
+#include "Aquila/Foundation/Hash.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Platform/Filesystem/Filesystem.h"
+#include "Aquila/Platform/Filesystem/VirtualFileSystem.h"
+
+#include <glm/gtc/packing.hpp>
+
+namespace Aquila::Graphics::Texture {
+
+namespace {
+
+constexpr uint32 kVersion = 1;
+constexpr std::string_view kSourceKey = "AQsource";
+
+// Stored under kSourceKey: what identifies the source revision and settings a file was cooked from.
+struct SourceRecord {
+	uint32 version = kVersion;
+	uint32 settings = 0;
+	uint64 sourceSize = 0;
+	uint64 sourceWriteTime = 0;
+};
+
+uint32 PackSettings(const TextureCookSettings &settings) {
+	return static_cast<uint32>(settings.kind) | uint32(settings.compress) << 8 | uint32(settings.compact) << 9;
+}
+
+bool StatSource(const std::string &sourcePath, uint64 &outSize, uint64 &outWriteTime) {
+	auto *vfs = Platform::Filesystem::VirtualFileSystem::Get();
+	const int64 size = vfs->GetFileSize(sourcePath);
+	if (size <= 0) {
+		return false;
+	}
+	outSize = static_cast<uint64>(size);
+	outWriteTime = vfs->GetLastWriteTime(sourcePath);
+	return true;
+}
+
+RHI::TextureFormat PickFormat(const TextureCookSettings &settings, bool opaque) {
+	using enum RHI::TextureFormat;
+	switch (settings.kind) {
+	case TextureKind::Color:
+		if (!settings.compress) {
+			return RGBA8_SRGB;
+		}
+		return settings.compact ? (opaque ? BC1_RGBA_SRGB : BC3_RGBA_SRGB) : BC7_RGBA_SRGB;
+	case TextureKind::Data:
+		if (!settings.compress) {
+			return RGBA8;
+		}
+		return settings.compact ? (opaque ? BC1_RGBA : BC3_RGBA) : BC7_RGBA;
+	case TextureKind::NormalMap:
+		return settings.compress ? BC5_RG : RGBA8;
+	case TextureKind::HDR:
+		return settings.compress ? BC6H_RGB_UF16 : RGBA16F;
+	}
+	return None;
+}
+
+bool ImportLdr(const std::string &sourcePath, const TextureCookSettings &settings, Ktx2Texture &out) {
+	TextureLoader loader;
+	TextureLoader::RawImageData image;
+	try {
+		image = loader.LoadFromVFS(sourcePath);
+	} catch (const std::exception &e) {
+		AQUILA_LOG_ERROR("TextureCooker: failed to load '{}': {}", sourcePath, e.what());
+		return false;
+	}
+	if (!image.IsValid()) {
+		AQUILA_LOG_ERROR("TextureCooker: failed to decode '{}'", sourcePath);
+		return false;
+	}
+
+	bool opaque = true;
+	for (usize i = 3; i < image.SizeBytes() && opaque; i += 4) {
+		opaque = image.pixels[i] == 255;
+	}
+	const MipFilter filter = settings.kind == TextureKind::Color	   ? MipFilter::Srgb
+							 : settings.kind == TextureKind::NormalMap ? MipFilter::NormalMap
+																	   : MipFilter::Linear;
+	const auto levels = MipGenerator::Generate(image.pixels.get(), image.width, image.height, filter);
+
+	out.format = PickFormat(settings, opaque);
+	out.width = image.width;
+	out.height = image.height;
+	out.levelCount = static_cast<uint32>(levels.size());
+	for (uint32 level = 0; level < out.levelCount; ++level) {
+		if (!settings.compress) {
+			out.data.insert(out.data.end(), levels[level].begin(), levels[level].end());
+			continue;
+		}
+		const auto blocks = BlockCompressor::Compress(levels[level].data(), std::max(out.width >> level, 1u),
+													  std::max(out.height >> level, 1u), out.format);
+		out.data.insert(out.data.end(), blocks.begin(), blocks.end());
+	}
+	return true;
+}
+
+bool ImportHdr(const std::string &sourcePath, const TextureCookSettings &settings, Ktx2Texture &out) {
+	TextureLoader loader;
+	const TextureLoader::RawHDRData image = loader.LoadHDRFromFile(sourcePath);
+	if (!image.IsValid()) {
+		return false;
+	}
+	const auto levels = MipGenerator::Generate(image.pixels.get(), image.width, image.height);
+
+	out.format = PickFormat(settings, true);
+	out.width = image.width;
+	out.height = image.height;
+	out.levelCount = static_cast<uint32>(levels.size());
+	for (uint32 level = 0; level < out.levelCount; ++level) {
+		if (settings.compress) {
+			const auto blocks = BlockCompressor::CompressBC6H(levels[level].data(), std::max(out.width >> level, 1u),
+															  std::max(out.height >> level, 1u));
+			out.data.insert(out.data.end(), blocks.begin(), blocks.end());
+			continue;
+		}
+		const usize offset = out.data.size();
+		out.data.resize(offset + levels[level].size() * sizeof(uint16));
+		auto *halves = reinterpret_cast<uint16 *>(out.data.data() + offset);
+		for (usize i = 0; i < levels[level].size(); ++i) {
+			halves[i] = glm::packHalf1x16(levels[level][i]);
+		}
+	}
+	return true;
+}
+
+} // namespace
+
+bool TextureCooker::Cook(const std::string &sourcePath, const TextureCookSettings &settings) {
+	Ktx2Texture texture;
+	return Import(sourcePath, settings, texture) && Store(sourcePath, settings, texture);
+}
+
+bool TextureCooker::Load(const std::string &sourcePath, const TextureCookSettings &settings, Ktx2Texture &out) {
+	if (TryLoad(sourcePath, settings, out)) {
+		return true;
+	}
+	if (!Import(sourcePath, settings, out)) {
+		return false;
+	}
+	Store(sourcePath, settings, out); // a failed write only costs the next load another import
+	return true;
+}
+
+bool TextureCooker::TryLoad(const std::string &sourcePath, const TextureCookSettings &settings, Ktx2Texture &out) {
+	uint64 sourceSize = 0;
+	uint64 sourceWriteTime = 0;
+	std::vector<uint8> file;
+	if (!StatSource(sourcePath, sourceSize, sourceWriteTime) ||
+		!Platform::Filesystem::FileReadAll(GetCookedPath(sourcePath, settings), file)) {
+		return false;
+	}
+
+	Ktx2Texture texture;
+	if (!Ktx2::Read(file, texture)) {
+		AQUILA_LOG_WARNING("TextureCooker: cooked data for '{}' is unreadable, reimporting", sourcePath);
+		return false;
+	}
+	const std::vector<uint8> *value = texture.FindValue(kSourceKey);
+	SourceRecord record{};
+	if (value == nullptr || value->size() != sizeof(SourceRecord)) {
+		return false;
+	}
+	memcpy(&record, value->data(), sizeof(SourceRecord));
+	if (record.version != kVersion || record.settings != PackSettings(settings)) {
+		return false;
+	}
+	if (record.sourceSize != sourceSize || record.sourceWriteTime != sourceWriteTime) {
+		AQUILA_LOG_INFO("TextureCooker: '{}' changed since it was cooked, reimporting", sourcePath);
+		return false;
+	}
+	out = std::move(texture);
+	return true;
+}
+
+bool TextureCooker::Import(const std::string &sourcePath, const TextureCookSettings &settings, Ktx2Texture &out) {
+	out = {};
+	SourceRecord record{ .settings = PackSettings(settings) };
+	if (!StatSource(sourcePath, record.sourceSize, record.sourceWriteTime)) {
+		AQUILA_LOG_ERROR("TextureCooker: cannot find '{}'", sourcePath);
+		return false;
+	}
+	const bool imported = settings.kind == TextureKind::HDR ? ImportHdr(sourcePath, settings, out)
+															: ImportLdr(sourcePath, settings, out);
+	if (!imported) {
+		out = {};
+		return false;
+	}
+	const auto *bytes = reinterpret_cast<const uint8 *>(&record);
+	out.keyValues.emplace_back(std::string(kSourceKey), std::vector<uint8>(bytes, bytes + sizeof(record)));
+	return true;
+}
+
+bool TextureCooker::Store(const std::string &sourcePath, const TextureCookSettings &settings,
+						  const Ktx2Texture &texture) {
+	const std::vector<uint8> file = Ktx2::Write(texture);
+	if (!Platform::Filesystem::FileWriteAtomic(GetCookedPath(sourcePath, settings), file.data(), file.size())) {
+		AQUILA_LOG_WARNING("TextureCooker: failed to write cooked data for '{}'", sourcePath);
+		return false;
+	}
+	return true;
+}
+
+std::string TextureCooker::GetCookedPath(const std::string &sourcePath, const TextureCookSettings &settings) {
+	static const std::string s_Directory = [] {
+		std::string dir = Platform::Filesystem::PathJoin(Platform::Filesystem::DirGetUserCache(), "textures");
+		std::error_code ec;
+		std::filesystem::create_directories(dir, ec);
+		return dir;
+	}();
+	const uint64 hash = Foundation::HashFnv1a64(std::format("{}|{:x}", sourcePath, PackSettings(settings)));
+	return Platform::Filesystem::PathJoin(s_Directory, std::format("{:016x}.ktx2", hash));
+}
+
+} // namespace Aquila::Graphics::Texture
@@ -1,11 +1,17 @@
 #include "Aquila/Graphics/Texture/TextureLoader.h"
 #include "Aquila/Foundation/PrimitiveTypes.h"
+#include "Aquila/GFX/GfxContext.h"
+#include "Aquila/GFX/GfxUploadBatcher.h"
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb/stb_image.h"
 
 namespace Aquila::Graphics::Texture {
 
+void TextureLoader::StbiDeleter::operator()(void *pixels) const {
+	stbi_image_free(pixels);
+}
+
 TextureLoader::RawImageData TextureLoader::LoadFromFile(const std::string &filepath) {
 	return LoadFromVFS(filepath);
 }
@@ -30,20 +36,13 @@ TextureLoader::RawImageData TextureLoader::LoadFromVFS(const std::string &filepa
 	RawImageData data;
 
 	int width = 0, height = 0, channels = 0;
-	stbi_uc *pixels = stbi_load_from_memory(reinterpret_cast<const stbi_uc *>(buffer.data()),
-											static_cast<int>(bytesRead), &width, &height, &channels, STBI_rgb_alpha);
+	data.pixels.reset(stbi_load_from_memory(reinterpret_cast<const stbi_uc *>(buffer.data()),
+											static_cast<int>(bytesRead), &width, &height, &channels, STBI_rgb_alpha));
 
 	data.width = static_cast<uint32>(width);
 	data.height = static_cast<uint32>(height);
 	data.channels = static_cast<uint32>(channels);
 
-	if (pixels != nullptr) {
-		size_t pixelSize = static_cast<size_t>(data.width * data.height) * 4;
-		data.pixels = CreateUnique<uint8[]>(pixelSize);
-		std::memcpy(data.pixels.get(), pixels, pixelSize);
-		stbi_image_free(pixels);
-	}
-
 	return data;
 }
 
@@ -72,26 +71,49 @@ TextureLoader::RawHDRData TextureLoader::LoadHDRFromFile(const std::string &file
 	}
 
 	int width = 0, height = 0, channels = 0;
-	f32 *pixels = stbi_loadf_from_memory(reinterpret_cast<const stbi_uc *>(buffer.data()), static_cast<int>(bytesRead),
-										 &width, &height, &channels, 4);
+	data.pixels.reset(stbi_loadf_from_memory(reinterpret_cast<const stbi_uc *>(buffer.data()),
+											 static_cast<int>(bytesRead), &width, &height, &channels, 4));
 
 	data.width = static_cast<uint32>(width);
 	data.height = static_cast<uint32>(height);
 	data.channels = static_cast<uint32>(channels);
 
-	if (pixels == nullptr) {
+	if (data.pixels == nullptr) {
 		AQUILA_LOG_ERROR("TextureLoader: failed to decode HDR '{}': {}", filepath, stbi_failure_reason());
-		return data;
 	}
 
-	const size_t pixelCount = static_cast<size_t>(data.width) * data.height * 4;
-	data.pixels = CreateUnique<f32[]>(pixelCount);
-	std::memcpy(data.pixels.get(), pixels, pixelCount * sizeof(f32));
-	stbi_image_free(pixels);
-
 	return data;
 }
 
+Ref<GFX::GfxTexture> TextureLoader::Load(GFX::GfxContext &ctx, const std::string &filepath, TextureKind kind,
+										 Upload upload) {
+	const TextureCookSettings settings{ .kind = kind, .compress = ctx.SupportsBlockCompression() };
+	Ktx2Texture texture;
+	if (!TextureCooker::Load(filepath, settings, texture)) {
+		return nullptr;
+	}
+	return CreateTexture(ctx, texture, filepath, upload);
+}
+
+Ref<GFX::GfxTexture> TextureLoader::CreateTexture(GFX::GfxContext &ctx, const Ktx2Texture &texture,
+												  const std::string &debugName, Upload upload) {
+	AQUILA_ASSERT(texture.IsValid(), "CreateTexture needs a loaded texture");
+	auto gpuTexture = ctx.CreateTexture({
+		.width = texture.width,
+		.height = texture.height,
+		.mipLevels = texture.levelCount,
+		.format = texture.format,
+		.usage = RHI::TextureUsage::Sampled | RHI::TextureUsage::TransferDst,
+		.debugName = debugName,
+	});
+	if (upload == Upload::Batched) {
+		ctx.GetUploadBatcher().UploadTexture(gpuTexture, texture.data.data(), texture.data.size());
+	} else {
+		ctx.UploadTextureData(*gpuTexture, texture.data.data(), texture.data.size());
+	}
+	return gpuTexture;
+}
+
 std::array<uint8, 4> TextureLoader::ColorToPixel(vec4 color) {
 	return { static_cast<uint8>(color.r * 255.0f), static_cast<uint8>(color.g * 255.0f),
 			 static_cast<uint8>(color.b * 255.0f), static_cast<uint8>(color.a * 255.0f) };
@@ -0,0 +1,217 @@
+#include "Aquila/Platform/Filesystem/FileWatcher.h"
+#include "Aquila/Foundation/Macros.h"
+
+#ifdef AQUILA_PLATFORM_LINUX
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace Aquila::Platform::Filesystem {
+
+namespace {
+
+// How often the wake thread checks for a stop request while nothing happens.
+constexpr int32 kWakePollMilliseconds = 100;
+
+int64 WriteTime(const std::string &path) {
+	std::error_code ec;
+	const auto time = std::filesystem::last_write_time(path, ec);
+	return ec ? 0 : static_cast<int64>(time.time_since_epoch().count());
+}
+
+} // namespace
+
+FileWatcher::FileWatcher() {
+#ifdef AQUILA_PLATFORM_LINUX
+	m_Handle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (m_Handle < 0) {
+		AQUILA_LOG_WARNING("FileWatcher: inotify unavailable ({}), polling write times instead", errno);
+	}
+#endif
+}
+
+FileWatcher::~FileWatcher() {
+	StopWakeThread(); // it polls m_Handle
+#ifdef AQUILA_PLATFORM_LINUX
+	if (m_Handle >= 0) {
+		close(m_Handle); // drops every watch with it
+	}
+#endif
+}
+
+std::string FileWatcher::Normalize(const std::string &path) {
+	std::error_code ec;
+	std::filesystem::path absolute = std::filesystem::absolute(path, ec);
+	if (ec) {
+		absolute = path;
+	}
+	return absolute.lexically_normal().generic_string();
+}
+
+bool FileWatcher::Watch(const std::string &path) {
+	const std::string file = Normalize(path);
+	const std::filesystem::path fsPath(file);
+	const std::string directory = fsPath.parent_path().generic_string();
+	const std::string name = fsPath.filename().generic_string();
+
+	auto it = m_Directories.find(directory);
+	if (it == m_Directories.end()) {
+		Directory entry;
+#ifdef AQUILA_PLATFORM_LINUX
+		if (m_Handle >= 0) {
+			entry.descriptor = inotify_add_watch(m_Handle, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+			if (entry.descriptor < 0) {
+				AQUILA_LOG_WARNING("FileWatcher: cannot watch directory '{}' ({})", directory, errno);
+				return false;
+			}
+			m_DirectoryByDescriptor[entry.descriptor] = directory;
+		}
+#endif
+		it = m_Directories.emplace(directory, std::move(entry)).first;
+	}
+
+	it->second.names.insert(name);
+	m_WriteTimes[file] = WriteTime(file);
+	return true;
+}
+
+void FileWatcher::Unwatch(const std::string &path) {
+	const std::string file = Normalize(path);
+	const std::filesystem::path fsPath(file);
+	auto it = m_Directories.find(fsPath.parent_path().generic_string());
+	if (it == m_Directories.end()) {
+		return;
+	}
+
+	m_WriteTimes.erase(file);
+	it->second.names.erase(fsPath.filename().generic_string());
+	if (!it->second.names.empty()) {
+		return;
+	}
+#ifdef AQUILA_PLATFORM_LINUX
+	if (it->second.descriptor >= 0) {
+		inotify_rm_watch(m_Handle, it->second.descriptor);
+		m_DirectoryByDescriptor.erase(it->second.descriptor);
+	}
+#endif
+	m_Directories.erase(it);
+}
+
+void FileWatcher::Clear() {
+	while (!m_Directories.empty()) {
+		auto &[directory, entry] = *m_Directories.begin();
+		const std::string name = *entry.names.begin();
+		Unwatch(directory + "/" + name);
+	}
+}
+
+bool FileWatcher::IsWatching(const std::string &path) const {
+	return m_WriteTimes.contains(Normalize(path));
+}
+
+std::vector<std::string> FileWatcher::Poll() {
+#ifdef AQUILA_PLATFORM_LINUX
+	if (m_Handle < 0) {
+		return PollWriteTimes();
+	}
+
+	std::vector<std::string> changed;
+	std::unordered_set<std::string> seen;
+	alignas(inotify_event) char buffer[4096];
+	for (;;) {
+		const ssize_t length = read(m_Handle, buffer, sizeof(buffer));
+		if (length <= 0) {
+			break; // EAGAIN: nothing left queued
+		}
+
+		for (ssize_t offset = 0; offset < length;) {
+			const auto *event = reinterpret_cast<const inotify_event *>(buffer + offset);
+			offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+			if ((event->mask & IN_Q_OVERFLOW) != 0) {
+				// Events were dropped, so anything may have changed.
+				for (const auto &[file, time] : m_WriteTimes) {
+					if (seen.insert(file).second) {
+						changed.push_back(file);
+					}
+				}
+				continue;
+			}
+			if ((event->mask & IN_IGNORED) != 0) {
+				m_DirectoryByDescriptor.erase(event->wd); // the directory itself went away
+				continue;
+			}
+
+			auto dir = m_DirectoryByDescriptor.find(event->wd);
+			if (dir == m_DirectoryByDescriptor.end() || event->len == 0) {
+				continue;
+			}
+			const Directory &entry = m_Directories[dir->second];
+			if (entry.names.contains(event->name)) {
+				std::string file = dir->second + "/" + event->name;
+				if (seen.insert(file).second) {
+					changed.push_back(std::move(file));
+				}
+			}
+		}
+	}
+	m_WakePending = false;
+	m_WakePending.notify_one();
+	return changed;
+#else
+	return PollWriteTimes();
+#endif
+}
+
+void FileWatcher::SetWakeCallback(std::function<void()> callback) {
+	StopWakeThread();
+	m_WakeCallback = std::move(callback);
+#ifdef AQUILA_PLATFORM_LINUX
+	if (m_WakeCallback && m_Handle >= 0) {
+		m_WakeThread = std::jthread([this](const std::stop_token &stop) { WakeLoop(stop); });
+	}
+#endif
+}
+
+void FileWatcher::StopWakeThread() {
+	if (!m_WakeThread.joinable()) {
+		return;
+	}
+	m_WakeThread.request_stop();
+	m_WakePending = false;
+	m_WakePending.notify_one();
+	m_WakeThread.join();
+}
+
+void FileWatcher::WakeLoop(const std::stop_token &stop) {
+#ifdef AQUILA_PLATFORM_LINUX
+	pollfd descriptor{ .fd = m_Handle, .events = POLLIN, .revents = 0 };
+	while (!stop.stop_requested()) {
+		m_WakePending.wait(true); // the events stay queued until Poll() reads them
+		if (stop.stop_requested()) {
+			break;
+		}
+		if (poll(&descriptor, 1, kWakePollMilliseconds) > 0 && (descriptor.revents & POLLIN) != 0) {
+			m_WakePending = true;
+			m_WakeCallback();
+		}
+	}
+#else
+	AQUILA_UNUSED(stop);
+#endif
+}
+
+std::vector<std::string> FileWatcher::PollWriteTimes() {
+	std::vector<std::string> changed;
+	for (auto &[file, time] : m_WriteTimes) {
+		const int64 current = WriteTime(file);
+		if (current != 0 && current != time) {
+			time = current;
+			changed.push_back(file);
+		}
+	}
+	return changed;
+}
+
+} // namespace Aquila::Platform::Filesystem
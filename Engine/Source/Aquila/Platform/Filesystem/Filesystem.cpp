@@ -198,6 +198,68 @@ std::vector<std::string> DirList(const std::string &path, bool recursive) {
 	return entries;
 }
 
+std::string DirGetUserCache() {
+	static const std::string s_CacheDir = [] {
+		const auto env = [](const char *name) -> std::string {
+			const char *value = std::getenv(name);
+			return value != nullptr ? value : "";
+		};
+#ifdef AQUILA_PLATFORM_WINDOWS
+		std::string base = env("LOCALAPPDATA");
+		std::string dir = base.empty() ? PathJoin(DirGetCurrent(), ".cache") : PathJoin(base, "Aquila/Cache");
+#elif defined(AQUILA_PLATFORM_MACOS)
+		std::string base = env("HOME");
+		std::string dir = base.empty() ? PathJoin(DirGetCurrent(), ".cache") : PathJoin(base, "Library/Caches/Aquila");
+#else
+		std::string base = env("XDG_CACHE_HOME");
+		if (base.empty() && !env("HOME").empty()) {
+			base = PathJoin(env("HOME"), ".cache");
+		}
+		std::string dir = base.empty() ? PathJoin(DirGetCurrent(), ".cache") : PathJoin(base, "aquila");
+#endif
+		dir = PathNormalize(dir);
+		std::error_code ec;
+		std::filesystem::create_directories(dir, ec);
+		if (ec) {
+			AQUILA_LOG_WARNING("Could not create cache directory '{}': {}", dir, ec.message());
+		}
+		return dir;
+	}();
+	return s_CacheDir;
+}
+
+bool FileReadAll(const std::string &path, std::vector<uint8> &out) {
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file) {
+		return false;
+	}
+	const std::streamsize size = file.tellg();
+	if (size < 0) {
+		return false;
+	}
+	out.resize(static_cast<usize>(size));
+	file.seekg(0);
+	return static_cast<bool>(file.read(reinterpret_cast<char *>(out.data()), size));
+}
+
+bool FileWriteAtomic(const std::string &path, const void *data, usize size) {
+	// Unique per writer, so two threads or processes producing the same file never share a temp.
+	static std::atomic<uint32> s_Counter = 0;
+	const usize thread = std::hash<std::thread::id>{}(std::this_thread::get_id());
+	const std::string temp = std::format("{}.{:x}.{}.tmp", path, thread, s_Counter++);
+	{
+		std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+		if (!file || !file.write(static_cast<const char *>(data), static_cast<std::streamsize>(size))) {
+			return false;
+		}
+	}
+	if (!FileMove(temp, path)) {
+		FileRemove(temp);
+		return false;
+	}
+	return true;
+}
+
 std::string PathToAbsolute(const std::string &path) {
 	if (PathIsAbsolute(path)) {
 		return path;
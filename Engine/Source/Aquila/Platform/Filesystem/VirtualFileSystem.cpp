@@ -165,6 +165,16 @@ uint64 VirtualFileSystem::GetLastWriteTime(const std::string &virtualPath) {
 	return mount->fileSystem->FileGetLastWriteTime(relativePath);
 }
 
+std::string VirtualFileSystem::GetNativePath(const std::string &virtualPath) {
+	std::string relativePath;
+	MountPoint *mount = FindMountPoint(virtualPath, relativePath);
+
+	if (mount == nullptr) {
+		return {};
+	}
+	return mount->fileSystem->GetNativePath(relativePath);
+}
+
 bool VirtualFileSystem::CreateDir(const std::string &virtualPath) {
 	std::string relativePath;
 	MountPoint *mount = FindMountPoint(virtualPath, relativePath);
@@ -7,7 +7,7 @@ namespace Aquila::RHI {
 
 VulkanBuffer::VulkanBuffer(VulkanDevice &device, const std::string &debugName, VkDeviceSize instanceSize,
 						   uint32_t instanceCount, VkBufferUsageFlags usageFlags, MemoryDomain domain,
-						   VkDeviceSize minOffsetAlignment)
+						   VkDeviceSize minOffsetAlignment, bool transferQueueShared)
 	: m_Device(device), m_InstanceSize(instanceSize), m_AlignmentSize(GetAlignment(instanceSize, minOffsetAlignment)),
 	  m_InstanceCount(instanceCount), m_UsageFlags(usageFlags), m_Domain(domain) {
 	m_BufferSize = m_AlignmentSize * instanceCount;
@@ -15,15 +15,20 @@ VulkanBuffer::VulkanBuffer(VulkanDevice &device, const std::string &debugName, V
 	auto alloc = [&]() -> BufferAllocation {
 		switch (m_Domain) {
 		case MemoryDomain::GPU_ONLY:
-			return device.CreateBuffer<MemoryDomain::GPU_ONLY>(m_BufferSize, usageFlags, debugName.c_str());
+			return device.CreateBuffer<MemoryDomain::GPU_ONLY>(m_BufferSize, usageFlags, debugName.c_str(),
+															   transferQueueShared);
 		case MemoryDomain::CPU_TO_GPU:
-			return device.CreateBuffer<MemoryDomain::CPU_TO_GPU>(m_BufferSize, usageFlags, debugName.c_str());
+			return device.CreateBuffer<MemoryDomain::CPU_TO_GPU>(m_BufferSize, usageFlags, debugName.c_str(),
+																 transferQueueShared);
 		case MemoryDomain::GPU_TO_CPU:
-			return device.CreateBuffer<MemoryDomain::GPU_TO_CPU>(m_BufferSize, usageFlags, debugName.c_str());
+			return device.CreateBuffer<MemoryDomain::GPU_TO_CPU>(m_BufferSize, usageFlags, debugName.c_str(),
+																 transferQueueShared);
 		case MemoryDomain::CPU_ONLY:
-			return device.CreateBuffer<MemoryDomain::CPU_ONLY>(m_BufferSize, usageFlags, debugName.c_str());
+			return device.CreateBuffer<MemoryDomain::CPU_ONLY>(m_BufferSize, usageFlags, debugName.c_str(),
+															   transferQueueShared);
 		default:
-			return device.CreateBuffer<MemoryDomain::GPU_ONLY>(m_BufferSize, usageFlags, debugName.c_str());
+			return device.CreateBuffer<MemoryDomain::GPU_ONLY>(m_BufferSize, usageFlags, debugName.c_str(),
+															   transferQueueShared);
 		}
 	}();
 
@@ -9,28 +9,58 @@
 
 namespace Aquila::RHI {
 
-// ResourceState -> Vulkan barrier helpers
+// ResourceState -> synchronization2 barrier helpers
+//
+// PipelineScope narrows the shader stages a state implies: a compute pass never waits
+// on (or makes the next pass wait on) vertex / fragment work and vice versa.
 
 namespace {
 
 struct VkTexBarrierInfo {
-	VkPipelineStageFlags stage = 0;
-	VkAccessFlags access = 0;
+	VkPipelineStageFlags2 stage = VK_PIPELINE_STAGE_2_NONE;
+	VkAccessFlags2 access = VK_ACCESS_2_NONE;
 	VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
 };
 
 struct VkBufBarrierInfo {
-	VkPipelineStageFlags stage = 0;
-	VkAccessFlags access = 0;
+	VkPipelineStageFlags2 stage = VK_PIPELINE_STAGE_2_NONE;
+	VkAccessFlags2 access = VK_ACCESS_2_NONE;
 };
 
-static VkTexBarrierInfo TexBarrierInfo(ResourceState state, bool isDepth) {
+constexpr VkAccessFlags2 kWriteAccessMask = VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT |
+	VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+	VK_ACCESS_2_TRANSFER_WRITE_BIT | VK_ACCESS_2_HOST_WRITE_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+
+static VkPipelineStageFlags2 ShaderStages(PipelineScope scope) {
+	switch (scope) {
+	case PipelineScope::Graphics:
+		return VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
+	case PipelineScope::Compute:
+		return VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+	case PipelineScope::All:
+	default:
+		return VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT |
+			VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+	}
+}
+
+// Blits, resolves and image clears are graphics-queue commands; a transfer or compute queue
+// only copies (vkCmdFillBuffer included), and its barriers may not name the other stages.
+static VkPipelineStageFlags2 TransferStages(CommandListType queue, bool write) {
+	if (queue != CommandListType::Graphics) {
+		return VK_PIPELINE_STAGE_2_COPY_BIT;
+	}
+	return write ? VK_PIPELINE_STAGE_2_COPY_BIT | VK_PIPELINE_STAGE_2_BLIT_BIT | VK_PIPELINE_STAGE_2_CLEAR_BIT
+				 : VK_PIPELINE_STAGE_2_COPY_BIT | VK_PIPELINE_STAGE_2_BLIT_BIT;
+}
+
+// `queue` is the queue whose stages the half being built belongs to.
+static VkTexBarrierInfo TexBarrierInfo(ResourceState state, bool isDepth, PipelineScope scope,
+									   CommandListType queue) {
 	VkTexBarrierInfo out{};
 
+	// Nothing to wait for, contents are discarded
 	if (state == ResourceState::Undefined) {
-		out.stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-		out.access = 0;
-		out.layout = VK_IMAGE_LAYOUT_UNDEFINED;
 		return out;
 	}
 
@@ -38,13 +68,13 @@ static VkTexBarrierInfo TexBarrierInfo(ResourceState state, bool isDepth) {
 	const auto has = [s](ResourceState bit) { return (s & static_cast<uint16>(bit)) != 0; };
 
 	if (has(ResourceState::ColorAttachmentWrite)) {
-		out.stage |= VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-		out.access |= VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+		out.stage |= VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+		out.access |= VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT;
 		out.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 	}
 	if (has(ResourceState::ColorAttachmentRead)) {
-		out.stage |= VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-		out.access |= VK_ACCESS_COLOR_ATTACHMENT_READ_BIT;
+		out.stage |= VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+		out.access |= VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT;
 		if (out.layout == VK_IMAGE_LAYOUT_UNDEFINED) {
 			out.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 		}
@@ -52,21 +82,20 @@ static VkTexBarrierInfo TexBarrierInfo(ResourceState state, bool isDepth) {
 
 	// Depth write takes precedence over depth read for layout selection
 	if (has(ResourceState::DepthStencilWrite)) {
-		out.stage |= VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
-		out.access |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+		out.stage |= VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT;
+		out.access |= VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
 		out.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
 	} else if (has(ResourceState::DepthStencilRead)) {
-		out.stage |= VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
-		out.access |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
+		out.stage |= VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT;
+		out.access |= VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
 		if (out.layout == VK_IMAGE_LAYOUT_UNDEFINED) {
 			out.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
 		}
 	}
 
 	if (has(ResourceState::ShaderRead)) {
-		out.stage |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
-			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
-		out.access |= VK_ACCESS_SHADER_READ_BIT;
+		out.stage |= ShaderStages(scope);
+		out.access |= VK_ACCESS_2_SHADER_SAMPLED_READ_BIT;
 		if (out.layout == VK_IMAGE_LAYOUT_UNDEFINED) {
 			out.layout =
 				isDepth ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
@@ -75,47 +104,43 @@ static VkTexBarrierInfo TexBarrierInfo(ResourceState state, bool isDepth) {
 
 	// Storage overrides layout to GENERAL regardless of other flags
 	if (has(ResourceState::StorageRead) || has(ResourceState::StorageWrite)) {
-		out.stage |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+		out.stage |= ShaderStages(scope);
 		if (has(ResourceState::StorageRead)) {
-			out.access |= VK_ACCESS_SHADER_READ_BIT;
+			out.access |= VK_ACCESS_2_SHADER_STORAGE_READ_BIT;
 		}
 		if (has(ResourceState::StorageWrite)) {
-			out.access |= VK_ACCESS_SHADER_WRITE_BIT;
+			out.access |= VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT;
 		}
 		out.layout = VK_IMAGE_LAYOUT_GENERAL;
 	}
 
 	if (has(ResourceState::TransferSrc)) {
-		out.stage |= VK_PIPELINE_STAGE_TRANSFER_BIT;
-		out.access |= VK_ACCESS_TRANSFER_READ_BIT;
+		out.stage |= TransferStages(queue, false);
+		out.access |= VK_ACCESS_2_TRANSFER_READ_BIT;
 		if (out.layout == VK_IMAGE_LAYOUT_UNDEFINED) {
 			out.layout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
 		}
 	}
 	if (has(ResourceState::TransferDst)) {
-		out.stage |= VK_PIPELINE_STAGE_TRANSFER_BIT;
-		out.access |= VK_ACCESS_TRANSFER_WRITE_BIT;
+		out.stage |= TransferStages(queue, true);
+		out.access |= VK_ACCESS_2_TRANSFER_WRITE_BIT;
 		if (out.layout == VK_IMAGE_LAYOUT_UNDEFINED) {
 			out.layout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
 		}
 	}
 
+	// Presentation engine syncs through the semaphore, no stage to wait on
 	if (has(ResourceState::Present)) {
-		out.stage |= VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
 		out.layout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
 	}
 
-	if (out.stage == 0) {
-		out.stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-	}
 	return out;
 }
 
-static VkBufBarrierInfo BufBarrierInfo(ResourceState state) {
+static VkBufBarrierInfo BufBarrierInfo(ResourceState state, PipelineScope scope, CommandListType queue) {
 	VkBufBarrierInfo out{};
 
 	if (state == ResourceState::Undefined) {
-		out.stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
 		return out;
 	}
 
@@ -123,47 +148,39 @@ static VkBufBarrierInfo BufBarrierInfo(ResourceState state) {
 	const auto has = [s](ResourceState bit) { return (s & static_cast<uint16>(bit)) != 0; };
 
 	if (has(ResourceState::UniformRead)) {
-		out.stage |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
-			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
-		out.access |= VK_ACCESS_UNIFORM_READ_BIT;
-	}
-	if (has(ResourceState::ShaderRead)) {
-		out.stage |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
-			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
-		out.access |= VK_ACCESS_SHADER_READ_BIT;
+		out.stage |= ShaderStages(scope);
+		out.access |= VK_ACCESS_2_UNIFORM_READ_BIT;
 	}
-	if (has(ResourceState::StorageRead)) {
-		out.stage |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
-		out.access |= VK_ACCESS_SHADER_READ_BIT;
+	if (has(ResourceState::ShaderRead) || has(ResourceState::StorageRead)) {
+		out.stage |= ShaderStages(scope);
+		out.access |= VK_ACCESS_2_SHADER_STORAGE_READ_BIT;
 	}
 	if (has(ResourceState::StorageWrite)) {
-		out.stage |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
-		out.access |= VK_ACCESS_SHADER_WRITE_BIT;
+		out.stage |= ShaderStages(scope);
+		out.access |= VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT;
 	}
 	if (has(ResourceState::TransferSrc)) {
-		out.stage |= VK_PIPELINE_STAGE_TRANSFER_BIT;
-		out.access |= VK_ACCESS_TRANSFER_READ_BIT;
+		out.stage |= VK_PIPELINE_STAGE_2_COPY_BIT;
+		out.access |= VK_ACCESS_2_TRANSFER_READ_BIT;
 	}
 	if (has(ResourceState::TransferDst)) {
-		out.stage |= VK_PIPELINE_STAGE_TRANSFER_BIT;
-		out.access |= VK_ACCESS_TRANSFER_WRITE_BIT;
+		out.stage |= queue == CommandListType::Graphics ? VK_PIPELINE_STAGE_2_COPY_BIT | VK_PIPELINE_STAGE_2_CLEAR_BIT
+														: VK_PIPELINE_STAGE_2_COPY_BIT;
+		out.access |= VK_ACCESS_2_TRANSFER_WRITE_BIT;
 	}
 	if (has(ResourceState::IndirectArgument)) {
-		out.stage |= VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
-		out.access |= VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+		out.stage |= VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT;
+		out.access |= VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT;
 	}
 	if (has(ResourceState::IndexBuffer)) {
-		out.stage |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
-		out.access |= VK_ACCESS_INDEX_READ_BIT;
+		out.stage |= VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT;
+		out.access |= VK_ACCESS_2_INDEX_READ_BIT;
 	}
 	if (has(ResourceState::VertexBuffer)) {
-		out.stage |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
-		out.access |= VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+		out.stage |= VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT;
+		out.access |= VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT;
 	}
 
-	if (out.stage == 0) {
-		out.stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-	}
 	return out;
 }
 
@@ -201,6 +218,25 @@ VulkanCommandList::VulkanCommandList(VulkanDevice &device, VkCommandPool command
 	m_Device.SetObjectDebugName(VK_OBJECT_TYPE_COMMAND_BUFFER, reinterpret_cast<uint64>(m_CommandBuffer), name.c_str());
 }
 
+VulkanCommandList::VulkanCommandList(VulkanDevice &device, VkCommandPool commandPool, VkCommandBuffer existingCmd,
+									 const SecondaryCommandListDesc &inheritance)
+	: m_CommandBuffer(existingCmd), m_CommandPool(commandPool), m_Type(CommandListType::Graphics),
+	  m_Name(inheritance.debugName), m_Device(device), m_IsSecondary(true) {
+	m_InheritedColorFormats.reserve(inheritance.colorFormats.size());
+	for (const TextureFormat fmt : inheritance.colorFormats) {
+		m_InheritedColorFormats.push_back(ToVkFormat(fmt));
+	}
+	if (inheritance.depthFormat != TextureFormat::None) {
+		m_InheritedDepthFormat = ToVkFormat(inheritance.depthFormat);
+		if (AspectFor(inheritance.depthFormat) & VK_IMAGE_ASPECT_STENCIL_BIT) {
+			m_InheritedStencilFormat = m_InheritedDepthFormat;
+		}
+	}
+	m_InheritedSamples = ToVkSampleCount(inheritance.samples);
+	m_Device.SetObjectDebugName(VK_OBJECT_TYPE_COMMAND_BUFFER, reinterpret_cast<uint64>(m_CommandBuffer),
+								m_Name.c_str());
+}
+
 VulkanCommandList::~VulkanCommandList() {
 	// Freed automatically when the command pool is destroyed
 }
@@ -212,8 +248,27 @@ void VulkanCommandList::Begin() {
 
 	VkCommandBufferBeginInfo beginInfo{};
 	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+
+	VkCommandBufferInheritanceRenderingInfo renderingInfo{};
+	VkCommandBufferInheritanceInfo inheritanceInfo{};
+	if (m_IsSecondary) {
+		renderingInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO;
+		renderingInfo.colorAttachmentCount = static_cast<uint32>(m_InheritedColorFormats.size());
+		renderingInfo.pColorAttachmentFormats = m_InheritedColorFormats.empty() ? nullptr : m_InheritedColorFormats.data();
+		renderingInfo.depthAttachmentFormat = m_InheritedDepthFormat;
+		renderingInfo.stencilAttachmentFormat = m_InheritedStencilFormat;
+		renderingInfo.rasterizationSamples = m_InheritedSamples;
+
+		inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+		inheritanceInfo.pNext = &renderingInfo;
+
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		beginInfo.pInheritanceInfo = &inheritanceInfo;
+	}
+
 	AQUILA_VULKAN_CHECK(vkBeginCommandBuffer(m_CommandBuffer, &beginInfo));
 	m_IsRecording = true;
+	m_BoundPipelineLayout = VK_NULL_HANDLE;
 }
 
 void VulkanCommandList::End() {
@@ -234,52 +289,206 @@ void VulkanCommandList::Reset() {
 // Resource transitions
 
 void VulkanCommandList::TransitionTexture(IRHITexture &texture, ResourceState oldState, ResourceState newState) {
-	if (oldState == newState) {
-		return;
+	const TextureBarrier barrier{ .texture = &texture, .oldState = oldState, .newState = newState };
+	PipelineBarrier({ &barrier, 1 }, {});
+}
+
+void VulkanCommandList::TransitionBuffer(IRHIBuffer &buffer, ResourceState oldState, ResourceState newState) {
+	const BufferBarrier barrier{ .buffer = &buffer, .oldState = oldState, .newState = newState };
+	PipelineBarrier({}, { &barrier, 1 });
+}
+
+// Everything lands in a single vkCmdPipelineBarrier2. Along the way:
+//  - a resource listed twice is folded into one transition (first old -> last new),
+//  - read -> read with an unchanged layout is dropped, there is no hazard to cover,
+//  - queue hand-offs keep only the half that belongs on this list's queue.
+void VulkanCommandList::PipelineBarrier(std::span<const TextureBarrier> textures,
+										std::span<const BufferBarrier> buffers) {
+	std::vector<VkImageMemoryBarrier2> &imageBarriers = m_ImageBarrierScratch;
+	std::vector<VkBufferMemoryBarrier2> &bufferBarriers = m_BufferBarrierScratch;
+	imageBarriers.clear();
+	bufferBarriers.clear();
+
+	for (usize i = 0; i < textures.size(); ++i) {
+		const TextureBarrier &first = textures[i];
+		if (first.texture == nullptr) {
+			continue;
+		}
+		auto &vkTex = static_cast<VulkanTexture &>(*first.texture);
+
+		bool seen = false;
+		for (usize j = 0; j < i && !seen; ++j) {
+			seen = textures[j].texture == first.texture;
+		}
+		if (seen) {
+			continue;
+		}
+		const TextureBarrier *last = &first;
+		for (usize j = i + 1; j < textures.size(); ++j) {
+			if (textures[j].texture == first.texture) {
+				last = &textures[j];
+			}
+		}
+
+		const bool handOff = first.srcQueue != last->dstQueue;
+		if (!handOff && first.oldState == last->newState) {
+			continue;
+		}
+
+		// Without a hand-off both halves run on this list's queue, whatever the barrier names.
+		const bool depth = IsDepthFormat(vkTex.GetFormat());
+		VkTexBarrierInfo src = TexBarrierInfo(first.oldState, depth, first.srcScope, handOff ? first.srcQueue : m_Type);
+		VkTexBarrierInfo dst = TexBarrierInfo(last->newState, depth, last->dstScope, handOff ? last->dstQueue : m_Type);
+
+		uint32 srcFamily = VK_QUEUE_FAMILY_IGNORED;
+		uint32 dstFamily = VK_QUEUE_FAMILY_IGNORED;
+		if (handOff) {
+			if (!ResolveQueueHandOff(first.srcQueue, last->dstQueue, src.layout != dst.layout, src.stage, src.access,
+									 dst.stage, dst.access, srcFamily, dstFamily)) {
+				continue;
+			}
+		} else if (src.layout == dst.layout && ((src.access | dst.access) & kWriteAccessMask) == 0) {
+			continue;
+		}
+
+		VkImageMemoryBarrier2 &barrier = imageBarriers.emplace_back();
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+		barrier.srcStageMask = src.stage;
+		barrier.srcAccessMask = src.access;
+		barrier.dstStageMask = dst.stage;
+		barrier.dstAccessMask = dst.access;
+		barrier.oldLayout = src.layout;
+		barrier.newLayout = dst.layout;
+		barrier.srcQueueFamilyIndex = srcFamily;
+		barrier.dstQueueFamilyIndex = dstFamily;
+		barrier.image = vkTex.GetImage();
+		barrier.subresourceRange = { AspectFor(vkTex.GetFormat()), 0, VK_REMAINING_MIP_LEVELS, 0,
+									 VK_REMAINING_ARRAY_LAYERS };
 	}
 
-	auto &vkTex = static_cast<VulkanTexture &>(texture);
-	const bool depth = IsDepthFormat(vkTex.GetFormat());
+	for (usize i = 0; i < buffers.size(); ++i) {
+		const BufferBarrier &first = buffers[i];
+		if (first.buffer == nullptr) {
+			continue;
+		}
 
-	VkTexBarrierInfo src = TexBarrierInfo(oldState, depth);
-	VkTexBarrierInfo dst = TexBarrierInfo(newState, depth);
+		bool seen = false;
+		for (usize j = 0; j < i && !seen; ++j) {
+			seen = buffers[j].buffer == first.buffer;
+		}
+		if (seen) {
+			continue;
+		}
+		const BufferBarrier *last = &first;
+		for (usize j = i + 1; j < buffers.size(); ++j) {
+			if (buffers[j].buffer == first.buffer) {
+				last = &buffers[j];
+			}
+		}
 
-	VkImageMemoryBarrier barrier{};
-	barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-	barrier.srcAccessMask = src.access;
-	barrier.dstAccessMask = dst.access;
-	barrier.oldLayout = src.layout;
-	barrier.newLayout = dst.layout;
-	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-	barrier.image = vkTex.GetImage();
-	barrier.subresourceRange = { AspectFor(vkTex.GetFormat()), 0, VK_REMAINING_MIP_LEVELS, 0,
-								 VK_REMAINING_ARRAY_LAYERS };
+		const bool handOff = first.srcQueue != last->dstQueue;
+		if (!handOff && first.oldState == last->newState) {
+			continue;
+		}
 
-	vkCmdPipelineBarrier(m_CommandBuffer, src.stage, dst.stage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
-}
+		VkBufBarrierInfo src = BufBarrierInfo(first.oldState, first.srcScope, handOff ? first.srcQueue : m_Type);
+		VkBufBarrierInfo dst = BufBarrierInfo(last->newState, last->dstScope, handOff ? last->dstQueue : m_Type);
+
+		uint32 srcFamily = VK_QUEUE_FAMILY_IGNORED;
+		uint32 dstFamily = VK_QUEUE_FAMILY_IGNORED;
+		if (handOff) {
+			if (!ResolveQueueHandOff(first.srcQueue, last->dstQueue, false, src.stage, src.access, dst.stage,
+									 dst.access, srcFamily, dstFamily)) {
+				continue;
+			}
+		} else if (((src.access | dst.access) & kWriteAccessMask) == 0) {
+			// Buffers have no layout: without a write on either side there is nothing to order
+			continue;
+		}
 
-void VulkanCommandList::TransitionBuffer(IRHIBuffer &buffer, ResourceState oldState, ResourceState newState) {
-	if (oldState == newState) {
+		VkBufferMemoryBarrier2 &barrier = bufferBarriers.emplace_back();
+		barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+		barrier.srcStageMask = src.stage;
+		barrier.srcAccessMask = src.access;
+		barrier.dstStageMask = dst.stage;
+		barrier.dstAccessMask = dst.access;
+		barrier.srcQueueFamilyIndex = srcFamily;
+		barrier.dstQueueFamilyIndex = dstFamily;
+		barrier.buffer = static_cast<VulkanBuffer &>(*first.buffer).GetBuffer();
+		barrier.offset = 0;
+		barrier.size = VK_WHOLE_SIZE;
+	}
+
+	if (imageBarriers.empty() && bufferBarriers.empty()) {
 		return;
 	}
 
-	auto &vkBuf = static_cast<VulkanBuffer &>(buffer);
+	VkDependencyInfo dependency{};
+	dependency.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+	dependency.imageMemoryBarrierCount = static_cast<uint32>(imageBarriers.size());
+	dependency.pImageMemoryBarriers = imageBarriers.data();
+	dependency.bufferMemoryBarrierCount = static_cast<uint32>(bufferBarriers.size());
+	dependency.pBufferMemoryBarriers = bufferBarriers.data();
+	vkCmdPipelineBarrier2(m_CommandBuffer, &dependency);
+}
+
+// A queue hand-off is split in two: the release half on the source queue and the acquire
+// half on the destination queue, ordered by the semaphore wait between the submissions.
+// Within one queue family the semaphore already orders memory, so the release records
+// nothing and the acquire only performs a layout change, if any. Across families both
+// halves carry the family indices (an ownership transfer). The acquire's source stages
+// are set to its destination stages so it chains onto the semaphore wait.
+// Returns false when there is nothing to record on this list.
+bool VulkanCommandList::ResolveQueueHandOff(CommandListType srcQueue, CommandListType dstQueue, bool layoutChange,
+											VkPipelineStageFlags2 &srcStage, VkAccessFlags2 &srcAccess,
+											VkPipelineStageFlags2 &dstStage, VkAccessFlags2 &dstAccess,
+											uint32 &srcFamily, uint32 &dstFamily) const {
+	const uint32 srcIndex = m_Device.GetQueueFamilyIndex(srcQueue);
+	const uint32 dstIndex = m_Device.GetQueueFamilyIndex(dstQueue);
+	const bool release = m_Type == srcQueue;
+
+	if (srcIndex == dstIndex) {
+		if (release || !layoutChange) {
+			return false;
+		}
+		srcStage = dstStage;
+		srcAccess = VK_ACCESS_2_NONE;
+		return true;
+	}
 
-	VkBufBarrierInfo src = BufBarrierInfo(oldState);
-	VkBufBarrierInfo dst = BufBarrierInfo(newState);
+	srcFamily = srcIndex;
+	dstFamily = dstIndex;
+	if (release) {
+		dstStage = VK_PIPELINE_STAGE_2_NONE;
+		dstAccess = VK_ACCESS_2_NONE;
+	} else {
+		srcStage = dstStage;
+		srcAccess = VK_ACCESS_2_NONE;
+	}
+	return true;
+}
 
-	VkBufferMemoryBarrier barrier{};
-	barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-	barrier.srcAccessMask = src.access;
-	barrier.dstAccessMask = dst.access;
-	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-	barrier.buffer = vkBuf.GetBuffer();
-	barrier.offset = 0;
-	barrier.size = VK_WHOLE_SIZE;
+void VulkanCommandList::WaitForQueue(const QueueWait &wait) {
+	m_PendingWaits.push_back(wait);
+}
 
-	vkCmdPipelineBarrier(m_CommandBuffer, src.stage, dst.stage, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+std::vector<QueueWait> VulkanCommandList::TakePendingWaits() {
+	return std::exchange(m_PendingWaits, {});
+}
+
+void VulkanCommandList::Retarget(VkCommandBuffer commandBuffer) {
+	AQUILA_ASSERT(!m_IsRecording, "Cannot retarget a recording command list");
+	if (m_HomeCommandBuffer == VK_NULL_HANDLE) {
+		m_HomeCommandBuffer = m_CommandBuffer;
+	}
+	m_CommandBuffer = commandBuffer;
+}
+
+void VulkanCommandList::RestoreHomeBuffer() {
+	if (m_HomeCommandBuffer != VK_NULL_HANDLE) {
+		m_CommandBuffer = m_HomeCommandBuffer;
+		m_HomeCommandBuffer = VK_NULL_HANDLE;
+	}
 }
 
 // Pipeline and state
@@ -310,11 +519,13 @@ void VulkanCommandList::SetScissor(int32 x, int32 y, uint32 width, uint32 height
 
 // Resource binding
 
-void VulkanCommandList::BindDescriptorSet(uint32 set, IRHIDescriptorSet &descriptorSet) {
+void VulkanCommandList::BindDescriptorSet(uint32 set, IRHIDescriptorSet &descriptorSet,
+										  std::span<const uint32> dynamicOffsets) {
 	AQUILA_ASSERT(m_BoundPipelineLayout != VK_NULL_HANDLE, "BindDescriptorSet called before BindPipeline");
 	auto &vkSet = static_cast<VulkanDescriptorSet &>(descriptorSet);
 	VkDescriptorSet raw = vkSet.GetDescriptorSet();
-	vkCmdBindDescriptorSets(m_CommandBuffer, m_BoundBindPoint, m_BoundPipelineLayout, set, 1, &raw, 0, nullptr);
+	vkCmdBindDescriptorSets(m_CommandBuffer, m_BoundBindPoint, m_BoundPipelineLayout, set, 1, &raw,
+							static_cast<uint32>(dynamicOffsets.size()), dynamicOffsets.data());
 }
 
 void VulkanCommandList::PushConstants(const void *data, uint32 size, ShaderStageFlags stages, uint32 offset) {
@@ -357,12 +568,12 @@ void VulkanCommandList::DrawIndexedIndirect(IRHIBuffer &buffer, uint64 offset, u
 }
 
 void VulkanCommandList::CopyBufferToTexture(IRHIBuffer &src, IRHITexture &dst, uint32 width, uint32 height,
-											uint32 dstArrayLayer, uint32 dstMipLevel) {
+											uint32 dstArrayLayer, uint32 dstMipLevel, uint64 srcOffset) {
 	auto &vkBuf = static_cast<VulkanBuffer &>(src);
 	auto &vkTex = static_cast<VulkanTexture &>(dst);
 
 	VkBufferImageCopy region{};
-	region.bufferOffset = 0;
+	region.bufferOffset = static_cast<VkDeviceSize>(srcOffset);
 	region.bufferRowLength = 0;
 	region.bufferImageHeight = 0;
 	region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
@@ -407,4 +618,22 @@ void VulkanCommandList::PopDebugGroup() {
 	}
 }
 
+// Secondary command lists
+
+void VulkanCommandList::ExecuteSecondary(std::span<IRHICommandList *const> secondaries) {
+	AQUILA_ASSERT(!m_IsSecondary, "ExecuteSecondary called on a secondary command list");
+	if (secondaries.empty()) {
+		return;
+	}
+
+	std::vector<VkCommandBuffer> handles;
+	handles.reserve(secondaries.size());
+	for (IRHICommandList *secondary : secondaries) {
+		AQUILA_ASSERT(secondary->IsSecondary() && !secondary->IsRecording(),
+					  "ExecuteSecondary expects finished secondary command lists");
+		handles.push_back(static_cast<VulkanCommandList *>(secondary)->GetHandle());
+	}
+	vkCmdExecuteCommands(m_CommandBuffer, static_cast<uint32>(handles.size()), handles.data());
+}
+
 } // namespace Aquila::RHI
@@ -12,8 +12,6 @@ VulkanComputePipeline::VulkanComputePipeline(VulkanDevice &device, VkShaderModul
 	AQUILA_ASSERT(module != VK_NULL_HANDLE, "VulkanComputePipeline requires a valid VkShaderModule");
 	AQUILA_ASSERT(layout != VK_NULL_HANDLE, "VulkanComputePipeline requires a valid VkPipelineLayout");
 
-	CreatePipelineCache();
-
 	VkPipelineShaderStageCreateInfo stageInfo{};
 	stageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
 	stageInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
@@ -25,8 +23,8 @@ VulkanComputePipeline::VulkanComputePipeline(VulkanDevice &device, VkShaderModul
 	pipelineInfo.stage = stageInfo;
 	pipelineInfo.layout = layout;
 
-	AQUILA_VULKAN_CHECK(
-		vkCreateComputePipelines(m_Device.GetDevice(), m_PipelineCache, 1, &pipelineInfo, nullptr, &m_Pipeline));
+	AQUILA_VULKAN_CHECK(vkCreateComputePipelines(m_Device.GetDevice(), m_Device.GetPipelineCache(), 1, &pipelineInfo,
+												 nullptr, &m_Pipeline));
 }
 
 VulkanComputePipeline::~VulkanComputePipeline() {
@@ -39,20 +37,10 @@ VulkanComputePipeline::~VulkanComputePipeline() {
 		dq.QueueDeletion(m_Layout);
 		m_Layout = VK_NULL_HANDLE;
 	}
-	if (m_PipelineCache != VK_NULL_HANDLE) {
-		dq.QueueDeletion(m_PipelineCache);
-		m_PipelineCache = VK_NULL_HANDLE;
-	}
 }
 
 void VulkanComputePipeline::Bind(IRHICommandList &cmd) {
 	vkCmdBindPipeline(static_cast<VulkanCommandList &>(cmd).GetHandle(), VK_PIPELINE_BIND_POINT_COMPUTE, m_Pipeline);
 }
 
-void VulkanComputePipeline::CreatePipelineCache() {
-	VkPipelineCacheCreateInfo cacheInfo{};
-	cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-	AQUILA_VULKAN_CHECK(vkCreatePipelineCache(m_Device.GetDevice(), &cacheInfo, nullptr, &m_PipelineCache));
-}
-
 } // namespace Aquila::RHI
@@ -11,10 +11,12 @@ DeletionQueue::~DeletionQueue() {
 
 void DeletionQueue::SetCurrentSlot(uint32 slot) {
 	AQUILA_ASSERT(slot < SharedConstants::MAX_FRAMES_IN_FLIGHT, "DeletionQueue slot out of range");
+	std::lock_guard lock(m_Mutex);
 	m_CurrentSlot = slot;
 }
 
 void DeletionQueue::QueueDeletion(const Deletion::ResourceVariant &resource) {
+	std::lock_guard lock(m_Mutex);
 	m_Buckets[m_CurrentSlot].push_back(resource);
 }
 
@@ -24,10 +26,14 @@ void DeletionQueue::DestroyNow(const Deletion::ResourceVariant &resource) {
 
 void DeletionQueue::Flush(uint32 slot) {
 	AQUILA_ASSERT(slot < SharedConstants::MAX_FRAMES_IN_FLIGHT, "DeletionQueue slot out of range");
-	for (auto &resource : m_Buckets[slot]) {
+	std::vector<Deletion::ResourceVariant> bucket;
+	{
+		std::lock_guard lock(m_Mutex);
+		bucket.swap(m_Buckets[slot]);
+	}
+	for (auto &resource : bucket) {
 		Dispatch(resource);
 	}
-	m_Buckets[slot].clear();
 }
 
 void DeletionQueue::FlushAll() {
@@ -40,7 +40,7 @@ void VulkanDescriptorSet::SetBuffer(uint32 binding, IRHIBuffer &buffer, uint64 o
 	m_PendingWrites.push_back(write);
 }
 
-void VulkanDescriptorSet::SetTexture(uint32 binding, IRHITexture &texture) {
+void VulkanDescriptorSet::SetTexture(uint32 binding, IRHITexture &texture, uint32 arrayElement) {
 	auto &vkTex = static_cast<VulkanTexture &>(texture);
 
 	VkSampler sampler = m_Device.GetOrCreateSampler(vkTex.GetDesc().sampler);
@@ -54,7 +54,7 @@ void VulkanDescriptorSet::SetTexture(uint32 binding, IRHITexture &texture) {
 	write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 	write.dstSet = m_Set;
 	write.dstBinding = binding;
-	write.dstArrayElement = 0;
+	write.dstArrayElement = arrayElement;
 	write.descriptorCount = 1;
 	write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
 	write.pImageInfo = nullptr; // fixed up in Flush()
@@ -72,7 +72,9 @@ void VulkanDescriptorSet::Flush() {
 
 	for (auto &write : m_PendingWrites) {
 		if (write.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ||
-			write.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER) {
+			write.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER ||
+			write.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC ||
+			write.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC) {
 			write.pBufferInfo = &m_BufferInfos[bufferIdx++];
 		} else {
 			write.pImageInfo = &m_ImageInfos[imageIdx++];
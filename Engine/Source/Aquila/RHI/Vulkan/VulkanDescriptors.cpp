@@ -3,10 +3,10 @@
 
 namespace Aquila::RHI {
 
-VulkanDescriptorSetLayout::Builder &VulkanDescriptorSetLayout::Builder::AddBinding(uint32 binding,
-																				   VkDescriptorType descriptorType,
-																				   VkShaderStageFlags stageFlags,
-																				   uint32 count) {
+VulkanDescriptorSetLayout::Builder &
+VulkanDescriptorSetLayout::Builder::AddBinding(uint32 binding, VkDescriptorType descriptorType,
+											   VkShaderStageFlags stageFlags, uint32 count,
+											   VkDescriptorBindingFlags bindingFlags) {
 	AQUILA_ASSERT(!m_Bindings.contains(binding), "Binding already in use");
 	VkDescriptorSetLayoutBinding layoutBinding{};
 	layoutBinding.binding = binding;
@@ -14,26 +14,43 @@ VulkanDescriptorSetLayout::Builder &VulkanDescriptorSetLayout::Builder::AddBindi
 	layoutBinding.descriptorCount = count;
 	layoutBinding.stageFlags = stageFlags;
 	m_Bindings[binding] = layoutBinding;
+	if (bindingFlags != 0) {
+		m_BindingFlags[binding] = bindingFlags;
+	}
 	return *this;
 }
 
 Unique<VulkanDescriptorSetLayout> VulkanDescriptorSetLayout::Builder::Build() const {
-	return CreateUnique<VulkanDescriptorSetLayout>(m_Device, m_Bindings);
+	return CreateUnique<VulkanDescriptorSetLayout>(m_Device, m_Bindings, m_BindingFlags);
 }
 
-VulkanDescriptorSetLayout::VulkanDescriptorSetLayout(VulkanDevice &device,
-													 std::unordered_map<uint32, VkDescriptorSetLayoutBinding> bindings)
+VulkanDescriptorSetLayout::VulkanDescriptorSetLayout(
+	VulkanDevice &device, std::unordered_map<uint32, VkDescriptorSetLayoutBinding> bindings,
+	const std::unordered_map<uint32, VkDescriptorBindingFlags> &bindingFlags)
 	: m_Device(device), m_Bindings(std::move(bindings)) {
 	std::vector<VkDescriptorSetLayoutBinding> flatBindings;
+	std::vector<VkDescriptorBindingFlags> flatFlags;
 	flatBindings.reserve(m_Bindings.size());
-	for (auto &val : m_Bindings | std::views::values) {
+	flatFlags.reserve(m_Bindings.size());
+	for (auto &[binding, val] : m_Bindings) {
 		flatBindings.push_back(val);
+		auto it = bindingFlags.find(binding);
+		flatFlags.push_back(it != bindingFlags.end() ? it->second : 0);
 	}
 
 	VkDescriptorSetLayoutCreateInfo info{};
 	info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
 	info.bindingCount = static_cast<uint32>(flatBindings.size());
 	info.pBindings = flatBindings.data();
+
+	// Parallel to pBindings; only chained when a binding asked for descriptor-indexing behaviour.
+	VkDescriptorSetLayoutBindingFlagsCreateInfo flagsInfo{};
+	if (!bindingFlags.empty()) {
+		flagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+		flagsInfo.bindingCount = static_cast<uint32>(flatFlags.size());
+		flagsInfo.pBindingFlags = flatFlags.data();
+		info.pNext = &flagsInfo;
+	}
 	AQUILA_VULKAN_CHECK(vkCreateDescriptorSetLayout(m_Device.GetDevice(), &info, nullptr, &m_DescriptorSetLayout));
 }
 
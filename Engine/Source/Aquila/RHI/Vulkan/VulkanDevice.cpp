@@ -1,6 +1,7 @@
 #include "Aquila/RHI/Vulkan/VulkanDevice.h"
 #include "Aquila/RHI/Vulkan/VulkanDeletionQueue.h"
 #include "Aquila/Foundation/Profiler.h"
+#include "Aquila/Platform/Filesystem/Filesystem.h"
 
 #include "Aquila/RHI/Vulkan/VulkanBuffer.h"
 #include "Aquila/RHI/Vulkan/VulkanCommandList.h"
@@ -9,6 +10,7 @@
 #include "Aquila/RHI/Vulkan/VulkanDescriptors.h"
 #include "Aquila/RHI/Vulkan/VulkanFormatUtils.h"
 #include "Aquila/RHI/Vulkan/VulkanPipeline.h"
+#include "Aquila/RHI/Vulkan/VulkanPipelineCache.h"
 #include "Aquila/RHI/Vulkan/VulkanRenderPass.h"
 #include "Aquila/RHI/Vulkan/VulkanShader.h"
 #include "Aquila/RHI/Vulkan/VulkanSwapchain.h"
@@ -17,15 +19,46 @@
 
 namespace Aquila::RHI {
 
+namespace {
+
+uint32 TimelineIndex(CommandListType queue) {
+	switch (queue) {
+	case CommandListType::Compute:
+		return 1u;
+	case CommandListType::Transfer:
+		return 2u;
+	default:
+		return 0u;
+	}
+}
+
+// Stages of the waiting submission that are held back by a QueueWait
+VkPipelineStageFlags2 WaitStages(PipelineScope scope) {
+	switch (scope) {
+	case PipelineScope::Graphics:
+		return VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT |
+			VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
+	case PipelineScope::Compute:
+		return VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_2_COPY_BIT | VK_PIPELINE_STAGE_2_CLEAR_BIT;
+	case PipelineScope::All:
+	default:
+		return VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+	}
+}
+
+} // namespace
+
 VulkanDevice::VulkanDevice(GLFWwindow &nativeWindow) : m_WindowHandle(nativeWindow) {
 	CreateInstance();
 	CreateSurface();
 	PickPhysicalDevice();
 	CreateLogicalDevice();
+	CreateQueueTimelines();
 
 	InitializeVMA();
 
 	m_DeletionQueue = CreateUnique<RHI::DeletionQueue>(*this);
+	CreatePipelineCache();
 
 	CreateGraphicsCommandPool();
 	CreateComputeCommandPool();
@@ -55,6 +88,7 @@ VulkanDevice::~VulkanDevice() {
 	}
 
 	m_DeletionQueue.reset();
+	m_PipelineCache.reset(); // saves to disk
 
 	DestroySamplerCache();
 	DestroyGlobalDescriptorPool();
@@ -67,13 +101,27 @@ VulkanDevice::~VulkanDevice() {
 		}
 	}
 
+	for (auto &slotPools : m_SecondaryPools) {
+		for (auto &[id, secondary] : slotPools) {
+			vkDestroyCommandPool(m_Device, secondary.pool, nullptr);
+		}
+	}
+
 	for (uint32 i = 0; i < SharedConstants::MAX_FRAMES_IN_FLIGHT; ++i) {
 		vkDestroyCommandPool(m_Device, m_FrameSlots[i].pool, nullptr);
+		if (m_FrameSlots[i].computePool != VK_NULL_HANDLE) {
+			vkDestroyCommandPool(m_Device, m_FrameSlots[i].computePool, nullptr);
+		}
+	}
+
+	for (VkSemaphore timeline : m_QueueTimelines) {
+		vkDestroySemaphore(m_Device, timeline, nullptr);
 	}
 
 	vkDestroyCommandPool(m_Device, m_GraphicsCommandPool, nullptr);
 	vkDestroyCommandPool(m_Device, m_ComputeCommandPool, nullptr);
 	vkDestroyCommandPool(m_Device, m_TransferCommandPool, nullptr);
+	vkDestroyCommandPool(m_Device, m_UploadCommandPool, nullptr);
 
 	vkDestroyDevice(m_Device, nullptr);
 
@@ -93,7 +141,8 @@ Unique<IRHIBuffer> VulkanDevice::CreateBuffer(const BufferDesc &desc) {
 		vkUsage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
 	}
 	return CreateUnique<VulkanBuffer>(*this, desc.debugName, static_cast<VkDeviceSize>(desc.size), desc.instanceCount,
-									  vkUsage, desc.domain, static_cast<VkDeviceSize>(desc.minAlignment));
+									  vkUsage, desc.domain, static_cast<VkDeviceSize>(desc.minAlignment),
+									  desc.transferQueueShared);
 }
 
 Unique<IRHITexture> VulkanDevice::CreateTexture(const TextureDesc &desc) {
@@ -245,29 +294,26 @@ void VulkanDevice::SubmitFrame(IRHICommandList &cmd, IRHISwapchain *swapchain, u
 		cmd.End();
 	}
 
-	VkSubmitInfo submitInfo{};
-	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-	submitInfo.commandBufferCount = 1;
-	submitInfo.pCommandBuffers = &cmdBuf;
-
 	if (swapchain != nullptr) {
 		auto &vkSwapchain = static_cast<VulkanSwapchain &>(*swapchain);
 		uint32 lastFrame = vkSwapchain.GetCurrentFrameSlot();
-		VkSemaphore imageAvailable = vkSwapchain.GetImageAvailableSemaphore(lastFrame);
-		VkSemaphore renderFinished = vkSwapchain.GetRenderFinishedSemaphore(lastFrame);
 
-		VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-		submitInfo.waitSemaphoreCount = 1;
-		submitInfo.pWaitSemaphores = &imageAvailable;
-		submitInfo.pWaitDstStageMask = &waitStage;
-		submitInfo.signalSemaphoreCount = 1;
-		submitInfo.pSignalSemaphores = &renderFinished;
+		VkSemaphoreSubmitInfo imageAvailable{};
+		imageAvailable.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+		imageAvailable.semaphore = vkSwapchain.GetImageAvailableSemaphore(lastFrame);
+		imageAvailable.stageMask = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+
+		VkSemaphoreSubmitInfo renderFinished{};
+		renderFinished.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+		renderFinished.semaphore = vkSwapchain.GetRenderFinishedSemaphore(lastFrame);
+		renderFinished.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
 
 		VkFence fence = vkSwapchain.GetInFlightFence(lastFrame);
 		{
 			vkResetFences(m_Device, 1, &fence);
 			PROFILE_SCOPE("QueueSubmit");
-			SubmitToGraphicsQueue(&submitInfo, fence);
+			(void)SubmitTimeline(CommandListType::Graphics, vkCmd, { &imageAvailable, 1 }, { &renderFinished, 1 },
+								 fence);
 			vkSwapchain.MarkSlotSubmitted(lastFrame);
 		}
 		bool isFrameManaged = false;
@@ -283,11 +329,12 @@ void VulkanDevice::SubmitFrame(IRHICommandList &cmd, IRHISwapchain *swapchain, u
 
 		{
 			PROFILE_SCOPE("QueuePresent");
-			vkSwapchain.PresentImageRaw(&imageIndex, renderFinished);
+			vkSwapchain.PresentImageRaw(&imageIndex, renderFinished.semaphore);
 		}
 	} else {
 		uint32 slot = m_OffscreenFrameIndex;
 		vkWaitForFences(m_Device, 1, &m_OffscreenFences[slot], VK_TRUE, UINT64_MAX);
+		WaitForAsyncCompute(slot);
 		for (auto &p : m_OffscreenPendingCmdBufs[slot]) {
 			vkFreeCommandBuffers(m_Device, p.pool, 1, &p.cmd);
 		}
@@ -296,18 +343,189 @@ void VulkanDevice::SubmitFrame(IRHICommandList &cmd, IRHISwapchain *swapchain, u
 		m_DeletionQueue->Flush(slot);
 
 		vkResetFences(m_Device, 1, &m_OffscreenFences[slot]);
-		SubmitToGraphicsQueue(&submitInfo, m_OffscreenFences[slot]);
+		(void)SubmitTimeline(CommandListType::Graphics, vkCmd, {}, {}, m_OffscreenFences[slot]);
 		m_OffscreenPendingCmdBufs[slot].push_back({ cmdBuf, vkCmd.GetPool() });
 
 		m_OffscreenFrameIndex = (slot + 1) % SharedConstants::MAX_FRAMES_IN_FLIGHT;
 		m_DeletionQueue->SetCurrentSlot(m_OffscreenFrameIndex);
 	}
+
+	vkCmd.RestoreHomeBuffer();
+}
+
+uint64 VulkanDevice::SubmitAsyncCompute(IRHICommandList &cmd) {
+	AQUILA_ASSERT(cmd.GetType() == CommandListType::Compute, "Not an async compute list");
+	auto &vkCmd = static_cast<VulkanCommandList &>(cmd);
+	cmd.End();
+
+	const uint64 value = SubmitTimeline(CommandListType::Compute, vkCmd, {}, {}, VK_NULL_HANDLE);
+	m_FrameSlots[m_RecordingSlot].computeValue = value;
+	return value;
+}
+
+uint64 VulkanDevice::SubmitTransfer(IRHICommandList &cmd) {
+	AQUILA_ASSERT(cmd.GetType() == CommandListType::Transfer, "Not a transfer list");
+	auto &vkCmd = static_cast<VulkanCommandList &>(cmd);
+	cmd.End();
+	return SubmitTimeline(CommandListType::Transfer, vkCmd, {}, {}, VK_NULL_HANDLE);
+}
+
+uint64 VulkanDevice::FlushFrameCommandList(IRHICommandList &cmd) {
+	auto &vkCmd = static_cast<VulkanCommandList &>(cmd);
+	FrameCommandSlot &slot = m_FrameSlots[m_RecordingSlot];
+	AQUILA_ASSERT(vkCmd.GetPool() == slot.pool, "Only the current frame command list can be flushed");
+
+	cmd.End();
+	const uint64 value = SubmitTimeline(CommandListType::Graphics, vkCmd, {}, {}, VK_NULL_HANDLE);
+
+	if (slot.extraUsed == slot.extra.size()) {
+		VkCommandBufferAllocateInfo allocInfo{};
+		allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		allocInfo.commandPool = slot.pool;
+		allocInfo.commandBufferCount = 1;
+
+		VkCommandBuffer fresh = VK_NULL_HANDLE;
+		AQUILA_VULKAN_CHECK(vkAllocateCommandBuffers(m_Device, &allocInfo, &fresh));
+		slot.extra.push_back(fresh);
+	}
+	vkCmd.Retarget(slot.extra[slot.extraUsed++]);
+	cmd.Begin();
+	return value;
+}
+
+uint64 VulkanDevice::GetLastSubmittedValue(CommandListType queue) const {
+	return m_QueueTimelineValues[TimelineIndex(queue)];
+}
+
+uint64 VulkanDevice::GetCompletedValue(CommandListType queue) const {
+	uint64 value = 0;
+	AQUILA_VULKAN_CHECK(vkGetSemaphoreCounterValue(m_Device, m_QueueTimelines[TimelineIndex(queue)], &value));
+	return value;
+}
+
+void VulkanDevice::WaitForTimeline(CommandListType queue, uint64 value) {
+	if (value == 0) {
+		return;
+	}
+
+	VkSemaphoreWaitInfo waitInfo{};
+	waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+	waitInfo.semaphoreCount = 1;
+	waitInfo.pSemaphores = &m_QueueTimelines[TimelineIndex(queue)];
+	waitInfo.pValues = &value;
+	AQUILA_VULKAN_CHECK(vkWaitSemaphores(m_Device, &waitInfo, UINT64_MAX));
+}
+
+void VulkanDevice::WaitForAsyncCompute(uint32 slot) {
+	WaitForTimeline(CommandListType::Compute, m_FrameSlots[slot].computeValue);
+}
+
+uint32 VulkanDevice::GetDistinctQueueFamilies(std::array<uint32, 3> &out) const {
+	uint32 count = 0;
+	for (uint32 family : { m_GraphicsFamily, m_ComputeFamily, m_TransferFamily }) {
+		if (std::find(out.begin(), out.begin() + count, family) == out.begin() + count) {
+			out[count++] = family;
+		}
+	}
+	return count;
+}
+
+uint32 VulkanDevice::GetQueueFamilyIndex(CommandListType queue) const {
+	switch (queue) {
+	case CommandListType::Compute:
+		return m_ComputeFamily;
+	case CommandListType::Transfer:
+		return m_TransferFamily;
+	default:
+		return m_GraphicsFamily;
+	}
+}
+
+// Submits `cmd` on `queue`, waiting on the list's pending QueueWaits plus `extraWaits`,
+// and signals the queue timeline (plus `extraSignals`). Returns the signalled value.
+uint64 VulkanDevice::SubmitTimeline(CommandListType queue, VulkanCommandList &cmd,
+									std::span<const VkSemaphoreSubmitInfo> extraWaits,
+									std::span<const VkSemaphoreSubmitInfo> extraSignals, VkFence fence) {
+	std::vector<VkSemaphoreSubmitInfo> waits(extraWaits.begin(), extraWaits.end());
+	for (const QueueWait &wait : cmd.TakePendingWaits()) {
+		VkSemaphoreSubmitInfo &info = waits.emplace_back();
+		info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+		info.semaphore = m_QueueTimelines[TimelineIndex(wait.queue)];
+		info.value = wait.value;
+		info.stageMask = WaitStages(wait.scope);
+	}
+
+	const uint32 index = TimelineIndex(queue);
+	std::vector<VkSemaphoreSubmitInfo> signals(extraSignals.begin(), extraSignals.end());
+	VkSemaphoreSubmitInfo &timeline = signals.emplace_back();
+	timeline.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+	timeline.semaphore = m_QueueTimelines[index];
+	timeline.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+
+	VkCommandBufferSubmitInfo cmdInfo{};
+	cmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+	cmdInfo.commandBuffer = cmd.GetHandle();
+
+	VkSubmitInfo2 submitInfo{};
+	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+	submitInfo.waitSemaphoreInfoCount = static_cast<uint32>(waits.size());
+	submitInfo.pWaitSemaphoreInfos = waits.data();
+	submitInfo.commandBufferInfoCount = 1;
+	submitInfo.pCommandBufferInfos = &cmdInfo;
+	submitInfo.signalSemaphoreInfoCount = static_cast<uint32>(signals.size());
+	submitInfo.pSignalSemaphoreInfos = signals.data();
+
+	VkQueue vkQueue = m_GraphicsQueue;
+	if (queue == CommandListType::Compute) {
+		vkQueue = m_ComputeQueue;
+	} else if (queue == CommandListType::Transfer) {
+		vkQueue = m_TransferQueue;
+	}
+
+	std::lock_guard<std::mutex> lock(QueueMutex(vkQueue));
+	timeline.value = ++m_QueueTimelineValues[index];
+	AQUILA_VULKAN_CHECK(vkQueueSubmit2(vkQueue, 1, &submitInfo, fence));
+	return timeline.value;
+}
+
+void VulkanDevice::CreateQueueTimelines() {
+	VkSemaphoreTypeCreateInfo typeInfo{};
+	typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+	typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+	typeInfo.initialValue = 0;
+
+	VkSemaphoreCreateInfo createInfo{};
+	createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+	createInfo.pNext = &typeInfo;
+
+	for (VkSemaphore &timeline : m_QueueTimelines) {
+		AQUILA_VULKAN_CHECK(vkCreateSemaphore(m_Device, &createInfo, nullptr, &timeline));
+	}
+	SetObjectDebugName(VK_OBJECT_TYPE_SEMAPHORE, reinterpret_cast<uint64>(m_QueueTimelines[0]), "GraphicsTimeline");
+	SetObjectDebugName(VK_OBJECT_TYPE_SEMAPHORE, reinterpret_cast<uint64>(m_QueueTimelines[1]), "ComputeTimeline");
+	SetObjectDebugName(VK_OBJECT_TYPE_SEMAPHORE, reinterpret_cast<uint64>(m_QueueTimelines[2]), "TransferTimeline");
 }
 
 RHI::DeletionQueue &VulkanDevice::GetDeletionQueue() const {
 	return *m_DeletionQueue;
 }
 
+VkPipelineCache VulkanDevice::GetPipelineCache() const {
+	return m_PipelineCache->GetHandle();
+}
+
+void VulkanDevice::CreatePipelineCache() {
+	VkPhysicalDeviceProperties properties{};
+	vkGetPhysicalDeviceProperties(m_PhysicalDevice, &properties);
+
+	// Named per GPU, so a machine switching between two adapters keeps both caches warm.
+	const std::string path = Platform::Filesystem::PathJoin(
+		Platform::Filesystem::DirGetUserCache(),
+		std::format("pipelines_{:04x}_{:04x}.bin", properties.vendorID, properties.deviceID));
+	m_PipelineCache = CreateUnique<VulkanPipelineCache>(m_Device, properties, path);
+}
+
 void VulkanDevice::CopyBuffer(IRHICommandList &cmd, IRHIBuffer &src, IRHIBuffer &dst, uint64 size, uint64 srcOffset,
 							  uint64 dstOffset) {
 	auto &vkCmd = static_cast<VulkanCommandList &>(cmd);
@@ -422,8 +640,8 @@ Unique<IRHIPipeline> VulkanDevice::CreateGraphicsPipeline(const GraphicsPipeline
 			config.attributeDescriptions.push_back({ a.location, a.binding, ToVkFormat(a.format), a.offset });
 		}
 	} else {
-		config.bindingDescriptions = Vertex::GetBindingDescriptions();
-		config.attributeDescriptions = Vertex::GetAttributeDescriptions();
+		config.bindingDescriptions = PackedVertex::GetBindingDescriptions();
+		config.attributeDescriptions = PackedVertex::GetAttributeDescriptions();
 	}
 	auto pipeline = CreateUnique<VulkanPipeline>(*this, stages, config);
 
@@ -473,7 +691,9 @@ Unique<IRHIPipeline> VulkanDevice::CreateComputePipeline(const ComputePipelineDe
 Unique<IRHIDescriptorSetLayout> VulkanDevice::CreateDescriptorSetLayout(const DescriptorSetLayoutDesc &desc) {
 	VulkanDescriptorSetLayout::Builder builder(*this);
 	for (const auto &b : desc.bindings) {
-		builder.AddBinding(b.binding, ToVkDescriptorType(b.type), ToVkShaderStage(b.stages), b.count);
+		const VkDescriptorBindingFlags flags =
+			b.partiallyBound && m_DescriptorIndexing ? VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT : 0;
+		builder.AddBinding(b.binding, ToVkDescriptorType(b.type), ToVkShaderStage(b.stages), b.count, flags);
 	}
 	return builder.Build();
 }
@@ -490,7 +710,10 @@ Unique<IRHIDescriptorSet> VulkanDevice::AllocateDescriptorSet(IRHIDescriptorSetL
 void VulkanDevice::CreateGlobalDescriptorPool() {
 	std::vector<VkDescriptorPoolSize> poolSizes = {
 		{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1000 },		 { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1000 },
-		{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1000 }, { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 256 },
+		{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1000 }, { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 64 },
+		{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+		  1000 + SharedConstants::MAX_BINDLESS_TEXTURES * SharedConstants::MAX_FRAMES_IN_FLIGHT },
+		{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 256 },
 		{ VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 64 },
 	};
 	m_GlobalPool =
@@ -532,6 +755,7 @@ void VulkanDevice::CreateTransferCommandPool() {
 	poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
 
 	AQUILA_VULKAN_CHECK(vkCreateCommandPool(m_Device, &poolInfo, nullptr, &m_TransferCommandPool));
+	AQUILA_VULKAN_CHECK(vkCreateCommandPool(m_Device, &poolInfo, nullptr, &m_UploadCommandPool));
 }
 
 void VulkanDevice::CreateFrameCommandPools() {
@@ -555,11 +779,94 @@ void VulkanDevice::CreateFrameCommandPools() {
 		std::string name = "FrameCmd_" + std::to_string(i);
 		SetObjectDebugName(VK_OBJECT_TYPE_COMMAND_BUFFER, reinterpret_cast<uint64>(m_FrameSlots[i].cmd), name.c_str());
 	}
+
+	if (!HasAsyncCompute()) {
+		return;
+	}
+
+	VkCommandPoolCreateInfo computePoolInfo{};
+	computePoolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	computePoolInfo.queueFamilyIndex = indices.m_ComputeFamily.value();
+	computePoolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+	for (uint32 i = 0; i < SharedConstants::MAX_FRAMES_IN_FLIGHT; ++i) {
+		AQUILA_VULKAN_CHECK(vkCreateCommandPool(m_Device, &computePoolInfo, nullptr, &m_FrameSlots[i].computePool));
+	}
 }
 
 void VulkanDevice::ResetFrameCommandPool(uint32 slot) {
 	AQUILA_ASSERT(slot < SharedConstants::MAX_FRAMES_IN_FLIGHT, "Frame slot out of range");
-	vkResetCommandPool(m_Device, m_FrameSlots[slot].pool, 0);
+	FrameCommandSlot &frame = m_FrameSlots[slot];
+	vkResetCommandPool(m_Device, frame.pool, 0);
+	frame.extraUsed = 0;
+	if (frame.computePool != VK_NULL_HANDLE) {
+		vkResetCommandPool(m_Device, frame.computePool, 0);
+		frame.computeUsed = 0;
+	}
+
+	std::lock_guard<std::mutex> lock(m_SecondaryPoolMutex);
+	for (auto &[id, secondary] : m_SecondaryPools[slot]) {
+		vkResetCommandPool(m_Device, secondary.pool, 0);
+		secondary.used = 0;
+	}
+	m_RecordingSlot = slot;
+}
+
+Unique<IRHICommandList> VulkanDevice::CreateSecondaryCommandList(const SecondaryCommandListDesc &desc) {
+	VkCommandPool pool = VK_NULL_HANDLE;
+	VkCommandBuffer cmd = VK_NULL_HANDLE;
+	{
+		std::lock_guard<std::mutex> lock(m_SecondaryPoolMutex);
+		SecondaryPool &secondary = m_SecondaryPools[m_RecordingSlot][std::this_thread::get_id()];
+
+		if (secondary.pool == VK_NULL_HANDLE) {
+			VkCommandPoolCreateInfo poolInfo{};
+			poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+			poolInfo.queueFamilyIndex = FindQueueFamilies(m_PhysicalDevice).m_GraphicsFamily.value();
+			poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+			AQUILA_VULKAN_CHECK(vkCreateCommandPool(m_Device, &poolInfo, nullptr, &secondary.pool));
+		}
+
+		if (secondary.used == secondary.buffers.size()) {
+			VkCommandBufferAllocateInfo allocInfo{};
+			allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+			allocInfo.commandPool = secondary.pool;
+			allocInfo.commandBufferCount = 1;
+
+			VkCommandBuffer fresh = VK_NULL_HANDLE;
+			AQUILA_VULKAN_CHECK(vkAllocateCommandBuffers(m_Device, &allocInfo, &fresh));
+			secondary.buffers.push_back(fresh);
+		}
+
+		pool = secondary.pool;
+		cmd = secondary.buffers[secondary.used++];
+	}
+	return CreateUnique<VulkanCommandList>(*this, pool, cmd, desc);
+}
+
+Unique<IRHICommandList> VulkanDevice::CreateAsyncComputeCommandList() {
+	AQUILA_ASSERT(HasAsyncCompute(), "Device has no separate compute queue");
+	FrameCommandSlot &slot = m_FrameSlots[m_RecordingSlot];
+
+	if (slot.computeUsed == slot.computeBuffers.size()) {
+		VkCommandBufferAllocateInfo allocInfo{};
+		allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		allocInfo.commandPool = slot.computePool;
+		allocInfo.commandBufferCount = 1;
+
+		VkCommandBuffer fresh = VK_NULL_HANDLE;
+		AQUILA_VULKAN_CHECK(vkAllocateCommandBuffers(m_Device, &allocInfo, &fresh));
+		slot.computeBuffers.push_back(fresh);
+	}
+
+	VkCommandBuffer cmd = slot.computeBuffers[slot.computeUsed++];
+	return CreateUnique<VulkanCommandList>(*this, slot.computePool, cmd, CommandListType::Compute,
+										   "AsyncCompute_" + std::to_string(m_RecordingSlot));
+}
+
+Unique<IRHICommandList> VulkanDevice::CreateUploadCommandList(const std::string &name) {
+	return CreateUnique<VulkanCommandList>(*this, m_UploadCommandPool, CommandListType::Transfer, name);
 }
 
 Unique<IRHICommandList> VulkanDevice::CreateFrameCommandList(uint32 slot) {
@@ -568,32 +875,40 @@ Unique<IRHICommandList> VulkanDevice::CreateFrameCommandList(uint32 slot) {
 										   CommandListType::Graphics, "FrameCmd_" + std::to_string(slot));
 }
 
+std::mutex &VulkanDevice::QueueMutex(VkQueue queue) {
+	if (queue == m_GraphicsQueue) {
+		return m_GraphicsQueueMutex;
+	}
+	return queue == m_ComputeQueue ? m_ComputeQueueMutex : m_TransferQueueMutex;
+}
+
 void VulkanDevice::SubmitToComputeQueue(const VkSubmitInfo *submitInfo, VkFence fence) {
-	std::lock_guard<std::mutex> lock(m_ComputeQueueMutex);
+	std::lock_guard<std::mutex> lock(QueueMutex(m_ComputeQueue));
 	AQUILA_VULKAN_CHECK(vkQueueSubmit(m_ComputeQueue, 1, submitInfo, fence));
 }
 
 void VulkanDevice::SubmitToGraphicsQueue(const VkSubmitInfo *submitInfo, VkFence fence) {
-	std::lock_guard<std::mutex> lock(m_GraphicsQueueMutex);
+	std::lock_guard<std::mutex> lock(QueueMutex(m_GraphicsQueue));
 	AQUILA_VULKAN_CHECK(vkQueueSubmit(m_GraphicsQueue, 1, submitInfo, fence));
 }
 
 void VulkanDevice::SubmitToTransferQueue(const VkSubmitInfo *submitInfo, VkFence fence) {
-	std::lock_guard<std::mutex> lock(m_TransferQueueMutex);
+	std::lock_guard<std::mutex> lock(QueueMutex(m_TransferQueue));
 	AQUILA_VULKAN_CHECK(vkQueueSubmit(m_TransferQueue, 1, submitInfo, fence));
 }
 
 void VulkanDevice::WaitGraphicsQueueIdle() {
-	std::lock_guard<std::mutex> lock(m_GraphicsQueueMutex);
+	std::lock_guard<std::mutex> lock(QueueMutex(m_GraphicsQueue));
 	AQUILA_VULKAN_CHECK(vkQueueWaitIdle(m_GraphicsQueue));
 }
 
 void VulkanDevice::WaitTransferQueueIdle() {
-	std::lock_guard<std::mutex> lock(m_TransferQueueMutex);
+	std::lock_guard<std::mutex> lock(QueueMutex(m_TransferQueue));
 	AQUILA_VULKAN_CHECK(vkQueueWaitIdle(m_TransferQueue));
 }
 
 VkSampler VulkanDevice::GetOrCreateSampler(const SamplerDesc &desc) {
+	std::lock_guard lock(m_SamplerMutex);
 	auto it = m_SamplerCache.find(desc);
 	if (it != m_SamplerCache.end()) {
 		return it->second;
@@ -870,8 +1185,41 @@ void VulkanDevice::CreateLogicalDevice() {
 	dynamicRenderingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES;
 	dynamicRenderingFeatures.dynamicRendering = VK_TRUE;
 
+	VkPhysicalDeviceSynchronization2Features synchronization2Features{};
+	synchronization2Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES;
+	synchronization2Features.synchronization2 = VK_TRUE;
+	dynamicRenderingFeatures.pNext = &synchronization2Features;
+
+	VkPhysicalDeviceTimelineSemaphoreFeatures timelineSemaphoreFeatures{};
+	timelineSemaphoreFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
+	timelineSemaphoreFeatures.timelineSemaphore = VK_TRUE;
+	synchronization2Features.pNext = &timelineSemaphoreFeatures;
+
+	// Optional: the bindless texture array wants partially bound bindings. Without them it
+	// still works, every array element just has to be written with a valid descriptor.
+	VkPhysicalDeviceDescriptorIndexingFeatures supportedIndexing{};
+	supportedIndexing.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+	VkPhysicalDeviceFeatures2 supportedFeatures{};
+	supportedFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+	supportedFeatures.pNext = &supportedIndexing;
+	vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &supportedFeatures);
+
+	VkPhysicalDeviceDescriptorIndexingFeatures descriptorIndexingFeatures{};
+	descriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+	descriptorIndexingFeatures.descriptorBindingPartiallyBound = supportedIndexing.descriptorBindingPartiallyBound;
+	descriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing =
+		supportedIndexing.shaderSampledImageArrayNonUniformIndexing;
+	descriptorIndexingFeatures.runtimeDescriptorArray = supportedIndexing.runtimeDescriptorArray;
+	timelineSemaphoreFeatures.pNext = &descriptorIndexingFeatures;
+	m_DescriptorIndexing = supportedIndexing.descriptorBindingPartiallyBound == VK_TRUE;
+
 	VkPhysicalDeviceFeatures deviceFeatures{};
+	deviceFeatures.shaderSampledImageArrayDynamicIndexing =
+		supportedFeatures.features.shaderSampledImageArrayDynamicIndexing;
 	deviceFeatures.samplerAnisotropy = VK_TRUE;
+	// Optional: cooked textures fall back to uncompressed mips without it.
+	deviceFeatures.textureCompressionBC = supportedFeatures.features.textureCompressionBC;
+	m_BlockCompression = supportedFeatures.features.textureCompressionBC == VK_TRUE;
 	deviceFeatures.wideLines = VK_TRUE;
 	deviceFeatures.fillModeNonSolid = VK_TRUE;
 	deviceFeatures.independentBlend = VK_TRUE;
@@ -903,6 +1251,9 @@ void VulkanDevice::CreateLogicalDevice() {
 	}
 
 	bool computeSharesGraphics = indices.m_ComputeFamily.value() == indices.m_GraphicsFamily.value();
+	m_GraphicsFamily = indices.m_GraphicsFamily.value();
+	m_ComputeFamily = indices.m_ComputeFamily.value();
+	m_TransferFamily = indices.m_TransferFamily.value();
 
 	vkGetDeviceQueue(m_Device, indices.m_GraphicsFamily.value(), 0, &m_GraphicsQueue);
 	vkGetDeviceQueue(m_Device, indices.m_PresentFamily.value(), 0, &m_PresentQueue);
@@ -1108,6 +1459,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL VulkanDevice::DebugCallback(VkDebugUtilsMessageSe
 														   void *pUserData) {
 	if (messageSeverity >= VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) {
 		AQUILA_LOG_ERROR("Vulkan: {}", pCallbackData->pMessage);
+		s_ValidationErrors.fetch_add(1);
 	} else if (messageSeverity >= VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) {
 		AQUILA_LOG_WARNING("Vulkan: {}", pCallbackData->pMessage);
 	}
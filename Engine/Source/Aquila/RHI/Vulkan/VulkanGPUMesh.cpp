@@ -41,12 +41,13 @@ VulkanGPUMesh::~VulkanGPUMesh() {
 }
 
 void VulkanGPUMesh::UploadVertexBuffer(const std::vector<Vertex> &vertices) {
-	VkDeviceSize size = sizeof(Vertex) * vertices.size();
+	const std::vector<PackedVertex> packed = PackVertices(vertices);
+	VkDeviceSize size = sizeof(PackedVertex) * packed.size();
 
 	auto staging = m_Device.CreateBuffer<MemoryDomain::CPU_TO_GPU>(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
 																   (m_DebugName + "_VtxStaging").c_str());
 
-	memcpy(staging.mappedPtr, vertices.data(), size);
+	memcpy(staging.mappedPtr, packed.data(), size);
 
 	m_VertexAllocation = m_Device.CreateBuffer<MemoryDomain::GPU_ONLY>(
 		size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, (m_DebugName + "_Vtx").c_str());
@@ -9,7 +9,6 @@ namespace Aquila::RHI {
 VulkanPipeline::VulkanPipeline(VulkanDevice &device, const std::vector<VkPipelineShaderStageCreateInfo> &stages,
 							   const VulkanPipelineConfig &configInfo)
 	: m_Device(device), m_Layout(configInfo.pipelineLayout) {
-	CreatePipelineCache();
 	CreatePipelineFromStages(stages, configInfo);
 }
 
@@ -23,10 +22,6 @@ VulkanPipeline::~VulkanPipeline() {
 		dq.QueueDeletion(m_Layout);
 		m_Layout = VK_NULL_HANDLE;
 	}
-	if (m_PipelineCache != VK_NULL_HANDLE) {
-		dq.QueueDeletion(m_PipelineCache);
-		m_PipelineCache = VK_NULL_HANDLE;
-	}
 }
 
 void VulkanPipeline::Bind(IRHICommandList &cmd) {
@@ -92,14 +87,8 @@ void VulkanPipeline::CreatePipelineFromStages(const std::vector<VkPipelineShader
 	pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
 	pipelineInfo.basePipelineIndex = -1;
 
-	AQUILA_VULKAN_CHECK(vkCreateGraphicsPipelines(m_Device.GetDevice(), m_PipelineCache, 1, &pipelineInfo, nullptr,
-												  &m_GraphicsPipeline));
-}
-
-void VulkanPipeline::CreatePipelineCache() {
-	VkPipelineCacheCreateInfo cacheInfo{};
-	cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-	AQUILA_VULKAN_CHECK(vkCreatePipelineCache(m_Device.GetDevice(), &cacheInfo, nullptr, &m_PipelineCache));
+	AQUILA_VULKAN_CHECK(vkCreateGraphicsPipelines(m_Device.GetDevice(), m_Device.GetPipelineCache(), 1, &pipelineInfo,
+												  nullptr, &m_GraphicsPipeline));
 }
 
 void VulkanPipeline::DefaultPipelineConfig(VulkanPipelineConfig &configInfo) {
@@ -176,8 +165,8 @@ void VulkanPipeline::DefaultPipelineConfig(VulkanPipelineConfig &configInfo) {
 			configInfo.attributeDescriptions.push_back({ a.location, a.binding, ToVkFormat(a.format), a.offset });
 		}
 	} else {
-		configInfo.bindingDescriptions = Vertex::GetBindingDescriptions();
-		configInfo.attributeDescriptions = Vertex::GetAttributeDescriptions();
+		configInfo.bindingDescriptions = PackedVertex::GetBindingDescriptions();
+		configInfo.attributeDescriptions = PackedVertex::GetAttributeDescriptions();
 	}
 }
 
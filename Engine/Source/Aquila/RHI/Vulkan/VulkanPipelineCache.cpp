@@ -0,0 +1,104 @@
+#include "Aquila/RHI/Vulkan/VulkanPipelineCache.h"
+#include "Aquila/Foundation/Hash.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Platform/Filesystem/Filesystem.h"
+
+namespace Aquila::RHI {
+
+namespace {
+
+constexpr uint32 kMagic = 0x43505141; // "AQPC"
+constexpr uint32 kVersion = 1;
+
+struct FileHeader {
+	uint32 magic = kMagic;
+	uint32 version = kVersion;
+	uint32 driverVersion = 0;
+	uint32 dataSize = 0;
+	uint32 dataHash = 0;
+	uint32 reserved = 0;
+};
+
+uint32 HashBlob(const uint8 *data, usize size) {
+	return Foundation::HashFnv1a({ reinterpret_cast<const char *>(data), size });
+}
+
+} // namespace
+
+VulkanPipelineCache::VulkanPipelineCache(VkDevice device, const VkPhysicalDeviceProperties &properties,
+										 std::string path)
+	: m_Device(device), m_Properties(properties), m_Path(std::move(path)) {
+	std::vector<uint8> file;
+	if (Platform::Filesystem::FileReadAll(m_Path, file)) {
+		m_Loaded = Validate(file);
+		if (!m_Loaded) {
+			AQUILA_LOG_INFO("Pipeline cache '{}' is stale or from another device, starting empty", m_Path);
+		}
+	}
+
+	VkPipelineCacheCreateInfo cacheInfo{};
+	cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+	if (m_Loaded) {
+		cacheInfo.initialDataSize = file.size() - sizeof(FileHeader);
+		cacheInfo.pInitialData = file.data() + sizeof(FileHeader);
+	}
+	AQUILA_VULKAN_CHECK(vkCreatePipelineCache(m_Device, &cacheInfo, nullptr, &m_Cache));
+
+	if (m_Loaded) {
+		AQUILA_LOG_INFO("Loaded pipeline cache '{}' ({} KB)", m_Path, cacheInfo.initialDataSize / 1024);
+	}
+}
+
+VulkanPipelineCache::~VulkanPipelineCache() {
+	Save();
+	vkDestroyPipelineCache(m_Device, m_Cache, nullptr);
+}
+
+bool VulkanPipelineCache::Save() const {
+	usize size = 0;
+	if (vkGetPipelineCacheData(m_Device, m_Cache, &size, nullptr) != VK_SUCCESS || size == 0) {
+		return false;
+	}
+
+	std::vector<uint8> file(sizeof(FileHeader) + size);
+	if (vkGetPipelineCacheData(m_Device, m_Cache, &size, file.data() + sizeof(FileHeader)) != VK_SUCCESS) {
+		return false;
+	}
+	file.resize(sizeof(FileHeader) + size);
+
+	FileHeader header{};
+	header.driverVersion = m_Properties.driverVersion;
+	header.dataSize = static_cast<uint32>(size);
+	header.dataHash = HashBlob(file.data() + sizeof(FileHeader), size);
+	memcpy(file.data(), &header, sizeof(header));
+
+	if (!Platform::Filesystem::FileWriteAtomic(m_Path, file.data(), file.size())) {
+		AQUILA_LOG_WARNING("Failed to write pipeline cache '{}'", m_Path);
+		return false;
+	}
+	return true;
+}
+
+bool VulkanPipelineCache::Validate(const std::vector<uint8> &file) const {
+	if (file.size() < sizeof(FileHeader) + sizeof(VkPipelineCacheHeaderVersionOne)) {
+		return false;
+	}
+
+	FileHeader header{};
+	memcpy(&header, file.data(), sizeof(header));
+	const uint8 *blob = file.data() + sizeof(FileHeader);
+	const usize blobSize = file.size() - sizeof(FileHeader);
+	if (header.magic != kMagic || header.version != kVersion || header.driverVersion != m_Properties.driverVersion ||
+		header.dataSize != blobSize || header.dataHash != HashBlob(blob, blobSize)) {
+		return false;
+	}
+
+	// The driver checks this too, but some drivers have crashed on blobs from another GPU.
+	VkPipelineCacheHeaderVersionOne vkHeader{};
+	memcpy(&vkHeader, blob, sizeof(vkHeader));
+	return vkHeader.headerSize >= sizeof(vkHeader) && vkHeader.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+		vkHeader.vendorID == m_Properties.vendorID && vkHeader.deviceID == m_Properties.deviceID &&
+		memcmp(vkHeader.pipelineCacheUUID, m_Properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+} // namespace Aquila::RHI
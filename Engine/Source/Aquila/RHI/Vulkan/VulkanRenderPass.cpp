@@ -264,11 +264,16 @@ void VulkanRenderPass::Begin(IRHICommandList &cmd, IRHISwapchain *swapchain, uin
 									  .height = height,
 									  .colorAttachments = colorDescs,
 									  .depthAttachment = depthDesc,
+									  .secondaryContents = m_Desc.secondaryCommandLists,
 								  });
 
 	m_Width = width;
 	m_Height = height;
 
+	if (m_Desc.secondaryCommandLists) {
+		return; // secondaries set their own viewport/scissor
+	}
+
 	// Default full-attachment viewport and scissor — caller can override via
 	// cmd.SetViewport / cmd.SetScissor after Begin() returns.
 	VkViewport viewport{ 0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height), 0.0f, 1.0f };
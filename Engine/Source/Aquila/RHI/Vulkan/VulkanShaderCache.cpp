@@ -0,0 +1,250 @@
+#include "Aquila/RHI/Vulkan/VulkanShaderCache.h"
+#include "Aquila/RHI/Vulkan/VulkanShaderCompiler.h"
+#include "Aquila/Foundation/Hash.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Platform/Filesystem/Filesystem.h"
+#include "Aquila/Platform/Filesystem/VirtualFileSystem.h"
+
+namespace Aquila::RHI {
+
+namespace {
+
+constexpr uint32 kMagic = 0x43535141; // "AQSC"
+constexpr uint32 kVersion = 1;
+
+// Little helpers for the entry format. Reads past the end leave the reader failed.
+class BlobWriter {
+  public:
+	void U32(uint32 value) { Bytes(&value, sizeof(value)); }
+	void U64(uint64 value) { Bytes(&value, sizeof(value)); }
+	void String(const std::string &value) {
+		U32(static_cast<uint32>(value.size()));
+		Bytes(value.data(), value.size());
+	}
+	void Bytes(const void *data, usize size) {
+		const auto *bytes = static_cast<const uint8 *>(data);
+		m_Data.insert(m_Data.end(), bytes, bytes + size);
+	}
+	[[nodiscard]] const std::vector<uint8> &GetData() const { return m_Data; }
+
+  private:
+	std::vector<uint8> m_Data;
+};
+
+class BlobReader {
+  public:
+	explicit BlobReader(const std::vector<uint8> &data) : m_Data(data) {}
+
+	uint32 U32() {
+		uint32 value = 0;
+		Bytes(&value, sizeof(value));
+		return value;
+	}
+	uint64 U64() {
+		uint64 value = 0;
+		Bytes(&value, sizeof(value));
+		return value;
+	}
+	// An element count, rejected if the remaining bytes couldn't possibly hold that many.
+	uint32 Count(usize minElementSize) {
+		const uint32 count = U32();
+		if (static_cast<uint64>(count) * minElementSize > m_Data.size() - m_Offset) {
+			m_Failed = true;
+			return 0;
+		}
+		return count;
+	}
+	std::string String() {
+		std::string value(Count(1), '\0');
+		Bytes(value.data(), value.size());
+		return value;
+	}
+	void Bytes(void *out, usize size) {
+		if (m_Failed || m_Data.size() - m_Offset < size) {
+			m_Failed = true;
+			return;
+		}
+		memcpy(out, m_Data.data() + m_Offset, size);
+		m_Offset += size;
+	}
+	[[nodiscard]] bool Ok() const { return !m_Failed; }
+	[[nodiscard]] bool AtEnd() const { return m_Offset == m_Data.size(); }
+
+  private:
+	const std::vector<uint8> &m_Data;
+	usize m_Offset = 0;
+	bool m_Failed = false;
+};
+
+std::string EntryPath(uint64 key, const char *extension) {
+	return Platform::Filesystem::PathJoin(VulkanShaderCache::GetDirectory(), std::format("{:016x}{}", key, extension));
+}
+
+std::string ManifestPath(const std::string &path, uint64 configHash) {
+	return EntryPath(Foundation::HashFnv1a64(path, configHash), ".deps");
+}
+
+// Returns false when a dependency can no longer be read, which always means a recompile.
+bool ComputeKey(const std::string &source, uint64 configHash, const std::vector<std::string> &dependencies,
+				uint64 &outKey) {
+	uint64 key = Foundation::HashFnv1a64(source, Foundation::HashFnv1a64("source", configHash));
+	std::string contents;
+	for (const std::string &dependency : dependencies) {
+		if (!ReadShaderSource(dependency, contents)) {
+			return false;
+		}
+		key = Foundation::HashFnv1a64(dependency, key);
+		key = Foundation::HashFnv1a64(contents, key);
+	}
+	outKey = key;
+	return true;
+}
+
+void Serialize(BlobWriter &out, uint64 key, const std::vector<VulkanCompiledStage> &stages) {
+	out.U32(kMagic);
+	out.U32(kVersion);
+	out.U64(key);
+	out.U32(static_cast<uint32>(stages.size()));
+	for (const VulkanCompiledStage &stage : stages) {
+		out.U32(static_cast<uint32>(stage.stage));
+		out.String(stage.entryPointName);
+		out.U32(static_cast<uint32>(stage.spirv.size()));
+		out.Bytes(stage.spirv.data(), stage.spirv.size() * sizeof(uint32));
+		out.U32(static_cast<uint32>(stage.parameters.size()));
+		for (const VulkanReflectedParameter &param : stage.parameters) {
+			out.String(param.name);
+			out.U32(param.set);
+			out.U32(param.binding);
+			out.U32(param.isDescriptor ? 1u : 0u);
+			out.U32(static_cast<uint32>(param.type));
+			out.U32(static_cast<uint32>(param.fields.size()));
+			for (const VulkanReflectedField &field : param.fields) {
+				out.String(field.name);
+				out.U32(field.scalarType);
+				out.U32(field.columns);
+			}
+		}
+	}
+}
+
+bool Deserialize(BlobReader &in, uint64 key, std::vector<VulkanCompiledStage> &outStages) {
+	if (in.U32() != kMagic || in.U32() != kVersion || in.U64() != key) {
+		return false;
+	}
+
+	std::vector<VulkanCompiledStage> stages(in.Count(sizeof(uint32)));
+	for (VulkanCompiledStage &stage : stages) {
+		stage.stage = static_cast<VkShaderStageFlagBits>(in.U32());
+		stage.entryPointName = in.String();
+		stage.spirv.resize(in.Count(sizeof(uint32)));
+		in.Bytes(stage.spirv.data(), stage.spirv.size() * sizeof(uint32));
+		stage.parameters.resize(in.Count(sizeof(uint32)));
+		for (VulkanReflectedParameter &param : stage.parameters) {
+			param.name = in.String();
+			param.set = in.U32();
+			param.binding = in.U32();
+			param.isDescriptor = in.U32() != 0;
+			param.type = static_cast<DescriptorType>(in.U32());
+			param.fields.resize(in.Count(sizeof(uint32)));
+			for (VulkanReflectedField &field : param.fields) {
+				field.name = in.String();
+				field.scalarType = in.U32();
+				field.columns = in.U32();
+			}
+		}
+		if (!in.Ok()) {
+			return false;
+		}
+	}
+
+	if (!in.Ok() || !in.AtEnd() || stages.empty()) {
+		return false;
+	}
+	outStages = std::move(stages);
+	return true;
+}
+
+} // namespace
+
+bool ReadShaderSource(const std::string &path, std::string &out) {
+	if (path.find("://") != std::string::npos) {
+		out = Platform::Filesystem::VirtualFileSystem::Get()->ReadTextFile(path);
+		return !out.empty();
+	}
+	std::ifstream file(path, std::ios::binary);
+	if (!file.is_open()) {
+		return false;
+	}
+	out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return true;
+}
+
+bool VulkanShaderCache::Load(const std::string &path, const std::string &source, uint64 configHash,
+							 std::vector<VulkanCompiledStage> &outStages, std::vector<std::string> *outDependencies) {
+	std::vector<uint8> manifest;
+	if (!Platform::Filesystem::FileReadAll(ManifestPath(path, configHash), manifest)) {
+		return false;
+	}
+
+	std::vector<std::string> dependencies;
+	std::istringstream lines(std::string(manifest.begin(), manifest.end()));
+	for (std::string line; std::getline(lines, line);) {
+		if (!line.empty()) {
+			dependencies.push_back(std::move(line));
+		}
+	}
+
+	uint64 key = 0;
+	std::vector<uint8> entry;
+	if (!ComputeKey(source, configHash, dependencies, key) ||
+		!Platform::Filesystem::FileReadAll(EntryPath(key, ".spv"), entry)) {
+		return false;
+	}
+
+	BlobReader reader(entry);
+	if (!Deserialize(reader, key, outStages)) {
+		AQUILA_LOG_WARNING("Shader cache entry for '{}' is corrupt, recompiling", path);
+		return false;
+	}
+	if (outDependencies != nullptr) {
+		*outDependencies = std::move(dependencies);
+	}
+	return true;
+}
+
+void VulkanShaderCache::Store(const std::string &path, const std::string &source, uint64 configHash,
+							  const std::vector<std::string> &dependencies,
+							  const std::vector<VulkanCompiledStage> &stages) {
+	uint64 key = 0;
+	if (!ComputeKey(source, configHash, dependencies, key)) {
+		return;
+	}
+
+	// Entry before manifest: a reader that sees the new manifest always finds its entry.
+	BlobWriter writer;
+	Serialize(writer, key, stages);
+	const std::vector<uint8> &entry = writer.GetData();
+	if (!Platform::Filesystem::FileWriteAtomic(EntryPath(key, ".spv"), entry.data(), entry.size())) {
+		AQUILA_LOG_WARNING("Failed to write shader cache entry for '{}'", path);
+		return;
+	}
+
+	std::string manifest;
+	for (const std::string &dependency : dependencies) {
+		manifest += dependency;
+		manifest += '\n';
+	}
+	Platform::Filesystem::FileWriteAtomic(ManifestPath(path, configHash), manifest.data(), manifest.size());
+}
+
+const std::string &VulkanShaderCache::GetDirectory() {
+	static const std::string s_Directory = [] {
+		std::string dir = Platform::Filesystem::PathJoin(Platform::Filesystem::DirGetUserCache(), "shaders");
+		std::error_code ec;
+		std::filesystem::create_directories(dir, ec);
+		return dir;
+	}();
+	return s_Directory;
+}
+
+} // namespace Aquila::RHI
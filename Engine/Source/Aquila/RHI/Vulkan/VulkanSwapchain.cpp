@@ -207,6 +207,7 @@ bool VulkanSwapchain::AcquireNextImage(uint32 &outImageIndex) {
 		vkWaitForFences(dev, 1, &m_InFlightFences[m_NextFrameSlot], VK_TRUE, UINT64_MAX);
 		m_SlotSubmitted[m_NextFrameSlot] = false;
 	}
+	m_Device.WaitForAsyncCompute(m_NextFrameSlot);
 	m_Device.GetDeletionQueue().Flush(m_NextFrameSlot);
 
 	for (auto &p : m_PendingCmdBufs[m_NextFrameSlot]) {
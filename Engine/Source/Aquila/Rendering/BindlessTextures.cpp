@@ -0,0 +1,101 @@
+#include "Aquila/Rendering/BindlessTextures.h"
+#include "Aquila/GFX/GfxContext.h"
+#include "Aquila/Graphics/SurfaceData.h"
+
+namespace Aquila::Rendering {
+
+BindlessTextures::BindlessTextures(GFX::GfxContext &ctx) {
+	m_DefaultTexture = ctx.CreateTexture({
+		.format = RHI::TextureFormat::RGBA8,
+		.usage = RHI::TextureUsage::Sampled | RHI::TextureUsage::TransferDst,
+		.debugName = "BindlessDefault",
+	});
+	constexpr uint32 kWhite = 0xFFFFFFFFu;
+	ctx.UploadTextureData(*m_DefaultTexture, &kWhite, sizeof(kWhite));
+
+	if (!ctx.SupportsDescriptorIndexing()) {
+		for (uint32 slot = 0; slot < SharedConstants::MAX_BINDLESS_TEXTURES; ++slot) {
+			QueueWrite(slot);
+		}
+	}
+}
+
+uint32 BindlessTextures::Acquire(const Ref<GFX::GfxTexture> &texture) {
+	if (!texture) {
+		return Graphics::kNoBindlessTexture;
+	}
+
+	if (auto it = m_SlotLookup.find(texture.get()); it != m_SlotLookup.end()) {
+		++m_Slots[it->second].refCount;
+		return it->second;
+	}
+
+	uint32 slot = Graphics::kNoBindlessTexture;
+	if (!m_FreeSlots.empty()) {
+		slot = m_FreeSlots.top();
+		m_FreeSlots.pop();
+	} else if (m_Slots.size() < SharedConstants::MAX_BINDLESS_TEXTURES) {
+		slot = static_cast<uint32>(m_Slots.size());
+		m_Slots.emplace_back();
+	} else {
+		if (!m_OverflowReported) {
+			AQUILA_LOG_WARNING("BindlessTextures: all {} texture slots in use", SharedConstants::MAX_BINDLESS_TEXTURES);
+			m_OverflowReported = true;
+		}
+		return Graphics::kNoBindlessTexture;
+	}
+
+	m_Slots[slot] = { texture, 1 };
+	m_SlotLookup.emplace(texture.get(), slot);
+	QueueWrite(slot);
+	return slot;
+}
+
+void BindlessTextures::Release(uint32 slot) {
+	if (slot >= m_Slots.size() || m_Slots[slot].refCount == 0) {
+		return;
+	}
+	if (--m_Slots[slot].refCount > 0) {
+		return;
+	}
+
+	// The texture stays referenced until the slot leaves m_Retired: frames already in
+	// flight may still sample it.
+	m_SlotLookup.erase(m_Slots[slot].texture.get());
+	m_Retired.push_back({ slot, m_UpdateIndex });
+	QueueWrite(slot);
+	m_OverflowReported = false;
+}
+
+void BindlessTextures::Update(uint32 frameSlot, GFX::GfxDescriptorSet &set) {
+	++m_UpdateIndex;
+
+	// By now every set was rewritten to the default texture and the frames that sampled the
+	// old one have completed.
+	while (!m_Retired.empty() &&
+		   m_UpdateIndex >= m_Retired.front().retiredAt + SharedConstants::MAX_FRAMES_IN_FLIGHT) {
+		const uint32 slot = m_Retired.front().slot;
+		m_Retired.pop_front();
+		m_Slots[slot].texture.reset();
+		m_FreeSlots.push(slot);
+	}
+
+	auto &pending = m_PendingWrites[frameSlot];
+	if (pending.empty()) {
+		return;
+	}
+	for (uint32 slot : pending) {
+		const bool live = slot < m_Slots.size() && m_Slots[slot].refCount > 0;
+		set.SetTexture(kBinding, live ? *m_Slots[slot].texture : *m_DefaultTexture, slot);
+	}
+	set.Flush();
+	pending.clear();
+}
+
+void BindlessTextures::QueueWrite(uint32 slot) {
+	for (auto &pending : m_PendingWrites) {
+		pending.push_back(slot);
+	}
+}
+
+} // namespace Aquila::Rendering
@@ -0,0 +1,142 @@
+#include "Aquila/Rendering/LightRegistry.h"
+#include "Aquila/Scene/Components/TransformComponent.h"
+#include "Aquila/Scene/Components/LightComponent.h"
+
+#include <cstring>
+
+namespace Aquila::Rendering {
+
+using namespace SceneManagement::Components;
+
+namespace {
+
+constexpr uint32 kInvalidSlot = UINT32_MAX;
+
+GpuLightData BuildLightData(const LightComponent &light, const TransformComponent &transform) {
+	GpuLightData data{};
+
+	data.m_PositionAndRange = vec4(transform.GetWorldPosition(), light.m_Range);
+	data.m_ColorAndIntensity = vec4(light.m_Color, light.m_Intensity);
+	data.m_DirectionAndType = vec4(light.m_Direction, static_cast<float>(light.m_Type));
+	data.m_ShadowIndex = -1;
+	data.m_Flags = LightRegistry::kLightFlagEnabled;
+
+	switch (light.m_Type) {
+	case LightComponent::Type::Spot: {
+		data.m_CosInnerAngle = glm::cos(glm::radians(light.m_InnerConeAngle));
+		data.m_CosOuterAngle = glm::cos(glm::radians(light.m_OuterConeAngle));
+		break;
+	}
+	case LightComponent::Type::Area: {
+		const mat4 &world = transform.GetWorldMatrix();
+		const vec3 right = glm::normalize(vec3(world[0]));
+		const vec3 up = glm::normalize(vec3(world[1]));
+		data.m_RightAndWidth = vec4(right, light.m_AreaSize.x);
+		data.m_UpAndHeight = vec4(up, light.m_AreaSize.y);
+		data.m_CosInnerAngle = 1.0f;
+		data.m_CosOuterAngle = 1.0f;
+		break;
+	}
+	default:
+		data.m_CosInnerAngle = 1.0f;
+		data.m_CosOuterAngle = 1.0f;
+		break;
+	}
+
+	return data;
+}
+
+} // namespace
+
+LightRegistry::LightRegistry(GFX::GfxContext &ctx)
+	: m_Buffers(ctx, "LightData", SharedConstants::INITIAL_LIGHT_CAPACITY, SharedConstants::MAX_LIGHTS) {}
+
+void LightRegistry::Sync(entt::registry &registry) {
+	++m_SyncIndex;
+
+	usize seen = 0;
+	uint32 dropped = 0;
+	auto view = registry.view<LightComponent, TransformComponent>();
+	for (auto entity : view) {
+		const auto &light = view.get<LightComponent>(entity);
+		if (!light.m_IsActive) {
+			continue;
+		}
+
+		auto [it, inserted] = m_EntitySlots.try_emplace(entity);
+		if (inserted) {
+			it->second.slot = AllocateSlot();
+			if (it->second.slot == kInvalidSlot) {
+				m_EntitySlots.erase(it);
+				++dropped;
+				continue;
+			}
+		}
+		it->second.lastSeen = m_SyncIndex;
+		++seen;
+
+		const uint32 slot = it->second.slot;
+		const GpuLightData data = BuildLightData(light, view.get<TransformComponent>(entity));
+		if (std::memcmp(&m_Lights[slot], &data, sizeof(GpuLightData)) != 0) {
+			m_Lights[slot] = data;
+			m_Buffers.MarkDirty(slot, slot + 1);
+		}
+	}
+
+	if (dropped > 0 && !m_OverflowReported) {
+		AQUILA_LOG_WARNING("LightRegistry: light table full ({} slots), {} lights ignored", SharedConstants::MAX_LIGHTS,
+						   dropped);
+	}
+	m_OverflowReported = dropped > 0;
+
+	// Only sweep when something disappeared; the steady state skips this loop.
+	if (seen == m_EntitySlots.size()) {
+		return;
+	}
+	for (auto it = m_EntitySlots.begin(); it != m_EntitySlots.end();) {
+		if (it->second.lastSeen != m_SyncIndex) {
+			ReleaseSlot(it->second.slot);
+			it = m_EntitySlots.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
+bool LightRegistry::Upload(uint32 frameSlot) {
+	return m_Buffers.Upload(frameSlot, m_Lights);
+}
+
+uint32 LightRegistry::AllocateSlot() {
+	while (!m_FreeSlots.empty()) {
+		const uint32 slot = m_FreeSlots.top();
+		m_FreeSlots.pop();
+		// Entries past the end were trimmed away and are stale.
+		if (slot < m_SlotUsed.size() && !m_SlotUsed[slot]) {
+			m_SlotUsed[slot] = true;
+			return slot;
+		}
+	}
+
+	if (m_Lights.size() >= SharedConstants::MAX_LIGHTS) {
+		return kInvalidSlot;
+	}
+	m_Lights.emplace_back();
+	m_SlotUsed.push_back(true);
+	return static_cast<uint32>(m_Lights.size() - 1);
+}
+
+void LightRegistry::ReleaseSlot(uint32 slot) {
+	m_Lights[slot] = GpuLightData{};
+	m_SlotUsed[slot] = false;
+	m_FreeSlots.push(slot);
+	m_Buffers.MarkDirty(slot, slot + 1);
+
+	// Trailing holes are dropped so the cull shader does not walk them.
+	while (!m_SlotUsed.empty() && !m_SlotUsed.back()) {
+		m_SlotUsed.pop_back();
+		m_Lights.pop_back();
+	}
+}
+
+} // namespace Aquila::Rendering
@@ -0,0 +1,151 @@
+#include "Aquila/Rendering/MaterialTable.h"
+#include "Aquila/Scene/Scene.h"
+#include "Aquila/Scene/Components/MaterialComponent.h"
+
+namespace Aquila::Rendering {
+
+using namespace SceneManagement::Components;
+
+namespace {
+
+constexpr uint32 kInvalidSlot = UINT32_MAX;
+
+} // namespace
+
+MaterialTable::MaterialTable(GFX::GfxContext &ctx, BindlessTextures &textures)
+	: m_Textures(textures),
+	  m_Copies(ctx, "MaterialData", SharedConstants::INITIAL_MATERIAL_CAPACITY, SharedConstants::MAX_MATERIALS) {}
+
+void MaterialTable::Sync(SceneManagement::Scene &scene) {
+	const bool sameScene = m_SceneId && *m_SceneId == scene.GetHandle();
+	if (!sameScene) {
+		Rebuild(scene);
+		scene.ClearMaterialChanges();
+		return;
+	}
+
+	// Releases first, so slots freed this frame can be handed straight back out.
+	for (const auto &released : scene.GetReleasedMaterials()) {
+		if (released.slot < m_SlotOwners.size() && m_SlotOwners[released.slot] == released.entity) {
+			ReleaseSlot(released.slot);
+		}
+	}
+
+	auto &registry = scene.GetRegistry();
+	RetryOverflowed(registry);
+	for (entt::entity entity : scene.GetDirtyMaterials()) {
+		if (registry.valid(entity) && registry.all_of<MaterialComponent>(entity)) {
+			Assign(registry, entity);
+		}
+	}
+
+	scene.ClearMaterialChanges();
+}
+
+void MaterialTable::Rebuild(SceneManagement::Scene &scene) {
+	for (uint32 slot = 0; slot < GetSlotCount(); ++slot) {
+		if (m_SlotOwners[slot] != entt::null) {
+			ReleaseTextures(m_Surfaces[slot]);
+		}
+	}
+	m_Surfaces.clear();
+	m_SlotOwners.clear();
+	m_FreeSlots = {};
+	m_LiveCount = 0;
+	m_Overflowed.clear();
+	m_SceneId = scene.GetHandle();
+
+	auto &registry = scene.GetRegistry();
+	for (auto entity : registry.view<MaterialComponent>()) {
+		Assign(registry, entity);
+	}
+}
+
+void MaterialTable::Assign(entt::registry &registry, entt::entity entity) {
+	auto &comp = registry.get<MaterialComponent>(entity);
+
+	// A component copied from another entity arrives with that entity's index.
+	uint32 slot = comp.materialIndex;
+	if (slot >= m_SlotOwners.size() || m_SlotOwners[slot] != entity) {
+		slot = AllocateSlot();
+		if (slot == kInvalidSlot) {
+			if (!m_OverflowReported) {
+				AQUILA_LOG_WARNING("MaterialTable: all {} material slots in use", SharedConstants::MAX_MATERIALS);
+				m_OverflowReported = true;
+			}
+			comp.materialIndex = kInvalidSlot;
+			m_Overflowed.insert(entity);
+			return;
+		}
+		m_SlotOwners[slot] = entity;
+		comp.materialIndex = slot;
+		m_Overflowed.erase(entity);
+	}
+
+	// Acquire before releasing, so a texture the material keeps never loses its slot.
+	Graphics::GpuSurfaceData surface = comp.surfaceProperties;
+	for (glm::length_t i = 0; i < surface.textureIndices.length(); ++i) {
+		surface.textureIndices[i] = m_Textures.Acquire(comp.textures[static_cast<usize>(i)]);
+	}
+	ReleaseTextures(m_Surfaces[slot]);
+
+	m_Surfaces[slot] = surface;
+	m_Copies.MarkDirty(slot, slot + 1);
+}
+
+// Components that found the table full get another go once slots have been freed.
+void MaterialTable::RetryOverflowed(entt::registry &registry) {
+	if (m_Overflowed.empty() || (m_FreeSlots.empty() && GetSlotCount() >= SharedConstants::MAX_MATERIALS)) {
+		return;
+	}
+	const std::vector<entt::entity> waiting(m_Overflowed.begin(), m_Overflowed.end());
+	for (entt::entity entity : waiting) {
+		if (!registry.valid(entity) || !registry.all_of<MaterialComponent>(entity)) {
+			m_Overflowed.erase(entity);
+			continue;
+		}
+		Assign(registry, entity);
+		if (m_Overflowed.contains(entity)) {
+			break; // full again
+		}
+	}
+}
+
+bool MaterialTable::Upload(uint32 frameSlot) {
+	return m_Copies.Upload(frameSlot, m_Surfaces);
+}
+
+uint32 MaterialTable::AllocateSlot() {
+	uint32 slot = kInvalidSlot;
+	if (!m_FreeSlots.empty()) {
+		slot = m_FreeSlots.top();
+		m_FreeSlots.pop();
+	} else if (m_SlotOwners.size() < SharedConstants::MAX_MATERIALS) {
+		slot = static_cast<uint32>(m_SlotOwners.size());
+		m_SlotOwners.push_back(entt::null);
+		m_Surfaces.emplace_back();
+	}
+	if (slot != kInvalidSlot) {
+		++m_LiveCount;
+	}
+	return slot;
+}
+
+void MaterialTable::ReleaseSlot(uint32 slot) {
+	ReleaseTextures(m_Surfaces[slot]);
+	m_Surfaces[slot] = {};
+	m_SlotOwners[slot] = entt::null;
+	m_FreeSlots.push(slot);
+	--m_LiveCount;
+	m_OverflowReported = false;
+}
+
+void MaterialTable::ReleaseTextures(const Graphics::GpuSurfaceData &surface) {
+	for (glm::length_t i = 0; i < surface.textureIndices.length(); ++i) {
+		if (surface.textureIndices[i] != Graphics::kNoBindlessTexture) {
+			m_Textures.Release(surface.textureIndices[i]);
+		}
+	}
+}
+
+} // namespace Aquila::Rendering
@@ -0,0 +1,50 @@
+#include "Aquila/Rendering/MeshLodSelector.h"
+#include "Aquila/Rendering/FrameContext.h"
+#include "Aquila/Graphics/Resources/Mesh.h"
+
+namespace Aquila::Rendering {
+
+f32 MeshLodSelector::PixelsPerUnit(const Graphics::Resources::Mesh &mesh, const mat4 &model, const FrameContext &ctx) {
+	const vec3 center = vec3(model * vec4((mesh.GetBoundsMin() + mesh.GetBoundsMax()) * 0.5F, 1.F));
+	const f32 scale =
+		std::max({ glm::length(vec3(model[0])), glm::length(vec3(model[1])), glm::length(vec3(model[2])) });
+	const f32 radius = glm::length(mesh.GetBoundsMax() - mesh.GetBoundsMin()) * 0.5F * scale;
+
+	// proj[1][1] is cot(fovY / 2) for a perspective projection and 2 / height for an
+	// orthographic one, where size on screen doesn't depend on distance.
+	const f32 pixels = scale * std::abs(ctx.projection[1][1]) * static_cast<f32>(ctx.height) * 0.5F;
+	const bool perspective = ctx.projection[2][3] != 0.F;
+	if (!perspective) {
+		return pixels;
+	}
+	const f32 distance = glm::length(center - ctx.cameraPosition) - radius;
+	return pixels / std::max(distance, 1e-3F);
+}
+
+uint32 MeshLodSelector::Select(std::span<const Graphics::Resources::MeshLod> lods, uint32 current, f32 pixelsPerUnit,
+							   f32 thresholdPixels, f32 hysteresis) {
+	if (lods.size() <= 1) {
+		return 0;
+	}
+	const auto last = static_cast<uint32>(lods.size() - 1);
+	current = std::min(current, last);
+
+	// Errors never decrease along the chain, so both searches stop at the first miss.
+	if (lods[current].error * pixelsPerUnit > thresholdPixels) {
+		while (current > 0 && lods[current].error * pixelsPerUnit > thresholdPixels) {
+			--current;
+		}
+		return current;
+	}
+	while (current < last && lods[current + 1].error * pixelsPerUnit <= thresholdPixels * hysteresis) {
+		++current;
+	}
+	return current;
+}
+
+uint32 MeshLodSelector::Select(const Graphics::Resources::Mesh &mesh, const mat4 &model, uint32 current,
+							   const FrameContext &ctx) {
+	return Select(mesh.GetLods(), current, PixelsPerUnit(mesh, model, ctx));
+}
+
+} // namespace Aquila::Rendering
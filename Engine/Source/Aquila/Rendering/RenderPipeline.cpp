@@ -1,8 +1,14 @@
 #include "Aquila/Rendering/RenderPipeline.h"
 #include "Aquila/Rendering/SceneFrameData.h"
 #include "Aquila/Foundation/Profiler.h"
+#include "Aquila/Foundation/Cache/ResidencyManager.h"
 #include "Aquila/GFX/GfxContext.h"
 #include "Aquila/GFX/GfxCommandList.h"
+#include "Aquila/GFX/GfxMeshRegistry.h"
+#include "Aquila/GFX/GfxGeometryArena.h"
+#include "Aquila/GFX/GfxUploadRing.h"
+#include "Aquila/GFX/GfxUploadBatcher.h"
+#include "Aquila/RHI/Vulkan/VulkanShaderCompiler.h"
 #include "Aquila/Scene/Scene.h"
 #include "Aquila/Scene/Entity.h"
 #include "Aquila/Scene/Components/CameraComponent.h"
@@ -18,6 +24,23 @@ RenderPipeline::RenderPipeline(GFX::GfxContext &ctx, uint32 width, uint32 height
 	RebuildTargets();
 }
 
+void RenderPipeline::Initialize() {
+	if (m_Initialized) {
+		return;
+	}
+
+	std::vector<std::string> shaders;
+	for (auto &r : m_Renderers) {
+		r->DeclareShaders(shaders);
+	}
+	RHI::VulkanShaderCompiler::PrecompileFiles(std::move(shaders));
+
+	for (auto &r : m_Renderers) {
+		r->OnInit(m_Ctx);
+	}
+	m_Initialized = true;
+}
+
 RenderPipeline::~RenderPipeline() {
 	for (auto &r : m_Renderers) {
 		r->OnShutdown();
@@ -32,6 +55,7 @@ void RenderPipeline::Render(GFX::GfxCommandList &cmd, SceneManagement::Scene &sc
 	}
 
 	m_FrameSlot = (m_FrameSlot + 1) % SharedConstants::MAX_FRAMES_IN_FLIGHT;
+	m_Ctx.GetUploadRing().BeginFrame(m_FrameSlot);
 	{
 		PROFILE_SCOPE("RenderPipeline::FrameDataUpdate");
 		SceneFrameData::Get()->Update(scene, deltaTime, m_FrameSlot);
@@ -58,11 +82,21 @@ void RenderPipeline::Render(GFX::GfxCommandList &cmd, SceneManagement::Scene &sc
 		PROFILE_SCOPE("RenderPipeline::GraphCompile");
 		m_Graph.Compile(m_Ctx);
 	}
+	// Meshes first seen this frame were queued while adding passes.
+	m_Ctx.GetUploadBatcher().Submit(cmd);
 	{
 		PROFILE_SCOPE("RenderPipeline::GraphExecute");
 		m_Graph.Execute(cmd);
 	}
 	m_Graph.Reset();
+	m_Ctx.GetUploadRing().EndFrame();
+
+	// Evict cached assets over budget first, so meshes dropped here free their GPU copies below.
+	Foundation::ResidencyManager::Get().EndFrame();
+	// Meshes whose CPU side died this frame give their GPU buffers back.
+	m_Ctx.GetMeshRegistry().CollectGarbage();
+	m_Ctx.GetGeometryArena().Tick();
+	m_Ctx.GetUploadBatcher().Collect();
 }
 
 void RenderPipeline::Render(GFX::GfxCommandList &cmd, SceneManagement::Scene &scene, f32 deltaTime, uint32 width,
@@ -77,6 +111,7 @@ void RenderPipeline::Resize(uint32 width, uint32 height) {
 	m_Width = width;
 	m_Height = height;
 	SceneFrameData::Get()->OnResize(width, height);
+	m_Graph.ClearCache(); // every cached structure and pooled target has the old extent
 	RebuildTargets();
 	for (auto &r : m_Renderers) {
 		r->OnResize(width, height);
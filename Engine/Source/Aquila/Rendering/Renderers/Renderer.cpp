@@ -11,8 +11,18 @@ using Aquila::SharedConstants::SHADERS_DIR;
 
 namespace Aquila::Rendering {
 
+void Renderer::DeclareShaders(std::vector<std::string> &outPaths) const {
+	outPaths.push_back(SHADERS_DIR + "Blit.slang");
+	for (const auto &sys : m_Systems) {
+		sys->DeclareShaders(outPaths);
+	}
+}
+
 void Renderer::OnInit(GFX::GfxContext &ctx) {
 	m_Ctx = &ctx;
+	for (auto &sys : m_Systems) {
+		sys->OnInit(ctx);
+	}
 
 	// define blit layout
 	m_BlitLayout = ctx.CreateDescriptorSetLayout({
@@ -3,14 +3,25 @@
 #include "Aquila/Graphics/RenderGraph/RGGraph.h"
 #include "Aquila/Graphics/RenderGraph/RGPassBuilder.h"
 #include "Aquila/Rendering/FrameContext.h"
+#include "Aquila/Rendering/FrameScheduler.h"
 #include "Aquila/GFX/GfxSwapchain.h"
 #include "Aquila/Foundation/Math/Math.h"
 
 namespace Aquila::Rendering {
 
+void Renderer2D::DeclareShaders(std::vector<std::string> &outPaths) const {
+	Graphics::QuadBatcher::DeclareShaders(outPaths);
+	for (const auto &sys : m_Systems) {
+		sys->DeclareShaders(outPaths);
+	}
+}
+
 void Renderer2D::OnInit(GFX::GfxContext &ctx) {
 	m_Ctx = &ctx;
 	m_R2D = CreateUnique<Graphics::QuadBatcher>(ctx);
+	for (auto &sys : m_Systems) {
+		sys->OnInit(ctx);
+	}
 	// MSAA resources are created lazily in AddFinalPasses once dimensions are known.
 }
 
@@ -73,6 +84,9 @@ void Renderer2D::BlitToSwapchain(Graphics::RG::RenderGraph &graph, FrameContext
 
 	// m_UIDirty is set by the application before Render() via SetUIDirty().
 	const bool uiDirty = m_UIDirty;
+	if (!m_R2D->CanReplay()) {
+		FrameScheduler::Get()->RequestFrame(); // keep ticking until the placeholders' textures land
+	}
 
 	graph.AddPass(
 		"UIOverlay",
@@ -86,7 +100,7 @@ void Renderer2D::BlitToSwapchain(Graphics::RG::RenderGraph &graph, FrameContext
 																		 Graphics::RG::RGRegistry & /*reg*/) {
 			const mat4 ortho = glm::ortho(0.f, static_cast<float>(w), static_cast<float>(h), 0.f, -1.f, 1.f);
 			renderPass->Begin(cmd, swapchain, imageIndex);
-			if (uiDirty) {
+			if (uiDirty || !r2d->CanReplay()) {
 				PROFILE_SCOPE("UIOverlay::DirtyRebuild");
 				r2d->BeginCapture();
 				r2d->Begin(cmd, RHI::TextureFormat::BGRA8, RHI::SampleCount::x4, ortho);
@@ -4,9 +4,7 @@
 #include "Aquila/Scene/Entity.h"
 #include "Aquila/Scene/Components/CameraComponent.h"
 #include "Aquila/Scene/Components/TransformComponent.h"
-#include "Aquila/Scene/Components/LightComponent.h"
 #include "Aquila/Scene/Components/SkyLightComponent.h"
-#include "Aquila/Scene/Components/MaterialComponent.h"
 #include "Aquila/Foundation/Macros.h"
 
 #include <glm/gtc/constants.hpp>
@@ -21,7 +19,7 @@ SceneFrameData::SceneFrameData(GFX::GfxContext &ctx, uint32 width, uint32 height
         .bindings = {
             {
                 .binding = 0,
-                .type    = RHI::DescriptorType::UniformBuffer,
+                .type    = RHI::DescriptorType::UniformBufferDynamic,
                 .stages  = RHI::ShaderStageFlags::Vertex | RHI::ShaderStageFlags::Fragment | RHI::ShaderStageFlags::Compute,
                 .count   = 1,
             },
@@ -33,7 +31,7 @@ SceneFrameData::SceneFrameData(GFX::GfxContext &ctx, uint32 width, uint32 height
             },
             {
                 .binding = 2,
-                .type    = RHI::DescriptorType::UniformBuffer,
+                .type    = RHI::DescriptorType::UniformBufferDynamic,
                 .stages  = RHI::ShaderStageFlags::Fragment | RHI::ShaderStageFlags::Compute,
                 .count   = 1,
             },
@@ -55,41 +53,24 @@ SceneFrameData::SceneFrameData(GFX::GfxContext &ctx, uint32 width, uint32 height
                 .stages  = RHI::ShaderStageFlags::Fragment | RHI::ShaderStageFlags::Compute,
                 .count   = 1,
             },
+            {
+                .binding        = BindlessTextures::kBinding,
+                .type           = RHI::DescriptorType::CombinedImageSampler,
+                .stages         = RHI::ShaderStageFlags::Vertex | RHI::ShaderStageFlags::Fragment | RHI::ShaderStageFlags::Compute,
+                .count          = SharedConstants::MAX_BINDLESS_TEXTURES,
+                .partiallyBound = true,
+            },
         },
     });
 
 	for (uint32 i = 0; i < SharedConstants::MAX_FRAMES_IN_FLIGHT; ++i) {
-		m_FrameBuffers[i] = ctx.CreateBuffer({
-			.size = sizeof(GpuFrameData),
-			.usage = RHI::BufferUsage::UniformBuffer,
-			.domain = RHI::MemoryDomain::CPU_TO_GPU,
-			.debugName = "FrameData_" + std::to_string(i),
-		});
-
-		m_LightBuffers[i] = ctx.CreateBuffer({
-			.size = sizeof(GpuLightData) * SharedConstants::MAX_LIGHTS,
-			.usage = RHI::BufferUsage::StorageBuffer,
-			.domain = RHI::MemoryDomain::CPU_TO_GPU,
-			.debugName = "LightData_" + std::to_string(i),
-		});
-
-		m_EnvBuffers[i] = ctx.CreateBuffer({
-			.size = sizeof(GpuEnvironmentData),
-			.usage = RHI::BufferUsage::UniformBuffer,
-			.domain = RHI::MemoryDomain::CPU_TO_GPU,
-			.debugName = "EnvironmentData_" + std::to_string(i),
-		});
-
-		m_MaterialBuffers[i] = ctx.CreateBuffer({
-			.size = sizeof(Graphics::GpuSurfaceData) * SharedConstants::MAX_MATERIALS,
-			.usage = RHI::BufferUsage::StorageBuffer,
-			.domain = RHI::MemoryDomain::CPU_TO_GPU,
-			.debugName = "MaterialData_" + std::to_string(i),
-		});
-
 		m_Sets[i] = ctx.AllocateDescriptorSet(*m_Layout);
 	}
 
+	m_LightRegistry = CreateUnique<LightRegistry>(ctx);
+	m_BindlessTextures = CreateUnique<BindlessTextures>(ctx);
+	m_MaterialTable = CreateUnique<MaterialTable>(ctx, *m_BindlessTextures);
+
 	m_LightIndexListBuffer = ctx.CreateBuffer({
 		.size = sizeof(uint32) * SharedConstants::CLUSTER_COUNT * SharedConstants::MAX_LIGHTS_PER_CLUSTER,
 		.usage = RHI::BufferUsage::StorageBuffer,
@@ -104,11 +85,10 @@ SceneFrameData::SceneFrameData(GFX::GfxContext &ctx, uint32 width, uint32 height
 	});
 
 	for (uint32 i = 0; i < SharedConstants::MAX_FRAMES_IN_FLIGHT; ++i) {
+		// Bindings 0 and 2 point into the upload ring and are written by Update.
 		m_Sets[i]
-			->SetBuffer(0, *m_FrameBuffers[i])
-			.SetBuffer(1, *m_LightBuffers[i])
-			.SetBuffer(2, *m_EnvBuffers[i])
-			.SetBuffer(3, *m_MaterialBuffers[i])
+			->SetBuffer(1, m_LightRegistry->GetBuffer(i))
+			.SetBuffer(3, m_MaterialTable->GetBuffer(i))
 			.SetBuffer(4, *m_LightIndexListBuffer)
 			.SetBuffer(5, *m_ClusterLightInfoBuffer)
 			.Flush();
@@ -146,40 +126,6 @@ static GpuCameraData BuildCameraData(const CameraComponent &cam, const Transform
 	return data;
 }
 
-static GpuLightData BuildLightData(const LightComponent &light, const TransformComponent &transform) {
-	GpuLightData data{};
-
-	data.m_PositionAndRange = vec4(vec3(transform.GetLocalPosition()), light.m_Range);
-	data.m_ColorAndIntensity = vec4(light.m_Color, light.m_Intensity);
-	data.m_DirectionAndType = vec4(light.m_Direction, static_cast<float>(light.m_Type));
-	data.m_ShadowIndex = -1;
-	data.m_Flags = 0;
-
-	switch (light.m_Type) {
-	case LightComponent::Type::Spot: {
-		data.m_CosInnerAngle = glm::cos(glm::radians(light.m_InnerConeAngle));
-		data.m_CosOuterAngle = glm::cos(glm::radians(light.m_OuterConeAngle));
-		break;
-	}
-	case LightComponent::Type::Area: {
-		const mat3 rot = glm::mat3_cast(transform.GetLocalRotation());
-		const vec3 right = rot[0];
-		const vec3 up = rot[1];
-		data.m_RightAndWidth = vec4(right, light.m_AreaSize.x);
-		data.m_UpAndHeight = vec4(up, light.m_AreaSize.y);
-		data.m_CosInnerAngle = 1.0f;
-		data.m_CosOuterAngle = 1.0f;
-		break;
-	}
-	default:
-		data.m_CosInnerAngle = 1.0f;
-		data.m_CosOuterAngle = 1.0f;
-		break;
-	}
-
-	return data;
-}
-
 void SceneFrameData::Update(SceneManagement::Scene &scene, float deltaTime, uint32 frameSlot) {
 	m_Time += deltaTime;
 
@@ -213,28 +159,13 @@ void SceneFrameData::Update(SceneManagement::Scene &scene, float deltaTime, uint
 		gpuFrame.cameraCount = count;
 	}
 
-	GpuLightData lights[SharedConstants::MAX_LIGHTS];
-	uint32 lightCount = 0;
-	{
-		auto view = registry.view<LightComponent, TransformComponent>();
-		for (auto entity : view) {
-			if (lightCount >= SharedConstants::MAX_LIGHTS) {
-				break;
-			}
-			const auto &light = view.get<LightComponent>(entity);
-			const auto &transform = view.get<TransformComponent>(entity);
-			if (!light.m_IsActive) {
-				continue;
-			}
-			lights[lightCount++] = BuildLightData(light, transform);
-		}
+	m_LightRegistry->Sync(registry);
+	if (m_LightRegistry->Upload(frameSlot)) {
+		m_Sets[frameSlot]->SetBuffer(1, m_LightRegistry->GetBuffer(frameSlot)).Flush();
 	}
-	gpuFrame.lightCount = lightCount;
+	gpuFrame.lightCount = m_LightRegistry->GetSlotCount();
 
-	m_FrameBuffers[frameSlot]->Write(&gpuFrame, sizeof(GpuFrameData));
-	if (lightCount > 0) {
-		m_LightBuffers[frameSlot]->Write(lights, sizeof(GpuLightData) * lightCount);
-	}
+	const GFX::UploadAllocation frameAlloc = m_Ctx.GetUploadRing().Push(gpuFrame);
 
 	GpuEnvironmentData envData{};
 	{
@@ -253,24 +184,24 @@ void SceneFrameData::Update(SceneManagement::Scene &scene, float deltaTime, uint
 			break;
 		}
 	}
-	m_EnvBuffers[frameSlot]->Write(&envData, sizeof(GpuEnvironmentData));
+	const GFX::UploadAllocation envAlloc = m_Ctx.GetUploadRing().Push(envData);
 
-	{
-		Graphics::GpuSurfaceData materials[SharedConstants::MAX_MATERIALS];
-		uint32 materialCount = 0;
-		auto matView = registry.view<MaterialComponent>();
-		for (auto entity : matView) {
-			if (materialCount >= SharedConstants::MAX_MATERIALS) {
-				break;
-			}
-			auto &comp = matView.get<MaterialComponent>(entity);
-			materials[materialCount] = comp.surfaceProperties;
-			comp.materialIndex = materialCount++;
-		}
-		if (materialCount > 0) {
-			m_MaterialBuffers[frameSlot]->Write(materials, sizeof(Graphics::GpuSurfaceData) * materialCount);
-		}
+	RingBindings &ring = m_RingBindings[frameSlot];
+	if (ring.frameBufferId != frameAlloc.bufferId || ring.envBufferId != envAlloc.bufferId) {
+		m_Sets[frameSlot]
+			->SetBuffer(0, *frameAlloc.buffer, 0, sizeof(GpuFrameData))
+			.SetBuffer(2, *envAlloc.buffer, 0, sizeof(GpuEnvironmentData))
+			.Flush();
+		ring.frameBufferId = frameAlloc.bufferId;
+		ring.envBufferId = envAlloc.bufferId;
+	}
+	ring.offsets = { frameAlloc.offset, envAlloc.offset };
+
+	m_MaterialTable->Sync(scene);
+	if (m_MaterialTable->Upload(frameSlot)) {
+		m_Sets[frameSlot]->SetBuffer(3, m_MaterialTable->GetBuffer(frameSlot)).Flush();
 	}
+	m_BindlessTextures->Update(frameSlot, *m_Sets[frameSlot]);
 }
 
 void SceneFrameData::OnResize(uint32 width, uint32 height) {
@@ -15,6 +15,10 @@ using Aquila::SharedConstants::SHADERS_DIR;
 
 static constexpr uint32 kElementCount = 3456; // cluster size so 16x9x24
 
+void ClusterComputeSystem::DeclareShaders(std::vector<std::string> &outPaths) const {
+	outPaths.push_back(SHADERS_DIR + "ClusterCompute.slang");
+}
+
 void ClusterComputeSystem::OnInit(GFX::GfxContext &ctx) {
 	RenderingSystemBase::OnInit(ctx);
 
@@ -56,8 +60,8 @@ void ClusterComputeSystem::OnInit(GFX::GfxContext &ctx) {
 
 	m_OutputBuffer = ctx.CreateBuffer({
 		.size = sizeof(AABB) * kElementCount,
-		.usage = RHI::BufferUsage::StorageBuffer,
-		.domain = RHI::MemoryDomain::GPU_TO_CPU,
+		.usage = RHI::BufferUsage::StorageBuffer | RHI::BufferUsage::TransferSrc,
+		.domain = RHI::MemoryDomain::GPU_ONLY,
 		.debugName = "ClusterCompute_AABBOutput",
 	});
 
@@ -80,31 +84,73 @@ void ClusterComputeSystem::AddPasses(Graphics::RG::RenderGraph &graph, FrameCont
 		return;
 	}
 
+	// The previous rebuild has been submitted by now
+	if (m_ReadbackPending) {
+		ReadBackAABBs();
+		m_ReadbackPending = false;
+	}
+
+	// LightCull only ever reads the AABBs, so between rebuilds they stay in ShaderRead
+	auto hAABBs = graph.ImportBuffer(m_OutputBuffer.get(), "ClusterAABBs", Graphics::RG::ResourceState::ShaderRead);
+
+	const GridKey key{ .projection = ctx.projection, .width = ctx.width, .height = ctx.height };
+	if (m_BuiltKey == key) {
+		ctx.hClusterAABBs = hAABBs;
+		return;
+	}
+	m_BuiltKey = key;
+	m_ReadbackPending = m_DebugReadback;
+
 	auto *frameData = ctx.frameData;
 	const uint32 frameSlot = ctx.frameSlot;
 
-	auto hAABBs =
-		graph.ImportBuffer(m_OutputBuffer.get(), "ClusterAABBs", Graphics::RG::ResourceState::UnorderedAccess);
-
 	graph.AddPass(
-		"ClusterCompute", [&hAABBs](Graphics::RG::RGPassBuilder &builder) { hAABBs = builder.WriteBuffer(hAABBs); },
+		"ClusterCompute",
+		[&hAABBs](Graphics::RG::RGPassBuilder &builder) {
+			builder.SetQueue(Graphics::RG::RGQueue::AsyncCompute);
+			hAABBs = builder.WriteBuffer(hAABBs);
+		},
 		[this, frameData, frameSlot](GFX::GfxCommandList &cmd, Graphics::RG::RGRegistry &) {
 			cmd.BindPipeline(*m_Pipeline);
-			cmd.BindDescriptorSet(0, frameData->GetDescriptorSet(frameSlot));
+			cmd.BindDescriptorSet(0, frameData->GetDescriptorSet(frameSlot),
+								  frameData->GetDynamicOffsets(frameSlot));
 			cmd.BindDescriptorSet(1, *m_StorageSet);
 			cmd.Dispatch((m_GridData.grid.x + 4 - 1) / 4, (m_GridData.grid.y + 4 - 1) / 4,
 						 (m_GridData.grid.z + 4 - 1) / 4);
-
-			if (!m_Verified) {
-				auto *data = static_cast<uint32 *>(m_OutputBuffer->Map());
-				if (data) {
-					m_OutputBuffer->Unmap();
-				}
-				m_Verified = true;
-			}
 		});
 
 	ctx.hClusterAABBs = hAABBs;
 }
 
+void ClusterComputeSystem::ReadBackAABBs() {
+	m_Ctx->WaitIdle();
+
+	const uint64 size = sizeof(AABB) * kElementCount;
+	Ref<GFX::GfxBuffer> readback = m_Ctx->CreateBuffer({
+		.size = size,
+		.usage = RHI::BufferUsage::TransferDst,
+		.domain = RHI::MemoryDomain::GPU_TO_CPU,
+		.debugName = "ClusterCompute_Readback",
+	});
+
+	// Copy on the queue family that wrote the buffer, it is not handed over anywhere else
+	const RHI::CommandListType queue =
+		m_Ctx->HasAsyncCompute() ? RHI::CommandListType::Compute : RHI::CommandListType::Graphics;
+	m_Ctx->ExecuteImmediate(queue, [&](GFX::GfxCommandList &cmd) {
+		m_Ctx->GetDevice().CopyBuffer(cmd.GetRHI(), m_OutputBuffer->GetRHI(), readback->GetRHI(), size);
+	});
+
+	const auto *aabbs = static_cast<const AABB *>(readback->Map());
+	if (aabbs == nullptr) {
+		AQUILA_LOG_WARNING("ClusterComputeSystem: AABB readback could not be mapped");
+		return;
+	}
+	const AABB &first = aabbs[0];
+	const AABB &last = aabbs[kElementCount - 1];
+	AQUILA_LOG_DEBUG("ClusterComputeSystem: cluster 0 [{}, {}, {}]-[{}, {}, {}], cluster {} [{}, {}, {}]-[{}, {}, {}]",
+					 first.min.x, first.min.y, first.min.z, first.max.x, first.max.y, first.max.z, kElementCount - 1,
+					 last.min.x, last.min.y, last.min.z, last.max.x, last.max.y, last.max.z);
+	readback->Unmap();
+}
+
 } // namespace Aquila::Rendering
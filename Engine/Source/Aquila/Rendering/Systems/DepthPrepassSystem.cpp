@@ -1,8 +1,10 @@
 #include "Aquila/Rendering/Systems/DepthPrepassSystem.h"
 #include "Aquila/Rendering/FrameContext.h"
+#include "Aquila/Rendering/MeshLodSelector.h"
 #include "Aquila/Rendering/SceneFrameData.h"
 #include "Aquila/GFX/GfxContext.h"
 #include "Aquila/GFX/GfxCommandList.h"
+#include "Aquila/GFX/GfxGeometryArena.h"
 #include "Aquila/Graphics/RenderGraph/RGGraph.h"
 #include "Aquila/Graphics/RenderGraph/RGPassBuilder.h"
 #include "Aquila/RHI/Vulkan/VulkanShaderCompiler.h"
@@ -22,6 +24,10 @@ struct DepthPushConstants {
 	mat4 model;
 };
 
+void DepthPrepassSystem::DeclareShaders(std::vector<std::string> &outPaths) const {
+	outPaths.push_back(SHADERS_DIR + "DepthOnly.slang");
+}
+
 void DepthPrepassSystem::OnInit(GFX::GfxContext &ctx) {
 	RenderingSystemBase::OnInit(ctx);
 
@@ -66,6 +72,7 @@ void DepthPrepassSystem::AddPasses(RG::RenderGraph &graph, FrameContext &ctx) {
 
 	struct DrawCall {
 		Ref<GFX::GfxMesh> gpuMesh;
+		GFX::GeometryRange range;
 		mat4 model;
 	};
 
@@ -79,35 +86,46 @@ void DepthPrepassSystem::AddPasses(RG::RenderGraph &graph, FrameContext &ctx) {
 			continue;
 		}
 
+		const mat4 &model = transform.GetWorldMatrix();
+		mesh.lodIndex = MeshLodSelector::Select(*mesh.data, model, mesh.lodIndex, ctx);
+		auto gpuMesh = GetOrUploadMesh(mesh.data);
+		const auto range = gpuMesh->GetLodRange(mesh.lodIndex);
 		drawCalls.push_back({
-			.gpuMesh = GetOrUploadMesh(mesh.data),
-			.model = transform.GetWorldMatrix(),
+			.gpuMesh = std::move(gpuMesh),
+			.range = range,
+			.model = model,
 		});
 	}
 
 	auto *frameData = ctx.frameData;
+	auto *geometry = &m_Ctx->GetGeometryArena();
 	const uint32 frameSlot = ctx.frameSlot;
+	const auto drawCount = static_cast<uint32>(drawCalls.size());
 
-	graph.AddPass(
-		"DepthPrepass",
+	graph.AddParallelPass(
+		"DepthPrepass", drawCount, SharedConstants::MIN_DRAWS_PER_RECORD_JOB,
 		[&ctx](RG::RGPassBuilder &builder) {
 			ctx.hDepth =
 				builder.SetDepthAttachment(ctx.hDepth, RG::AttachmentLoadOp::Clear, RG::AttachmentStoreOp::Store,
 										   RG::AttachmentLoadOp::DontCare, RG::AttachmentStoreOp::DontCare,
 										   /*readOnly=*/false, RG::ClearDepth{ .depth = 1.F });
 		},
-		[this, drawCalls = std::move(drawCalls), frameData, frameSlot](GFX::GfxCommandList &cmd, RG::RGRegistry &) {
-			if (drawCalls.empty()) {
+		[this, drawCalls = std::move(drawCalls), frameData, frameSlot,
+		 geometry](GFX::GfxCommandList &cmd, RG::RGRegistry &, uint32 begin, uint32 end) {
+			if (begin >= end) {
 				return;
 			}
+			// May run once per chunk on a worker: only read shared state, rebind everything
 			cmd.BindPipeline(*m_Pipeline);
-			cmd.BindDescriptorSet(0, frameData->GetDescriptorSet(frameSlot));
-			for (const auto &drawCall : drawCalls) {
+			cmd.BindDescriptorSet(0, frameData->GetDescriptorSet(frameSlot),
+								  frameData->GetDynamicOffsets(frameSlot));
+			geometry->Bind(cmd); // every mesh lives in the arena, one bind per chunk
+			for (uint32 i = begin; i < end; ++i) {
+				const auto &drawCall = drawCalls[i];
 				DepthPushConstants pushConstants{ .model = drawCall.model };
 				cmd.PushConstants(pushConstants, RHI::ShaderStageFlags::Vertex);
-				cmd.BindVertexBuffer(drawCall.gpuMesh->GetVertexBuffer());
-				cmd.BindIndexBuffer(drawCall.gpuMesh->GetIndexBuffer());
-				cmd.DrawIndexed(drawCall.gpuMesh->GetIndexCount());
+				cmd.DrawIndexed(drawCall.range.indexCount, 1, drawCall.range.firstIndex,
+								static_cast<int32>(drawCall.range.vertexOffset));
 			}
 		});
 }
@@ -1,8 +1,10 @@
 #include "Aquila/Rendering/Systems/GeometrySystem.h"
 #include "Aquila/Rendering/FrameContext.h"
+#include "Aquila/Rendering/MeshLodSelector.h"
 #include "Aquila/Rendering/SceneFrameData.h"
 #include "Aquila/GFX/GfxContext.h"
 #include "Aquila/GFX/GfxCommandList.h"
+#include "Aquila/GFX/GfxGeometryArena.h"
 #include "Aquila/Graphics/RenderGraph/RGGraph.h"
 #include "Aquila/Graphics/RenderGraph/RGPassBuilder.h"
 #include "Aquila/Scene/Scene.h"
@@ -10,6 +12,7 @@
 #include "Aquila/Scene/Components/TransformComponent.h"
 #include "Aquila/Scene/Components/MaterialComponent.h"
 #include "Aquila/Foundation/Color.h"
+#include "Aquila/Foundation/SharedConstants.h"
 
 namespace Aquila::Rendering {
 
@@ -32,11 +35,14 @@ void GeometrySystem::AddPasses(RG::RenderGraph &graph, FrameContext &ctx) {
 
 	struct DrawCall {
 		Ref<GFX::GfxMesh> gpuMesh;
+		GFX::GeometryRange range;
 		mat4 model;
+		Material *material = nullptr;
 		uint32 materialIndex = 0;
 	};
 
-	std::unordered_map<Material *, std::vector<DrawCall>> batches;
+	std::vector<DrawCall> drawCalls;
+	drawCalls.reserve(view.size_hint());
 
 	for (auto entity : view) {
 		auto &transform = view.get<TransformComponent>(entity);
@@ -46,26 +52,48 @@ void GeometrySystem::AddPasses(RG::RenderGraph &graph, FrameContext &ctx) {
 		}
 
 		auto *mat = registry.try_get<MaterialComponent>(entity);
-		if (!mat || mat->type != MaterialType::Lit || !mat->material) {
+		if (!mat || mat->type != MaterialType::Lit || !mat->material || mat->materialIndex == UINT32_MAX) {
 			continue;
 		}
 
-		batches[mat->material.get()].push_back({
-			.gpuMesh = GetOrUploadMesh(mesh.data),
-			.model = transform.GetWorldMatrix(),
+		const mat4 &model = transform.GetWorldMatrix();
+		mesh.lodIndex = MeshLodSelector::Select(*mesh.data, model, mesh.lodIndex, ctx);
+		auto gpuMesh = GetOrUploadMesh(mesh.data);
+		const auto range = gpuMesh->GetLodRange(mesh.lodIndex);
+		drawCalls.push_back({
+			.gpuMesh = std::move(gpuMesh),
+			.range = range,
+			.model = model,
+			.material = mat->material.get(),
 			.materialIndex = mat->materialIndex,
 		});
 	}
 
-	if (batches.empty()) {
+	if (drawCalls.empty()) {
 		return;
 	}
 
-	auto *frameData = ctx.frameData;
+	// One flat list sorted by material keeps batches contiguous, so any chunk the graph
+	// cuts out of it only rebinds at material boundaries.
+	std::ranges::stable_sort(drawCalls, std::less<>{}, &DrawCall::material);
+
 	const uint32 frameSlot = ctx.frameSlot;
 
-	graph.AddPass(
-		"Geometry",
+	// Flush on the main thread: chunks may record concurrently and Flush writes descriptors.
+	Material *lastFlushed = nullptr;
+	for (const auto &dc : drawCalls) {
+		if (dc.material != lastFlushed) {
+			dc.material->Flush(frameSlot);
+			lastFlushed = dc.material;
+		}
+	}
+
+	auto *frameData = ctx.frameData;
+	auto *geometry = &m_Ctx->GetGeometryArena();
+	const auto drawCount = static_cast<uint32>(drawCalls.size());
+
+	graph.AddParallelPass(
+		"Geometry", drawCount, SharedConstants::MIN_DRAWS_PER_RECORD_JOB,
 		[&ctx](RG::RGPassBuilder &builder) {
 			builder.ReadBuffer(ctx.hLightList, RG::ResourceState::ShaderRead);
 			builder.ReadBuffer(ctx.hClusterLightInfo, RG::ResourceState::ShaderRead);
@@ -78,19 +106,31 @@ void GeometrySystem::AddPasses(RG::RenderGraph &graph, FrameContext &ctx) {
 									   RG::AttachmentLoadOp::DontCare, RG::AttachmentStoreOp::DontCare,
 									   /*readOnly=*/false, RG::ClearDepth{ .depth = 1.F });
 		},
-		[batches = std::move(batches), frameData, frameSlot](GFX::GfxCommandList &cmd, RG::RGRegistry &) {
-			for (auto &[material, drawCalls] : batches) {
-				material->Flush(frameSlot);
-				material->Bind(cmd, 1, frameSlot);
-				cmd.BindDescriptorSet(0, frameData->GetDescriptorSet(frameSlot));
-
-				for (const auto &dc : drawCalls) {
-					MeshPushConstants push{ .model = dc.model, .materialIndex = dc.materialIndex };
-					cmd.PushConstants(push, RHI::ShaderStageFlags::Vertex | RHI::ShaderStageFlags::Fragment);
-					cmd.BindVertexBuffer(dc.gpuMesh->GetVertexBuffer());
-					cmd.BindIndexBuffer(dc.gpuMesh->GetIndexBuffer());
-					cmd.DrawIndexed(dc.gpuMesh->GetIndexCount());
+		[drawCalls = std::move(drawCalls), frameData, frameSlot,
+		 geometry](GFX::GfxCommandList &cmd, RG::RGRegistry &, uint32 begin, uint32 end) {
+			// Vertex/index bindings survive pipeline switches, so one bind covers every batch.
+			// Set 0 does not: each pipeline owns its layout and push constant sizes differ per
+			// material, so it is rebound whenever the pipeline changes. Instances sharing a
+			// pipeline only rebind set 1, and surface data plus textures come from set 0 by
+			// materialIndex.
+			geometry->Bind(cmd);
+			Material *bound = nullptr;
+			GFX::GfxPipeline *boundPipeline = nullptr;
+			for (uint32 i = begin; i < end; ++i) {
+				const auto &dc = drawCalls[i];
+				if (dc.material != bound) {
+					dc.material->Bind(cmd, 1, frameSlot);
+					if (&dc.material->GetPipeline() != boundPipeline) {
+						cmd.BindDescriptorSet(0, frameData->GetDescriptorSet(frameSlot),
+											  frameData->GetDynamicOffsets(frameSlot));
+						boundPipeline = &dc.material->GetPipeline();
+					}
+					bound = dc.material;
 				}
+
+				MeshPushConstants push{ .model = dc.model, .materialIndex = dc.materialIndex };
+				cmd.PushConstants(push, RHI::ShaderStageFlags::Vertex | RHI::ShaderStageFlags::Fragment);
+				cmd.DrawIndexed(dc.range.indexCount, 1, dc.range.firstIndex, static_cast<int32>(dc.range.vertexOffset));
 			}
 		});
 }
@@ -15,6 +15,10 @@ namespace Aquila::Rendering {
 
 using Aquila::SharedConstants::SHADERS_DIR;
 
+void LightCullingSystem::DeclareShaders(std::vector<std::string> &outPaths) const {
+	outPaths.push_back(SHADERS_DIR + "LightCullCompute.slang");
+}
+
 void LightCullingSystem::OnInit(GFX::GfxContext &ctx) {
 	RenderingSystemBase::OnInit(ctx);
 
@@ -30,7 +34,6 @@ void LightCullingSystem::OnInit(GFX::GfxContext &ctx) {
 			{ .binding = 0, .type = RHI::DescriptorType::StorageBuffer, .stages = RHI::ShaderStageFlags::Compute, .count = 1 },
 			{ .binding = 1, .type = RHI::DescriptorType::StorageBuffer, .stages = RHI::ShaderStageFlags::Compute, .count = 1 },
 			{ .binding = 2, .type = RHI::DescriptorType::StorageBuffer, .stages = RHI::ShaderStageFlags::Compute, .count = 1 },
-			{ .binding = 3, .type = RHI::DescriptorType::StorageBuffer, .stages = RHI::ShaderStageFlags::Compute, .count = 1 },
 		},
 	});
 
@@ -44,18 +47,10 @@ void LightCullingSystem::OnInit(GFX::GfxContext &ctx) {
 	pipelineDesc.debugName = "LightCull";
 	m_Pipeline = ctx.CreateComputePipeline(pipelineDesc);
 
-	m_GlobalIndexCounter = ctx.CreateBuffer({
-		.size = sizeof(uint32),
-		.usage = RHI::BufferUsage::StorageBuffer,
-		.domain = RHI::MemoryDomain::GPU_ONLY,
-		.debugName = "GlobalIndexCounter",
-	});
-
 	auto *sfd = SceneFrameData::Get();
 	m_StorageSet = ctx.AllocateDescriptorSet(*m_StorageLayout);
 	m_StorageSet->SetBuffer(1, sfd->GetLightIndexListBuffer())
 		.SetBuffer(2, sfd->GetClusterLightInfoBuffer())
-		.SetBuffer(3, *m_GlobalIndexCounter)
 		.Flush();
 }
 
@@ -78,23 +73,23 @@ void LightCullingSystem::AddPasses(Graphics::RG::RenderGraph &graph, FrameContex
 										 Graphics::RG::ResourceState::UnorderedAccess);
 	auto hClusterLightInfo = graph.ImportBuffer(&SceneFrameData::Get()->GetClusterLightInfoBuffer(), "ClusterLightInfo",
 												Graphics::RG::ResourceState::UnorderedAccess);
-	auto hGlobalCounter = graph.ImportBuffer(m_GlobalIndexCounter.get(), "GlobalIndexCounter",
-											 Graphics::RG::ResourceState::UnorderedAccess);
 
 	graph.AddPass(
 		"LightCull",
-		[&hAABBs, &hLightList, &hClusterLightInfo, &hGlobalCounter](Graphics::RG::RGPassBuilder &builder) {
+		[&hAABBs, &hLightList, &hClusterLightInfo](Graphics::RG::RGPassBuilder &builder) {
+			// Only depends on the cluster grid, so it can overlap the depth prepass
+			builder.SetQueue(Graphics::RG::RGQueue::AsyncCompute);
 			builder.ReadBuffer(hAABBs, Graphics::RG::ResourceState::ShaderRead);
 			hLightList = builder.WriteBuffer(hLightList);
 			hClusterLightInfo = builder.WriteBuffer(hClusterLightInfo);
-			hGlobalCounter = builder.WriteBuffer(hGlobalCounter);
 		},
 		[this, frameData, frameSlot](GFX::GfxCommandList &cmd, Graphics::RG::RGRegistry &) {
-			cmd.FillBuffer(*m_GlobalIndexCounter, 0u);
 			cmd.BindPipeline(*m_Pipeline);
-			cmd.BindDescriptorSet(0, frameData->GetDescriptorSet(frameSlot));
+			cmd.BindDescriptorSet(0, frameData->GetDescriptorSet(frameSlot),
+								  frameData->GetDynamicOffsets(frameSlot));
 			cmd.BindDescriptorSet(1, *m_StorageSet);
-			cmd.Dispatch(4, 3, 6);
+			cmd.Dispatch((SharedConstants::CLUSTER_GRID_X + 4 - 1) / 4, (SharedConstants::CLUSTER_GRID_Y + 4 - 1) / 4,
+						 (SharedConstants::CLUSTER_GRID_Z + 4 - 1) / 4);
 		});
 
 	if (ctx.hClusterAABBs.IsValid()) {
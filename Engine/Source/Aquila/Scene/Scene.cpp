@@ -38,6 +38,11 @@ void Scene::OnStart() {
 	// Wire dirty callback on every TransformComponent that gets created.
 	m_EntityManager->GetRegistry().on_construct<Components::TransformComponent>().connect<&Scene::OnTransformConstruct>(
 		this);
+	// Track material changes so the renderer only re-uploads what moved.
+	auto &registry = m_EntityManager->GetRegistry();
+	registry.on_construct<Components::MaterialComponent>().connect<&Scene::OnMaterialChanged>(this);
+	registry.on_update<Components::MaterialComponent>().connect<&Scene::OnMaterialChanged>(this);
+	registry.on_destroy<Components::MaterialComponent>().connect<&Scene::OnMaterialDestroy>(this);
 	m_EntityManager->ConstructSceneGraph();
 }
 
@@ -51,6 +56,23 @@ void Scene::MarkTransformDirty(entt::entity entity) {
 	m_DirtyTransforms.MarkDirty(entity);
 }
 
+void Scene::OnMaterialChanged(entt::registry &, entt::entity entity) {
+	m_DirtyMaterials.MarkDirty(entity);
+}
+
+void Scene::OnMaterialDestroy(entt::registry &registry, entt::entity entity) {
+	m_DirtyMaterials.Remove(entity);
+	const uint32 slot = registry.get<Components::MaterialComponent>(entity).materialIndex;
+	if (slot != UINT32_MAX) {
+		m_ReleasedMaterials.push_back({ entity, slot });
+	}
+}
+
+void Scene::ClearMaterialChanges() {
+	m_DirtyMaterials.Clear();
+	m_ReleasedMaterials.clear();
+}
+
 bool Scene::HasDirtyAncestor(entt::entity e) const {
 	Entity entity(e, const_cast<Scene *>(this));
 	auto *node = entity.TryGetComponent<Components::SceneNodeComponent>();
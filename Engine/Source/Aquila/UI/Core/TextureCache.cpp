@@ -1,5 +1,6 @@
 #include "Aquila/UI/Core/TextureCache.h"
 #include "Aquila/Foundation/Macros.h"
+#include "Aquila/GFX/GfxUploadBatcher.h"
 #include "Aquila/RHI/Backend/RHITypes.h"
 #include "Aquila/Platform/Filesystem/VirtualFileSystem.h"
 
@@ -9,6 +10,10 @@ namespace Aquila::UI::Core {
 
 TextureCache::TextureCache(GFX::GfxContext &ctx, std::string basePath) : m_Ctx(ctx), m_BasePath(std::move(basePath)) {}
 
+TextureCache::~TextureCache() {
+	WaitForDecodes();
+}
+
 std::string TextureCache::Resolve(const std::string &path) const {
 	if (m_BasePath.empty() || path.find("://") != std::string::npos || (!path.empty() && path[0] == '/')) {
 		return path;
@@ -33,10 +38,9 @@ GFX::GfxTexture *TextureCache::Load(const std::string &path) {
 	std::vector<uint8> fileData(static_cast<usize>(fileSize));
 	vfile->Read(fileData.data(), static_cast<usize>(fileSize));
 
+	// Only the header here; the pixels are decoded on a worker.
 	int width = 0, height = 0, channels = 0;
-	stbi_uc *pixels =
-		stbi_load_from_memory(fileData.data(), static_cast<int>(fileSize), &width, &height, &channels, STBI_rgb_alpha);
-	if (pixels == nullptr) {
+	if (stbi_info_from_memory(fileData.data(), static_cast<int>(fileSize), &width, &height, &channels) == 0) {
 		AQUILA_LOG_ERROR("TextureCache: failed to load '{}': {}", resolved, stbi_failure_reason());
 		return nullptr;
 	}
@@ -51,14 +55,27 @@ GFX::GfxTexture *TextureCache::Load(const std::string &path) {
 
 	Ref<GFX::GfxTexture> tex = m_Ctx.CreateTexture(desc);
 	if (!tex) {
-		stbi_image_free(pixels);
 		AQUILA_LOG_ERROR("TextureCache: GfxContext::CreateTexture failed for '{}'", resolved);
 		return nullptr;
 	}
+	tex->SetResident(false);
 
-	const uint64 byteSize = static_cast<uint64>(width) * static_cast<uint64>(height) * 4u;
-	m_Ctx.UploadTextureData(*tex, pixels, byteSize);
-	stbi_image_free(pixels);
+	// Drop decodes that already finished so the list stays as long as what is in flight.
+	std::erase_if(m_Decodes, [](const Foundation::JobHandle<void> &decode) { return decode.IsComplete(); });
+	m_Decodes.push_back(Foundation::JobSystem::Get().ScheduleNormal(
+		"TextureDecode", [&batcher = m_Ctx.GetUploadBatcher(), tex, resolved, fileData = std::move(fileData)]() {
+			int w = 0, h = 0, c = 0;
+			stbi_uc *pixels =
+				stbi_load_from_memory(fileData.data(), static_cast<int>(fileData.size()), &w, &h, &c, STBI_rgb_alpha);
+			if (pixels == nullptr) {
+				// Stays a placeholder; marked so the UI stops re-recording while waiting on it.
+				AQUILA_LOG_ERROR("TextureCache: failed to decode '{}': {}", resolved, stbi_failure_reason());
+				tex->MarkFailed();
+				return;
+			}
+			batcher.UploadTexture(tex, pixels, static_cast<uint64>(w) * static_cast<uint64>(h) * 4u);
+			stbi_image_free(pixels);
+		}));
 
 	GFX::GfxTexture *raw = tex.get();
 	m_Cache.emplace(resolved, std::move(tex));
@@ -73,4 +90,11 @@ void TextureCache::Clear() {
 	m_Cache.clear();
 }
 
+void TextureCache::WaitForDecodes() {
+	for (const Foundation::JobHandle<void> &decode : m_Decodes) {
+		decode.Wait();
+	}
+	m_Decodes.clear();
+}
+
 } // namespace Aquila::UI::Core
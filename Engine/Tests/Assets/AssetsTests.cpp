@@ -0,0 +1,148 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+#include <future>
+#include "Aquila/Assets/AssetManager.h"
+
+using namespace Aquila;
+using namespace Aquila::Assets;
+
+namespace {
+
+struct TextAsset {
+	std::string text;
+};
+
+// Loads "<path>" as its own text, "fail*" as nothing, and holds every load until Open().
+struct GatedLoader {
+	std::promise<void> gate;
+	std::shared_future<void> opened = gate.get_future().share();
+	std::atomic<int> calls{ 0 };
+
+	void Open() { gate.set_value(); }
+
+	AssetLoader<TextAsset> Make() {
+		return {
+			.load =
+				[this](const std::string &path) -> Ref<TextAsset> {
+				++calls;
+				opened.wait();
+				if (path.starts_with("fail")) {
+					return nullptr;
+				}
+				return CreateRef<TextAsset>(TextAsset{ path });
+			},
+			.fallback = CreateRef<TextAsset>(TextAsset{ "fallback" }),
+		};
+	}
+};
+
+void EnsureJobSystem() {
+	static const bool initialized = [] {
+		Foundation::JobSystem::Get().Initialize(2);
+		return true;
+	}();
+	(void)initialized;
+}
+
+} // namespace
+
+TEST_SUITE("AssetManager tests") {
+	TEST_CASE("Handles return the fallback until the asset is loaded") {
+		EnsureJobSystem();
+		GatedLoader loader;
+		AssetManager assets;
+		assets.RegisterLoader(loader.Make());
+
+		AssetHandle<TextAsset> handle = assets.Load<TextAsset>("a.txt");
+		CHECK(handle.IsValid());
+		CHECK(handle.IsLoading());
+		CHECK(handle.TryGet() == nullptr);
+		CHECK(handle.Get()->text == "fallback");
+		CHECK(assets.HasPendingLoads());
+
+		loader.Open();
+		assets.WaitForAll();
+		CHECK(handle.IsReady());
+		CHECK(handle.Get()->text == "a.txt");
+		CHECK_FALSE(assets.HasPendingLoads());
+	}
+
+	TEST_CASE("Requests for an asset in flight share one load") {
+		EnsureJobSystem();
+		GatedLoader loader;
+		AssetManager assets;
+		assets.RegisterLoader(loader.Make());
+
+		AssetHandle<TextAsset> first = assets.Load<TextAsset>("b.txt", Priority::Low);
+		AssetHandle<TextAsset> second = assets.Load<TextAsset>("b.txt", Priority::Low);
+		// More urgent: queued again, but only one of the two jobs loads.
+		AssetHandle<TextAsset> third = assets.Load<TextAsset>("b.txt", Priority::VeryHigh);
+		CHECK(first == second);
+		CHECK(first == third);
+
+		loader.Open();
+		assets.WaitForAll();
+		CHECK(loader.calls.load() == 1);
+		CHECK(first.Get() == third.Get());
+		CHECK(assets.GetAssetCount() == 1u);
+	}
+
+	TEST_CASE("Assets are addressable by UUID") {
+		EnsureJobSystem();
+		GatedLoader loader;
+		loader.Open();
+		AssetManager assets;
+		assets.RegisterLoader(loader.Make());
+
+		AssetHandle<TextAsset> byPath = assets.Load<TextAsset>("c.txt");
+		CHECK(assets.Find<TextAsset>(byPath.GetUUID()) == byPath);
+		CHECK(assets.GetPath(byPath.GetUUID()) == "c.txt");
+
+		const Foundation::UUID uuid = Foundation::UUID::Generate();
+		REQUIRE(assets.Register(uuid, "d.txt"));
+		CHECK_FALSE(assets.Register(Foundation::UUID::Generate(), "d.txt"));
+		AssetHandle<TextAsset> byUuid = assets.Load<TextAsset>(uuid);
+		assets.WaitForAll();
+		CHECK(byUuid.GetUUID() == uuid);
+		CHECK(byUuid.Get()->text == "d.txt");
+
+		CHECK_FALSE(assets.Load<TextAsset>(Foundation::UUID::Generate()).IsValid());
+		CHECK_FALSE(assets.Load<int>("e.txt").IsValid()); // no loader for int
+	}
+
+	TEST_CASE("Failed loads keep the fallback") {
+		EnsureJobSystem();
+		GatedLoader loader;
+		loader.Open();
+		AssetManager assets;
+		assets.RegisterLoader(loader.Make());
+
+		AssetHandle<TextAsset> handle = assets.Load<TextAsset>("fail.txt");
+		assets.WaitForAll();
+		CHECK(handle.IsFailed());
+		CHECK_FALSE(handle.IsReady());
+		CHECK(handle.Get()->text == "fallback");
+	}
+
+	TEST_CASE("CollectGarbage releases assets no handle refers to") {
+		EnsureJobSystem();
+		GatedLoader loader;
+		loader.Open();
+		AssetManager assets;
+		assets.RegisterLoader(loader.Make());
+
+		AssetHandle<TextAsset> handle = assets.Load<TextAsset>("f.txt");
+		assets.WaitForAll();
+		assets.CollectGarbage();
+		CHECK(assets.GetAssetCount() == 1u);
+
+		handle = {};
+		assets.CollectGarbage();
+		CHECK(assets.GetAssetCount() == 0u);
+
+		handle = assets.Load<TextAsset>("f.txt");
+		assets.WaitForAll();
+		CHECK(loader.calls.load() == 2);
+		CHECK(handle.Get()->text == "f.txt");
+	}
+}
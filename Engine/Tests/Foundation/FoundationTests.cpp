@@ -4,6 +4,10 @@
 #include "Aquila/Foundation/Timer.h"
 #include "Aquila/Foundation/Log.h"
 #include "Aquila/Foundation/Profiler.h"
+#include "Aquila/Foundation/Allocation/RangeAllocator.h"
+#include "Aquila/Foundation/Hash.h"
+#include "Aquila/Foundation/Cache/ResidentCache.h"
+#include "Aquila/Foundation/Job.h"
 
 using namespace Aquila::Foundation;
 
@@ -420,3 +424,198 @@ TEST_SUITE("Logger tests") {
 		PROFILE_SHUTDOWN(); // ! TODO: THIS SHOULD ALWAYS BE IN THE LAST TEST FOR THE PROFILER
 	}
 }
+
+TEST_SUITE("RangeAllocator tests") {
+	TEST_CASE("Allocations are packed and accounted for") {
+		RangeAllocator alloc(100);
+		auto a = alloc.Allocate(10);
+		auto b = alloc.Allocate(20);
+		REQUIRE(a.has_value());
+		REQUIRE(b.has_value());
+		CHECK(*a == 0u);
+		CHECK(*b == 10u);
+		CHECK(alloc.GetUsed() == 30u);
+		CHECK(alloc.GetAllocationCount() == 2u);
+	}
+
+	TEST_CASE("Allocation larger than any free block fails") {
+		RangeAllocator alloc(16);
+		CHECK_FALSE(alloc.Allocate(17).has_value());
+		CHECK_FALSE(alloc.Allocate(0).has_value());
+	}
+
+	TEST_CASE("Free coalesces with both neighbours") {
+		RangeAllocator alloc(30);
+		auto a = alloc.Allocate(10);
+		auto b = alloc.Allocate(10);
+		auto c = alloc.Allocate(10);
+		CHECK(alloc.GetFreeBlockCount() == 0u);
+
+		alloc.Free(*a);
+		alloc.Free(*c);
+		CHECK(alloc.GetFreeBlockCount() == 2u);
+
+		alloc.Free(*b);
+		CHECK(alloc.GetFreeBlockCount() == 1u);
+		CHECK(alloc.GetLargestFreeBlock() == 30u);
+		CHECK(alloc.GetUsed() == 0u);
+	}
+
+	TEST_CASE("Best fit picks the smallest hole that fits") {
+		RangeAllocator alloc(100);
+		auto a = alloc.Allocate(30);
+		(void)alloc.Allocate(5);
+		auto c = alloc.Allocate(10);
+		(void)alloc.Allocate(5);
+		alloc.Free(*a);
+		alloc.Free(*c);
+
+		auto d = alloc.Allocate(8);
+		REQUIRE(d.has_value());
+		CHECK(*d == *c);
+	}
+
+	TEST_CASE("Double free is rejected") {
+		RangeAllocator alloc(10);
+		auto a = alloc.Allocate(4);
+		CHECK(alloc.Free(*a));
+		CHECK_FALSE(alloc.Free(*a));
+	}
+
+	TEST_CASE("Grow merges with trailing free space") {
+		RangeAllocator alloc(10);
+		(void)alloc.Allocate(6);
+		alloc.Grow(20);
+		CHECK(alloc.GetCapacity() == 20u);
+		CHECK(alloc.GetFreeBlockCount() == 1u);
+		CHECK(alloc.GetLargestFreeBlock() == 14u);
+	}
+
+	TEST_CASE("Compact packs live ranges and reports moves") {
+		RangeAllocator alloc(40);
+		auto a = alloc.Allocate(10);
+		auto b = alloc.Allocate(10);
+		auto c = alloc.Allocate(10);
+		alloc.Free(*a);
+		alloc.Free(*c);
+		CHECK(alloc.GetFragmentation() > 0.F);
+
+		auto moves = alloc.Compact();
+		REQUIRE(moves.size() == 1u);
+		CHECK(moves[0].from == *b);
+		CHECK(moves[0].to == 0u);
+		CHECK(moves[0].size == 10u);
+		CHECK(alloc.GetFragmentation() == doctest::Approx(0.F));
+		CHECK(alloc.Free(0));
+	}
+}
+
+TEST_SUITE("Hash tests") {
+	TEST_CASE("FNV-1a matches reference values") {
+		static_assert(HashFnv1a("") == 0x811c9dc5u);
+		CHECK(HashFnv1a("a") == 0xe40c292cu);
+		CHECK(HashFnv1a("foobar") == 0xbf9cf968u);
+	}
+
+	TEST_CASE("64-bit FNV-1a matches reference values and chains") {
+		static_assert(HashFnv1a64("") == 0xcbf29ce484222325ull);
+		CHECK(HashFnv1a64("a") == 0xaf63dc4c8601ec8cull);
+		CHECK(HashFnv1a64("foobar") == 0x85944171f73967e8ull);
+		CHECK(HashFnv1a64("bar", HashFnv1a64("foo")) == HashFnv1a64("foobar"));
+	}
+
+	TEST_CASE("Compile-time and runtime hashes agree") {
+		constexpr uint32 compileTime = HashFnv1a("roughness");
+		const std::string runtime = "roughness";
+		CHECK(HashFnv1a(runtime) == compileTime);
+		CHECK(HashFnv1a("metallic") != compileTime);
+	}
+}
+
+TEST_SUITE("ResidentCache tests") {
+	using IntCache = ResidentCache<std::string, int>;
+	constexpr ResidentBytes kEntryBytes{ .cpu = 60, .gpu = 40 };
+
+	TEST_CASE("Lookups count hits and misses, entries their bytes") {
+		IntCache cache("Test");
+		CHECK(cache.Find("a") == nullptr);
+		cache.Insert("a", CreateRef<int>(1), kEntryBytes);
+		REQUIRE(cache.Find("a") != nullptr);
+		CHECK(cache.Peek("a") != nullptr);
+
+		const ResidentCacheStats stats = cache.GetStats();
+		CHECK(stats.hits == 1u);
+		CHECK(stats.misses == 1u);
+		CHECK(stats.HitRate() == doctest::Approx(0.5F));
+		CHECK(stats.bytes.cpu == 60u);
+		CHECK(stats.bytes.gpu == 40u);
+
+		cache.Insert("a", CreateRef<int>(2), { .cpu = 10 });
+		CHECK(cache.GetResidentBytes().Total() == 10u);
+		CHECK(cache.Remove("a"));
+		CHECK(cache.GetResidentBytes().Total() == 0u);
+	}
+
+	TEST_CASE("Trim evicts the least recently used entries first") {
+		IntCache cache("Test", 250);
+		cache.Insert("a", CreateRef<int>(1), kEntryBytes);
+		cache.Insert("b", CreateRef<int>(2), kEntryBytes);
+		cache.Insert("c", CreateRef<int>(3), kEntryBytes);
+		(void)cache.Find("a");
+
+		cache.Trim();
+		CHECK_FALSE(cache.Contains("b"));
+		CHECK(cache.Contains("a"));
+		CHECK(cache.Contains("c"));
+		CHECK(cache.GetStats().evictions == 1u);
+	}
+
+	TEST_CASE("Entries referenced outside the cache are never evicted") {
+		IntCache cache("Test", 50);
+		cache.Insert("a", CreateRef<int>(1), kEntryBytes);
+		cache.Insert("b", CreateRef<int>(2), kEntryBytes);
+		const Ref<int> held = cache.Find("a");
+
+		cache.Trim();
+		CHECK(cache.Contains("a"));
+		CHECK_FALSE(cache.Contains("b"));
+		CHECK(cache.GetResidentBytes().Total() == 100u);
+		CHECK_FALSE(cache.EvictOldest());
+	}
+
+	TEST_CASE("Global budget evicts the oldest entry across caches") {
+		ResidencyManager &manager = ResidencyManager::Get();
+		const uint64 previousBudget = manager.GetGlobalBudget();
+		manager.SetGlobalBudget(150);
+
+		IntCache first("First");
+		IntCache second("Second");
+		first.Insert("old", CreateRef<int>(1), kEntryBytes);
+		manager.EndFrame();
+		second.Insert("new", CreateRef<int>(2), kEntryBytes);
+		manager.EndFrame();
+
+		CHECK_FALSE(first.Contains("old"));
+		CHECK(second.Contains("new"));
+		CHECK(manager.GetResidentBytes().Total() == 100u);
+
+		manager.SetGlobalBudget(previousBudget);
+	}
+}
+
+TEST_SUITE("Job tests") {
+	TEST_CASE("Queued jobs pop most urgent first, then in schedule order") {
+		std::priority_queue<Job> queue;
+		queue.push({ .priority = Priority::Low, .debugName = "low", .sequence = 0 });
+		queue.push({ .priority = Priority::Medium, .debugName = "medium-2", .sequence = 2 });
+		queue.push({ .priority = Priority::VeryHigh, .debugName = "very-high", .sequence = 3 });
+		queue.push({ .priority = Priority::Medium, .debugName = "medium-1", .sequence = 1 });
+
+		std::vector<std::string> order;
+		while (!queue.empty()) {
+			order.push_back(queue.top().debugName);
+			queue.pop();
+		}
+		CHECK(order == std::vector<std::string>{ "very-high", "medium-1", "medium-2", "low" });
+	}
+}
@@ -1,6 +1,10 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
 #include "Aquila/Platform/Filesystem/Filesystem.h"
+#include "Aquila/Platform/Filesystem/FileWatcher.h"
 #include "Aquila/Platform/Filesystem/NativeFileSystem.h"
 
 using namespace Aquila::Platform::Filesystem;
@@ -120,7 +124,95 @@ TEST_SUITE("Filesystem::File") {
 
 		CleanupTempRoot(root);
 	}
+
+	TEST_CASE("FileWriteAtomic / FileReadAll") {
+		const std::string root = MakeTempRoot("fileatomic");
+		const std::string file = PathJoin(root, "blob.bin");
+
+		const std::vector<uint8> first = { 1, 2, 3, 4 };
+		const std::vector<uint8> second = { 9, 8 };
+		CHECK(FileWriteAtomic(file, first.data(), first.size()) == true);
+		CHECK(FileWriteAtomic(file, second.data(), second.size()) == true);
+		CHECK(DirList(root).size() == 1); // no temp files left behind
+
+		std::vector<uint8> read;
+		CHECK(FileReadAll(file, read) == true);
+		CHECK(read == second);
+		CHECK(FileReadAll(PathJoin(root, "missing.bin"), read) == false);
+
+		FileRemove(file);
+		CleanupTempRoot(root);
+	}
+}
+
+#ifdef AQUILA_PLATFORM_LINUX
+TEST_SUITE("Filesystem::FileWatcher") {
+	TEST_CASE("Reports writes and renames to watched files only") {
+		const std::string root = MakeTempRoot("filewatcher");
+		const std::string watched = PathJoin(root, "watched.slang");
+		const std::string sibling = PathJoin(root, "sibling.slang");
+		const std::vector<uint8> bytes = { 1, 2, 3 };
+		CHECK(FileWriteAtomic(watched, bytes.data(), bytes.size()) == true);
+
+		FileWatcher watcher;
+		CHECK(watcher.Watch(watched) == true);
+		CHECK(watcher.IsWatching(watched) == true);
+		CHECK(watcher.Poll().empty());
+
+		// FileWriteAtomic renames over the target, the way many editors save
+		CHECK(FileWriteAtomic(watched, bytes.data(), bytes.size()) == true);
+		CHECK(FileWriteAtomic(watched, bytes.data(), bytes.size()) == true);
+		CHECK(FileWriteAtomic(sibling, bytes.data(), bytes.size()) == true);
+		const std::vector<std::string> changed = watcher.Poll();
+		REQUIRE(changed.size() == 1); // reported once, sibling ignored
+		CHECK(changed[0] == FileWatcher::Normalize(watched));
+		CHECK(watcher.Poll().empty());
+
+		watcher.Unwatch(watched);
+		CHECK(watcher.IsWatching(watched) == false);
+		CHECK(FileWriteAtomic(watched, bytes.data(), bytes.size()) == true);
+		CHECK(watcher.Poll().empty());
+
+		FileRemove(watched);
+		FileRemove(sibling);
+		CleanupTempRoot(root);
+	}
+
+	TEST_CASE("Wakes its owner once per batch of changes until polled") {
+		const std::string root = MakeTempRoot("filewatcher_wake");
+		const std::string watched = PathJoin(root, "watched.slang");
+		const std::vector<uint8> bytes = { 1, 2, 3 };
+		CHECK(FileWriteAtomic(watched, bytes.data(), bytes.size()) == true);
+
+		FileWatcher watcher;
+		CHECK(watcher.Watch(watched) == true);
+		std::atomic<uint32> wakes{ 0 };
+		watcher.SetWakeCallback([&wakes] { ++wakes; });
+		const auto waitForWakes = [&wakes](uint32 count) {
+			for (uint32 i = 0; i < 200 && wakes < count; ++i) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+			return wakes.load();
+		};
+
+		CHECK(FileWriteAtomic(watched, bytes.data(), bytes.size()) == true);
+		CHECK(waitForWakes(1) == 1);
+
+		// Nothing polled yet, so a second save does not wake again.
+		CHECK(FileWriteAtomic(watched, bytes.data(), bytes.size()) == true);
+		std::this_thread::sleep_for(std::chrono::milliseconds(300));
+		CHECK(wakes == 1);
+
+		CHECK(watcher.Poll().size() == 1);
+		CHECK(FileWriteAtomic(watched, bytes.data(), bytes.size()) == true);
+		CHECK(waitForWakes(2) == 2);
+		CHECK(watcher.Poll().size() == 1);
+
+		FileRemove(watched);
+		CleanupTempRoot(root);
+	}
 }
+#endif
 
 TEST_SUITE("NativeFileSystem") {
 	TEST_CASE("DirCreate / DirExists / DirRemove") {
@@ -1,9 +1,40 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest.h>
 
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <random>
 #include <GLFW/glfw3.h>
 
+#include "Aquila/Foundation/Job.h"
 #include "Aquila/GFX/GfxContext.h"
+#include "Aquila/GFX/GfxGeometryArena.h"
+#include "Aquila/GFX/GfxMesh.h"
+#include "Aquila/GFX/GfxMeshRegistry.h"
+#include "Aquila/GFX/GfxRenderpass.h"
+#include "Aquila/GFX/GfxStagingPool.h"
+#include "Aquila/GFX/GfxUploadBatcher.h"
+#include "Aquila/GFX/GfxUploadRing.h"
+#include "Aquila/Graphics/Core/QuadBatcher.h"
+#include "Aquila/Graphics/Resources/MeshCache.h"
+#include "Aquila/Graphics/Resources/MeshCooker.h"
+#include "Aquila/Graphics/Resources/MeshOptimizer.h"
+#include "Aquila/Graphics/Resources/MeshSimplifier.h"
+#include "Aquila/Graphics/SurfaceData.h"
+#include "Aquila/Graphics/Texture/BlockCompressor.h"
+#include "Aquila/Graphics/Texture/Ktx2.h"
+#include "Aquila/Graphics/Texture/MipGenerator.h"
+#include "Aquila/RHI/FormatUtils.h"
+#include "Aquila/RHI/Vulkan/VulkanDevice.h"
+#include "Aquila/RHI/Vertex.h"
+#include "Aquila/Platform/Filesystem/Filesystem.h"
+#include "Aquila/Platform/Filesystem/NativeFileSystem.h"
+#include "Aquila/Platform/Filesystem/VirtualFileSystem.h"
+#include "Aquila/RHI/Vulkan/VulkanShaderCompiler.h"
+#include "Aquila/Rendering/BindlessTextures.h"
+#include "Aquila/Rendering/MeshLodSelector.h"
+#include "Aquila/UI/Core/TextureCache.h"
 
 using namespace Aquila;
 
@@ -134,6 +165,94 @@ TEST_SUITE("Buffer") {
 		auto buf = Ctx().CreateBuffer(desc);
 		CHECK(buf != nullptr);
 	}
+
+	TEST_CASE("Upload ring hands out aligned ranges and grows past its capacity") {
+		auto &ring = Ctx().GetUploadRing();
+		ring.BeginFrame(0);
+
+		const GFX::UploadAllocation first = ring.Allocate(100);
+		const GFX::UploadAllocation second = ring.Allocate(4);
+		REQUIRE(first.data != nullptr);
+		CHECK(first.offset == 0);
+		CHECK(second.offset == SharedConstants::UPLOAD_RING_ALIGNMENT);
+		CHECK(second.buffer == first.buffer);
+
+		const GFX::UploadAllocation large = ring.Allocate(ring.GetCapacity());
+		CHECK(large.bufferId != first.bufferId);
+		CHECK(large.offset == 0);
+
+		ring.BeginFrame(0);
+		CHECK(ring.GetUsed() == 0);
+		ring.EndFrame();
+	}
+
+	TEST_CASE("Staging pool reuses retired ranges and falls back to dedicated buffers") {
+		GFX::GfxStagingPool pool(Ctx(), 4096);
+
+		GFX::StagingAllocation first = pool.Allocate(1024);
+		GFX::StagingAllocation second = pool.Allocate(1000);
+		GFX::StagingAllocation third = pool.Allocate(1024);
+		REQUIRE(first.IsValid());
+		GFX::GfxBuffer *ring = first.buffer;
+		CHECK(first.offset == 0);
+		CHECK(second.offset == 1024);
+		CHECK(third.offset == 2032);
+		CHECK(third.buffer == ring);
+
+		// Too big for the ring: dedicated, and counted towards the peak.
+		GFX::StagingAllocation large = pool.Allocate(4096);
+		CHECK(large.buffer != ring);
+		CHECK(pool.GetStats().dedicatedAllocations == 1);
+		CHECK(pool.GetStats().peakInUse >= 3056 + 4096);
+
+		// The ring is held by unsubmitted work, so a full ring steps around it.
+		GFX::StagingAllocation spill = pool.Allocate(2048);
+		CHECK(spill.buffer != ring);
+
+		for (GFX::StagingAllocation *alloc : { &first, &second, &third, &large, &spill }) {
+			pool.Free(*alloc);
+		}
+		GFX::StagingAllocation reused = pool.Allocate(2048);
+		CHECK(reused.buffer == ring);
+		CHECK(reused.offset == 0);
+		CHECK(pool.GetStats().dedicatedInUse == 0);
+		pool.Free(reused);
+	}
+
+	TEST_CASE("Geometry arena defragments on Tick once freed ranges retire") {
+		GFX::GfxGeometryArena arena(Ctx());
+		constexpr uint32 kBlock = GFX::GfxGeometryArena::InitialVertexCapacity / 8;
+		const std::vector<RHI::PackedVertex> vertices(kBlock);
+		const std::vector<uint32> indices = { 0, 1, 2 };
+
+		std::vector<GFX::GfxGeometryArena::Handle> handles;
+		for (uint32 i = 0; i < 8; ++i) {
+			handles.push_back(arena.Allocate(vertices, indices));
+		}
+		// Every other block freed: half the vertex buffer is free, in holes no bigger than a block.
+		for (uint32 i = 0; i < 8; i += 2) {
+			arena.Free(handles[i]);
+		}
+		CHECK(arena.GetStats().liveRanges == 4);
+
+		// Nothing moves while the freed ranges wait out the frames in flight.
+		arena.Tick();
+		CHECK(arena.GetRange(handles[1]).vertexOffset == kBlock);
+		for (uint32 frame = 0; frame < SharedConstants::MAX_FRAMES_IN_FLIGHT; ++frame) {
+			arena.Tick();
+		}
+
+		const GFX::GfxGeometryArena::Stats stats = arena.GetStats();
+		CHECK(stats.liveRanges == 4);
+		CHECK(stats.vertexFragmentation == doctest::Approx(0.F));
+		for (uint32 i = 1; i < 8; i += 2) {
+			CHECK(arena.GetRange(handles[i]).vertexOffset == (i / 2) * kBlock);
+		}
+		for (uint32 i = 1; i < 8; i += 2) {
+			arena.Free(handles[i]);
+		}
+		Ctx().WaitIdle();
+	}
 }
 
 // [Texture]
@@ -226,6 +345,39 @@ TEST_SUITE("Texture") {
 		auto tex = Ctx().CreateTexture(desc);
 		CHECK(tex != nullptr);
 	}
+
+	TEST_CASE("Block-compressed level sizes round up to whole blocks") {
+		CHECK(RHI::GetFullMipCount(100, 37) == 7u);
+		CHECK(RHI::GetTextureLevelSize(RHI::TextureFormat::BC7_RGBA, 100, 37) == 25u * 10u * 16u);
+		CHECK(RHI::GetTextureLevelSize(RHI::TextureFormat::BC1_RGBA, 100, 37, 6) == 8u);
+		CHECK(RHI::GetTextureLevelSize(RHI::TextureFormat::RGBA8, 100, 37, 1) == 50u * 18u * 4u);
+	}
+
+	TEST_CASE("BC7 texture uploads a full mip chain") {
+		if (!Ctx().SupportsBlockCompression()) {
+			MESSAGE("Device has no BC support, skipping");
+			return;
+		}
+		RHI::TextureDesc desc{};
+		desc.width = 100;
+		desc.height = 37;
+		desc.mipLevels = RHI::GetFullMipCount(desc.width, desc.height);
+		desc.format = RHI::TextureFormat::BC7_RGBA_SRGB;
+		desc.usage = RHI::TextureUsage::Sampled | RHI::TextureUsage::TransferDst;
+		desc.debugName = "Test_BC7_Mipped";
+
+		auto tex = Ctx().CreateTexture(desc);
+		REQUIRE(tex != nullptr);
+		CHECK(tex->GetMipLevels() == 7u);
+
+		uint64 byteSize = 0;
+		for (uint32 level = 0; level < desc.mipLevels; ++level) {
+			byteSize += RHI::GetTextureLevelSize(desc.format, desc.width, desc.height, level);
+		}
+		std::vector<uint8> blocks(byteSize, 0);
+		Ctx().UploadTextureData(*tex, blocks.data(), blocks.size());
+		Ctx().WaitIdle();
+	}
 }
 
 // [Swapchain]
@@ -266,6 +418,115 @@ TEST_SUITE("Swapchain") {
 	}
 }
 
+// [Descriptor]
+
+TEST_SUITE("Descriptor") {
+	TEST_CASE("Texture array accepts writes to individual elements") {
+		auto layout = Ctx().CreateDescriptorSetLayout({
+			.bindings = { {
+				.binding = 0,
+				.type = RHI::DescriptorType::CombinedImageSampler,
+				.stages = RHI::ShaderStageFlags::Fragment,
+				.count = 64,
+				.partiallyBound = true,
+			} },
+		});
+		REQUIRE(layout != nullptr);
+		auto set = Ctx().AllocateDescriptorSet(*layout);
+		REQUIRE(set != nullptr);
+
+		RHI::TextureDesc desc{};
+		desc.width = 4;
+		desc.height = 4;
+		desc.format = RHI::TextureFormat::RGBA8;
+		desc.usage = RHI::TextureUsage::Sampled | RHI::TextureUsage::TransferDst;
+		desc.debugName = "Test_Bindless";
+		auto tex = Ctx().CreateTexture(desc);
+		REQUIRE(tex != nullptr);
+
+		CHECK_NOTHROW(set->SetTexture(0, *tex, 0).SetTexture(0, *tex, 63).Flush());
+	}
+
+	TEST_CASE("Bindless slots are shared per texture and reused only after the frames in flight") {
+		auto layout = Ctx().CreateDescriptorSetLayout({
+			.bindings = { {
+				.binding = Rendering::BindlessTextures::kBinding,
+				.type = RHI::DescriptorType::CombinedImageSampler,
+				.stages = RHI::ShaderStageFlags::Fragment,
+				.count = SharedConstants::MAX_BINDLESS_TEXTURES,
+				.partiallyBound = true,
+			} },
+		});
+		REQUIRE(layout != nullptr);
+		auto set = Ctx().AllocateDescriptorSet(*layout);
+		REQUIRE(set != nullptr);
+
+		auto makeTexture = [] {
+			RHI::TextureDesc desc{};
+			desc.width = 4;
+			desc.height = 4;
+			desc.format = RHI::TextureFormat::RGBA8;
+			desc.usage = RHI::TextureUsage::Sampled | RHI::TextureUsage::TransferDst;
+			desc.debugName = "Test_BindlessSlot";
+			return Ctx().CreateTexture(desc);
+		};
+		const auto a = makeTexture();
+		const auto b = makeTexture();
+		const auto c = makeTexture();
+		const auto d = makeTexture();
+
+		Rendering::BindlessTextures bindless(Ctx());
+		CHECK(bindless.Acquire(nullptr) == Graphics::kNoBindlessTexture);
+
+		const uint32 slotA = bindless.Acquire(a);
+		CHECK(slotA == 0);
+		CHECK(bindless.Acquire(a) == slotA);
+		CHECK(bindless.Acquire(b) == 1);
+		CHECK(bindless.GetLiveCount() == 2);
+
+		bindless.Release(slotA);
+		CHECK(bindless.GetLiveCount() == 2);
+		bindless.Release(slotA);
+		CHECK(bindless.GetLiveCount() == 1);
+		bindless.Release(slotA);
+		CHECK(bindless.GetLiveCount() == 1);
+
+		// Frames recorded before the release may still sample slot 0.
+		for (uint32 frame = 0; frame + 1 < SharedConstants::MAX_FRAMES_IN_FLIGHT; ++frame) {
+			bindless.Update(frame, *set);
+		}
+		CHECK(bindless.Acquire(c) == 2);
+
+		bindless.Update(SharedConstants::MAX_FRAMES_IN_FLIGHT - 1, *set);
+		CHECK(bindless.Acquire(d) == slotA);
+		CHECK(bindless.GetLiveCount() == 3);
+	}
+
+	TEST_CASE("Dynamic uniform buffer accepts a sub-range write") {
+		auto layout = Ctx().CreateDescriptorSetLayout({
+			.bindings = { {
+				.binding = 0,
+				.type = RHI::DescriptorType::UniformBufferDynamic,
+				.stages = RHI::ShaderStageFlags::Vertex,
+				.count = 1,
+			} },
+		});
+		REQUIRE(layout != nullptr);
+		auto set = Ctx().AllocateDescriptorSet(*layout);
+		REQUIRE(set != nullptr);
+
+		RHI::BufferDesc desc{};
+		desc.size = 4096;
+		desc.usage = RHI::BufferUsage::UniformBuffer;
+		desc.domain = RHI::MemoryDomain::CPU_TO_GPU;
+		desc.debugName = "Test_DynamicUBO";
+		auto buf = Ctx().CreateBuffer(desc);
+		REQUIRE(buf != nullptr);
+
+		CHECK_NOTHROW(set->SetBuffer(0, *buf, 0, 256).Flush());
+	}
+}
+
 // [CommandList]
 
 TEST_SUITE("CommandList") {
@@ -302,4 +563,903 @@ TEST_SUITE("CommandList") {
 	TEST_CASE("ExecuteImmediate does not crash") {
 		CHECK_NOTHROW(Ctx().ExecuteImmediate(RHI::CommandListType::Transfer, [](GFX::GfxCommandList &) {}));
 	}
+
+	TEST_CASE("Upload batcher signals the transfer timeline and releases completed batches") {
+		auto dst = Ctx().CreateBuffer({
+			.size = 256,
+			.usage = RHI::BufferUsage::VertexBuffer | RHI::BufferUsage::TransferDst,
+			.domain = RHI::MemoryDomain::GPU_ONLY,
+			.transferQueueShared = true,
+			.debugName = "Test_UploadDst",
+		});
+		REQUIRE(dst != nullptr);
+
+		auto &batcher = Ctx().GetUploadBatcher();
+		const std::array<uint32, 16> data{};
+		bool completed = false;
+		batcher.UploadBuffer(dst, data.data(), sizeof(data), 64);
+		batcher.Record([](GFX::GfxCommandList &) {}, [&] { completed = true; });
+		CHECK(batcher.HasPending());
+
+		batcher.SubmitAndWait();
+		CHECK(completed);
+		CHECK_FALSE(batcher.HasPending());
+		CHECK(Ctx().GetCompletedValue(RHI::CommandListType::Transfer) > 0);
+	}
+
+	TEST_CASE("Texture uploads on the transfer queue pass validation") {
+		if (!RHI::VulkanDevice::enableValidationLayers) {
+			MESSAGE("Validation layers are disabled in this build");
+			return;
+		}
+
+		RHI::TextureDesc desc{};
+		desc.width = 64;
+		desc.height = 64;
+		desc.mipLevels = 7;
+		desc.format = RHI::TextureFormat::RGBA8;
+		desc.usage = RHI::TextureUsage::Sampled | RHI::TextureUsage::TransferDst;
+		desc.debugName = "Test_TransferUpload";
+		auto tex = Ctx().CreateTexture(desc);
+		REQUIRE(tex != nullptr);
+
+		uint64 size = 0;
+		for (uint32 level = 0; level < desc.mipLevels; ++level) {
+			size += RHI::GetTextureLevelSize(desc.format, desc.width, desc.height, level);
+		}
+		const std::vector<uint8> pixels(size, 0x7F);
+		const uint32 errorsBefore = RHI::VulkanDevice::GetValidationErrorCount();
+
+		auto &batcher = Ctx().GetUploadBatcher();
+		batcher.UploadTexture(tex, pixels.data(), size);
+		CHECK_FALSE(tex->IsResident());
+
+		auto frame = Ctx().CreateCommandList(RHI::CommandListType::Graphics, "Test_TransferAcquire");
+		frame->Begin();
+		batcher.Submit(*frame);
+		frame->End();
+		// SubmitAndWait drops the frame list's queue waits, so wait for the transfer batch here.
+		const uint64 batchValue = Ctx().GetLastSubmittedValue(RHI::CommandListType::Transfer);
+		Ctx().WaitForTimeline(RHI::CommandListType::Transfer, batchValue);
+		Ctx().SubmitAndWait(*frame);
+		batcher.SubmitAndWait();
+
+		CHECK(tex->IsResident());
+		CHECK(RHI::VulkanDevice::GetValidationErrorCount() == errorsBefore);
+	}
+}
+
+// [QuadBatcher]
+
+TEST_SUITE("QuadBatcher") {
+	TEST_CASE("A texture that fails to decode lets the UI replay again") {
+		using namespace Platform::Filesystem;
+
+		// Signature, a 4x4 RGBA IHDR and an IDAT that promises 64 bytes but holds 8: the header
+		// reads fine on the calling thread, and decoding fails on the worker.
+		const std::vector<uint8> png = {
+			0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, // signature
+			0x00, 0x00, 0x00, 0x0D, 'I', 'H', 'D', 'R', // IHDR
+			0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x08, 0x06, 0x00, 0x00, 0x00, // 4x4, RGBA8
+			0x00, 0x00, 0x00, 0x00, // CRC, unchecked
+			0x00, 0x00, 0x00, 0x40, 'I', 'D', 'A', 'T', // IDAT
+			0x78, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // cut short
+		};
+		const std::filesystem::path root = std::filesystem::temp_directory_path() / "AquilaRHITests";
+		std::filesystem::create_directories(root);
+		std::ofstream(root / "truncated.png", std::ios::binary)
+			.write(reinterpret_cast<const char *>(png.data()), static_cast<std::streamsize>(png.size()));
+
+		VirtualFileSystem::Init();
+		VirtualFileSystem::Get()->Mount("/testdata", CreateRef<NativeFileSystem>(root.string()));
+		RHI::VulkanShaderCompiler::Initialize();
+		Foundation::JobSystem::Get().Initialize();
+
+		UI::Core::TextureCache cache(Ctx());
+		GFX::GfxTexture *tex = cache.Load("/testdata/truncated.png");
+		REQUIRE(tex != nullptr);
+		cache.WaitForDecodes();
+		CHECK(tex->HasFailed());
+		CHECK_FALSE(tex->IsResident());
+
+		auto target = Ctx().CreateTexture({
+			.width = 64,
+			.height = 64,
+			.format = RHI::TextureFormat::BGRA8,
+			.usage = RHI::TextureUsage::ColorAttachment,
+			.debugName = "Test_QuadTarget",
+		});
+		auto pass = Ctx().CreateRenderPass({
+			.colorAttachments = { { .texture = &target->GetRHI() } },
+			.debugName = "Test_QuadPass",
+		});
+		Graphics::QuadBatcher quads(Ctx());
+
+		auto cmd = Ctx().CreateCommandList(RHI::CommandListType::Graphics, "Test_QuadCapture");
+		cmd->Begin();
+		pass->Begin(*cmd);
+		quads.BeginCapture();
+		quads.Begin(*cmd, RHI::TextureFormat::BGRA8, RHI::SampleCount::x1, mat4(1.F));
+		quads.DrawSprite({ .size = { 16.F, 16.F }, .texture = tex });
+		quads.End();
+		pass->End(*cmd);
+		cmd->End();
+		Ctx().SubmitAndWait(*cmd);
+
+		CHECK(quads.CanReplay());
+
+		VirtualFileSystem::Shutdown();
+		std::filesystem::remove_all(root);
+	}
+}
+
+// [Vertex]
+TEST_SUITE("Vertex") {
+	TEST_CASE("Packed vertices round-trip within quantization error") {
+		RHI::Vertex v;
+		v.pos = vec3(1.5F, -2.25F, 100.F);
+		v.color = vec3(0.25F, 0.5F, 1.F);
+		v.normals = glm::normalize(vec3(0.3F, -0.8F, -0.52F));
+		v.tangent = vec4(glm::normalize(vec3(-0.6F, 0.1F, -0.79F)), -1.F);
+		v.texcoord = vec2(0.125F, 3.75F);
+
+		const RHI::Vertex unpacked = RHI::UnpackVertex(RHI::PackVertex(v));
+		CHECK(unpacked.pos == v.pos);
+		CHECK(glm::length(unpacked.color - v.color) < 0.01F);
+		CHECK(glm::dot(unpacked.normals, v.normals) > 0.9999F);
+		CHECK(glm::dot(vec3(unpacked.tangent), vec3(v.tangent)) > 0.9999F);
+		CHECK(unpacked.tangent.w == -1.F);
+		CHECK(glm::length(unpacked.texcoord - v.texcoord) < 0.002F);
+	}
+
+	TEST_CASE("Missing normals and tangents pack as valid unit vectors") {
+		const RHI::Vertex unpacked = RHI::UnpackVertex(RHI::PackVertex(RHI::Vertex{}));
+		CHECK(glm::length(unpacked.normals) == doctest::Approx(1.F));
+		CHECK(glm::length(vec3(unpacked.tangent)) == doctest::Approx(1.F));
+	}
+}
+
+// [Mesh]
+
+namespace {
+
+struct TestMesh {
+	std::vector<RHI::Vertex> vertices;
+	std::vector<uint32> indices;
+};
+
+// A unit UV sphere with its texture seam along one meridian and a vertex per segment at each
+// pole, so positions are shared by vertices with different UVs the way imported meshes share
+// them.
+TestMesh MakeSphere(uint32 rings, uint32 segments) {
+	TestMesh mesh;
+	for (uint32 ring = 0; ring <= rings; ++ring) {
+		const f32 v = static_cast<f32>(ring) / static_cast<f32>(rings);
+		const f32 theta = Math::PI * v;
+		for (uint32 segment = 0; segment <= segments; ++segment) {
+			// The seam column repeats the first one's positions bit for bit, as do the poles.
+			const f32 phi = 2.F * Math::PI * static_cast<f32>(segment % segments) / static_cast<f32>(segments);
+			RHI::Vertex vertex;
+			vertex.pos = vec3(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+			if (ring == 0 || ring == rings) {
+				vertex.pos = vec3(0.F, ring == 0 ? 1.F : -1.F, 0.F);
+			}
+			vertex.normals = vertex.pos;
+			vertex.texcoord = vec2(static_cast<f32>(segment) / static_cast<f32>(segments), v);
+			mesh.vertices.push_back(vertex);
+		}
+	}
+	for (uint32 ring = 0; ring < rings; ++ring) {
+		for (uint32 segment = 0; segment < segments; ++segment) {
+			const uint32 a = ring * (segments + 1) + segment;
+			const uint32 b = a + segments + 1;
+			if (ring != rings - 1) {
+				mesh.indices.insert(mesh.indices.end(), { a, b, b + 1 });
+			}
+			if (ring != 0) {
+				mesh.indices.insert(mesh.indices.end(), { a, b + 1, a + 1 });
+			}
+		}
+	}
+	return mesh;
+}
+
+// Edges only one triangle uses, with vertices matched by position so seams count as closed.
+usize CountOpenEdges(std::span<const RHI::Vertex> vertices, std::span<const uint32> indices) {
+	std::map<std::array<f32, 3>, uint32> positions;
+	std::vector<uint32> ids(vertices.size());
+	for (usize v = 0; v < vertices.size(); ++v) {
+		const vec3 &p = vertices[v].pos;
+		const auto next = static_cast<uint32>(positions.size());
+		ids[v] = positions.try_emplace({ p.x, p.y, p.z }, next).first->second;
+	}
+	std::map<std::pair<uint32, uint32>, uint32> edgeUse;
+	for (usize i = 0; i + 2 < indices.size(); i += 3) {
+		for (uint32 k = 0; k < 3; ++k) {
+			const uint32 a = ids[indices[i + k]];
+			const uint32 b = ids[indices[i + (k + 1) % 3]];
+			++edgeUse[{ std::min(a, b), std::max(a, b) }];
+		}
+	}
+	return static_cast<usize>(std::ranges::count(edgeUse | std::views::values, 1u));
+}
+
+usize CountReferenced(std::span<const uint32> indices) {
+	std::vector<uint32> unique(indices.begin(), indices.end());
+	std::ranges::sort(unique);
+	return static_cast<usize>(std::ranges::unique(unique).begin() - unique.begin());
+}
+
+// Each triangle rotated to start at its smallest index (keeping the winding), then sorted: two
+// orderings of the same triangles compare equal.
+std::vector<std::array<uint32, 3>> TriangleSet(std::span<const uint32> indices) {
+	std::vector<std::array<uint32, 3>> triangles;
+	for (usize i = 0; i + 2 < indices.size(); i += 3) {
+		std::array<uint32, 3> t = { indices[i], indices[i + 1], indices[i + 2] };
+		std::ranges::rotate(t, std::ranges::min_element(t));
+		triangles.push_back(t);
+	}
+	std::ranges::sort(triangles);
+	return triangles;
+}
+
+// The same by corner position, rotated to start at the smallest one, for comparing across a vertex renumbering.
+std::vector<std::array<std::array<f32, 3>, 3>> TrianglePositions(std::span<const RHI::Vertex> vertices,
+																 std::span<const uint32> indices) {
+	std::vector<std::array<std::array<f32, 3>, 3>> triangles;
+	for (usize i = 0; i + 2 < indices.size(); i += 3) {
+		std::array<std::array<f32, 3>, 3> corners{};
+		for (uint32 k = 0; k < 3; ++k) {
+			const vec3 &p = vertices[indices[i + k]].pos;
+			corners[k] = { p.x, p.y, p.z };
+		}
+		std::ranges::rotate(corners, std::ranges::min_element(corners));
+		triangles.push_back(corners);
+	}
+	std::ranges::sort(triangles);
+	return triangles;
+}
+
+void ShuffleTriangles(std::span<uint32> indices, uint32 seed) {
+	std::vector<std::array<uint32, 3>> triangles(indices.size() / 3);
+	memcpy(triangles.data(), indices.data(), triangles.size() * sizeof(triangles[0]));
+	std::ranges::shuffle(triangles, std::mt19937(seed));
+	memcpy(indices.data(), triangles.data(), triangles.size() * sizeof(triangles[0]));
+}
+
+RHI::GPUMeshPrimitive WholeMesh(const TestMesh &mesh) {
+	return { .indexCount = static_cast<uint32>(mesh.indices.size()),
+			 .vertexCount = static_cast<uint32>(mesh.vertices.size()) };
+}
+
+} // namespace
+
+TEST_SUITE("Mesh") {
+	TEST_CASE("Mesh cache counts a mesh's GPU bytes once it is uploaded") {
+		auto &cache = Graphics::Resources::MeshCache::Get();
+		auto mesh = cache.LoadFromData("Test_ResidentCube", Graphics::Resources::Mesh::GenerateCube(1.F));
+		REQUIRE(mesh != nullptr);
+		const uint64 gpuBefore = cache.GetStats().bytes.gpu;
+
+		auto gpu = Ctx().GetMeshRegistry().GetOrUpload(mesh);
+		REQUIRE(gpu != nullptr);
+		const uint64 expected = mesh->GetVertices().size() * sizeof(RHI::PackedVertex) +
+								mesh->GetIndices().size() * sizeof(uint32);
+		CHECK(gpu->GetGpuBytes() == expected);
+		CHECK(cache.GetStats().bytes.gpu == gpuBefore + expected);
+
+		cache.Remove("Test_ResidentCube");
+	}
+
+	TEST_CASE("Cooked meshes round-trip and damaged blobs fall back to a reimport") {
+		using namespace Platform::Filesystem;
+		using Graphics::Resources::Mesh;
+		using Graphics::Resources::MeshCooker;
+
+		const std::string octahedron = "v 1 0 0\nv -1 0 0\nv 0 1 0\nv 0 -1 0\nv 0 0 1\nv 0 0 -1\n"
+									   "f 1 3 5\nf 3 2 5\nf 2 4 5\nf 4 1 5\nf 3 1 6\nf 2 3 6\nf 4 2 6\nf 1 4 6\n";
+		const std::filesystem::path root = std::filesystem::temp_directory_path() / "AquilaMeshTests";
+		std::filesystem::create_directories(root / "a");
+		std::filesystem::create_directories(root / "b");
+		std::ofstream(root / "a" / "octahedron.obj") << octahedron;
+
+		VirtualFileSystem::Init();
+		VirtualFileSystem::Get()->Mount("/testdata", CreateRef<NativeFileSystem>((root / "a").string()));
+		const std::string source = "/testdata/octahedron.obj";
+		const std::string cookedPath = MeshCooker::GetCookedPath(source);
+		std::filesystem::remove(cookedPath);
+
+		Mesh imported("Test_Imported");
+		imported.Load(source); // no blob yet: imports and stores one
+		REQUIRE(imported.GetVertexCount() > 0);
+		REQUIRE(std::filesystem::exists(cookedPath));
+
+		Mesh cooked("Test_Cooked");
+		REQUIRE(MeshCooker::TryLoad(source, cooked));
+		CHECK(cooked.GetVertices() == imported.GetVertices());
+		CHECK(cooked.GetIndices() == imported.GetIndices());
+		CHECK(cooked.GetMaterialSlots() == imported.GetMaterialSlots());
+		CHECK(cooked.GetPrimitiveMaterialSlots() == imported.GetPrimitiveMaterialSlots());
+		CHECK(cooked.GetLods().size() == imported.GetLods().size());
+		CHECK(cooked.GetBoundsMin() == imported.GetBoundsMin());
+		CHECK(cooked.GetBoundsMax() == imported.GetBoundsMax());
+
+		std::vector<uint8> blob;
+		REQUIRE(FileReadAll(cookedPath, blob));
+		const auto rejected = [&](const std::vector<uint8> &damaged) {
+			REQUIRE(FileWriteAtomic(cookedPath, damaged.data(), damaged.size()));
+			Mesh mesh("Test_Damaged");
+			return !MeshCooker::TryLoad(source, mesh);
+		};
+		// Cut inside the header, and inside the payload.
+		CHECK(rejected({ blob.begin(), blob.begin() + 16 }));
+		CHECK(rejected({ blob.begin(), blob.end() - 4 }));
+		// A flipped magic byte, and an index count (header bytes 32-35) past the data.
+		std::vector<uint8> damaged = blob;
+		damaged[0] ^= 0xFF;
+		CHECK(rejected(damaged));
+		damaged = blob;
+		damaged[33] ^= 0x10;
+		CHECK(rejected(damaged));
+		// An index past the vertex array: the indices end where the material slot names begin.
+		usize slotBytes = 0;
+		for (const std::string &slot : imported.GetMaterialSlots()) {
+			slotBytes += sizeof(uint32) + slot.size();
+		}
+		damaged = blob;
+		std::fill_n(damaged.end() - static_cast<isize>(slotBytes + sizeof(uint32)), sizeof(uint32), uint8(0xFF));
+		CHECK(rejected(damaged));
+
+		// The next load imports again and replaces the damaged blob.
+		Mesh reloaded("Test_Reloaded");
+		reloaded.Load(source);
+		CHECK(reloaded.GetVertices() == imported.GetVertices());
+		CHECK(MeshCooker::TryLoad(source, cooked));
+
+		// Another project mounting its own tree at the same virtual path gets its own blob.
+		VirtualFileSystem::Get()->Unmount("/testdata");
+		VirtualFileSystem::Get()->Mount("/testdata", CreateRef<NativeFileSystem>((root / "b").string()));
+		CHECK(MeshCooker::GetCookedPath(source) != cookedPath);
+
+		VirtualFileSystem::Shutdown();
+		std::filesystem::remove(cookedPath);
+		std::filesystem::remove_all(root);
+	}
+
+	TEST_CASE("Cache and overdraw reordering keep the same triangles") {
+		using Graphics::Resources::MeshOptimizer;
+		TestMesh sphere = MakeSphere(32, 64);
+		ShuffleTriangles(sphere.indices, 7);
+		const std::vector<uint32> shuffled = sphere.indices;
+		const f32 acmrBefore = MeshOptimizer::AnalyzeVertexCache(sphere.indices, 16);
+
+		MeshOptimizer::OptimizeVertexCache(sphere.indices);
+		CHECK(TriangleSet(sphere.indices) == TriangleSet(shuffled));
+		CHECK(MeshOptimizer::AnalyzeVertexCache(sphere.indices, 16) < acmrBefore);
+
+		MeshOptimizer::OptimizeOverdraw(sphere.indices, sphere.vertices);
+		CHECK(TriangleSet(sphere.indices) == TriangleSet(shuffled));
+	}
+
+	TEST_CASE("Vertex fetch remapping renumbers vertices in first-use order") {
+		using Graphics::Resources::MeshOptimizer;
+		TestMesh sphere = MakeSphere(16, 32);
+		ShuffleTriangles(sphere.indices, 11);
+		// One more vertex nothing refers to (the poles' last copies are unreferenced already); the remap drops them.
+		sphere.vertices.push_back({ .pos = vec3(5.F) });
+		const TestMesh before = sphere;
+		std::vector<RHI::GPUMeshPrimitive> primitives = { WholeMesh(sphere) };
+
+		MeshOptimizer::OptimizeVertexFetch(sphere.vertices, sphere.indices, primitives);
+		REQUIRE(sphere.indices.size() == before.indices.size());
+		CHECK(sphere.vertices.size() == CountReferenced(before.indices));
+		CHECK(sphere.vertices.size() < before.vertices.size());
+
+		// Every old vertex used maps to exactly one new one and back, new ids appear in order,
+		// and each index still fetches the vertex it did before.
+		std::vector<uint32> oldToNew(before.vertices.size(), ~0u);
+		std::vector<uint32> newToOld(sphere.vertices.size(), ~0u);
+		uint32 nextFirstUse = 0;
+		bool consistent = true;
+		for (usize i = 0; i < sphere.indices.size(); ++i) {
+			const uint32 oldIndex = before.indices[i];
+			const uint32 newIndex = sphere.indices[i];
+			if (oldToNew[oldIndex] == ~0u && newToOld[newIndex] == ~0u) {
+				consistent &= newIndex == nextFirstUse++;
+				oldToNew[oldIndex] = newIndex;
+				newToOld[newIndex] = oldIndex;
+			}
+			consistent &= oldToNew[oldIndex] == newIndex && newToOld[newIndex] == oldIndex;
+			consistent &= sphere.vertices[newIndex] == before.vertices[oldIndex];
+		}
+		CHECK(consistent);
+		CHECK(nextFirstUse == sphere.vertices.size());
+		CHECK(primitives[0].firstVertex == 0);
+		CHECK(primitives[0].vertexCount == sphere.vertices.size());
+	}
+
+	TEST_CASE("Optimize keeps primitives on their own index ranges and remaps their vertices") {
+		using Graphics::Resources::MeshOptimizer;
+		// Two spheres, the second one's vertices stored first, so fetch order swaps them.
+		const TestMesh a = MakeSphere(12, 24);
+		TestMesh b = MakeSphere(8, 16);
+		for (RHI::Vertex &v : b.vertices) {
+			v.pos = v.pos * 0.5F + vec3(3.F, 0.F, 0.F);
+		}
+		std::vector<RHI::Vertex> vertices = b.vertices;
+		vertices.insert(vertices.end(), a.vertices.begin(), a.vertices.end());
+		std::vector<uint32> indices;
+		for (uint32 index : a.indices) {
+			indices.push_back(index + static_cast<uint32>(b.vertices.size()));
+		}
+		indices.insert(indices.end(), b.indices.begin(), b.indices.end());
+		std::vector<RHI::GPUMeshPrimitive> primitives = {
+			{ .firstIndex = 0,
+			  .firstVertex = static_cast<uint32>(b.vertices.size()),
+			  .indexCount = static_cast<uint32>(a.indices.size()),
+			  .vertexCount = static_cast<uint32>(a.vertices.size()) },
+			{ .firstIndex = static_cast<uint32>(a.indices.size()),
+			  .firstVertex = 0,
+			  .indexCount = static_cast<uint32>(b.indices.size()),
+			  .vertexCount = static_cast<uint32>(b.vertices.size()) },
+		};
+		const std::vector<RHI::Vertex> verticesBefore = vertices;
+		const std::vector<uint32> indicesBefore = indices;
+		const std::vector<RHI::GPUMeshPrimitive> primitivesBefore = primitives;
+
+		MeshOptimizer::Optimize(vertices, indices, primitives);
+		REQUIRE(primitives.size() == 2);
+		CHECK(primitives[0].firstVertex == 0);
+		CHECK(primitives[1].firstVertex == primitives[0].vertexCount);
+		for (usize p = 0; p < primitives.size(); ++p) {
+			const RHI::GPUMeshPrimitive &prim = primitives[p];
+			CHECK(prim.firstIndex == primitivesBefore[p].firstIndex);
+			CHECK(prim.indexCount == primitivesBefore[p].indexCount);
+			const std::span<const uint32> range(indices.data() + prim.firstIndex, prim.indexCount);
+			const std::span<const uint32> rangeBefore(indicesBefore.data() + prim.firstIndex, prim.indexCount);
+			CHECK(prim.vertexCount == CountReferenced(rangeBefore));
+			CHECK(std::ranges::all_of(range, [&](uint32 index) {
+				return index >= prim.firstVertex && index < prim.firstVertex + prim.vertexCount;
+			}));
+			CHECK(TrianglePositions(vertices, range) == TrianglePositions(verticesBefore, rangeBefore));
+		}
+	}
+
+	TEST_CASE("LOD chains stay inside the index buffer and halve with growing error") {
+		using Graphics::Resources::MeshLod;
+		TestMesh sphere = MakeSphere(64, 128);
+		const std::vector<uint32> original = sphere.indices;
+		const std::vector<RHI::GPUMeshPrimitive> primitives = { WholeMesh(sphere) };
+
+		const std::vector<MeshLod> lods = Graphics::Resources::MeshSimplifier::GenerateLods(
+			sphere.vertices, sphere.indices, primitives, SharedConstants::MAX_MESH_LODS);
+		REQUIRE(lods.size() >= 3);
+		CHECK(lods[0].firstIndex == 0);
+		CHECK(lods[0].indexCount == original.size());
+		CHECK(std::equal(original.begin(), original.end(), sphere.indices.begin()));
+		CHECK(lods.back().firstIndex + lods.back().indexCount == sphere.indices.size());
+
+		for (usize i = 0; i < lods.size(); ++i) {
+			const MeshLod &lod = lods[i];
+			REQUIRE(static_cast<uint64>(lod.firstIndex) + lod.indexCount <= sphere.indices.size());
+			CHECK(lod.indexCount % 3 == 0);
+			const std::span<const uint32> range(sphere.indices.data() + lod.firstIndex, lod.indexCount);
+			CHECK(std::ranges::all_of(range, [&](uint32 index) { return index < sphere.vertices.size(); }));
+			if (i == 0) {
+				continue;
+			}
+			CHECK(lod.error >= lods[i - 1].error);
+			const f32 kept = static_cast<f32>(lod.indexCount) / static_cast<f32>(lods[i - 1].indexCount);
+			CHECK(kept == doctest::Approx(0.5F).epsilon(0.1F));
+		}
+		CHECK(lods[1].error > 0.F);
+		CHECK(lods.back().error < 0.05F); // unit sphere: a 32x coarser level within 5% of the radius
+	}
+
+	TEST_CASE("Simplified levels keep UV seams and poles closed") {
+		TestMesh sphere = MakeSphere(32, 64);
+		const std::vector<RHI::GPUMeshPrimitive> primitives = { WholeMesh(sphere) };
+		REQUIRE(CountOpenEdges(sphere.vertices, sphere.indices) == 0);
+
+		const auto lods = Graphics::Resources::MeshSimplifier::GenerateLods(sphere.vertices, sphere.indices,
+																			primitives, SharedConstants::MAX_MESH_LODS);
+		REQUIRE(lods.size() >= 2);
+		for (const Graphics::Resources::MeshLod &lod : lods) {
+			const std::span<const uint32> range(sphere.indices.data() + lod.firstIndex, lod.indexCount);
+			CHECK(CountOpenEdges(sphere.vertices, range) == 0);
+		}
+	}
+
+	TEST_CASE("LOD selection is stable when applied to its own result") {
+		// The depth prepass and the geometry pass both select from the stored LOD; they must agree.
+		const std::vector<Graphics::Resources::MeshLod> lods = {
+			{ .error = 0.F }, { .error = 0.01F }, { .error = 0.02F }, { .error = 0.04F }, { .error = 0.08F },
+		};
+		for (f32 pixelsPerUnit = 1.F; pixelsPerUnit < 400.F; pixelsPerUnit *= 1.1F) {
+			for (uint32 current = 0; current < lods.size(); ++current) {
+				const uint32 selected = Rendering::MeshLodSelector::Select(lods, current, pixelsPerUnit);
+				CHECK(Rendering::MeshLodSelector::Select(lods, selected, pixelsPerUnit) == selected);
+			}
+		}
+	}
+
+	TEST_CASE("LOD selection holds inside the hysteresis band") {
+		using Rendering::MeshLodSelector;
+		const std::vector<Graphics::Resources::MeshLod> lods = {
+			{ .error = 0.F }, { .error = 1.F }, { .error = 2.F }, { .error = 4.F },
+		};
+		constexpr f32 kThreshold = 1.F;
+		constexpr f32 kHysteresis = 0.75F;
+
+		// LOD 1 projects to 0.9 px: fine enough to keep, not far enough under to switch to.
+		CHECK(MeshLodSelector::Select(lods, 0, 0.9F, kThreshold, kHysteresis) == 0);
+		CHECK(MeshLodSelector::Select(lods, 1, 0.9F, kThreshold, kHysteresis) == 1);
+		// Under the band it coarsens, and over the threshold it refines right away.
+		CHECK(MeshLodSelector::Select(lods, 0, 0.7F, kThreshold, kHysteresis) == 1);
+		CHECK(MeshLodSelector::Select(lods, 1, 1.1F, kThreshold, kHysteresis) == 0);
+		// Both ways across several levels: LOD 2 projects to 0.6 px, LOD 3 to 1.2 px.
+		CHECK(MeshLodSelector::Select(lods, 0, 0.3F, kThreshold, kHysteresis) == 2);
+		CHECK(MeshLodSelector::Select(lods, 3, 0.3F, kThreshold, kHysteresis) == 2);
+	}
+}
+
+// [TextureCooking]
+
+namespace {
+
+// Reference BCn decoders written from the format specification, independent of the encoders
+// under test. Each fills a 4x4 RGBA8 block, BC6H a 4x4 RGB float block.
+
+uint16 ReadU16(const uint8 *bytes) {
+	return static_cast<uint16>(bytes[0] | bytes[1] << 8);
+}
+
+// BC2/BC3 color blocks ignore the endpoint order and always interpolate four colors.
+void DecodeBC1(const uint8 *block, uint8 out[64], bool fourColorOnly = false) {
+	const uint16 c0 = ReadU16(block);
+	const uint16 c1 = ReadU16(block + 2);
+	auto expand = [](uint16 c, uint8 rgb[3]) {
+		const uint32 r = c >> 11;
+		const uint32 g = (c >> 5) & 63u;
+		const uint32 b = c & 31u;
+		rgb[0] = static_cast<uint8>(r << 3 | r >> 2);
+		rgb[1] = static_cast<uint8>(g << 2 | g >> 4);
+		rgb[2] = static_cast<uint8>(b << 3 | b >> 2);
+	};
+	const bool fourColor = fourColorOnly || c0 > c1;
+	uint8 palette[4][4] = {};
+	expand(c0, palette[0]);
+	expand(c1, palette[1]);
+	for (uint32 c = 0; c < 3; ++c) {
+		if (fourColor) {
+			palette[2][c] = static_cast<uint8>((2 * palette[0][c] + palette[1][c]) / 3);
+			palette[3][c] = static_cast<uint8>((palette[0][c] + 2 * palette[1][c]) / 3);
+		} else {
+			palette[2][c] = static_cast<uint8>((palette[0][c] + palette[1][c]) / 2);
+		}
+	}
+	palette[0][3] = palette[1][3] = palette[2][3] = 255;
+	palette[3][3] = fourColor ? 255 : 0;
+
+	const uint32 indices = block[4] | block[5] << 8 | block[6] << 16 | static_cast<uint32>(block[7]) << 24;
+	for (uint32 i = 0; i < 16; ++i) {
+		memcpy(out + i * 4, palette[(indices >> (2 * i)) & 3u], 4);
+	}
+}
+
+// One BC4 channel into `out` at the given component.
+void DecodeBC4(const uint8 *block, uint8 out[64], uint32 component) {
+	const uint32 r0 = block[0];
+	const uint32 r1 = block[1];
+	uint8 palette[8] = { static_cast<uint8>(r0), static_cast<uint8>(r1) };
+	for (uint32 i = 2; i < 8; ++i) {
+		if (r0 > r1) {
+			palette[i] = static_cast<uint8>(((8 - i) * r0 + (i - 1) * r1) / 7);
+		} else if (i < 6) {
+			palette[i] = static_cast<uint8>(((6 - i) * r0 + (i - 1) * r1) / 5);
+		} else {
+			palette[i] = i == 6 ? 0 : 255;
+		}
+	}
+	uint64 indices = 0;
+	for (uint32 i = 0; i < 6; ++i) {
+		indices |= static_cast<uint64>(block[2 + i]) << (8 * i);
+	}
+	for (uint32 i = 0; i < 16; ++i) {
+		out[i * 4 + component] = palette[(indices >> (3 * i)) & 7u];
+	}
+}
+
+void DecodeBC3(const uint8 *block, uint8 out[64]) {
+	DecodeBC1(block + 8, out, true);
+	DecodeBC4(block, out, 3);
+}
+
+void DecodeBC5(const uint8 *block, uint8 out[64]) {
+	for (uint32 i = 0; i < 16; ++i) {
+		out[i * 4 + 2] = 0;
+		out[i * 4 + 3] = 255;
+	}
+	DecodeBC4(block, out, 0);
+	DecodeBC4(block + 8, out, 1);
+}
+
+// Mode 6 only, the one mode the encoder emits. Returns false for any other mode.
+bool DecodeBC7(const uint8 *block, uint8 out[64]) {
+	uint32 bit = 0;
+	auto take = [&](uint32 count) {
+		uint32 value = 0;
+		for (uint32 i = 0; i < count; ++i, ++bit) {
+			value |= ((block[bit >> 3] >> (bit & 7)) & 1u) << i;
+		}
+		return value;
+	};
+	if (take(7) != 1u << 6) {
+		return false;
+	}
+	uint32 endpoints[2][4] = {};
+	for (uint32 c = 0; c < 4; ++c) {
+		endpoints[0][c] = take(7);
+		endpoints[1][c] = take(7);
+	}
+	const uint32 p0 = take(1);
+	const uint32 p1 = take(1);
+	for (uint32 c = 0; c < 4; ++c) {
+		endpoints[0][c] = endpoints[0][c] << 1 | p0;
+		endpoints[1][c] = endpoints[1][c] << 1 | p1;
+	}
+	constexpr uint32 kWeights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+	for (uint32 i = 0; i < 16; ++i) {
+		const uint32 weight = kWeights[take(i == 0 ? 3 : 4)];
+		for (uint32 c = 0; c < 4; ++c) {
+			out[i * 4 + c] = static_cast<uint8>(((64 - weight) * endpoints[0][c] + weight * endpoints[1][c] + 32) >> 6);
+		}
+	}
+	return true;
+}
+
+f32 HalfToFloat(uint32 half) {
+	const uint32 exponent = (half >> 10) & 31u;
+	const auto mantissa = static_cast<f32>(half & 1023u);
+	if (exponent == 0) {
+		return std::ldexp(mantissa, -24);
+	}
+	return std::ldexp(1024.F + mantissa, static_cast<int32>(exponent) - 25);
+}
+
+// Unsigned mode 11 only, the one mode the encoder emits. Returns false for any other mode.
+bool DecodeBC6H(const uint8 *block, f32 out[48]) {
+	uint32 bit = 0;
+	auto take = [&](uint32 count) {
+		uint32 value = 0;
+		for (uint32 i = 0; i < count; ++i, ++bit) {
+			value |= ((block[bit >> 3] >> (bit & 7)) & 1u) << i;
+		}
+		return value;
+	};
+	if (take(5) != 0x03) {
+		return false;
+	}
+	auto unquantize = [](uint32 q) -> uint32 {
+		if (q == 0) {
+			return 0;
+		}
+		return q == 1023 ? 0xFFFF : ((q << 16) + 0x8000) >> 10;
+	};
+	uint32 endpoints[2][3] = {};
+	for (uint32 e = 0; e < 2; ++e) {
+		for (uint32 c = 0; c < 3; ++c) {
+			endpoints[e][c] = unquantize(take(10));
+		}
+	}
+	constexpr uint32 kWeights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+	for (uint32 i = 0; i < 16; ++i) {
+		const uint32 weight = kWeights[take(i == 0 ? 3 : 4)];
+		for (uint32 c = 0; c < 3; ++c) {
+			const uint32 value = ((64 - weight) * endpoints[0][c] + weight * endpoints[1][c] + 32) >> 6;
+			out[i * 3 + c] = HalfToFloat((value * 31) >> 6);
+		}
+	}
+	return true;
+}
+
+// A smooth gradient with some texel noise, the kind of content BCn is tuned for.
+std::vector<uint8> MakeTestImage(uint32 width, uint32 height) {
+	std::vector<uint8> rgba(static_cast<usize>(width) * height * 4);
+	for (uint32 y = 0; y < height; ++y) {
+		for (uint32 x = 0; x < width; ++x) {
+			const uint32 noise = (x * 73856093u ^ y * 19349663u) % 9u;
+			uint8 *texel = rgba.data() + (static_cast<usize>(y) * width + x) * 4;
+			texel[0] = static_cast<uint8>(128.F + 100.F * std::sin(static_cast<f32>(x) * 0.2F) + noise);
+			texel[1] = static_cast<uint8>(y * 255 / (height - 1));
+			texel[2] = static_cast<uint8>((x + y) * 255 / (width + height - 2));
+			texel[3] = static_cast<uint8>(255 - x * 2 - noise);
+		}
+	}
+	return rgba;
+}
+
+// Compresses `rgba`, decodes it block by block and returns the PSNR over `channels`.
+template <typename Decode>
+f64 CompressionPsnr(const std::vector<uint8> &rgba, uint32 width, uint32 height, RHI::TextureFormat format,
+					uint32 channels, Decode decode) {
+	const std::vector<uint8> blocks = Graphics::Texture::BlockCompressor::Compress(rgba.data(), width, height, format);
+	const uint32 blockBytes = RHI::GetFormatBytesPerBlock(format);
+	REQUIRE(blocks.size() == RHI::GetTextureLevelSize(format, width, height));
+
+	f64 squaredError = 0.0;
+	uint8 decoded[64];
+	for (uint32 by = 0; by < height / 4; ++by) {
+		for (uint32 bx = 0; bx < width / 4; ++bx) {
+			REQUIRE(decode(blocks.data() + (static_cast<usize>(by) * (width / 4) + bx) * blockBytes, decoded));
+			for (uint32 i = 0; i < 16; ++i) {
+				const uint8 *source = rgba.data() + ((static_cast<usize>(by) * 4 + i / 4) * width + bx * 4 + i % 4) * 4;
+				for (uint32 c = 0; c < channels; ++c) {
+					const f64 diff = static_cast<f64>(decoded[i * 4 + c]) - source[c];
+					squaredError += diff * diff;
+				}
+			}
+		}
+	}
+	const f64 mse = squaredError / (static_cast<f64>(width) * height * channels);
+	return mse == 0.0 ? 99.0 : 10.0 * std::log10(255.0 * 255.0 / mse);
+}
+
+// An HDR gradient spanning about 0.01 to 60 across x, with a tint that varies along y.
+std::vector<f32> MakeHdrTestImage(uint32 width, uint32 height) {
+	std::vector<f32> rgba(static_cast<usize>(width) * height * 4);
+	for (uint32 y = 0; y < height; ++y) {
+		for (uint32 x = 0; x < width; ++x) {
+			const f32 luminance = std::exp2(static_cast<f32>(x) / static_cast<f32>(width - 1) * 12.5F - 6.6F);
+			const f32 tint = static_cast<f32>(y) / static_cast<f32>(height - 1);
+			f32 *texel = rgba.data() + (static_cast<usize>(y) * width + x) * 4;
+			texel[0] = luminance;
+			texel[1] = luminance * (0.4F + 0.6F * tint);
+			texel[2] = luminance * (1.F - 0.7F * tint);
+			texel[3] = 1.F;
+		}
+	}
+	return rgba;
+}
+
+// BC6H counterpart of CompressionPsnr: PSNR of log2 values (one stop = 1), against the
+// image's range of stops, so dark and bright texels weigh the same.
+f64 Bc6hCompressionPsnr(const std::vector<f32> &rgba, uint32 width, uint32 height) {
+	const std::vector<uint8> blocks = Graphics::Texture::BlockCompressor::CompressBC6H(rgba.data(), width, height);
+	REQUIRE(blocks.size() == RHI::GetTextureLevelSize(RHI::TextureFormat::BC6H_RGB_UF16, width, height));
+
+	auto stops = [](f64 value) { return std::log2(std::max(value, 1e-4)); };
+	f64 lowest = DBL_MAX;
+	f64 highest = -DBL_MAX;
+	f64 squaredError = 0.0;
+	f32 decoded[48];
+	for (uint32 by = 0; by < height / 4; ++by) {
+		for (uint32 bx = 0; bx < width / 4; ++bx) {
+			REQUIRE(DecodeBC6H(blocks.data() + (static_cast<usize>(by) * (width / 4) + bx) * 16, decoded));
+			for (uint32 i = 0; i < 16; ++i) {
+				const f32 *source = rgba.data() + ((static_cast<usize>(by) * 4 + i / 4) * width + bx * 4 + i % 4) * 4;
+				for (uint32 c = 0; c < 3; ++c) {
+					const f64 expected = stops(source[c]);
+					const f64 diff = stops(decoded[i * 3 + c]) - expected;
+					squaredError += diff * diff;
+					lowest = std::min(lowest, expected);
+					highest = std::max(highest, expected);
+				}
+			}
+		}
+	}
+	const f64 mse = squaredError / (static_cast<f64>(width) * height * 3);
+	return mse == 0.0 ? 99.0 : 10.0 * std::log10((highest - lowest) * (highest - lowest) / mse);
+}
+
+} // namespace
+
+TEST_SUITE("Texture cooking") {
+	TEST_CASE("Mip chains halve each level down to 1x1") {
+		constexpr uint32 kWidth = 13;
+		constexpr uint32 kHeight = 6;
+		const std::vector<uint8> rgba(kWidth * kHeight * 4, 200);
+		const auto levels = Graphics::Texture::MipGenerator::Generate(rgba.data(), kWidth, kHeight,
+																	  Graphics::Texture::MipFilter::Linear);
+		REQUIRE(levels.size() == RHI::GetFullMipCount(kWidth, kHeight));
+		for (uint32 level = 0; level < levels.size(); ++level) {
+			CHECK(levels[level].size() == RHI::GetTextureLevelSize(RHI::TextureFormat::RGBA8, kWidth, kHeight, level));
+			CHECK(std::ranges::all_of(levels[level], [](uint8 value) { return value == 200; }));
+		}
+
+		// Block-compressed levels round up to whole 4x4 blocks.
+		CHECK(RHI::GetTextureLevelSize(RHI::TextureFormat::BC1_RGBA, kWidth, kHeight, 0) == 4 * 2 * 8);
+		CHECK(RHI::GetTextureLevelSize(RHI::TextureFormat::BC7_RGBA, kWidth, kHeight, 1) == 2 * 1 * 16);
+		CHECK(RHI::GetTextureLevelSize(RHI::TextureFormat::BC5_RG, kWidth, kHeight, 3) == 16);
+	}
+
+	TEST_CASE("KTX2 files round-trip every level and key") {
+		Graphics::Texture::Ktx2Texture texture;
+		texture.format = RHI::TextureFormat::BC7_RGBA;
+		texture.width = 16;
+		texture.height = 8;
+		texture.levelCount = RHI::GetFullMipCount(texture.width, texture.height);
+		for (uint32 level = 0; level < texture.levelCount; ++level) {
+			const uint64 size = RHI::GetTextureLevelSize(texture.format, texture.width, texture.height, level);
+			for (uint64 i = 0; i < size; ++i) {
+				texture.data.push_back(static_cast<uint8>(level * 31 + i));
+			}
+		}
+		texture.keyValues.emplace_back("AquilaCook", std::vector<uint8>{ 1, 2, 3 });
+
+		const std::vector<uint8> file = Graphics::Texture::Ktx2::Write(texture);
+		Graphics::Texture::Ktx2Texture read;
+		REQUIRE(Graphics::Texture::Ktx2::Read(file, read));
+		CHECK(read.format == texture.format);
+		CHECK(read.width == texture.width);
+		CHECK(read.height == texture.height);
+		CHECK(read.levelCount == texture.levelCount);
+		CHECK(read.data == texture.data);
+		const std::vector<uint8> *value = read.FindValue("AquilaCook");
+		REQUIRE(value != nullptr);
+		CHECK(*value == std::vector<uint8>{ 1, 2, 3 });
+	}
+
+	TEST_CASE("KTX2 reader rejects truncated files and mismatched level indices") {
+		Graphics::Texture::Ktx2Texture texture;
+		texture.format = RHI::TextureFormat::RGBA8;
+		texture.width = 8;
+		texture.height = 8;
+		texture.levelCount = 2;
+		texture.data.resize(8 * 8 * 4 + 4 * 4 * 4, 0x55);
+		const std::vector<uint8> file = Graphics::Texture::Ktx2::Write(texture);
+		Graphics::Texture::Ktx2Texture read;
+		REQUIRE(Graphics::Texture::Ktx2::Read(file, read));
+
+		// The header is 80 bytes, followed by one {byteOffset, byteLength, uncompressedByteLength}
+		// uint64 triple per level. Level 0 is stored last, so it ends the file.
+		constexpr usize kLevelIndex = 80;
+		auto patched = [&](usize offset, uint64 value) {
+			std::vector<uint8> copy = file;
+			memcpy(copy.data() + offset, &value, sizeof(value));
+			return copy;
+		};
+
+		const std::vector<uint8> truncated(file.begin(), file.end() - 1);
+		CHECK_FALSE(Graphics::Texture::Ktx2::Read(truncated, read));
+		CHECK_FALSE(Graphics::Texture::Ktx2::Read(std::span(file).first(40), read));
+		CHECK_FALSE(Graphics::Texture::Ktx2::Read(patched(kLevelIndex + 8, 8 * 8 * 4 - 4), read));
+		CHECK_FALSE(Graphics::Texture::Ktx2::Read(patched(kLevelIndex + 24 + 8, 8 * 8 * 4), read));
+		CHECK_FALSE(Graphics::Texture::Ktx2::Read(patched(kLevelIndex + 24, file.size()), read));
+		CHECK_FALSE(Graphics::Texture::Ktx2::Read(patched(kLevelIndex, UINT64_MAX - 8), read));
+	}
+
+	TEST_CASE("BC1, BC5 and BC7 blocks decode close to their source") {
+		// Bounds sit a few dB under what the encoders reach on this image (BC5 ~45, BC7 ~39,
+		// BC1 ~37 dB), so a regression in endpoint fitting or index selection trips them.
+		constexpr uint32 kSize = 64;
+		const std::vector<uint8> rgba = MakeTestImage(kSize, kSize);
+
+		CHECK(CompressionPsnr(rgba, kSize, kSize, RHI::TextureFormat::BC5_RG, 2, [](const uint8 *block, uint8 *out) {
+				  DecodeBC5(block, out);
+				  return true;
+			  }) > 42.0);
+		CHECK(CompressionPsnr(rgba, kSize, kSize, RHI::TextureFormat::BC7_RGBA, 4, DecodeBC7) > 36.0);
+
+		// BC1 is encoded as opaque, so the comparison leaves alpha out.
+		CHECK(CompressionPsnr(rgba, kSize, kSize, RHI::TextureFormat::BC1_RGBA, 3, [](const uint8 *block, uint8 *out) {
+				  DecodeBC1(block, out);
+				  return true;
+			  }) > 34.0);
+	}
+
+	TEST_CASE("BC3 and BC6H blocks decode close to their source") {
+		// As above, a few dB under what the encoders reach (BC3 ~38 dB with alpha, BC6H ~54 dB
+		// in stops over the image's range).
+		constexpr uint32 kSize = 64;
+
+		// The compact option's path for maps with alpha: BC4 alpha plus a four-color BC1 block.
+		const std::vector<uint8> rgba = MakeTestImage(kSize, kSize);
+		CHECK(CompressionPsnr(rgba, kSize, kSize, RHI::TextureFormat::BC3_RGBA, 4, [](const uint8 *block, uint8 *out) {
+				  DecodeBC3(block, out);
+				  return true;
+			  }) > 35.0);
+
+		CHECK(Bc6hCompressionPsnr(MakeHdrTestImage(kSize, kSize), kSize, kSize) > 50.0);
+	}
 }
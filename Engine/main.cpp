@@ -1,14 +1,313 @@
 #include "Aquila/Application/ApplicationNew.h"
+#include "Aquila/Foundation/Macros.h"
+#include "Aquila/Foundation/Profiler.h"
+#include "Aquila/Foundation/SharedConstants.h"
+#include "Aquila/Graphics/Material/MaterialFactory.h"
+#include "Aquila/Graphics/RenderGraph/RGCompiler.h"
+#include "Aquila/Graphics/Resources/Mesh.h"
+#include "Aquila/Graphics/Resources/MeshCooker.h"
+#include "Aquila/Platform/Filesystem/NativeFileSystem.h"
+#include "Aquila/Platform/Filesystem/VirtualFileSystem.h"
+#include "Aquila/Rendering/FrameScheduler.h"
+#include "Aquila/Scene/Components/CameraComponent.h"
+#include "Aquila/Scene/Components/LightComponent.h"
+#include "Aquila/Scene/Components/MaterialComponent.h"
+#include "Aquila/Scene/Components/MeshComponent.h"
+#include "Aquila/Scene/Components/TransformComponent.h"
+#include "Aquila/Scene/EntityManager.h"
 
 // Headless engine runner — starts with an empty scene, no editor UI.
 // For the full editor experience build and run AquilaEditor instead.
+//
+// `AquilaEngine --light-bench [count]` runs the light stress benchmark instead: count
+// (default 10000) point lights orbiting above a floor, every one of them moving every
+// frame. Frame times are logged after a warm-up and the runner exits.
+//
+// `AquilaEngine --draw-bench [count] [--serial]` runs the draw recording benchmark: count
+// (default 50000) static cubes, each its own draw. It logs the frame time and the CPU time
+// spent recording the render graph; --serial records every pass inline on the main thread
+// instead of in parallel secondaries, for comparison.
+//
+// `AquilaEngine --cook <mesh>...` cooks meshes ahead of time and exits without opening a
+// window. Paths are the /resources paths scenes refer to, since cooked blobs are keyed by
+// them. The exit code is non-zero if any mesh failed to import or write.
+
+namespace {
+
+using namespace Aquila;
+using namespace Aquila::SceneManagement::Components;
+
+// BenchApplication
+//
+// Shared frame of the benchmarks: a camera looking down the +Z grid, the lit Basic.slang
+// material, a frame requested every tick (the runner otherwise renders on demand) and the
+// timing, which skips kWarmupFrames and then measures kMeasuredFrames before closing.
+// A bench fills the scene in OnBuildScene and reports in OnMeasureEnd.
+class BenchApplication : public Application::Application {
+  public:
+	static constexpr uint32 kWarmupFrames = 120;
+	static constexpr uint32 kMeasuredFrames = 1000;
+
+	BenchApplication(const ApplicationSpec &spec, const vec3 &cameraPosition)
+		: Application(spec), m_CameraPosition(cameraPosition) {}
+
+  protected:
+	static constexpr f32 kGridExtent = 200.f;
+
+	virtual void OnBuildScene(const Ref<Graphics::Material> &litMaterial) = 0;
+	virtual void OnBenchFrame(f32 deltaTime) {}
+	virtual void OnMeasureBegin() {}
+	virtual void OnMeasureEnd(f64 avgMs, f64 minMs, f64 maxMs) = 0;
+
+	// Calls fn(index, centre, cellSize) for count cells of a square grid spanning
+	// kGridExtent across x and forward along z, centres at y = 0.
+	template <typename Fn> static void ForEachGridCell(uint32 count, Fn &&fn) {
+		const auto side = static_cast<uint32>(glm::ceil(glm::sqrt(static_cast<f32>(count))));
+		const f32 cell = kGridExtent / static_cast<f32>(side);
+		for (uint32 i = 0; i < count; ++i) {
+			const f32 x = (static_cast<f32>(i % side) + 0.5f) * cell - kGridExtent * 0.5f;
+			const f32 z = (static_cast<f32>(i / side) + 0.5f) * cell;
+			fn(i, vec3(x, 0.f, z), cell);
+		}
+	}
+
+	void OnInit() override {
+		auto *em = GetScene().GetEntityManager();
+
+		auto cam = em->CreateEntity("Camera");
+		auto &camComp = cam.AddComponent<CameraComponent>();
+		camComp.fov = 60.f;
+		camComp.nearPlane = 0.1f;
+		camComp.farPlane = 500.f;
+		camComp.aspectRatio = static_cast<f32>(GetWindow().GetWidth()) / static_cast<f32>(GetWindow().GetHeight());
+		camComp.primary = true;
+		cam.GetComponent<TransformComponent>().SetLocalPosition(m_CameraPosition);
+		GetScene().SetActiveCamera(cam);
+
+		const std::string shaderPath = SharedConstants::SHADERS_DIR + "Basic.slang";
+		auto litMat = Graphics::MaterialFactory::Get()->Create(GetContext(), shaderPath,
+															   {
+																   .type = Graphics::MaterialType::Lit,
+																   .colorFormats = { RHI::TextureFormat::RGBA16F },
+																   .depthTest = true,
+																   .depthWrite = false,
+															   });
+		OnBuildScene(litMat);
+	}
+
+	void OnPreRender(f32 deltaTime) override {
+		// The runner only renders on demand; the benchmark wants every frame.
+		Rendering::FrameScheduler::Get()->RequestFrame();
+
+		OnBenchFrame(deltaTime);
+
+		if (m_Frame++ < kWarmupFrames) {
+			if (m_Frame == kWarmupFrames) {
+				OnMeasureBegin();
+			}
+			return;
+		}
+		const f64 ms = static_cast<f64>(deltaTime) * 1000.0;
+		m_TotalMs += ms;
+		m_MinMs = std::min(m_MinMs, ms);
+		m_MaxMs = std::max(m_MaxMs, ms);
+
+		if (m_Frame == kWarmupFrames + kMeasuredFrames) {
+			OnMeasureEnd(m_TotalMs / kMeasuredFrames, m_MinMs, m_MaxMs);
+			Close();
+		}
+	}
+
+  private:
+	vec3 m_CameraPosition;
+	uint32 m_Frame = 0;
+	f64 m_TotalMs = 0.0;
+	f64 m_MinMs = DBL_MAX;
+	f64 m_MaxMs = 0.0;
+};
+
+class LightBenchApplication final : public BenchApplication {
+  public:
+	LightBenchApplication(const ApplicationSpec &spec, uint32 lightCount)
+		: BenchApplication(spec, { 0.f, 8.f, -20.f }), m_LightCount(lightCount) {}
+
+  protected:
+	void OnBuildScene(const Ref<Graphics::Material> &litMaterial) override {
+		{
+			auto floor = GetScene().GetEntityManager()->CreateEntity("Floor");
+			auto mesh = CreateRef<Graphics::Resources::Mesh>("Floor");
+			mesh->LoadFromData(Graphics::Resources::Mesh::GenerateCube(0.5f));
+			floor.AddComponent<MeshComponent>().SetMesh(mesh);
+			auto &transform = floor.GetComponent<TransformComponent>();
+			transform.SetLocalPosition({ 0.f, -0.5f, kGridExtent * 0.5f });
+			transform.SetLocalScale({ kGridExtent, 0.1f, kGridExtent });
+			auto &mat = floor.AddComponent<MaterialComponent>(litMaterial);
+			mat.surfaceProperties.albedo = vec4(0.7f, 0.7f, 0.7f, 1.f);
+			mat.surfaceProperties.roughness = 0.8f;
+		}
+
+		// One light per cell, each orbiting its cell centre.
+		// Created on the registry directly: EntityManager names are deduplicated in O(n).
+		auto &registry = GetScene().GetRegistry();
+		m_Lights.reserve(m_LightCount);
+		ForEachGridCell(m_LightCount, [&](uint32 i, const vec3 &centre, f32 cell) {
+			const vec3 hue = glm::abs(glm::fract(vec3(0.f, 0.33f, 0.67f) + static_cast<f32>(i) * 0.618f) * 2.f - 1.f);
+
+			const entt::entity e = registry.create();
+			registry.emplace<TransformComponent>(e);
+			auto &light = registry.emplace<LightComponent>(e, LightComponent::Type::Point, hue, 4.0f);
+			light.SetRange(cell * 1.5f);
+			m_Lights.push_back({ e, centre + vec3(0.f, 0.5f, 0.f), cell * 0.4f, static_cast<f32>(i) * 0.37f });
+		});
+
+		AQUILA_LOG_INFO("LightBench: {} moving point lights, {} warm-up + {} measured frames", m_LightCount,
+						kWarmupFrames, kMeasuredFrames);
+	}
+
+	void OnBenchFrame(f32 deltaTime) override {
+		m_Time += deltaTime;
+		auto &registry = GetScene().GetRegistry();
+		for (const BenchLight &bench : m_Lights) {
+			const f32 angle = m_Time * 1.5f + bench.phase;
+			const vec3 offset = vec3(glm::cos(angle), 0.f, glm::sin(angle)) * bench.radius;
+			registry.get<TransformComponent>(bench.entity).SetLocalPosition(bench.center + offset);
+		}
+	}
+
+	void OnMeasureEnd(f64 avgMs, f64 minMs, f64 maxMs) override {
+		AQUILA_LOG_INFO("LightBench: {} lights, avg {:.3f} ms, min {:.3f} ms, max {:.3f} ms over {} frames",
+						m_LightCount, avgMs, minMs, maxMs, kMeasuredFrames);
+	}
+
+  private:
+	struct BenchLight {
+		entt::entity entity;
+		vec3 center;
+		f32 radius;
+		f32 phase;
+	};
+
+	uint32 m_LightCount;
+	std::vector<BenchLight> m_Lights;
+	f32 m_Time = 0.f;
+};
+
+class DrawBenchApplication final : public BenchApplication {
+  public:
+	DrawBenchApplication(const ApplicationSpec &spec, uint32 drawCount, bool serial)
+		: BenchApplication(spec, { 0.f, 30.f, -20.f }), m_DrawCount(drawCount), m_Serial(serial) {}
+
+  protected:
+	void OnBuildScene(const Ref<Graphics::Material> &litMaterial) override {
+		Graphics::RG::RGCompiler::SetParallelRecording(!m_Serial);
+
+		auto cube = CreateRef<Graphics::Resources::Mesh>("BenchCube");
+		cube->LoadFromData(Graphics::Resources::Mesh::GenerateCube(0.5f));
+
+		// One shared mesh and shader, but every cube is its own draw with its own material
+		// slot. Created on the registry directly: EntityManager names are deduplicated in O(n).
+		auto &registry = GetScene().GetRegistry();
+		ForEachGridCell(m_DrawCount, [&](uint32 i, const vec3 &centre, f32 cell) {
+			const entt::entity e = registry.create();
+			auto &transform = registry.emplace<TransformComponent>(e);
+			transform.SetLocalPosition(centre + vec3(0.f, 0.5f, 0.f));
+			transform.SetLocalScale(vec3(cell * 0.6f));
+			registry.emplace<MeshComponent>(e).SetMesh(cube);
+			auto &mat = registry.emplace<MaterialComponent>(e, litMaterial);
+			const vec3 tint = glm::fract(vec3(0.f, 0.33f, 0.67f) + static_cast<f32>(i) * 0.618f);
+			mat.surfaceProperties.albedo = vec4(tint, 1.f);
+		});
+
+		AQUILA_LOG_INFO("DrawBench: {} draws, {} recording, {} warm-up + {} measured frames", m_DrawCount,
+						m_Serial ? "serial" : "parallel", kWarmupFrames, kMeasuredFrames);
+	}
+
+	void OnMeasureBegin() override { m_RecordingAtWarmup = GetRecordingStats(); }
+
+	void OnMeasureEnd(f64 avgMs, f64 minMs, f64 maxMs) override {
+		// The profiler's stats run from startup, so the warm-up share is subtracted.
+		const Foundation::ProfilerEntry recording = GetRecordingStats();
+		const f64 recordingMs = (recording.totalDuration - m_RecordingAtWarmup.totalDuration) /
+			std::max(recording.frameCount - m_RecordingAtWarmup.frameCount, 1u);
+		AQUILA_LOG_INFO("DrawBench: {} draws ({}), frame avg {:.3f} ms, min {:.3f} ms, max {:.3f} ms, "
+						"graph recording avg {:.3f} ms over {} frames",
+						m_DrawCount, m_Serial ? "serial" : "parallel", avgMs, minMs, maxMs, recordingMs,
+						kMeasuredFrames);
+	}
+
+  private:
+	// CPU time of RenderGraph::Execute, which is where the passes are recorded
+	static Foundation::ProfilerEntry GetRecordingStats() {
+		Foundation::ProfilerEntry entry;
+		Foundation::Profiler::Get()->GetSectionStats("RenderPipeline::GraphExecute", entry);
+		return entry;
+	}
+
+	uint32 m_DrawCount;
+	bool m_Serial;
+	Foundation::ProfilerEntry m_RecordingAtWarmup;
+};
+
+int CookMeshes(std::span<char *const> paths) {
+	if (paths.empty()) {
+		AQUILA_LOG_ERROR("Usage: AquilaEngine --cook <mesh>...");
+		return EXIT_FAILURE;
+	}
+
+	using namespace Platform::Filesystem;
+	VirtualFileSystem::Init();
+	VirtualFileSystem::Get()->Mount("/resources", CreateRef<NativeFileSystem>(SharedConstants::RESOURCES_DIR));
+
+	uint32 failed = 0;
+	for (const char *path : paths) {
+		if (Graphics::Resources::MeshCooker::Cook(path)) {
+			AQUILA_LOG_INFO("Cooked '{}' -> {}", path, Graphics::Resources::MeshCooker::GetCookedPath(path));
+		} else {
+			++failed;
+		}
+	}
+	return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+	if (argc > 1 && std::string_view(argv[1]) == "--cook") {
+		return CookMeshes({ argv + 2, static_cast<usize>(argc - 2) });
+	}
 
-int main() {
 	ApplicationSpec spec;
 	spec.Name = "Aquila Runtime";
 	spec.Width = 1920;
 	spec.Height = 1080;
 
+	if (argc > 1 && std::string_view(argv[1]) == "--light-bench") {
+		uint32 lightCount = 10000;
+		if (argc > 2) {
+			lightCount = std::max(static_cast<uint32>(std::strtoul(argv[2], nullptr, 10)), 1u);
+		}
+		spec.Name = "Aquila Light Bench";
+		LightBenchApplication bench{ spec, lightCount };
+		bench.Run();
+		return EXIT_SUCCESS;
+	}
+
+	if (argc > 1 && std::string_view(argv[1]) == "--draw-bench") {
+		uint32 drawCount = 50000;
+		bool serial = false;
+		for (int i = 2; i < argc; ++i) {
+			if (std::string_view(argv[i]) == "--serial") {
+				serial = true;
+			} else {
+				drawCount = std::max(static_cast<uint32>(std::strtoul(argv[i], nullptr, 10)), 1u);
+			}
+		}
+		spec.Name = "Aquila Draw Bench";
+		DrawBenchApplication bench{ spec, drawCount, serial };
+		bench.Run();
+		return EXIT_SUCCESS;
+	}
+
 	Aquila::Application::Application app{ spec };
 	app.Run();
 	return EXIT_SUCCESS;